@@ -0,0 +1,146 @@
+// BatchResolve.h – resolve every title-ID folder under a directory tree.
+// Directories are walked by a pool of threads, each working depth-first on its own deque and
+// stealing the oldest pending directory from another thread when it runs dry. Only pending
+// directory paths and one small batch of results per thread are held in memory, so trees with
+// millions of entries stream through in bounded space. Platform-independent (std::filesystem).
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace titledb {
+
+    // Paths on the command line and in output are UTF-8 on every platform.
+    inline std::filesystem::path Utf8Path(const std::string& s) { return std::filesystem::u8path(s); }
+    inline std::string PathToUtf8(const std::filesystem::path& p) { return p.u8string(); }
+
+    struct ResolveHit {
+        std::filesystem::path path;
+        uint64_t key = 0;
+        const char16_t* name = nullptr; // nullptr if the ID is not in the database
+        size_t nameLen = 0;
+    };
+
+    struct ResolveStats {
+        uint64_t directories = 0; // directories opened
+        uint64_t entries = 0;     // directory entries seen
+        uint64_t matches = 0;     // folders whose name is a title ID
+        uint64_t known = 0;       // ... and found in the database
+        uint64_t errors = 0;      // directories that could not be read
+    };
+
+    // Walk root with `threads` workers. For every folder whose name packs as a title ID, looks it up
+    // with find(uint64_t key, const char16_t** name, size_t* len) -> bool (called concurrently) and
+    // hands results to emit(const std::vector<ResolveHit>&) in batches; emit calls are serialized.
+    // Symlinks and junctions are not followed.
+    template <class Find, class Emit>
+    ResolveStats ResolveTree(const std::filesystem::path& root, unsigned threads, Find&& find, Emit&& emit) {
+        namespace fs = std::filesystem;
+        if (threads == 0) threads = 1;
+
+        struct Worker {
+            std::mutex m;
+            std::deque<fs::path> dirs;
+        };
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (unsigned i = 0; i < threads; ++i) workers.push_back(std::make_unique<Worker>());
+        std::atomic<uint64_t> pending{ 1 }; // queued or in-progress directories
+        workers[0]->dirs.push_back(root);
+
+        std::mutex emitMutex;
+        std::atomic<uint64_t> directories{ 0 }, entries{ 0 }, matches{ 0 }, known{ 0 }, errors{ 0 };
+        const size_t kBatch = 256;
+
+        auto run = [&](unsigned self) {
+            std::vector<ResolveHit> batch;
+            auto flush = [&] {
+                if (batch.empty()) return;
+                std::lock_guard<std::mutex> lk(emitMutex);
+                emit(batch);
+                batch.clear();
+            };
+            auto take = [&](fs::path& out) {
+                { // own work: newest first (depth-first, keeps the deque short)
+                    Worker& w = *workers[self];
+                    std::lock_guard<std::mutex> lk(w.m);
+                    if (!w.dirs.empty()) { out = std::move(w.dirs.back()); w.dirs.pop_back(); return true; }
+                }
+                for (unsigned k = 1; k < threads; ++k) { // steal: oldest first (biggest subtrees)
+                    Worker& v = *workers[(self + k) % threads];
+                    std::lock_guard<std::mutex> lk(v.m);
+                    if (!v.dirs.empty()) { out = std::move(v.dirs.front()); v.dirs.pop_front(); return true; }
+                }
+                return false;
+            };
+
+            fs::path dir;
+            while (pending.load() != 0) {
+                if (!take(dir)) {
+                    flush();
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    continue;
+                }
+                std::error_code ec;
+                fs::directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec), end;
+                if (ec) {
+                    errors.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    directories.fetch_add(1, std::memory_order_relaxed);
+                    uint64_t seen = 0;
+                    for (; it != end; it.increment(ec)) {
+                        if (ec) { errors.fetch_add(1, std::memory_order_relaxed); break; }
+                        ++seen;
+                        std::error_code sec;
+                        if (it->is_symlink(sec) || !it->is_directory(sec)) continue;
+                        const fs::path& child = it->path();
+                        const fs::path leafPath = child.filename();
+                        const auto& leaf = leafPath.native();
+                        uint64_t key;
+                        if (PackTitleId(leaf.data(), leaf.size(), &key)) {
+                            ResolveHit hit;
+                            hit.path = child;
+                            hit.key = key;
+                            if (find(key, &hit.name, &hit.nameLen)) known.fetch_add(1, std::memory_order_relaxed);
+                            else hit.name = nullptr;
+                            matches.fetch_add(1, std::memory_order_relaxed);
+                            batch.push_back(std::move(hit));
+                            if (batch.size() >= kBatch) flush();
+                        }
+                        pending.fetch_add(1);
+                        Worker& w = *workers[self];
+                        std::lock_guard<std::mutex> lk(w.m);
+                        w.dirs.push_back(child);
+                    }
+                    entries.fetch_add(seen, std::memory_order_relaxed);
+                }
+                pending.fetch_sub(1);
+            }
+            flush();
+        };
+
+        std::vector<std::thread> pool;
+        for (unsigned i = 1; i < threads; ++i) pool.emplace_back(run, i);
+        run(0);
+        for (auto& t : pool) t.join();
+
+        ResolveStats st;
+        st.directories = directories.load();
+        st.entries = entries.load();
+        st.matches = matches.load();
+        st.known = known.load();
+        st.errors = errors.load();
+        return st;
+    }
+
+} // namespace titledb
@@ -0,0 +1,35 @@
+// HandlerMetrics.h – the metrics layout of the handler: the names of its counters, gauges and
+// histograms as they appear in the stats files. Shared with the bench, which records into the same
+// layout to measure recording and snapshot cost. Platform-independent.
+
+#pragma once
+
+#include "Metrics.h"
+
+namespace titledb {
+
+    struct HandlerMetrics {
+        enum Counter {
+            InfoTipCalls, TitleTips, DefaultTips, NoTips, NotTitleNames,
+            LookupHits, LookupMisses, FreshnessChecks, LayerReloads, Parses, IncrementalReloads, IndexMaps,
+            TooltipCacheHits, TooltipCacheMisses, EmbeddedHits, EmbeddedMatches, PendingLookups, WarmupCancels,
+            NameScans, NameScanHits, SharedAttaches, SharedPublishes, SharedFallbacks,
+            kCounters
+        };
+        enum Gauge { Mappings, Shares, kGauges };
+        enum Histogram { InfoTip, Lookup, Freshness, Parse, DefaultTooltip, Warmup, kHistograms };
+
+        static constexpr const char* kCounterNames[] = {
+            "infotip_calls", "title_tips", "default_tips", "no_tips", "not_title_names",
+            "lookup_hits", "lookup_misses", "freshness_checks", "layer_reloads", "parses", "incremental_reloads", "index_maps",
+            "tooltip_cache_hits", "tooltip_cache_misses", "embedded_hits", "embedded_matches", "pending_lookups", "warmup_cancels",
+            "name_scans", "name_scan_hits", "shared_attaches", "shared_publishes", "shared_fallbacks"
+        };
+        static constexpr const char* kGaugeNames[] = { "mappings", "shares" };
+        static constexpr const char* kHistogramNames[] = { "infotip_ns", "lookup_ns", "freshness_ns", "parse_ns", "default_tooltip_ns", "warmup_ns" };
+    };
+    static_assert(sizeof(HandlerMetrics::kCounterNames) / sizeof(char*) == HandlerMetrics::kCounters, "one name per counter");
+    static_assert(sizeof(HandlerMetrics::kHistogramNames) / sizeof(char*) == HandlerMetrics::kHistograms, "one name per histogram");
+    static_assert(sizeof(HandlerMetrics::kGaugeNames) / sizeof(char*) == HandlerMetrics::kGauges, "one name per gauge");
+
+} // namespace titledb
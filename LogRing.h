@@ -0,0 +1,95 @@
+// LogRing.h – bounded lock-free queue of formatted log records.
+// Producers (any thread) claim a slot, format into it in place and publish it; a single
+// background consumer drains published records in order. When the ring is full a record is
+// dropped and counted rather than making the producer wait. Platform-independent.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace titledb {
+
+    enum class LogLevel : uint8_t { Debug = 0, Info = 1, Warn = 2, Error = 3 };
+
+    // Capacity must be a power of two. Each slot carries up to SlotChars characters of text.
+    template <class CharT, size_t SlotChars, size_t Capacity>
+    class LogRing {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        LogRing() {
+            for (size_t i = 0; i < Capacity; ++i) m_slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+        LogRing(const LogRing&) = delete;
+        LogRing& operator=(const LogRing&) = delete;
+
+        // Claim a slot and call fill(CharT* buf, size_t cap) -> size_t length to write the text.
+        // Returns false (and counts a drop) if the ring is full.
+        template <class Fill>
+        bool Push(LogLevel level, uint64_t time, Fill&& fill) {
+            size_t pos = m_head.load(std::memory_order_relaxed);
+            Slot* slot;
+            for (;;) {
+                slot = &m_slots[pos & (Capacity - 1)];
+                size_t seq = slot->seq.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+                if (diff == 0) {
+                    if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                } else if (diff < 0) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                } else {
+                    pos = m_head.load(std::memory_order_relaxed);
+                }
+            }
+            slot->level = level;
+            slot->time = time;
+            size_t len = fill(slot->text, SlotChars);
+            slot->length = static_cast<uint32_t>(len < SlotChars ? len : SlotChars);
+            slot->seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side: call sink(LogLevel, uint64_t time, const CharT* text, size_t len) for each
+        // published record, oldest first, up to max records. Returns the number consumed.
+        template <class Sink>
+        size_t Drain(Sink&& sink, size_t max = Capacity) {
+            size_t done = 0;
+            while (done < max) {
+                size_t pos = m_tail.load(std::memory_order_relaxed);
+                Slot* slot = &m_slots[pos & (Capacity - 1)];
+                size_t seq = slot->seq.load(std::memory_order_acquire);
+                if (seq != pos + 1) break; // not yet published
+                sink(slot->level, slot->time, slot->text, (size_t)slot->length);
+                m_tail.store(pos + 1, std::memory_order_relaxed);
+                slot->seq.store(pos + Capacity, std::memory_order_release);
+                ++done;
+            }
+            return done;
+        }
+
+        // Records claimed but not yet drained (approximate while producers run).
+        size_t Pending() const {
+            return m_head.load(std::memory_order_relaxed) - m_tail.load(std::memory_order_relaxed);
+        }
+        uint64_t Dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+        static constexpr size_t capacity() { return Capacity; }
+
+    private:
+        struct Slot {
+            std::atomic<size_t> seq;
+            LogLevel level;
+            uint32_t length;
+            uint64_t time;
+            CharT text[SlotChars];
+        };
+
+        Slot m_slots[Capacity];
+        alignas(64) std::atomic<size_t> m_head{ 0 };
+        alignas(64) std::atomic<size_t> m_tail{ 0 };
+        alignas(64) std::atomic<uint64_t> m_dropped{ 0 };
+    };
+
+} // namespace titledb
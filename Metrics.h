@@ -0,0 +1,231 @@
+// Metrics.h – low-overhead counters, gauges and latency histograms.
+// Recording goes to one of kShards cache-line-aligned shards picked once per thread, so threads
+// rarely touch the same lines and a sample is one or two uncontended relaxed atomic adds. Latency
+// histograms are log-bucketed: four buckets per power of two of nanoseconds, so any recorded value
+// is known to within 25% over the whole range from 1 ns to about 18 minutes. Reading sums the
+// shards into a MetricsSnapshot, which can be written out as JSON. Platform-independent.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace titledb {
+
+    inline uint64_t MetricsNowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Bucket geometry: values below 4 get a bucket each; above that, each power of two [2^e, 2^e+1)
+    // is split into four equal buckets. Values past the last bucket are counted in it.
+    struct LatencyBuckets {
+        static constexpr unsigned kSubBits = 2;
+        static constexpr unsigned kMaxExp = 39;
+        static constexpr size_t kCount = size_t(kMaxExp - kSubBits + 2) << kSubBits;
+
+        static size_t Index(uint64_t v) {
+            if (v < (1u << kSubBits)) return size_t(v);
+            unsigned e = HighestBit(v);
+            if (e > kMaxExp) return kCount - 1;
+            return (size_t(e - kSubBits + 1) << kSubBits) | size_t((v >> (e - kSubBits)) & ((1u << kSubBits) - 1));
+        }
+
+        // Smallest value that falls into bucket i.
+        static uint64_t Lower(size_t i) {
+            if (i < (1u << kSubBits)) return i;
+            unsigned e = unsigned(i >> kSubBits) + kSubBits - 1;
+            return (uint64_t(1) << e) | (uint64_t(i & ((1u << kSubBits) - 1)) << (e - kSubBits));
+        }
+
+        // Largest value that falls into bucket i.
+        static uint64_t Upper(size_t i) { return i + 1 < kCount ? Lower(i + 1) - 1 : UINT64_MAX; }
+
+    private:
+        static unsigned HighestBit(uint64_t v) {
+#if defined(_MSC_VER)
+            unsigned long i; _BitScanReverse64(&i, v); return static_cast<unsigned>(i);
+#else
+            return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#endif
+        }
+    };
+
+    struct HistogramSnapshot {
+        uint64_t count = 0;
+        uint64_t sum = 0; // ns
+        std::array<uint64_t, LatencyBuckets::kCount> buckets{};
+
+        // Value at quantile q (0..1): the middle of the bucket holding that rank.
+        uint64_t Percentile(double q) const {
+            if (count == 0) return 0;
+            uint64_t rank = static_cast<uint64_t>(q * double(count - 1)) + 1, seen = 0;
+            for (size_t i = 0; i < buckets.size(); ++i) {
+                seen += buckets[i];
+                if (seen >= rank) return Middle(i);
+            }
+            return Middle(buckets.size() - 1);
+        }
+
+        // Upper bound of the highest non-empty bucket.
+        uint64_t Max() const {
+            for (size_t i = buckets.size(); i-- > 0;) {
+                if (buckets[i]) return i + 1 < buckets.size() ? LatencyBuckets::Upper(i) : LatencyBuckets::Lower(i);
+            }
+            return 0;
+        }
+
+    private:
+        static uint64_t Middle(size_t i) {
+            uint64_t lo = LatencyBuckets::Lower(i);
+            return i + 1 < LatencyBuckets::kCount ? lo + (LatencyBuckets::Upper(i) - lo) / 2 : lo;
+        }
+    };
+
+    // Schema describes what is recorded:
+    //   enum Counter { ..., kCounters };     static const char* const kCounterNames[];
+    //   enum Gauge { ..., kGauges };         static const char* const kGaugeNames[];
+    //   enum Histogram { ..., kHistograms }; static const char* const kHistogramNames[];
+    // Counters are summed over all threads, gauges hold the last value set and histograms count
+    // latency samples in nanoseconds. Names are written as JSON keys as they are.
+    template <class Schema>
+    struct MetricsSnapshot {
+        std::array<uint64_t, Schema::kCounters> counters{};
+        std::array<uint64_t, Schema::kGauges> gauges{};
+        std::array<HistogramSnapshot, Schema::kHistograms> histograms{};
+
+        // Total samples and counts; unchanged between two snapshots means nothing was recorded.
+        uint64_t Events() const {
+            uint64_t n = 0;
+            for (uint64_t c : counters) n += c;
+            for (const HistogramSnapshot& h : histograms) n += h.count;
+            return n;
+        }
+
+        // Append "counters": {...}, "gauges": {...}, "histograms": {...} (members of an object the
+        // caller opens and closes). Each histogram reports count, mean, p50/p90/p99/p999 and max
+        // in ns, plus its non-empty buckets as [lowest ns, count] pairs.
+        void AppendJson(std::string& out) const {
+            char buf[160];
+            out += "\"counters\": {";
+            for (size_t i = 0; i < counters.size(); ++i) {
+                std::snprintf(buf, sizeof(buf), "%s\"%s\": %llu", i ? ", " : "", Schema::kCounterNames[i], (unsigned long long)counters[i]);
+                out += buf;
+            }
+            out += "},\n\"gauges\": {";
+            for (size_t i = 0; i < gauges.size(); ++i) {
+                std::snprintf(buf, sizeof(buf), "%s\"%s\": %llu", i ? ", " : "", Schema::kGaugeNames[i], (unsigned long long)gauges[i]);
+                out += buf;
+            }
+            out += "},\n\"histograms\": {";
+            for (size_t i = 0; i < histograms.size(); ++i) {
+                const HistogramSnapshot& h = histograms[i];
+                std::snprintf(buf, sizeof(buf), "%s\n  \"%s\": {\"count\": %llu, ", i ? "," : "", Schema::kHistogramNames[i], (unsigned long long)h.count);
+                out += buf;
+                std::snprintf(buf, sizeof(buf), "\"mean_ns\": %llu, \"p50_ns\": %llu, \"p90_ns\": %llu, ",
+                              (unsigned long long)(h.count ? h.sum / h.count : 0), (unsigned long long)h.Percentile(0.5),
+                              (unsigned long long)h.Percentile(0.9));
+                out += buf;
+                std::snprintf(buf, sizeof(buf), "\"p99_ns\": %llu, \"p999_ns\": %llu, \"max_ns\": %llu, \"buckets\": [",
+                              (unsigned long long)h.Percentile(0.99), (unsigned long long)h.Percentile(0.999), (unsigned long long)h.Max());
+                out += buf;
+                bool first = true;
+                for (size_t b = 0; b < h.buckets.size(); ++b) {
+                    if (!h.buckets[b]) continue;
+                    std::snprintf(buf, sizeof(buf), "%s[%llu, %llu]", first ? "" : ", ",
+                                  (unsigned long long)LatencyBuckets::Lower(b), (unsigned long long)h.buckets[b]);
+                    out += buf;
+                    first = false;
+                }
+                out += "]}";
+            }
+            out += "\n}";
+        }
+    };
+
+    template <class Schema>
+    class Metrics {
+    public:
+        static constexpr size_t kShards = 16;
+
+        using Counter = typename Schema::Counter;
+        using Gauge = typename Schema::Gauge;
+        using Histogram = typename Schema::Histogram;
+
+        Metrics() = default;
+        Metrics(const Metrics&) = delete;
+        Metrics& operator=(const Metrics&) = delete;
+
+        void Add(Counter c, uint64_t n = 1) {
+            Local().counters[c].fetch_add(n, std::memory_order_relaxed);
+        }
+
+        void Set(Gauge g, uint64_t v) { m_gauges[g].store(v, std::memory_order_relaxed); }
+
+        void Record(Histogram h, uint64_t ns) {
+            Shard& s = Local();
+            s.buckets[h][LatencyBuckets::Index(ns)].fetch_add(1, std::memory_order_relaxed);
+            s.sums[h].fetch_add(ns, std::memory_order_relaxed);
+        }
+
+        // Sum of every shard. Samples recorded while this runs may or may not be included.
+        MetricsSnapshot<Schema> Snapshot() const {
+            MetricsSnapshot<Schema> snap;
+            for (const Shard& s : m_shards) {
+                for (size_t c = 0; c < Schema::kCounters; ++c) snap.counters[c] += s.counters[c].load(std::memory_order_relaxed);
+                for (size_t h = 0; h < Schema::kHistograms; ++h) {
+                    HistogramSnapshot& out = snap.histograms[h];
+                    out.sum += s.sums[h].load(std::memory_order_relaxed);
+                    for (size_t b = 0; b < LatencyBuckets::kCount; ++b) {
+                        uint64_t n = s.buckets[h][b].load(std::memory_order_relaxed);
+                        out.buckets[b] += n;
+                        out.count += n;
+                    }
+                }
+            }
+            for (size_t g = 0; g < Schema::kGauges; ++g) snap.gauges[g] = m_gauges[g].load(std::memory_order_relaxed);
+            return snap;
+        }
+
+        // Times a scope into histogram h.
+        class Timer {
+        public:
+            Timer(Metrics& m, Histogram h) : m_metrics(m), m_histogram(h), m_start(MetricsNowNs()) {}
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+            ~Timer() { m_metrics.Record(m_histogram, MetricsNowNs() - m_start); }
+
+        private:
+            Metrics& m_metrics;
+            Histogram m_histogram;
+            uint64_t m_start;
+        };
+
+    private:
+        struct alignas(64) Shard {
+            std::atomic<uint64_t> counters[Schema::kCounters] = {};
+            std::atomic<uint64_t> sums[Schema::kHistograms] = {};
+            std::atomic<uint64_t> buckets[Schema::kHistograms][LatencyBuckets::kCount] = {};
+        };
+
+        // Threads are dealt shards round-robin in the order they first record.
+        Shard& Local() {
+            static std::atomic<size_t> next{ 0 };
+            thread_local size_t index = next.fetch_add(1, std::memory_order_relaxed) % kShards;
+            return m_shards[index];
+        }
+
+        Shard m_shards[kShards];
+        std::atomic<uint64_t> m_gauges[Schema::kGauges > 0 ? Schema::kGauges : 1] = {};
+    };
+
+} // namespace titledb
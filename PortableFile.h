@@ -0,0 +1,147 @@
+// PortableFile.h – minimal file helpers for the command-line tools (Windows and POSIX).
+// The shell extension itself uses Win32 directly; these exist so the tools build anywhere.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace titledb {
+
+    struct FileInfo {
+        uint64_t size = 0;
+        uint64_t writeTime = 0; // FILETIME ticks (100 ns since 1601-01-01 UTC) on every platform
+    };
+
+    inline bool StatPath(const std::string& path, FileInfo* info) {
+#ifdef _WIN32
+        WIN32_FILE_ATTRIBUTE_DATA fad;
+        if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &fad)) return false;
+        info->size = (uint64_t(fad.nFileSizeHigh) << 32) | fad.nFileSizeLow;
+        info->writeTime = (uint64_t(fad.ftLastWriteTime.dwHighDateTime) << 32) | fad.ftLastWriteTime.dwLowDateTime;
+#else
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0) return false;
+        info->size = uint64_t(st.st_size);
+        const uint64_t kUnixEpochTicks = 116444736000000000ULL;
+        info->writeTime = kUnixEpochTicks + uint64_t(st.st_mtim.tv_sec) * 10000000ULL + uint64_t(st.st_mtim.tv_nsec) / 100;
+#endif
+        return true;
+    }
+
+    inline bool ReadFileBytes(const std::string& path, std::string& out) {
+        FILE* f = std::fopen(path.c_str(), "rb");
+        if (!f) return false;
+        out.clear();
+        char buf[64 * 1024];
+        size_t got;
+        while ((got = std::fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, got);
+        bool ok = !std::ferror(f);
+        std::fclose(f);
+        return ok;
+    }
+
+    // Reads a file front to back in caller-sized pieces; usable as the `read` of
+    // TitleTable::LoadStream and ParseMappingStream.
+    class FileReader {
+    public:
+        explicit FileReader(const std::string& path) : m_file(std::fopen(path.c_str(), "rb")) {}
+        FileReader(const FileReader&) = delete;
+        FileReader& operator=(const FileReader&) = delete;
+        ~FileReader() { if (m_file) std::fclose(m_file); }
+
+        bool IsOpen() const { return m_file != nullptr; }
+        bool Rewind() { return std::fseek(m_file, 0, SEEK_SET) == 0; }
+
+        // Up to cap bytes into buf; *got is 0 at the end of the file. False on a read error.
+        bool operator()(char* buf, size_t cap, size_t* got) {
+            *got = std::fread(buf, 1, cap, m_file);
+            return !std::ferror(m_file);
+        }
+
+    private:
+        FILE* m_file;
+    };
+
+    // Read-only view of a whole file (empty files are not mapped).
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile() { Close(); }
+
+        bool Open(const std::string& path) {
+            Close();
+#ifdef _WIN32
+            HANDLE h = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                                   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (h == INVALID_HANDLE_VALUE) return false;
+            LARGE_INTEGER size{};
+            HANDLE mapping = nullptr;
+            if (GetFileSizeEx(h, &size) && size.QuadPart > 0) mapping = CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(h);
+            if (!mapping) return false;
+            m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping); // the view keeps the mapping
+            if (!m_data) return false;
+            m_size = size_t(size.QuadPart);
+#else
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0) return false;
+            struct stat st;
+            void* p = MAP_FAILED;
+            if (fstat(fd, &st) == 0 && st.st_size > 0) p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (p == MAP_FAILED) return false;
+            m_data = p;
+            m_size = size_t(st.st_size);
+#endif
+            return true;
+        }
+
+        void Close() {
+            if (!m_data) return;
+#ifdef _WIN32
+            UnmapViewOfFile(m_data);
+#else
+            munmap(m_data, m_size);
+#endif
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        const char* Data() const { return static_cast<const char*>(m_data); }
+        size_t Size() const { return m_size; }
+
+    private:
+        void* m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    inline bool WriteFileBytes(const std::string& path, const void* data, size_t n) {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) return false;
+        bool ok = std::fwrite(data, 1, n, f) == n;
+        ok = (std::fclose(f) == 0) && ok;
+        return ok;
+    }
+
+} // namespace titledb
@@ -0,0 +1,223 @@
+// TitleCompact.h – compact, read-only title storage partitioned by publisher.
+// A hex title ID is a 16-bit publisher code (first four digits) and a 16-bit title number. The
+// table keeps a small sorted directory of publishers, each owning a run of sorted 16-bit title
+// numbers, and front-codes the names in UTF-8: in ID order each name is stored as the number of
+// bytes it shares with the previous one plus the rest, restarting every kRestart entries. A
+// lookup is two binary searches, at most kRestart small copies to rebuild the name, and one
+// conversion to UTF-16 into the caller's buffer. IDs that are not hex (homebrew, test IDs) go
+// to a small sorted side list with full keys. The handler stores share lists this way with
+// CompactShares; they are read directly and never merged, so names need no stable address.
+// Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace titledb {
+
+    // The 32-bit value of a packed ID made of hex digits (upper case, as PackTitleId folds them).
+    inline bool HexTitleValue(uint64_t key, uint32_t* value) {
+        uint32_t v = 0;
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            unsigned c = unsigned(key >> shift) & 0xFF;
+            if (c >= '0' && c <= '9') v = (v << 4) | (c - '0');
+            else if (c >= 'A' && c <= 'F') v = (v << 4) | (c - 'A' + 10);
+            else return false;
+        }
+        *value = v;
+        return true;
+    }
+
+    inline uint64_t HexTitleKey(uint32_t value) {
+        uint64_t key = 0;
+        for (int shift = 28; shift >= 0; shift -= 4) key = (key << 8) | uint64_t("0123456789ABCDEF"[(value >> shift) & 0xF]);
+        return key;
+    }
+
+    class PublisherTable {
+    public:
+        static constexpr size_t kRestart = 8;
+
+        size_t Size() const { return m_numbers.size() + m_others.size(); }
+        size_t PublisherCount() const { return m_dir.empty() ? 0 : m_dir.size() - 1; }
+
+        // Replace the contents with every entry of `table` (anything with
+        // ForEach(fn(uint64_t key, const char16_t* name, size_t len))).
+        template <class Table>
+        void Build(const Table& table) {
+            struct Source { uint64_t order; uint64_t key; const char16_t* name; size_t len; };
+            std::vector<Source> hex, other;
+            table.ForEach([&](uint64_t key, const char16_t* name, size_t len) {
+                uint32_t v;
+                if (HexTitleValue(key, &v)) hex.push_back({ v, key, name, len });
+                else other.push_back({ key, key, name, len });
+            });
+            auto byOrder = [](const Source& a, const Source& b) { return a.order < b.order; };
+            std::sort(hex.begin(), hex.end(), byOrder);
+            std::sort(other.begin(), other.end(), byOrder);
+
+            *this = PublisherTable();
+            m_numbers.reserve(hex.size());
+            m_others.reserve(other.size());
+            for (const Source& s : hex) {
+                uint16_t publisher = uint16_t(s.order >> 16);
+                if (m_dir.empty() || m_dir.back().code != publisher) m_dir.push_back({ publisher, uint32_t(m_numbers.size()) });
+                m_numbers.push_back(uint16_t(s.order));
+            }
+            m_dir.push_back({ 0, uint32_t(m_numbers.size()) }); // sentinel: end of the last run
+            for (const Source& s : other) m_others.push_back(s.key);
+
+            // Names in entry order: hex entries, then the others.
+            std::string prev, utf8;
+            size_t i = 0;
+            for (const std::vector<Source>* list : { &hex, &other }) {
+                for (const Source& s : *list) {
+                    utf8.clear();
+                    AppendUtf8(s.name, s.len, utf8);
+                    size_t shared = 0;
+                    if (i++ % kRestart == 0) m_restarts.push_back(uint32_t(m_names.size()));
+                    else while (shared < prev.size() && shared < utf8.size() && prev[shared] == utf8[shared]) ++shared;
+                    PutVarint(shared);
+                    PutVarint(utf8.size() - shared);
+                    m_names.insert(m_names.end(), utf8.begin() + shared, utf8.end());
+                    prev.swap(utf8);
+                }
+            }
+            m_names.shrink_to_fit();
+        }
+
+        // Parse a mapping file (see ParseMapping) straight into compact form.
+        bool LoadUtf8(const char* data, size_t n) {
+            TitleTable table;
+            if (!table.LoadUtf8(data, n)) { *this = PublisherTable(); return false; }
+            Build(table);
+            return true;
+        }
+
+        bool Contains(uint64_t key) const { return Locate(key) != SIZE_MAX; }
+
+        // Name of key, written over `out` (whose capacity is reused across calls).
+        bool Find(uint64_t key, std::u16string& out) const {
+            size_t i = Locate(key);
+            if (i == SIZE_MAX) return false;
+            Utf8Name name;
+            const uint8_t* p = m_names.data() + m_restarts[i / kRestart];
+            for (size_t j = i - i % kRestart; j <= i; ++j) p = name.Next(p);
+            name.ToUtf16(out);
+            return true;
+        }
+
+        // Calls fn(uint64_t key, const char16_t* name, size_t len) for every entry, in ID order
+        // (hex IDs first). The name pointer is only valid during the call.
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            Utf8Name utf8;
+            std::u16string name;
+            const uint8_t* p = m_names.data();
+            for (size_t d = 0; d + 1 < m_dir.size(); ++d) {
+                for (uint32_t e = m_dir[d].first; e < m_dir[d + 1].first; ++e) {
+                    p = utf8.Next(p);
+                    utf8.ToUtf16(name);
+                    fn(HexTitleKey((uint32_t(m_dir[d].code) << 16) | m_numbers[e]), name.data(), name.size());
+                }
+            }
+            for (uint64_t key : m_others) {
+                p = utf8.Next(p);
+                utf8.ToUtf16(name);
+                fn(key, name.data(), name.size());
+            }
+        }
+
+        // Heap bytes owned by the table.
+        size_t MemoryBytes() const {
+            return m_dir.capacity() * sizeof(Publisher) + m_numbers.capacity() * sizeof(uint16_t) +
+                   m_others.capacity() * sizeof(uint64_t) + m_restarts.capacity() * sizeof(uint32_t) + m_names.capacity();
+        }
+
+    private:
+        struct Publisher {
+            uint16_t code;  // first four hex digits
+            uint32_t first; // index of its first title number in m_numbers
+        };
+
+        // Entry index of key (hex entries first, then m_others), or SIZE_MAX.
+        size_t Locate(uint64_t key) const {
+            uint32_t v;
+            if (!HexTitleValue(key, &v)) {
+                auto it = std::lower_bound(m_others.begin(), m_others.end(), key);
+                return it != m_others.end() && *it == key ? m_numbers.size() + size_t(it - m_others.begin()) : SIZE_MAX;
+            }
+            if (m_dir.size() < 2) return SIZE_MAX;
+            uint16_t code = uint16_t(v >> 16), number = uint16_t(v);
+            auto pub = std::lower_bound(m_dir.begin(), m_dir.end() - 1, code, [](const Publisher& p, uint16_t c) { return p.code < c; });
+            if (pub == m_dir.end() - 1 || pub->code != code) return SIZE_MAX;
+            const uint16_t* begin = m_numbers.data() + pub->first;
+            const uint16_t* end = m_numbers.data() + pub[1].first;
+            const uint16_t* it = std::lower_bound(begin, end, number);
+            return it != end && *it == number ? size_t(it - m_numbers.data()) : SIZE_MAX;
+        }
+
+        void PutVarint(size_t v) {
+            for (; v >= 0x80; v >>= 7) m_names.push_back(uint8_t(v | 0x80));
+            m_names.push_back(uint8_t(v));
+        }
+
+        static const uint8_t* GetVarint(const uint8_t* p, size_t* v) {
+            size_t r = 0;
+            for (int shift = 0;; shift += 7) {
+                uint8_t b = *p++;
+                r |= size_t(b & 0x7F) << shift;
+                if (!(b & 0x80)) break;
+            }
+            *v = r;
+            return p;
+        }
+
+        // The name being rebuilt from front-coded records, on the stack unless it is long.
+        class Utf8Name {
+        public:
+            Utf8Name() = default;
+            Utf8Name(const Utf8Name&) = delete;
+            Utf8Name& operator=(const Utf8Name&) = delete;
+
+            // Apply the record at p to the current name; returns the following record.
+            const uint8_t* Next(const uint8_t* p) {
+                size_t shared, bytes;
+                p = GetVarint(p, &shared);
+                p = GetVarint(p, &bytes);
+                if (shared + bytes > m_cap) {
+                    std::string grown(m_data, shared);
+                    grown.resize(2 * (shared + bytes));
+                    m_heap.swap(grown);
+                    m_data = &m_heap[0];
+                    m_cap = m_heap.size();
+                }
+                std::memcpy(m_data + shared, p, bytes);
+                m_len = shared + bytes;
+                return p + bytes;
+            }
+
+            void ToUtf16(std::u16string& out) const {
+                out.resize(m_len);
+                out.resize(ConvertUtf8(m_data, m_len, &out[0]));
+            }
+
+        private:
+            char m_stack[256];
+            std::string m_heap;
+            char* m_data = m_stack;
+            size_t m_cap = sizeof(m_stack), m_len = 0;
+        };
+
+        std::vector<Publisher> m_dir;    // sorted by code, plus an end sentinel
+        std::vector<uint16_t> m_numbers; // title numbers, sorted within each publisher's run
+        std::vector<uint64_t> m_others;  // non-hex IDs, sorted
+        std::vector<uint32_t> m_restarts; // offset in m_names of every kRestart-th entry
+        std::vector<uint8_t> m_names;    // front-coded names
+    };
+
+} // namespace titledb
@@ -0,0 +1,666 @@
+// TitleDb.h – platform-independent core of the Xbox title ID database.
+// Title ID packing, strict UTF-8 handling, the XboxTitleIDs.txt parser, the in-memory table
+// and snapshot publication for reloads.
+// Header-only so XboxTitleIdInfoTip.cpp stays a single translation unit; no Windows headers.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Byte scanning uses AVX2 when the compiler targets it (/arch:AVX2, -mavx2), otherwise SSE2 on
+// x86/x64, otherwise plain loops. Define TITLEDB_NO_SIMD to force the plain loops.
+#if !defined(TITLEDB_NO_SIMD) && defined(__AVX2__)
+#define TITLEDB_AVX2 1
+#include <immintrin.h>
+#elif !defined(TITLEDB_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TITLEDB_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace titledb {
+
+    // ---------------- Title IDs ----------------
+    // A title ID is exactly 8 ASCII letters/digits. Packed into a uint64_t (first character in
+    // the top byte, upper-cased) so that integer order matches string order.
+    template <class CharT>
+    bool PackTitleId(const CharT* s, size_t n, uint64_t* key) {
+        if (n != 8) return false;
+        uint64_t k = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            auto ch = static_cast<uint32_t>(s[i]);
+            if (ch >= 'a' && ch <= 'z') ch -= 'a' - 'A';
+            if (!((ch >= '0' && ch <= '9') || (ch >= 'A' && ch <= 'Z'))) return false;
+            k = (k << 8) | ch;
+        }
+        *key = k;
+        return true;
+    }
+
+    // PackTitleId for 8 bytes of UTF-8/ASCII, done as one 64-bit word: every byte is range-checked
+    // and case-folded at once (SWAR). Same result as PackTitleId(p, 8, key). Little-endian hosts.
+    inline bool PackTitleId8(const char* p, uint64_t* key) {
+        const uint64_t ones = 0x0101010101010101ULL, high = 0x8080808080808080ULL;
+        uint64_t v;
+        std::memcpy(&v, p, 8);
+        if (v & high) return false;
+        // High bit of each byte set iff lo <= byte <= hi (valid because every byte is < 0x80).
+        auto between = [&](uint64_t x, unsigned lo, unsigned hi) {
+            return (x + ones * (0x80 - lo)) & ~(x + ones * (0x7F - hi)) & high;
+        };
+        v -= between(v, 'a', 'z') >> 2; // 0x80 >> 2 == 'a' - 'A'
+        if ((between(v, '0', '9') | between(v, 'A', 'Z')) != high) return false;
+#if defined(_MSC_VER)
+        *key = _byteswap_uint64(v);
+#else
+        *key = __builtin_bswap64(v);
+#endif
+        return true;
+    }
+
+    // Last component of a path: everything after the final '\\' or '/'.
+    template <class CharT>
+    std::basic_string_view<CharT> LeafName(std::basic_string_view<CharT> path) {
+        const CharT separators[2] = { CharT('\\'), CharT('/') };
+        size_t pos = path.find_last_of(separators, path.npos, 2);
+        return pos == path.npos ? path : path.substr(pos + 1);
+    }
+
+    // Write the 8 characters of a packed key (no terminator).
+    template <class CharT>
+    void UnpackTitleId(uint64_t key, CharT* out) {
+        for (int i = 7; i >= 0; --i) { out[i] = static_cast<CharT>(key & 0xFF); key >>= 8; }
+    }
+
+    // ---------------- UTF-8 ----------------
+    // Decode one code point starting at s[i]. Rejects everything MultiByteToWideChar rejects
+    // with MB_ERR_INVALID_CHARS: truncated and overlong sequences, surrogates, > U+10FFFF.
+    inline bool DecodeUtf8(const unsigned char* s, size_t n, size_t& i, uint32_t& cp) {
+        unsigned char b0 = s[i];
+        if (b0 < 0x80) { cp = b0; ++i; return true; }
+        size_t len; unsigned char lo = 0x80, hi = 0xBF;
+        if (b0 >= 0xC2 && b0 <= 0xDF) { len = 2; cp = b0 & 0x1F; }
+        else if (b0 >= 0xE0 && b0 <= 0xEF) {
+            len = 3; cp = b0 & 0x0F;
+            if (b0 == 0xE0) lo = 0xA0;
+            else if (b0 == 0xED) hi = 0x9F;
+        } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+            len = 4; cp = b0 & 0x07;
+            if (b0 == 0xF0) lo = 0x90;
+            else if (b0 == 0xF4) hi = 0x8F;
+        } else return false;
+        if (n - i < len) return false;
+        for (size_t k = 1; k < len; ++k) {
+            unsigned char b = s[i + k];
+            if (k == 1 ? (b < lo || b > hi) : (b < 0x80 || b > 0xBF)) return false;
+            cp = (cp << 6) | (b & 0x3F);
+        }
+        i += len;
+        return true;
+    }
+
+    // ---------------- Byte scanning ----------------
+    // Bit i of the result is set iff p[i] is one of the needles (one or two bytes).
+#if defined(TITLEDB_AVX2)
+    constexpr size_t kScanBlock = 32;
+    inline uint32_t MatchMask(const char* p, char a, char b) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(a)), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(b)));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(m));
+    }
+    inline uint32_t HighBitMask(const char* p) {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))));
+    }
+#elif defined(TITLEDB_SSE2)
+    constexpr size_t kScanBlock = 16;
+    inline uint32_t MatchMask(const char* p, char a, char b) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(a)), _mm_cmpeq_epi8(v, _mm_set1_epi8(b)));
+        return static_cast<uint32_t>(_mm_movemask_epi8(m));
+    }
+    inline uint32_t HighBitMask(const char* p) {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))));
+    }
+#endif
+
+    inline unsigned LowestBit(uint32_t m) {
+#if defined(_MSC_VER)
+        unsigned long i; _BitScanForward(&i, m); return static_cast<unsigned>(i);
+#else
+        return static_cast<unsigned>(__builtin_ctz(m));
+#endif
+    }
+
+    // Index of the first byte in [i, n) equal to a or b, or n.
+    inline size_t FindEither(const char* p, size_t i, size_t n, char a, char b) {
+#if defined(TITLEDB_AVX2) || defined(TITLEDB_SSE2)
+        for (; i + kScanBlock <= n; i += kScanBlock) {
+            if (uint32_t m = MatchMask(p + i, a, b)) return i + LowestBit(m);
+        }
+#endif
+        while (i < n && p[i] != a && p[i] != b) ++i;
+        return i;
+    }
+
+    inline bool IsValidUtf8(const char* data, size_t n) {
+        auto s = reinterpret_cast<const unsigned char*>(data);
+        size_t i = 0; uint32_t cp;
+        while (i < n) {
+#if defined(TITLEDB_AVX2) || defined(TITLEDB_SSE2)
+            // Skip pure-ASCII blocks; decode from the first non-ASCII byte.
+            if (i + kScanBlock <= n) {
+                uint32_t m = HighBitMask(data + i);
+                if (!m) { i += kScanBlock; continue; }
+                i += LowestBit(m);
+            }
+#endif
+            if (s[i] < 0x80) { ++i; continue; }
+            if (!DecodeUtf8(s, n, i, cp)) return false;
+        }
+        return true;
+    }
+
+    // Convert a UTF-8 slice to UTF-16 into out, which must have room for n units (UTF-16 never
+    // needs more units than UTF-8 has bytes). Returns the number written, or SIZE_MAX if invalid.
+    inline size_t ConvertUtf8(const char* data, size_t n, char16_t* out) {
+        auto s = reinterpret_cast<const unsigned char*>(data);
+        size_t i = 0, o = 0; uint32_t cp;
+        while (i < n) {
+            if (s[i] < 0x80) { out[o++] = s[i++]; continue; }
+            if (!DecodeUtf8(s, n, i, cp)) return SIZE_MAX;
+            if (cp < 0x10000) {
+                out[o++] = static_cast<char16_t>(cp);
+            } else {
+                cp -= 0x10000;
+                out[o++] = static_cast<char16_t>(0xD800 + (cp >> 10));
+                out[o++] = static_cast<char16_t>(0xDC00 + (cp & 0x3FF));
+            }
+        }
+        return o;
+    }
+
+    // Append the UTF-8 form of a UTF-16 string. Unpaired surrogates become U+FFFD.
+    inline void AppendUtf8(const char16_t* s, size_t n, std::string& out) {
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t cp = s[i];
+            if (cp >= 0xD800 && cp <= 0xDBFF && i + 1 < n && s[i + 1] >= 0xDC00 && s[i + 1] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (s[++i] - 0xDC00);
+            } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+                cp = 0xFFFD;
+            }
+            if (cp < 0x80) {
+                out.push_back(char(cp));
+            } else if (cp < 0x800) {
+                out.push_back(char(0xC0 | (cp >> 6)));
+                out.push_back(char(0x80 | (cp & 0x3F)));
+            } else if (cp < 0x10000) {
+                out.push_back(char(0xE0 | (cp >> 12)));
+                out.push_back(char(0x80 | ((cp >> 6) & 0x3F)));
+                out.push_back(char(0x80 | (cp & 0x3F)));
+            } else {
+                out.push_back(char(0xF0 | (cp >> 18)));
+                out.push_back(char(0x80 | ((cp >> 12) & 0x3F)));
+                out.push_back(char(0x80 | ((cp >> 6) & 0x3F)));
+                out.push_back(char(0x80 | (cp & 0x3F)));
+            }
+        }
+    }
+
+    // 64-bit FNV-1a, used for file checksums.
+    inline uint64_t Fnv1a64(const void* data, size_t n, uint64_t h = 14695981039346656037ULL) {
+        auto p = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < n; ++i) { h ^= p[i]; h *= 1099511628211ULL; }
+        return h;
+    }
+
+    // ---------------- XboxTitleIDs.txt ----------------
+    // Optional columns may follow a name, each a TAB, a lower-case key, '=' and a value (see
+    // TitleMeta.h), in a file that declares them: its first line (after a BOM) is a comment
+    // starting "#columns", which older readers skip like any other. In other files every name is
+    // kept whole, TABs and all, as it always was.
+    inline bool DeclaresColumns(const char* data, size_t n) {
+        size_t i = n >= 3 && (unsigned char)data[0] == 0xEF && (unsigned char)data[1] == 0xBB &&
+                   (unsigned char)data[2] == 0xBF ? 3 : 0;
+        if (n - i < 8 || std::memcmp(data + i, "#columns", 8) != 0) return false;
+        i += 8;
+        return i == n || data[i] == ' ' || data[i] == '\t' || data[i] == '\r' || data[i] == '\n';
+    }
+
+    // Bytes of the start of a file that DeclaresColumns needs: a BOM, "#columns" and the character
+    // after it.
+    constexpr size_t kDeclarationBytes = 12;
+
+    // Whether p (a TAB) starts a column.
+    inline bool IsColumnStart(const char* p, const char* end) {
+        const char* k = p + 1;
+        while (k < end && *k >= 'a' && *k <= 'z') ++k;
+        return k > p + 1 && k < end && *k == '=';
+    }
+
+    // ParseMappingRecords (below) over the lines in [begin, n) of an already validated file,
+    // calling onRecord(uint64_t key, const char* name, size_t nameLen, const char* columns,
+    // size_t columnsLen): the name without its columns, and the columns (from the first TAB,
+    // columnsLen 0 if there are none). columns tells whether the file declares them
+    // (DeclaresColumns); if not, the name is the rest of the line and columnsLen is 0. begin must
+    // be the start of a line. Offsets stay relative to data, so the BOM is only skipped at offset 0.
+    template <class Fn>
+    void ParseMappingRecords(const char* data, size_t begin, size_t n, bool columns, Fn&& onRecord) {
+        auto isBlank = [](char c) { return c == ' ' || c == '\t'; };
+        size_t i = begin;
+        while (i < n) {
+            size_t ls = i;
+            i = FindEither(data, i, n, '\n', '\r');
+            size_t le = i;
+            if (i < n && data[i] == '\r') ++i;
+            if (i < n && data[i] == '\n') ++i;
+
+            if (le <= ls) continue;
+            if (ls == 0 && le >= 3 && (unsigned char)data[0] == 0xEF &&
+                (unsigned char)data[1] == 0xBB && (unsigned char)data[2] == 0xBF) ls = 3;
+
+            while (ls < le && isBlank(data[ls])) ++ls;
+            while (le > ls && isBlank(data[le - 1])) --le;
+            if (ls == le) continue;
+            if (data[ls] == '#' || data[ls] == ';') continue;
+
+            size_t eq = FindEither(data, ls, le, '=', '=');
+            if (eq == le) continue;
+
+            size_t idl = ls, idr = eq;
+            while (idr > idl && isBlank(data[idr - 1])) --idr;
+            uint64_t key;
+            if (idr - idl != 8 || !PackTitleId8(data + idl, &key)) continue;
+            size_t col = columns ? FindEither(data, eq + 1, le, '\t', '\t') : le;
+            while (col < le && !IsColumnStart(data + col, data + le)) col = FindEither(data, col + 1, le, '\t', '\t');
+            size_t ne = col;
+            if (col < le) while (ne > eq + 1 && isBlank(data[ne - 1])) --ne;
+            onRecord(key, data + eq + 1, ne - eq - 1, data + col, le - col);
+        }
+    }
+
+    // ParseMappingRecords without the columns: onRecord(uint64_t key, const char* name, size_t nameLen).
+    template <class Fn>
+    void ParseMappingRange(const char* data, size_t begin, size_t n, bool columns, Fn&& onRecord) {
+        ParseMappingRecords(data, begin, n, columns, [&](uint64_t key, const char* name, size_t len, const char*, size_t) {
+            onRecord(key, name, len);
+        });
+    }
+
+    // Parse the raw UTF-8 bytes of a mapping file. For every valid "ID=Name" line, in file order,
+    // calls onRecord(uint64_t key, const char* name, size_t nameLen) with the name still in UTF-8.
+    // Semantics match the original wide-string parser: an invalid UTF-8 file yields no records;
+    // a BOM is skipped on the first line; lines split on CR, LF or CRLF; lines are trimmed of
+    // spaces/tabs; '#' and ';' start comments; the ID is trimmed and case-folded, the name keeps
+    // its leading whitespace and, in a file that declares columns (DeclaresColumns), ends at the
+    // first one (see IsColumnStart), so a file with columns gives every loader the same names as
+    // one without. Duplicates are all reported; the consumer keeps the last one.
+    // Works on the bytes in place: line breaks and '=' are found with FindEither and the ID is
+    // packed straight from the buffer, so nothing is copied or converted here.
+    template <class Fn>
+    bool ParseMapping(const char* data, size_t n, Fn&& onRecord) {
+        if (!IsValidUtf8(data, n)) return false;
+        ParseMappingRange(data, 0, n, DeclaresColumns(data, n), onRecord);
+        return true;
+    }
+
+    // ParseMapping over a file that is read in pieces of up to chunkBytes by
+    // read(char* buf, size_t cap, size_t* got) (got == 0 at the end; false on a read error), so
+    // the whole file is never in memory. Lines are parsed in place in each chunk; the unfinished
+    // line at its end is carried into the next one. Line breaks and the bytes of a line are
+    // ASCII-delimited, so a UTF-8 sequence never spans two checked pieces and checking each piece
+    // equals checking the file. Returns false on a read error or invalid UTF-8, possibly after
+    // some records were reported (the caller discards them then). Name pointers are only valid
+    // during the call.
+    template <class Read, class Fn>
+    bool ParseMappingStream(Read&& read, size_t chunkBytes, Fn&& onRecord) {
+        std::vector<char> buf(chunkBytes ? chunkBytes : 1);
+        std::string carry;    // the unfinished line
+        size_t carryAt = 0;   // where it starts in carry: after a '\n' once past the first line, so the BOM is only skipped there
+        bool columns = false; // DeclaresColumns, known once the first line is
+        auto isBreak = [](char c) { return c == '\n' || c == '\r'; };
+        for (;;) {
+            size_t got = 0;
+            if (!read(buf.data(), buf.size(), &got)) return false;
+            if (got == 0) break;
+            const char* p = buf.data();
+            size_t first = FindEither(p, 0, got, '\n', '\r');
+            if (first == got) { carry.append(p, got); continue; }
+            size_t last = got;
+            while (!isBreak(p[last - 1])) --last;
+
+            carry.append(p, first + 1);
+            if (!IsValidUtf8(carry.data() + carryAt, carry.size() - carryAt)) return false;
+            if (carryAt == 0) columns = DeclaresColumns(carry.data(), carry.size());
+            ParseMappingRange(carry.data(), carryAt, carry.size(), columns, onRecord);
+            if (!IsValidUtf8(p + first + 1, last - first - 1)) return false;
+            ParseMappingRange(p, first + 1, last, columns, onRecord);
+            carry.assign(1, '\n');
+            carry.append(p + last, got - last);
+            carryAt = 1;
+        }
+        if (!IsValidUtf8(carry.data() + carryAt, carry.size() - carryAt)) return false;
+        if (carryAt == 0) columns = DeclaresColumns(carry.data(), carry.size());
+        ParseMappingRange(carry.data(), carryAt, carry.size(), columns, onRecord);
+        return true;
+    }
+
+    // ---------------- In-memory table ----------------
+    // Open-addressing hash table over packed title IDs. Slots hold the key and the location of
+    // the name in one contiguous UTF-16 arena, so a lookup touches one slot and one name.
+    class TitleTable {
+    public:
+        size_t Size() const { return m_count; }
+        bool Empty() const { return m_count == 0; }
+
+        void Clear() {
+            m_slots.clear(); m_arena.clear();
+            m_count = 0; m_mask = 0; m_garbage = 0;
+        }
+
+        void Reserve(size_t n) {
+            size_t cap = 16;
+            while (cap - cap / 4 < n + 1) cap <<= 1; // keep load <= 3/4
+            if (cap > m_slots.size()) Rehash(cap);
+        }
+
+        // Insert or replace. Key 0 is never a valid packed ID and is ignored.
+        void Set(uint64_t key, const char16_t* name, size_t len) {
+            if (key == 0) return;
+            if (m_count + 1 > m_slots.size() - m_slots.size() / 4) Reserve(m_count + 1);
+            Slot& s = m_slots[Probe(key)];
+            if (s.key == key) {
+                if (len <= s.length) { // reuse the old space
+                    m_arena.replace(s.offset, len, name, len);
+                    m_garbage += s.length - len;
+                    s.length = static_cast<uint32_t>(len);
+                    return;
+                }
+                m_garbage += s.length;
+            } else {
+                s.key = key;
+                ++m_count;
+            }
+            s.offset = static_cast<uint32_t>(m_arena.size());
+            s.length = static_cast<uint32_t>(len);
+            m_arena.append(name, len);
+        }
+
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            if (m_count == 0) return false;
+            const Slot& s = m_slots[Probe(key)];
+            if (s.key != key || key == 0) return false;
+            *name = m_arena.data() + s.offset;
+            *len = s.length;
+            return true;
+        }
+
+        // Remove key. Other entries keep their arena offsets; the name's space becomes garbage.
+        bool Erase(uint64_t key) {
+            if (m_count == 0 || key == 0) return false;
+            size_t hole = Probe(key);
+            if (m_slots[hole].key != key) return false;
+            m_garbage += m_slots[hole].length;
+            m_slots[hole] = Slot{ 0, 0, 0 };
+            --m_count;
+            // Shift later members of the probe run back so lookups never stop early.
+            for (size_t j = (hole + 1) & m_mask; m_slots[j].key != 0; j = (j + 1) & m_mask) {
+                size_t home = Hash(m_slots[j].key) & m_mask;
+                if (((j - home) & m_mask) >= ((j - hole) & m_mask)) {
+                    m_slots[hole] = m_slots[j];
+                    m_slots[j] = Slot{ 0, 0, 0 };
+                    hole = j;
+                }
+            }
+            return true;
+        }
+
+        // Start of the name arena: every name returned by Find/ForEach lies at an offset into it,
+        // and Set/Erase never move the names they do not touch (ShrinkToFit and loads do).
+        const char16_t* NameData() const { return m_arena.data(); }
+        size_t NameChars() const { return m_arena.size(); }
+        size_t GarbageChars() const { return m_garbage; }
+
+        // Replace the contents with the records of a mapping file (see ParseMapping). Slots first
+        // point at the UTF-8 name bytes; only the name that wins for each ID is then converted,
+        // straight into the arena. Slots are reserved from the file size up to kReserveLimit IDs
+        // and trimmed afterwards, so a large file of comments or repeats does not leave a large
+        // table. Returns false (table empty) if the file is not valid UTF-8.
+        bool LoadUtf8(const char* data, size_t n) {
+            return LoadUtf8(data, n, [](uint64_t, const char*, size_t) {});
+        }
+
+        // As above, also passing every record (duplicates included) to
+        // observe(uint64_t key, const char* name, size_t len) in file order.
+        template <class Observe>
+        bool LoadUtf8(const char* data, size_t n, Observe&& observe) {
+            Clear();
+            Reserve(n / 32 < kReserveLimit ? n / 32 : kReserveLimit);
+            bool ok = ParseMapping(data, n, [&](uint64_t key, const char* name, size_t len) {
+                observe(key, name, len);
+                if (m_count + 1 > m_slots.size() - m_slots.size() / 4) Reserve(m_count + 1);
+                Slot& s = m_slots[Probe(key)];
+                if (s.key != key) { s.key = key; ++m_count; }
+                s.offset = static_cast<uint32_t>(name - data);
+                s.length = static_cast<uint32_t>(len);
+            });
+            if (!ok) { Clear(); return false; }
+            size_t bytes = 0;
+            for (const Slot& s : m_slots) if (s.key) bytes += s.length;
+            m_arena.resize(bytes);
+            size_t used = 0;
+            for (Slot& s : m_slots) {
+                if (!s.key) continue;
+                size_t w = ConvertUtf8(data + s.offset, s.length, &m_arena[used]);
+                s.offset = static_cast<uint32_t>(used);
+                s.length = static_cast<uint32_t>(w);
+                used += w;
+            }
+            m_arena.resize(used);
+            m_arena.shrink_to_fit();
+            size_t cap = 16;
+            while (cap - cap / 4 < m_count + 1) cap <<= 1;
+            if (cap < m_slots.size()) Rehash(cap);
+            return true;
+        }
+
+        static constexpr size_t kReserveLimit = size_t(1) << 20;
+
+        // As LoadUtf8, for a file read in chunks by read (see ParseMappingStream). Each record's
+        // name is converted as it arrives and a replaced name's space is reclaimed at the end, so
+        // memory stays proportional to the table rather than to the file.
+        template <class Read>
+        bool LoadStream(Read&& read, size_t chunkBytes = kStreamChunk) {
+            Clear();
+            std::u16string wide;
+            bool ok = ParseMappingStream(read, chunkBytes, [&](uint64_t key, const char* name, size_t len) {
+                wide.resize(len);
+                wide.resize(ConvertUtf8(name, len, &wide[0]));
+                Set(key, wide.data(), wide.size());
+            });
+            if (!ok) { Clear(); return false; }
+            ShrinkToFit();
+            m_arena.shrink_to_fit();
+            return true;
+        }
+
+        static constexpr size_t kStreamChunk = size_t(1) << 20;
+
+        // Case-insensitive lookup by ID text.
+        template <class CharT>
+        bool Find(const CharT* id, size_t n, const char16_t** name, size_t* len) const {
+            uint64_t key;
+            return PackTitleId(id, n, &key) && Find(key, name, len);
+        }
+
+        // Calls fn(uint64_t key, const char16_t* name, size_t len) for every entry, in slot order.
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            for (const Slot& s : m_slots) if (s.key) fn(s.key, m_arena.data() + s.offset, (size_t)s.length);
+        }
+
+        // Drop arena space left behind by replaced names.
+        void ShrinkToFit() {
+            if (m_garbage == 0) return;
+            std::u16string arena;
+            arena.reserve(m_arena.size() - m_garbage);
+            for (Slot& s : m_slots) {
+                if (!s.key) continue;
+                uint32_t off = static_cast<uint32_t>(arena.size());
+                arena.append(m_arena, s.offset, s.length);
+                s.offset = off;
+            }
+            m_arena.swap(arena);
+            m_garbage = 0;
+        }
+
+        // Heap bytes owned by the table (slots plus name arena).
+        size_t MemoryBytes() const {
+            return m_slots.capacity() * sizeof(Slot) + m_arena.capacity() * sizeof(char16_t);
+        }
+
+    private:
+        struct Slot {
+            uint64_t key;    // 0 = empty
+            uint32_t offset; // into m_arena
+            uint32_t length;
+        };
+
+        static size_t Hash(uint64_t key) {
+            key ^= key >> 29;
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32);
+        }
+
+        // Index of the slot holding key, or of the empty slot where it would go.
+        size_t Probe(uint64_t key) const {
+            size_t i = Hash(key) & m_mask;
+            while (m_slots[i].key != 0 && m_slots[i].key != key) i = (i + 1) & m_mask;
+            return i;
+        }
+
+        void Rehash(size_t cap) {
+            std::vector<Slot> old(cap, Slot{ 0, 0, 0 });
+            old.swap(m_slots);
+            m_mask = cap - 1;
+            for (const Slot& s : old) if (s.key) m_slots[Probe(s.key)] = s;
+        }
+
+        std::vector<Slot> m_slots;
+        std::u16string m_arena;
+        size_t m_count = 0;
+        size_t m_mask = 0;
+        size_t m_garbage = 0; // arena chars no longer referenced by any slot
+    };
+
+    // ---------------- Membership filter ----------------
+    // Blocked Bloom filter over packed keys: each key sets three bits in one 64-bit word, so a
+    // query is one multiply and one memory read. About 16 bits per key, ~1% false positives;
+    // never a false negative. Lets callers reject names that are title-shaped but unknown
+    // without touching the table (or the binary search of a mapped index).
+    class KeyFilter {
+    public:
+        // Size for n keys and clear. Must be called before Add.
+        void Reset(size_t n) {
+            size_t words = 1;
+            while (words * 64 < n * 16) words <<= 1;
+            m_words.assign(words, 0);
+            m_shift = 64;
+            for (size_t w = words; w > 1; w >>= 1) --m_shift;
+        }
+
+        void Add(uint64_t key) {
+            uint64_t h = Mix(key);
+            m_words[Word(h)] |= Bits(h);
+        }
+
+        // False means key was never added. An empty (never Reset) filter contains nothing.
+        bool MayContain(uint64_t key) const {
+            if (m_words.empty()) return false;
+            uint64_t h = Mix(key), bits = Bits(h);
+            return (m_words[Word(h)] & bits) == bits;
+        }
+
+        size_t MemoryBytes() const { return m_words.capacity() * sizeof(uint64_t); }
+
+    private:
+        static uint64_t Mix(uint64_t key) {
+            key ^= key >> 31;
+            key *= 0xBF58476D1CE4E5B9ULL;
+            return key ^ (key >> 29);
+        }
+        size_t Word(uint64_t h) const { return m_shift == 64 ? 0 : static_cast<size_t>(h >> m_shift); }
+        static uint64_t Bits(uint64_t h) {
+            return (1ULL << (h & 63)) | (1ULL << ((h >> 6) & 63)) | (1ULL << ((h >> 12) & 63));
+        }
+
+        std::vector<uint64_t> m_words;
+        unsigned m_shift = 64; // 64 - log2(word count); the top bits of the hash pick the word
+    };
+
+    // ---------------- Snapshot publication ----------------
+    // Holds the current immutable T. Readers never block: a read section bumps one of two
+    // counters (chosen by epoch), loads the pointer and later drops the counter. Publish swaps
+    // in a new object, then flips the epoch twice, each time waiting for the previous
+    // generation's readers to leave, after which nobody can still see the old object.
+    template <class T>
+    class SnapshotCell {
+    public:
+        class ReadGuard {
+        public:
+            explicit ReadGuard(const SnapshotCell& cell) : m_cell(cell) {
+                m_slot = cell.m_epoch.load() & 1;
+                cell.m_readers[m_slot].fetch_add(1);
+                m_ptr = cell.m_current.load();
+            }
+            ~ReadGuard() { m_cell.m_readers[m_slot].fetch_sub(1); }
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+
+            const T* get() const { return m_ptr; }
+            const T* operator->() const { return m_ptr; }
+            explicit operator bool() const { return m_ptr != nullptr; }
+
+        private:
+            const SnapshotCell& m_cell;
+            const T* m_ptr;
+            uint32_t m_slot;
+        };
+
+        SnapshotCell() = default;
+        SnapshotCell(const SnapshotCell&) = delete;
+        SnapshotCell& operator=(const SnapshotCell&) = delete;
+        ~SnapshotCell() { delete m_current.load(); }
+
+        ReadGuard Read() const { return ReadGuard(*this); }
+
+        // Replace the current object. Returns once the old one has been destroyed.
+        void Publish(std::unique_ptr<T> next) {
+            std::lock_guard<std::mutex> lk(m_writer);
+            T* old = m_current.exchange(next.release());
+            if (!old) return;
+            for (int pass = 0; pass < 2; ++pass) {
+                uint32_t e = m_epoch.fetch_add(1);
+                while (m_readers[e & 1].load() != 0) std::this_thread::yield();
+            }
+            delete old;
+        }
+
+    private:
+        std::atomic<T*> m_current{ nullptr };
+        std::atomic<uint32_t> m_epoch{ 0 };
+        mutable std::atomic<int32_t> m_readers[2] = {};
+        std::mutex m_writer;
+    };
+
+} // namespace titledb
@@ -0,0 +1,131 @@
+// TitleEmbedded.h – a title list compiled into the binary.
+// `XboxTitleTool embed` turns a mapping file into a header of constexpr arrays: packed IDs in
+// ascending order, one offset per title into a single UTF-16 name pool, and the size and checksum
+// of the file they came from. EmbeddedTable is a view over those arrays, so the list is there
+// before anything is read: a lookup is a binary search over the keys with no parsing and no heap
+// allocation, and the names live in the image's read-only data. WriteEmbeddedHeader is the
+// generator. Platform-independent.
+
+#pragma once
+
+#include "TitleReload.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace titledb {
+
+    class EmbeddedTable {
+    public:
+        // keys[count] ascending; names of title i are pool[offsets[i], offsets[i + 1]).
+        constexpr EmbeddedTable(const uint64_t* keys, const uint32_t* offsets, const char16_t* pool, size_t count,
+                                uint64_t sourceSize, uint64_t sourceChecksum)
+            : m_keys(keys), m_offsets(offsets), m_pool(pool), m_count(count),
+              m_sourceSize(sourceSize), m_sourceChecksum(sourceChecksum) {}
+
+        constexpr size_t Size() const { return m_count; }
+
+        // Size and HashBlock of the mapping file the table was generated from, so a file on disk
+        // can be recognised as the same list without parsing it.
+        constexpr uint64_t SourceSize() const { return m_sourceSize; }
+        constexpr uint64_t SourceChecksum() const { return m_sourceChecksum; }
+
+        // Whether data is the file the table was generated from.
+        bool IsSource(const char* data, size_t n) const {
+            return n == m_sourceSize && HashBlock(data, n) == m_sourceChecksum;
+        }
+
+        constexpr bool IsSorted() const {
+            for (size_t i = 1; i < m_count; ++i) if (m_keys[i - 1] >= m_keys[i]) return false;
+            return true;
+        }
+
+        constexpr bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            size_t lo = 0, hi = m_count;
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (m_keys[mid] < key) lo = mid + 1; else hi = mid;
+            }
+            if (lo == m_count || m_keys[lo] != key) return false;
+            *name = m_pool + m_offsets[lo];
+            *len = m_offsets[lo + 1] - m_offsets[lo];
+            return true;
+        }
+
+        template <class CharT>
+        bool Find(const CharT* id, size_t n, const char16_t** name, size_t* len) const {
+            uint64_t key;
+            return PackTitleId(id, n, &key) && Find(key, name, len);
+        }
+
+        // Start of the name pool; every name Find/ForEach returns lies at an offset into it.
+        constexpr const char16_t* NameData() const { return m_pool; }
+
+        // Call fn(uint64_t key, const char16_t* name, size_t len) for every entry, ascending.
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            for (size_t i = 0; i < m_count; ++i) fn(m_keys[i], m_pool + m_offsets[i], size_t(m_offsets[i + 1] - m_offsets[i]));
+        }
+
+    private:
+        const uint64_t* m_keys;
+        const uint32_t* m_offsets;
+        const char16_t* m_pool;
+        size_t m_count;
+        uint64_t m_sourceSize, m_sourceChecksum;
+    };
+
+    // Write the header defining titledb::kEmbeddedTitles from a mapping file's bytes; `source`
+    // is the file name quoted in its comment. Names are written as numbers rather than a string
+    // literal, which MSVC limits to 64 KB. False if the bytes are not valid UTF-8.
+    inline bool WriteEmbeddedHeader(const char* data, size_t n, const std::string& source, std::string& out) {
+        TitleTable table;
+        if (!table.LoadUtf8(data, n)) return false;
+        struct Title { uint64_t key; const char16_t* name; size_t len; };
+        std::vector<Title> titles;
+        titles.reserve(table.Size());
+        table.ForEach([&](uint64_t key, const char16_t* s, size_t len) { titles.push_back({ key, s, len }); });
+        std::sort(titles.begin(), titles.end(), [](const Title& a, const Title& b) { return a.key < b.key; });
+
+        char buf[64];
+        auto line = [&](const char* fmt, unsigned long long v) {
+            std::snprintf(buf, sizeof(buf), fmt, v);
+            out += buf;
+        };
+        out = "// Generated by `XboxTitleTool embed " + source + "`; do not edit.\n";
+        line("// %llu titles", (unsigned long long)titles.size());
+        line(" from %llu bytes.\n\n", (unsigned long long)n);
+        out += "#pragma once\n\n#include \"TitleEmbedded.h\"\n\nnamespace titledb {\n\n";
+        out += "    namespace embedded_data {\n";
+
+        out += "        inline constexpr uint64_t kKeys[] = {";
+        for (size_t i = 0; i < titles.size(); ++i) line(i % 4 ? " 0x%016llXULL," : "\n            0x%016llXULL,", titles[i].key);
+        out += titles.empty() ? " 0 };\n" : "\n        };\n";
+
+        out += "        inline constexpr uint32_t kOffsets[] = {";
+        uint64_t at = 0;
+        for (size_t i = 0; i <= titles.size(); ++i) {
+            line(i % 12 ? " %llu," : "\n            %llu,", at);
+            if (i < titles.size()) at += titles[i].len;
+        }
+        out += "\n        };\n";
+
+        out += "        inline constexpr char16_t kPool[] = {";
+        size_t column = 0;
+        for (const Title& t : titles) {
+            for (size_t i = 0; i < t.len; ++i, ++column) line(column % 20 ? " %llu," : "\n            %llu,", t.name[i]);
+        }
+        out += at ? "\n        };\n" : " 0 };\n";
+        out += "    }\n\n";
+
+        out += "    inline constexpr EmbeddedTable kEmbeddedTitles(embedded_data::kKeys, embedded_data::kOffsets, embedded_data::kPool,\n";
+        line("        %llu, ", (unsigned long long)titles.size());
+        line("%llu, ", (unsigned long long)n);
+        line("0x%016llXULL);\n", (unsigned long long)HashBlock(data, n));
+        out += "    static_assert(kEmbeddedTitles.IsSorted(), \"keys must ascend\");\n\n} // namespace titledb\n";
+        return true;
+    }
+
+} // namespace titledb
@@ -0,0 +1,51 @@
+// TitleFreshness.h – when a loaded mapping file is looked at again. Between loads only the file's
+// metadata (its stamp: size, write time, and whatever else the platform offers) is compared with
+// the stamp the loaded copy was built from, and no more often than once per interval; the bytes
+// are read again only when the stamps differ or the file came or went. The handler checks its
+// layers this way on the hover path, and the bench counts the bytes read while a file is left alone.
+// Platform-independent.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace titledb {
+
+    // Tells at most one caller per interval to check (the handler's RevalidateMs). Times are in
+    // milliseconds from any monotonic clock.
+    class RevalidateClock {
+    public:
+        void SetInterval(uint64_t ms) { m_interval = ms; }
+        uint64_t Interval() const { return m_interval; }
+
+        // The files were just looked at (a load): the next check is an interval away.
+        void Restart(uint64_t nowMs) { m_last.store(nowMs, std::memory_order_relaxed); }
+
+        bool ShouldCheck(uint64_t nowMs) {
+            uint64_t last = m_last.load(std::memory_order_relaxed);
+            if (nowMs - last < m_interval) return false;
+            return m_last.compare_exchange_strong(last, nowMs, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint64_t> m_last{ 0 };
+        uint64_t m_interval = 2000;
+    };
+
+    // What a loaded copy was built from: whether there was a file, and its stamp.
+    template <class Stamp>
+    struct LoadedStamp {
+        bool present = false;
+        Stamp stamp{};
+    };
+
+    // Whether a copy no longer matches its file; exists/now describe the file as it is now and
+    // same(a, b) compares two stamps. A file that is still missing is never stale.
+    template <class Stamp, class Same>
+    bool IsStale(const LoadedStamp<Stamp>& loaded, bool exists, const Stamp& now, Same&& same) {
+        if (!exists) return loaded.present;
+        return !loaded.present || !same(now, loaded.stamp);
+    }
+
+} // namespace titledb
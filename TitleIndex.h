@@ -0,0 +1,150 @@
+// TitleIndex.h – compiled binary form of XboxTitleIDs.txt (XboxTitleIDs.bin).
+// The file is designed to be mapped read-only and queried in place:
+//
+//   IndexHeader                 64 bytes
+//   uint64_t keys[count]        packed title IDs, ascending
+//   IndexEntry entries[count]   name location for keys[i]
+//   char16_t pool[poolChars]    all names, UTF-16, not terminated
+//
+// All integers are little-endian. The checksum covers everything after the header.
+// sourceSize/sourceWriteTime record the text file the index was compiled from, so a loader
+// can tell a stale index from a fresh one without reading the text file.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace titledb {
+
+    constexpr char kIndexMagic[4] = { 'X', 'T', 'I', 'X' };
+    constexpr uint32_t kIndexVersion = 1;
+
+    struct IndexHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t count;
+        uint64_t sourceSize;
+        uint64_t sourceWriteTime; // FILETIME ticks (100 ns since 1601-01-01 UTC)
+        uint64_t checksum;        // Fnv1a64 of the bytes after the header
+        uint32_t poolChars;
+        uint32_t reserved[5];
+    };
+    static_assert(sizeof(IndexHeader) == 64, "IndexHeader layout is part of the file format");
+
+    struct IndexEntry {
+        uint32_t offset; // into pool, in char16_t units
+        uint32_t length; // in char16_t units
+    };
+    static_assert(sizeof(IndexEntry) == 8, "IndexEntry layout is part of the file format");
+
+    // Build an index from the raw bytes of a mapping file. Last duplicate wins, as in the text loader.
+    // Returns false if the text is not valid UTF-8.
+    inline bool CompileIndex(const char* text, size_t n, uint64_t sourceSize, uint64_t sourceWriteTime,
+                             std::vector<unsigned char>& out) {
+        TitleTable table;
+        if (!table.LoadUtf8(text, n)) return false;
+
+        std::vector<std::pair<uint64_t, std::u16string_view>> sorted;
+        sorted.reserve(table.Size());
+        table.ForEach([&](uint64_t key, const char16_t* name, size_t len) { sorted.emplace_back(key, std::u16string_view(name, len)); });
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::vector<uint64_t> keys;
+        std::vector<IndexEntry> entries;
+        std::u16string pool;
+        keys.reserve(sorted.size());
+        entries.reserve(sorted.size());
+        for (auto& kv : sorted) {
+            keys.push_back(kv.first);
+            entries.push_back({ static_cast<uint32_t>(pool.size()), static_cast<uint32_t>(kv.second.size()) });
+            pool.append(kv.second);
+        }
+
+        IndexHeader h{};
+        std::memcpy(h.magic, kIndexMagic, sizeof(h.magic));
+        h.version = kIndexVersion;
+        h.headerSize = sizeof(IndexHeader);
+        h.count = static_cast<uint32_t>(keys.size());
+        h.sourceSize = sourceSize;
+        h.sourceWriteTime = sourceWriteTime;
+        h.poolChars = static_cast<uint32_t>(pool.size());
+
+        size_t keyBytes = keys.size() * sizeof(uint64_t);
+        size_t entryBytes = entries.size() * sizeof(IndexEntry);
+        size_t poolBytes = pool.size() * sizeof(char16_t);
+        out.assign(sizeof(h) + keyBytes + entryBytes + poolBytes, 0);
+        unsigned char* p = out.data() + sizeof(h);
+        if (keyBytes) std::memcpy(p, keys.data(), keyBytes);
+        if (entryBytes) std::memcpy(p + keyBytes, entries.data(), entryBytes);
+        if (poolBytes) std::memcpy(p + keyBytes + entryBytes, pool.data(), poolBytes);
+        h.checksum = Fnv1a64(p, out.size() - sizeof(h));
+        std::memcpy(out.data(), &h, sizeof(h));
+        return true;
+    }
+
+    // Read-only view over a mapped index. Lookups do not allocate; returned names point into
+    // the mapping and stay valid for as long as it does.
+    class IndexView {
+    public:
+        // Validate and attach to an index image. verifyChecksum reads every page once.
+        bool Open(const void* base, size_t size, bool verifyChecksum = true) {
+            *this = IndexView();
+            if (size < sizeof(IndexHeader)) return false;
+            auto h = static_cast<const IndexHeader*>(base);
+            if (std::memcmp(h->magic, kIndexMagic, sizeof(h->magic)) != 0) return false;
+            if (h->version != kIndexVersion || h->headerSize != sizeof(IndexHeader)) return false;
+            uint64_t need = sizeof(IndexHeader) + uint64_t(h->count) * (sizeof(uint64_t) + sizeof(IndexEntry)) +
+                            uint64_t(h->poolChars) * sizeof(char16_t);
+            if (need != size) return false;
+            auto payload = static_cast<const unsigned char*>(base) + sizeof(IndexHeader);
+            if (verifyChecksum && Fnv1a64(payload, size - sizeof(IndexHeader)) != h->checksum) return false;
+            m_header = h;
+            m_keys = reinterpret_cast<const uint64_t*>(payload);
+            m_entries = reinterpret_cast<const IndexEntry*>(payload + h->count * sizeof(uint64_t));
+            m_pool = reinterpret_cast<const char16_t*>(payload + h->count * (sizeof(uint64_t) + sizeof(IndexEntry)));
+            for (uint32_t i = 0; i < h->count; ++i) {
+                if (uint64_t(m_entries[i].offset) + m_entries[i].length > h->poolChars) { *this = IndexView(); return false; }
+            }
+            return true;
+        }
+
+        bool IsOpen() const { return m_header != nullptr; }
+        const IndexHeader* Header() const { return m_header; }
+        size_t Size() const { return m_header ? m_header->count : 0; }
+
+        // Find the name for a packed key. Returns false if the key is not present.
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            if (!m_header) return false;
+            const uint64_t* end = m_keys + m_header->count;
+            const uint64_t* it = std::lower_bound(m_keys, end, key);
+            if (it == end || *it != key) return false;
+            const IndexEntry& e = m_entries[it - m_keys];
+            *name = m_pool + e.offset;
+            *len = e.length;
+            return true;
+        }
+
+        // Start of the name pool; every name Find/ForEach returns lies at an offset into it.
+        const char16_t* NameData() const { return m_pool; }
+
+        // Call fn(uint64_t key, const char16_t* name, size_t len) for every entry, ascending.
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            for (size_t i = 0; i < Size(); ++i) fn(m_keys[i], m_pool + m_entries[i].offset, (size_t)m_entries[i].length);
+        }
+
+    private:
+        const IndexHeader* m_header = nullptr;
+        const uint64_t* m_keys = nullptr;
+        const IndexEntry* m_entries = nullptr;
+        const char16_t* m_pool = nullptr;
+    };
+
+} // namespace titledb
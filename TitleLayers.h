@@ -0,0 +1,200 @@
+// TitleLayers.h – several title databases merged into one lookup structure.
+// Layers are numbered from 0 (the system list) upwards; for an ID present in several layers the
+// highest layer wins. The merged table holds one slot per distinct ID recording the winning
+// layer and where its name sits in that layer, so overlapping layers cost one slot per ID rather
+// than a copy of every name. Replacing a layer only walks the old and new contents of that
+// layer, and an edited layer whose untouched names kept their place only walks the changed IDs.
+// Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <memory>
+#include <vector>
+
+namespace titledb {
+
+    // Layer is any immutable table with
+    //   bool Find(uint64_t key, const char16_t** name, size_t* len) const
+    //   void ForEach(fn(uint64_t key, const char16_t* name, size_t len)) const
+    //   const char16_t* NameData() const   (every name lies at an offset from this)
+    // Layers are shared between copies of a LayeredTable, so copying one and replacing a layer
+    // in the copy is the cheap way to build the next generation of a published snapshot.
+    template <class Layer>
+    class LayeredTable {
+    public:
+        static constexpr size_t kMaxLayers = 16;
+
+        size_t Size() const { return m_count; }
+        size_t LayerCount() const { return m_layers.size(); }
+        const std::shared_ptr<const Layer>& GetLayer(size_t i) const { return m_layers[i]; }
+
+        // Install layer i (nullptr removes it). IDs the old layer i supplied fall back to the next
+        // lower layer that has them; IDs of the new layer replace any lower layer's. Returns the
+        // number of merged entries that changed.
+        size_t SetLayer(size_t i, std::shared_ptr<const Layer> layer) {
+            if (i >= kMaxLayers) return 0;
+            std::shared_ptr<const Layer> old = Install(i, std::move(layer));
+            const Layer* now = m_layers[i].get();
+            size_t changed = 0;
+
+            if (old) {
+                old->ForEach([&](uint64_t key, const char16_t*, size_t) {
+                    if (Resolve(i, key, true)) ++changed;
+                });
+            }
+            if (now) {
+                now->ForEach([&](uint64_t key, const char16_t* name, size_t len) {
+                    if (key == 0) return;
+                    Grow();
+                    Slot& s = m_slots[Probe(key)];
+                    if (s.key == key) {
+                        if (s.LayerIndex() >= i) return; // a higher layer owns it, or repointed above
+                    } else {
+                        s.key = key;
+                        ++m_count;
+                    }
+                    Point(s, i, name, len);
+                    ++changed;
+                });
+            }
+            Trim();
+            return changed;
+        }
+
+        // Install a new version of layer i that differs from the current one only in `keys`:
+        // every other name must sit at the same offset from NameData() as before (true when the
+        // layer was copied and patched in place). Walks only `keys`. Returns entries changed.
+        size_t UpdateLayer(size_t i, std::shared_ptr<const Layer> layer, const std::vector<uint64_t>& keys) {
+            if (i >= kMaxLayers) return 0;
+            Install(i, std::move(layer));
+            size_t changed = 0;
+            for (uint64_t key : keys) if (Resolve(i, key, false)) ++changed;
+            Trim();
+            return changed;
+        }
+
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            if (m_count == 0) return false;
+            const Slot& s = m_slots[Probe(key)];
+            if (s.key != key || key == 0) return false;
+            *name = m_bases[s.LayerIndex()] + s.offset;
+            *len = s.Length();
+            return true;
+        }
+
+        // Layer that supplies key, or -1.
+        int LayerOf(uint64_t key) const {
+            if (m_count == 0) return -1;
+            const Slot& s = m_slots[Probe(key)];
+            return s.key == key && key != 0 ? int(s.LayerIndex()) : -1;
+        }
+
+        // Calls fn(uint64_t key, const char16_t* name, size_t len) for every merged entry.
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            for (const Slot& s : m_slots) if (s.key) fn(s.key, m_bases[s.LayerIndex()] + s.offset, (size_t)s.Length());
+        }
+
+        // Heap bytes of the merged slots (the layers account for their own names).
+        size_t MemoryBytes() const { return m_slots.capacity() * sizeof(Slot); }
+
+    private:
+        // 16 bytes: the layer lives in the low 4 bits of lengthLayer, the name length above it.
+        struct Slot {
+            uint64_t key = 0; // 0 = empty
+            uint32_t offset = 0;
+            uint32_t lengthLayer = 0;
+
+            size_t LayerIndex() const { return lengthLayer & (kMaxLayers - 1); }
+            size_t Length() const { return lengthLayer >> 4; }
+        };
+        static_assert(kMaxLayers == 16, "Slot packs the layer into 4 bits");
+
+        void Point(Slot& s, size_t layer, const char16_t* name, size_t len) {
+            s.offset = static_cast<uint32_t>(name - m_bases[layer]);
+            s.lengthLayer = static_cast<uint32_t>(len << 4) | static_cast<uint32_t>(layer);
+        }
+
+        std::shared_ptr<const Layer> Install(size_t i, std::shared_ptr<const Layer> layer) {
+            if (i >= m_layers.size()) { m_layers.resize(i + 1); m_bases.resize(i + 1, nullptr); }
+            std::shared_ptr<const Layer> old = std::move(m_layers[i]);
+            m_layers[i] = std::move(layer);
+            m_bases[i] = m_layers[i] ? m_layers[i]->NameData() : nullptr;
+            return old;
+        }
+
+        void Trim() {
+            while (!m_layers.empty() && !m_layers.back()) { m_layers.pop_back(); m_bases.pop_back(); }
+        }
+
+        void Grow() {
+            if (m_count + 1 > m_slots.size() - m_slots.size() / 4) Rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+        }
+
+        // Recompute key's entry after layer i changed: the highest layer at or below i that has
+        // it, or none. Keys a higher layer supplies are left alone; with onlyOwned (walking the
+        // old layer's keys) so are keys layer i did not supply. Returns whether the entry changed.
+        bool Resolve(size_t i, uint64_t key, bool onlyOwned) {
+            if (key == 0) return false;
+            if (!onlyOwned) Grow();
+            if (m_slots.empty()) return false;
+            size_t at = Probe(key);
+            bool present = m_slots[at].key == key;
+            if (present && m_slots[at].LayerIndex() > i) return false;
+            if (onlyOwned && (!present || m_slots[at].LayerIndex() != i)) return false;
+            const char16_t* name; size_t len;
+            for (size_t l = i + 1; l-- > 0;) {
+                if (!m_layers[l] || !m_layers[l]->Find(key, &name, &len)) continue;
+                Slot& s = m_slots[at];
+                Slot before = s;
+                if (!present) { s.key = key; ++m_count; }
+                Point(s, l, name, len);
+                return !present || s.offset != before.offset || s.lengthLayer != before.lengthLayer || l == i;
+            }
+            if (!present) return false;
+            Erase(at);
+            return true;
+        }
+
+        size_t Probe(uint64_t key) const {
+            size_t i = Hash(key) & m_mask;
+            while (m_slots[i].key != 0 && m_slots[i].key != key) i = (i + 1) & m_mask;
+            return i;
+        }
+
+        static size_t Hash(uint64_t key) {
+            key ^= key >> 29;
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32);
+        }
+
+        // Linear-probing delete: shift later members of the cluster back so no tombstones remain.
+        void Erase(size_t hole) {
+            m_slots[hole] = Slot();
+            --m_count;
+            for (size_t j = (hole + 1) & m_mask; m_slots[j].key != 0; j = (j + 1) & m_mask) {
+                size_t home = Hash(m_slots[j].key) & m_mask;
+                if (((j - home) & m_mask) >= ((j - hole) & m_mask)) {
+                    m_slots[hole] = m_slots[j];
+                    m_slots[j] = Slot();
+                    hole = j;
+                }
+            }
+        }
+
+        void Rehash(size_t cap) {
+            std::vector<Slot> old(cap);
+            old.swap(m_slots);
+            m_mask = cap - 1;
+            for (const Slot& s : old) if (s.key) m_slots[Probe(s.key)] = s;
+        }
+
+        std::vector<std::shared_ptr<const Layer>> m_layers;
+        std::vector<const char16_t*> m_bases; // m_layers[i]->NameData(), cached for Find
+        std::vector<Slot> m_slots;
+        size_t m_count = 0;
+        size_t m_mask = 0;
+    };
+
+} // namespace titledb
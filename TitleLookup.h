@@ -0,0 +1,105 @@
+// TitleLookup.h – the hover path over one published generation of the lists: which title ID an
+// item's path names, the title's name and details from the list that has it, and the tooltip
+// formatted into one buffer from the caller's allocator. The handler's GetInfoTip runs these, and
+// the bench runs the same code to check that a hover allocates nothing but the returned buffer.
+// Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+#include "TitleEmbedded.h"
+#include "TitleLayers.h"
+#include "TitleMeta.h"
+#include "TitleScan.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace titledb {
+
+    // The lists of one generation, in the order a lookup asks them. Layer is a LayeredTable layer
+    // that also has bool Contains(uint64_t key) const and a TitleMetaTable meta.
+    template <class Layer>
+    struct TitleSources {
+        const Layer* share = nullptr;                // the item's share list, ahead of the others
+        const LayeredTable<Layer>* merged = nullptr; // system and per-user lists
+        const KeyFilter* filter = nullptr;           // every key of merged, when set
+        const EmbeddedTable* builtIn = nullptr;      // answers for IDs none of the files has
+        size_t builtInLayer = 0;                     // the merged layer the built-in list was made from
+    };
+
+    // The name of key: the share list, then the merged lists (keys the filter has never seen are
+    // rejected before the table), then the built-in list. *builtIn tells whether the last answered.
+    template <class Layer>
+    bool FindTitle(const TitleSources<Layer>& src, uint64_t key, const char16_t** name, size_t* len, bool* builtIn) {
+        *builtIn = false;
+        if (src.share && src.share->Find(key, name, len)) return true;
+        if (src.merged && (!src.filter || src.filter->MayContain(key)) && src.merged->Find(key, name, len)) return true;
+        *builtIn = src.builtIn && src.builtIn->Find(key, name, len);
+        return *builtIn;
+    }
+
+    // The details of a title FindTitle found, from the same file as its name: the share's list,
+    // the layer that won the merge, or for the built-in list the layer it was made from. Nothing
+    // is inferred without a file that declares columns (TitleMetaTable::Describe).
+    template <class Layer>
+    TitleMeta DescribeTitle(const TitleSources<Layer>& src, uint64_t key, bool builtIn) {
+        const Layer* layer = !builtIn && src.share && src.share->Contains(key) ? src.share : nullptr;
+        if (!layer && src.merged) {
+            int i = builtIn ? int(src.builtInLayer) : src.merged->LayerOf(key);
+            if (i >= 0 && size_t(i) < src.merged->LayerCount()) layer = src.merged->GetLayer(size_t(i)).get();
+        }
+        return layer ? layer->meta.Describe(key) : TitleMeta();
+    }
+
+    // FindTitle, and DescribeTitle when details is set: calls fn(const char16_t* name, size_t len,
+    // const TitleMeta& meta) with the name where the list holds it, and returns whether key was
+    // found. Nothing is copied or allocated on the way.
+    template <class Layer, class Fn>
+    bool LookupTitle(const TitleSources<Layer>& src, uint64_t key, bool details, bool* builtIn, Fn&& fn) {
+        const char16_t* name; size_t len;
+        if (!FindTitle(src, key, &name, &len, builtIn)) return false;
+        fn(name, len, details ? DescribeTitle(src, key, *builtIn) : TitleMeta());
+        return true;
+    }
+
+    // How TitleIdOfPath got its answer.
+    struct PathMatch {
+        bool scanned = false; // the name or path was scanned for IDs inside it
+        bool inName = false;  // the ID came from the scan
+    };
+
+    // The title ID an item's path stands for. scope is the handler's MatchInName: 0 only a name
+    // that is an ID by itself, 1 also an ID inside the name, 2 anywhere in the path; known(key)
+    // tells which IDs a list has (TitleScanner::Find picks among those). A name that is an ID by
+    // itself is only looked past with scope 2 and only when no list knows it (the 000D0000 in
+    // Content\<id>\000D0000).
+    template <class CharT, class Known>
+    bool TitleIdOfPath(std::basic_string_view<CharT> path, int scope, const TitleScanner& scanner, Known&& known,
+                       uint64_t* key, PathMatch* how = nullptr) {
+        std::basic_string_view<CharT> leaf = LeafName<CharT>(path);
+        bool exact = PackTitleId(leaf.data(), leaf.size(), key);
+        if (scope == 0 || (exact && (scope == 1 || known(*key)))) return exact;
+        std::basic_string_view<CharT> text = scope == 1 ? leaf : path;
+        uint64_t found;
+        if (how) how->scanned = true;
+        if (!scanner.Find(text.data(), text.size(), known, &found)) return exact;
+        if (how) how->inName = true;
+        *key = found;
+        return true;
+    }
+
+    // The tooltip for a title as one NUL-terminated string in a buffer from alloc(bytes)
+    // (CoTaskMemAlloc in the handler). nullptr for an empty name or when alloc fails.
+    template <class CharT, class Alloc>
+    CharT* AllocTitleTip(const char16_t* name, size_t len, const TitleMeta& meta, Alloc&& alloc) {
+        if (len == 0) return nullptr;
+        size_t n = FormatTitleTip<CharT>(name, len, meta, nullptr);
+        CharT* tip = static_cast<CharT*>(alloc((n + 1) * sizeof(CharT)));
+        if (!tip) return nullptr;
+        FormatTitleTip(name, len, meta, tip);
+        tip[n] = CharT(0);
+        return tip;
+    }
+
+} // namespace titledb
@@ -0,0 +1,378 @@
+// TitleMeta.h – platform, publisher, region and release year of titles, and the tooltip built
+// from them. In a file whose first line is "#columns" (see DeclaresColumns), a line may carry any
+// of these as optional columns after the name, each a TAB, a key, '=' and a value:
+//
+//   #columns platform region year publisher
+//   4D530064=Halo 2<TAB>platform=xbox<TAB>region=ntsc-u<TAB>year=2004<TAB>publisher=Microsoft Game Studios
+//
+// Unknown keys and values are skipped, and the parser ends every name at its first column (see
+// ParseMappingRecords), so every table keeps only names. Files without the declaration load as
+// they always did: names whole, and no details at all. TitleMetaTable holds the columns of the
+// titles that have any, as a struct of arrays sorted by ID: the key, one byte each for platform
+// and region, the year, and a 16-bit index into a dictionary of publisher names; 14 bytes per
+// described title and nothing for the others. A title of such a file without a publisher column
+// gets the one its ID's first four hex digits name (4D53 is Microsoft). An incremental reload of
+// the file patches the table with the lines it re-read (Patch). Nothing is formatted until
+// FormatTitleTip is asked for a tooltip.
+// Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+#include "TitleReload.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace titledb {
+
+    enum class Platform : uint8_t { Unknown, Xbox, Xbox360, XboxOne, XboxSeries, PC };
+    enum class Region : uint8_t { Unknown, RegionFree, NtscU, Pal, NtscJ, Asia };
+
+    struct TitleMeta {
+        Platform platform = Platform::Unknown;
+        Region region = Region::Unknown;
+        uint16_t year = 0;                  // 0 = unknown
+        const char16_t* publisher = nullptr; // not terminated; nullptr = unknown
+        size_t publisherLen = 0;
+    };
+
+    // Display names; empty for Unknown.
+    inline std::u16string_view PlatformName(Platform p) {
+        static constexpr std::u16string_view kNames[] = { u"", u"Xbox", u"Xbox 360", u"Xbox One", u"Xbox Series X|S", u"PC" };
+        return kNames[size_t(p)];
+    }
+
+    inline std::u16string_view RegionName(Region r) {
+        static constexpr std::u16string_view kNames[] = { u"", u"Region free", u"NTSC-U", u"PAL", u"NTSC-J", u"Asia" };
+        return kNames[size_t(r)];
+    }
+
+    // Publishers by the first four hex digits of their title IDs (two ASCII letters), ascending.
+    struct PrefixPublisher {
+        uint16_t prefix;
+        std::u16string_view name;
+    };
+    inline constexpr PrefixPublisher kPrefixPublishers[] = {
+        { 0x4156, u"Activision" },   { 0x4343, u"Capcom" },     { 0x4541, u"Electronic Arts" },
+        { 0x4B4E, u"Konami" },       { 0x4C41, u"LucasArts" },  { 0x4D53, u"Microsoft" },
+        { 0x4D57, u"Midway" },       { 0x4E4D, u"Namco Bandai" }, { 0x5345, u"Sega" },
+        { 0x5451, u"THQ" },          { 0x5454, u"Take-Two Interactive" }, { 0x5553, u"Ubisoft" },
+    };
+
+    // Publisher of key by its prefix, or empty. Keys that are not hex have none.
+    inline std::u16string_view PublisherByPrefix(uint64_t key) {
+        uint16_t prefix = 0;
+        for (int shift = 56; shift >= 32; shift -= 8) {
+            unsigned c = unsigned(key >> shift) & 0xFF;
+            if (c >= '0' && c <= '9') prefix = uint16_t((prefix << 4) | (c - '0'));
+            else if (c >= 'A' && c <= 'F') prefix = uint16_t((prefix << 4) | (c - 'A' + 10));
+            else return {};
+        }
+        const PrefixPublisher* end = kPrefixPublishers + sizeof(kPrefixPublishers) / sizeof(kPrefixPublishers[0]);
+        const PrefixPublisher* it = std::lower_bound(kPrefixPublishers, end, prefix,
+                                                     [](const PrefixPublisher& p, uint16_t v) { return p.prefix < v; });
+        return it != end && it->prefix == prefix ? it->name : std::u16string_view();
+    }
+
+    // What is known of key in a file with columns when its line has none: the publisher its
+    // prefix names.
+    inline TitleMeta DefaultMeta(uint64_t key) {
+        TitleMeta m;
+        std::u16string_view p = PublisherByPrefix(key);
+        if (!p.empty()) {
+            m.publisher = p.data();
+            m.publisherLen = p.size();
+        }
+        return m;
+    }
+
+    class TitleMetaTable {
+    public:
+        size_t Size() const { return m_keys.size(); }
+        size_t PublisherCount() const { return m_pubOffsets.empty() ? 0 : m_pubOffsets.size() - 1; }
+        // Whether the file declared columns (DeclaresColumns); without, nothing is described.
+        bool HasColumns() const { return m_columns; }
+
+        // Replace the contents with the columns of a mapping file; the last line for an ID wins,
+        // as for names, even when it has no columns. A file that does not declare columns has
+        // none, and nothing past its first line is looked at. False (table empty) if a file that
+        // declares them is not valid UTF-8.
+        bool LoadUtf8(const char* data, size_t n) {
+            *this = TitleMetaTable();
+            if (!DeclaresColumns(data, n)) return true;
+            if (!IsValidUtf8(data, n)) return false;
+            m_columns = true;
+            struct Row { uint64_t key; uint32_t line; Platform platform; Region region; uint16_t year; uint16_t publisher; };
+            std::vector<Row> rows;
+            rows.reserve(n / 48);
+            std::unordered_map<std::string_view, uint16_t> dictionary; // raw UTF-8 values, into data
+            m_pubOffsets.push_back(0);
+            ParseMappingRecords(data, 0, n, true, [&](uint64_t key, const char*, size_t, const char* cols, size_t colsLen) {
+                Row row{ key, uint32_t(rows.size()), Platform::Unknown, Region::Unknown, 0, 0 };
+                std::string_view pub;
+                ParseColumns(cols, colsLen, &row.platform, &row.region, &row.year, &pub);
+                if (!pub.empty()) {
+                    auto it = dictionary.find(pub);
+                    if (it != dictionary.end()) {
+                        row.publisher = it->second;
+                    } else if (PublisherCount() < kMaxPublishers) {
+                        size_t at = m_pubPool.size();
+                        m_pubPool.resize(at + pub.size());
+                        m_pubPool.resize(at + ConvertUtf8(pub.data(), pub.size(), &m_pubPool[at]));
+                        m_pubOffsets.push_back(uint32_t(m_pubPool.size()));
+                        row.publisher = uint16_t(PublisherCount());
+                        dictionary.emplace(pub, row.publisher);
+                    }
+                }
+                rows.push_back(row);
+            });
+            // Files are usually kept in ID order; otherwise sort, keeping equal IDs in line order.
+            auto before = [](const Row& a, const Row& b) { return a.key < b.key || (a.key == b.key && a.line < b.line); };
+            if (!std::is_sorted(rows.begin(), rows.end(), before)) std::sort(rows.begin(), rows.end(), before);
+            for (size_t i = 0; i < rows.size(); ++i) {
+                const Row& r = rows[i];
+                if (i + 1 < rows.size() && rows[i + 1].key == r.key) continue; // a later line wins
+                if (r.platform == Platform::Unknown && r.region == Region::Unknown && r.year == 0 && r.publisher == 0) continue;
+                m_keys.push_back(r.key);
+                m_platform.push_back(r.platform);
+                m_region.push_back(r.region);
+                m_year.push_back(r.year);
+                m_publisher.push_back(r.publisher);
+            }
+            m_keys.shrink_to_fit(); m_platform.shrink_to_fit(); m_region.shrink_to_fit();
+            m_year.shrink_to_fit(); m_publisher.shrink_to_fit();
+            m_pubPool.shrink_to_fit(); m_pubOffsets.shrink_to_fit();
+            return true;
+        }
+
+        // LoadUtf8 for a file the caller has not read: head(char* buf, size_t cap) reads its first
+        // cap bytes (fewer only at its end) and returns how many, and whole(load) reads all of it,
+        // calls load(const char* data, size_t n) and returns false if it cannot. Only a file whose
+        // head declares columns is read whole, so one without costs kDeclarationBytes.
+        template <class Head, class Whole>
+        bool LoadFile(Head&& head, Whole&& whole) {
+            *this = TitleMetaTable();
+            char buf[kDeclarationBytes];
+            if (!DeclaresColumns(buf, head(buf, sizeof(buf)))) return true;
+            bool ok = false;
+            return whole([&](const char* data, size_t n) { ok = LoadUtf8(data, n); }) && ok;
+        }
+
+        // Bring the table up to date after an incremental reload of its file (IncrementalTable::Load
+        // with records): each record replaces what the table held for its ID. Only the lines that
+        // changed are parsed, and the arrays are merged with the new rows in one pass. A publisher
+        // no title names any more keeps its place in the dictionary until the next LoadUtf8.
+        void Patch(std::vector<ReloadRecord> records) {
+            if (!m_columns || records.empty()) return;
+            std::sort(records.begin(), records.end(), [](const ReloadRecord& a, const ReloadRecord& b) { return a.key < b.key; });
+            struct Row { uint64_t key; Platform platform; Region region; uint16_t year; uint16_t publisher; };
+            std::vector<Row> rows;
+            std::unordered_map<std::u16string, uint16_t> dictionary; // filled at the first publisher column
+            std::u16string value;
+            for (const ReloadRecord& r : records) {
+                if (!r.present) continue;
+                Row row{ r.key, Platform::Unknown, Region::Unknown, 0, 0 };
+                std::string_view pub;
+                ParseColumns(r.columns, r.columnsLen, &row.platform, &row.region, &row.year, &pub);
+                if (!pub.empty()) {
+                    if (dictionary.empty()) {
+                        for (size_t i = 1; i <= PublisherCount(); ++i) {
+                            dictionary.emplace(m_pubPool.substr(m_pubOffsets[i - 1], m_pubOffsets[i] - m_pubOffsets[i - 1]), uint16_t(i));
+                        }
+                    }
+                    value.resize(pub.size());
+                    value.resize(ConvertUtf8(pub.data(), pub.size(), &value[0]));
+                    auto it = dictionary.find(value);
+                    if (it != dictionary.end()) {
+                        row.publisher = it->second;
+                    } else if (PublisherCount() < kMaxPublishers) {
+                        m_pubPool += value;
+                        m_pubOffsets.push_back(uint32_t(m_pubPool.size()));
+                        row.publisher = uint16_t(PublisherCount());
+                        dictionary.emplace(value, row.publisher);
+                    }
+                }
+                if (row.platform == Platform::Unknown && row.region == Region::Unknown && row.year == 0 && row.publisher == 0) continue;
+                rows.push_back(row);
+            }
+
+            TitleMetaTable next;
+            next.m_keys.reserve(m_keys.size() + rows.size());
+            next.m_platform.reserve(m_keys.size() + rows.size());
+            next.m_region.reserve(m_keys.size() + rows.size());
+            next.m_year.reserve(m_keys.size() + rows.size());
+            next.m_publisher.reserve(m_keys.size() + rows.size());
+            auto put = [&](uint64_t key, Platform platform, Region region, uint16_t year, uint16_t publisher) {
+                next.m_keys.push_back(key);
+                next.m_platform.push_back(platform);
+                next.m_region.push_back(region);
+                next.m_year.push_back(year);
+                next.m_publisher.push_back(publisher);
+            };
+            size_t r = 0, w = 0;
+            for (size_t i = 0; i < m_keys.size(); ++i) {
+                uint64_t key = m_keys[i];
+                for (; w < rows.size() && rows[w].key < key; ++w) put(rows[w].key, rows[w].platform, rows[w].region, rows[w].year, rows[w].publisher);
+                while (r < records.size() && records[r].key < key) ++r;
+                if (r < records.size() && records[r].key == key) continue; // replaced or gone
+                put(key, m_platform[i], m_region[i], m_year[i], m_publisher[i]);
+            }
+            for (; w < rows.size(); ++w) put(rows[w].key, rows[w].platform, rows[w].region, rows[w].year, rows[w].publisher);
+            m_keys.swap(next.m_keys);
+            m_platform.swap(next.m_platform);
+            m_region.swap(next.m_region);
+            m_year.swap(next.m_year);
+            m_publisher.swap(next.m_publisher);
+        }
+
+        // Everything known of key: its columns, if the file gave any, with the publisher its
+        // prefix names when no column did; nothing for a file without columns. Pointers are into
+        // this table (or static).
+        TitleMeta Describe(uint64_t key) const {
+            if (!m_columns) return TitleMeta();
+            auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key);
+            if (it == m_keys.end() || *it != key) return DefaultMeta(key);
+            size_t i = size_t(it - m_keys.begin());
+            TitleMeta m = m_publisher[i] ? TitleMeta() : DefaultMeta(key);
+            m.platform = m_platform[i];
+            m.region = m_region[i];
+            m.year = m_year[i];
+            if (uint16_t p = m_publisher[i]) {
+                m.publisher = m_pubPool.data() + m_pubOffsets[p - 1];
+                m.publisherLen = m_pubOffsets[p] - m_pubOffsets[p - 1];
+            }
+            return m;
+        }
+
+        // Heap bytes owned by the table.
+        size_t MemoryBytes() const {
+            return m_keys.capacity() * sizeof(uint64_t) + m_platform.capacity() + m_region.capacity() +
+                   m_year.capacity() * sizeof(uint16_t) + m_publisher.capacity() * sizeof(uint16_t) +
+                   m_pubPool.capacity() * sizeof(char16_t) + m_pubOffsets.capacity() * sizeof(uint32_t);
+        }
+
+        static constexpr size_t kMaxPublishers = 0xFFFF; // index 0 is "none"
+
+    private:
+        // Accepted spellings of the enum columns, lower case.
+        struct Spelling {
+            std::string_view text;
+            uint8_t value;
+        };
+        static constexpr Spelling kPlatforms[] = {
+            { "xbox", uint8_t(Platform::Xbox) },          { "original", uint8_t(Platform::Xbox) },
+            { "og", uint8_t(Platform::Xbox) },            { "360", uint8_t(Platform::Xbox360) },
+            { "xbox360", uint8_t(Platform::Xbox360) },    { "xbox 360", uint8_t(Platform::Xbox360) },
+            { "x360", uint8_t(Platform::Xbox360) },       { "one", uint8_t(Platform::XboxOne) },
+            { "xboxone", uint8_t(Platform::XboxOne) },    { "xbox one", uint8_t(Platform::XboxOne) },
+            { "xb1", uint8_t(Platform::XboxOne) },        { "series", uint8_t(Platform::XboxSeries) },
+            { "xboxseries", uint8_t(Platform::XboxSeries) }, { "xbox series", uint8_t(Platform::XboxSeries) },
+            { "xsx", uint8_t(Platform::XboxSeries) },     { "xss", uint8_t(Platform::XboxSeries) },
+            { "pc", uint8_t(Platform::PC) },              { "windows", uint8_t(Platform::PC) },
+        };
+        static constexpr Spelling kRegions[] = {
+            { "free", uint8_t(Region::RegionFree) }, { "world", uint8_t(Region::RegionFree) },
+            { "all", uint8_t(Region::RegionFree) },  { "region free", uint8_t(Region::RegionFree) },
+            { "ntsc-u", uint8_t(Region::NtscU) },    { "ntsc", uint8_t(Region::NtscU) },
+            { "us", uint8_t(Region::NtscU) },        { "na", uint8_t(Region::NtscU) },
+            { "usa", uint8_t(Region::NtscU) },       { "pal", uint8_t(Region::Pal) },
+            { "eu", uint8_t(Region::Pal) },          { "europe", uint8_t(Region::Pal) },
+            { "ntsc-j", uint8_t(Region::NtscJ) },    { "jp", uint8_t(Region::NtscJ) },
+            { "japan", uint8_t(Region::NtscJ) },     { "asia", uint8_t(Region::Asia) },
+        };
+
+        // The value a spelling of v (any case) stands for, or 0 (Unknown).
+        template <size_t N>
+        static uint8_t Match(std::string_view v, const Spelling (&spellings)[N]) {
+            char lower[16];
+            if (v.size() > sizeof(lower)) return 0;
+            for (size_t i = 0; i < v.size(); ++i) lower[i] = char(v[i] >= 'A' && v[i] <= 'Z' ? v[i] | 0x20 : v[i]);
+            std::string_view l(lower, v.size());
+            for (const Spelling& s : spellings) if (s.text == l) return s.value;
+            return 0;
+        }
+
+        static void ParseColumns(const char* p, size_t n, Platform* platform, Region* region, uint16_t* year, std::string_view* publisher) {
+            const char* end = p + n;
+            while (p < end) {
+                const char* eq = p + 1;
+                while (*eq != '=') ++eq; // p starts a column (IsColumnStart)
+                std::string_view key(p + 1, size_t(eq - p - 1));
+                const char* v = eq + 1;
+                const char* next = v;
+                for (;;) {
+                    next = static_cast<const char*>(std::memchr(next, '\t', size_t(end - next)));
+                    if (!next) { next = end; break; }
+                    if (IsColumnStart(next, end)) break;
+                    ++next;
+                }
+                const char* ve = next;
+                while (v < ve && (*v == ' ' || *v == '\t')) ++v;
+                while (ve > v && (ve[-1] == ' ' || ve[-1] == '\t')) --ve;
+                std::string_view value(v, size_t(ve - v));
+                if (key == "platform") {
+                    if (uint8_t m = Match(value, kPlatforms)) *platform = Platform(m);
+                } else if (key == "region") {
+                    if (uint8_t m = Match(value, kRegions)) *region = Region(m);
+                } else if (key == "year") {
+                    unsigned y = 0;
+                    size_t i = 0;
+                    while (i < value.size() && i < 5 && value[i] >= '0' && value[i] <= '9') y = y * 10 + unsigned(value[i++] - '0');
+                    if (i == value.size() && y >= 1970 && y <= 9999) *year = uint16_t(y);
+                } else if (key == "publisher") {
+                    *publisher = value;
+                }
+                p = next;
+            }
+        }
+
+        std::vector<uint64_t> m_keys; // ascending; the columns below run parallel to it
+        std::vector<Platform> m_platform;
+        std::vector<Region> m_region;
+        std::vector<uint16_t> m_year;
+        std::vector<uint16_t> m_publisher;  // 1-based index into the dictionary; 0 = by prefix
+        std::u16string m_pubPool;           // dictionary: every distinct publisher name once
+        std::vector<uint32_t> m_pubOffsets; // publisher i is m_pubPool[m_pubOffsets[i - 1], m_pubOffsets[i])
+        bool m_columns = false;             // see HasColumns
+    };
+
+    // The tooltip of a title: its name, then a line (after CRLF) for each known detail, e.g.
+    //   Halo 2
+    //   Platform: Xbox
+    //   Publisher: Microsoft
+    //   Region: NTSC-U
+    //   Released: 2004
+    // Writes to out unless it is nullptr, and returns the length either way (no terminator), so a
+    // caller can size the buffer first and format straight into it.
+    template <class CharT>
+    size_t FormatTitleTip(const char16_t* name, size_t len, const TitleMeta& meta, CharT* out) {
+        size_t n = 0;
+        auto put = [&](const char16_t* s, size_t k) {
+            if (out) {
+                if constexpr (sizeof(CharT) == sizeof(char16_t)) std::memcpy(out + n, s, k * sizeof(char16_t));
+                else for (size_t i = 0; i < k; ++i) out[n + i] = CharT(s[i]);
+            }
+            n += k;
+        };
+        auto line = [&](std::u16string_view label, std::u16string_view s) {
+            put(label.data(), label.size());
+            put(s.data(), s.size());
+        };
+        put(name, len);
+        if (meta.platform != Platform::Unknown) line(u"\r\nPlatform: ", PlatformName(meta.platform));
+        if (meta.publisher) line(u"\r\nPublisher: ", { meta.publisher, meta.publisherLen });
+        if (meta.region != Region::Unknown) line(u"\r\nRegion: ", RegionName(meta.region));
+        if (meta.year) {
+            char16_t digits[4] = { char16_t(u'0' + meta.year / 1000 % 10), char16_t(u'0' + meta.year / 100 % 10),
+                                   char16_t(u'0' + meta.year / 10 % 10), char16_t(u'0' + meta.year % 10) };
+            line(u"\r\nReleased: ", { digits, 4 });
+        }
+        return n;
+    }
+
+} // namespace titledb
@@ -0,0 +1,370 @@
+// TitleReload.h – reload a mapping file by applying only what changed since the last load.
+// The file is cut into blocks at line boundaries chosen by content (a line whose leading bytes
+// hash to 0 mod kBlockMod may end a block), so an edit changes only the blocks it touches and the
+// blocks around it keep their boundaries. Each block's byte hash and the IDs it names are kept.
+// On reload, old blocks are first matched in place from the start of the file and at the same
+// distance from its end; only the bytes between are re-cut, matched against the remaining old
+// blocks by hash (so moved blocks are not re-read) and parsed where they are new. A file that
+// only grew is the case where nothing is left after the tail. Only IDs named by replaced or new
+// blocks are re-resolved (last occurrence in the file wins, as in LoadUtf8) and patched into the
+// table. Reload cost is one hash pass over the bytes plus work proportional to the change.
+// Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace titledb {
+
+    struct ReloadStats {
+        enum Kind { Full, Append, Diff, Unchanged };
+        Kind kind = Full;
+        size_t blocks = 0;       // blocks in the new file
+        size_t blocksParsed = 0; // of which parsed for this reload
+        size_t inserted = 0, updated = 0, deleted = 0;
+
+        size_t Touched() const { return inserted + updated + deleted; }
+        const char* KindName() const {
+            static const char* const kNames[] = { "full", "append", "diff", "unchanged" };
+            return kNames[kind];
+        }
+    };
+
+    // An ID an incremental reload re-resolved, with the columns of the line that now names it (see
+    // ParseMappingRecords; pointers into the loaded bytes). present is false when the ID is gone.
+    struct ReloadRecord {
+        uint64_t key;
+        const char* columns;
+        size_t columnsLen;
+        bool present;
+    };
+
+    // Byte hash for block contents, also used to recognise the source of the built-in list (only
+    // compared with values from the same source tree, never stored in files). Four independent
+    // 8-byte lanes keep the multiplies off one dependency chain, so hashing runs near memory speed.
+    inline uint64_t HashBlock(const char* p, size_t n) {
+        const uint64_t k = 0x9E3779B97F4A7C15ULL, m = 0xBF58476D1CE4E5B9ULL;
+        uint64_t h[4] = { k ^ n, k + 1, k + 2, k + 3 }, w;
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            for (int l = 0; l < 4; ++l) {
+                std::memcpy(&w, p + i + 8 * l, 8);
+                h[l] = (h[l] ^ w) * m;
+                h[l] ^= h[l] >> 31;
+            }
+        }
+        for (; i + 8 <= n; i += 8) {
+            std::memcpy(&w, p + i, 8);
+            h[0] = (h[0] ^ w) * m;
+            h[0] ^= h[0] >> 31;
+        }
+        w = 0;
+        if (i < n) std::memcpy(&w, p + i, n - i);
+        uint64_t r = (h[0] ^ w) * k;
+        for (int l = 1; l < 4; ++l) r = (r ^ h[l]) * m;
+        return r ^ (r >> 29);
+    }
+
+    // A TitleTable plus what is needed to bring it up to date with the next version of its file.
+    // Copyable: copy the current generation, Load the new bytes into the copy, publish the copy.
+    class IncrementalTable {
+    public:
+        size_t Size() const { return m_table.Size(); }
+        const TitleTable& Table() const { return m_table; }
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const { return m_table.Find(key, name, len); }
+        template <class Fn>
+        void ForEach(Fn&& fn) const { m_table.ForEach(fn); }
+        const char16_t* NameData() const { return m_table.NameData(); }
+        size_t MemoryBytes() const {
+            return m_table.MemoryBytes() + m_blocks.capacity() * sizeof(Block) + m_keys.capacity() * sizeof(uint64_t);
+        }
+
+        // Whether the last Load left every entry it did not report in place in the name arena,
+        // so a LayeredTable can take the new table with UpdateLayer(changed keys).
+        bool OffsetsStable() const { return m_stable; }
+
+        // Bring the table in line with the file bytes. Same result as TitleTable::LoadUtf8,
+        // including an empty table for invalid UTF-8 (returns false). When given, *changed
+        // receives the IDs whose entry was inserted, updated or deleted, and *records every ID the
+        // reload re-resolved, whether or not its name changed, so the file's other contents (its
+        // columns) can be patched the same way (both empty after a Full load).
+        bool Load(const char* data, size_t n, ReloadStats* stats = nullptr, std::vector<uint64_t>* changed = nullptr,
+                  std::vector<ReloadRecord>* records = nullptr) {
+            ReloadStats st;
+            if (changed) changed->clear();
+            if (records) records->clear();
+            bool ok = m_valid && Incremental(data, n, st, changed, records);
+            if (!ok) {
+                if (changed) changed->clear();
+                if (records) records->clear();
+                st = ReloadStats();
+                ok = LoadFull(data, n, st);
+            }
+            if (stats) *stats = st;
+            return ok;
+        }
+
+    private:
+        struct Block {
+            uint64_t start, end; // byte range, whole lines
+            uint64_t hash;       // HashBlock of the range
+            uint32_t firstKey;   // keys named by the block, in order: m_keys[firstKey, +keyCount)
+            uint32_t keyCount;
+        };
+
+        // A block may end after a line whose first bytes hash to 0 mod kBlockMod, once it has
+        // kMinLines lines, and always ends at kMaxLines: about 80 lines (3 KB) on average.
+        static constexpr uint64_t kBlockMod = 64;
+        static constexpr size_t kMinLines = 16, kMaxLines = 512;
+        // Past this share of parsed blocks a full load is cheaper than patching.
+        static constexpr size_t kDiffLimitPercent = 25;
+
+        static bool EndsBlock(const char* line, size_t len) {
+            uint64_t v = 0;
+            std::memcpy(&v, line, len < 8 ? len : 8);
+            return ((v * 0x9E3779B97F4A7C15ULL) >> 58) % kBlockMod == 0;
+        }
+
+        // Cut [from, n) into blocks (hashes filled, keys not).
+        static void Chunk(const char* data, size_t from, size_t n, std::vector<Block>& out) {
+            size_t i = from, start = from, lines = 0;
+            while (i < n) {
+                size_t ls = i;
+                i = FindEither(data, i, n, '\n', '\r');
+                if (i < n && data[i] == '\r') ++i;
+                if (i < n && data[i] == '\n') ++i;
+                ++lines;
+                if ((lines >= kMinLines && EndsBlock(data + ls, i - ls)) || lines >= kMaxLines || i == n) {
+                    out.push_back({ start, i, HashBlock(data + start, i - start), 0, 0 });
+                    start = i;
+                    lines = 0;
+                }
+            }
+        }
+
+        void Reset() {
+            m_table.Clear();
+            m_blocks.clear();
+            m_keys.clear();
+            m_valid = false;
+        }
+
+        bool LoadFull(const char* data, size_t n, ReloadStats& st) {
+            Reset();
+            m_stable = false;
+            st.kind = ReloadStats::Full;
+            // Blocks first, so each key can be dealt to its block as the record is parsed.
+            Chunk(data, 0, n, m_blocks);
+            m_columns = DeclaresColumns(data, n);
+            size_t b = 0;
+            bool ok = m_table.LoadUtf8(data, n, [&](uint64_t key, const char* name, size_t) {
+                while (m_blocks[b].end <= uint64_t(name - data)) m_blocks[++b].firstKey = static_cast<uint32_t>(m_keys.size());
+                m_keys.push_back(key);
+            });
+            if (!ok) {
+                Reset();
+                return false;
+            }
+            for (++b; b < m_blocks.size(); ++b) m_blocks[b].firstKey = static_cast<uint32_t>(m_keys.size());
+            for (size_t i = 0; i < m_blocks.size(); ++i) {
+                uint32_t next = i + 1 < m_blocks.size() ? m_blocks[i + 1].firstKey : static_cast<uint32_t>(m_keys.size());
+                m_blocks[i].keyCount = next - m_blocks[i].firstKey;
+            }
+            m_keys.shrink_to_fit();
+            st.blocks = st.blocksParsed = m_blocks.size();
+            st.inserted = m_table.Size();
+            m_valid = true;
+            return true;
+        }
+
+        bool Incremental(const char* data, size_t n, ReloadStats& st, std::vector<uint64_t>* changed,
+                         std::vector<ReloadRecord>* records) {
+            if (DeclaresColumns(data, n) != m_columns) return false; // every name may change
+            const size_t oldCount = m_blocks.size();
+            const size_t oldN = oldCount ? (size_t)m_blocks.back().end : 0;
+            auto afterBreak = [&](size_t at) { return data[at - 1] == '\n' || data[at - 1] == '\r'; };
+            auto sameAt = [&](const Block& b, size_t start) {
+                size_t len = (size_t)(b.end - b.start);
+                return start + len <= n && HashBlock(data + start, len) == b.hash;
+            };
+
+            // Head: old blocks unchanged in place. Each must end in a line break, or its last line
+            // may continue in the new file.
+            size_t head = 0;
+            while (head < oldCount && sameAt(m_blocks[head], (size_t)m_blocks[head].start) && afterBreak((size_t)m_blocks[head].end)) ++head;
+            const size_t headEnd = head ? (size_t)m_blocks[head - 1].end : 0;
+            // Tail: old blocks unchanged at the same distance from the end, starting on a new line.
+            size_t tail = 0;
+            while (tail < oldCount - head) {
+                const Block& b = m_blocks[oldCount - 1 - tail];
+                if (n + b.start < oldN) break;
+                size_t start = (size_t)(n + b.start - oldN);
+                if (start < headEnd || (start ? !afterBreak(start) : b.start != 0) || !sameAt(b, start)) break;
+                ++tail;
+            }
+            const size_t tailStart = tail ? (size_t)(n + m_blocks[oldCount - tail].start - oldN) : n;
+            const size_t oldMid = head, oldMidEnd = oldCount - tail; // old blocks replaced: [oldMid, oldMidEnd)
+
+            st.blocks = oldCount;
+            if (oldMid == oldMidEnd && headEnd == tailStart) {
+                st.kind = ReloadStats::Unchanged;
+                m_stable = true;
+                return true;
+            }
+            st.kind = tail == 0 && head + 1 >= oldCount && n >= oldN ? ReloadStats::Append : ReloadStats::Diff;
+
+            // Re-cut the middle and match it against the replaced old blocks, in order, so
+            // blocks that only moved keep their relative order and their last-wins decisions.
+            std::vector<Block> mid;
+            Chunk(data, headEnd, tailStart, mid);
+            std::unordered_multimap<uint64_t, size_t> byHash;
+            byHash.reserve(oldMidEnd - oldMid);
+            for (size_t i = oldMid; i < oldMidEnd; ++i) byHash.emplace(m_blocks[i].hash, i);
+            std::vector<size_t> matchOf(mid.size(), SIZE_MAX);
+            std::vector<char> used(oldMidEnd - oldMid, 0);
+            size_t next = oldMid, fresh = 0;
+            for (size_t b = 0; b < mid.size(); ++b) {
+                size_t match = SIZE_MAX;
+                auto range = byHash.equal_range(mid[b].hash);
+                for (auto it = range.first; it != range.second; ++it) {
+                    const Block& o = m_blocks[it->second];
+                    if (it->second >= next && it->second < match && o.end - o.start == mid[b].end - mid[b].start) match = it->second;
+                }
+                if (match == SIZE_MAX) {
+                    if (!IsValidUtf8(data + mid[b].start, (size_t)(mid[b].end - mid[b].start))) return false;
+                    ++fresh;
+                    continue;
+                }
+                matchOf[b] = match;
+                used[match - oldMid] = 1;
+                next = match + 1;
+            }
+            const size_t total = head + mid.size() + tail;
+            if (fresh * 100 > total * kDiffLimitPercent) return false;
+
+            // IDs whose entry may change: those named by replaced old blocks and by new ones.
+            // Value: the block holding the last occurrence in the new file, -1 until found.
+            std::unordered_map<uint64_t, int64_t> affected;
+            for (size_t i = oldMid; i < oldMidEnd; ++i) {
+                if (used[i - oldMid]) continue;
+                const Block& b = m_blocks[i];
+                for (uint32_t k = 0; k < b.keyCount; ++k) affected.emplace(m_keys[b.firstKey + k], -1);
+            }
+
+            // New key lists in block order: head kept in place, then the middle (carried over or
+            // parsed), then the tail moved by the size change.
+            const size_t headKeys = oldMid < oldCount ? m_blocks[oldMid].firstKey : m_keys.size();
+            const size_t tailKeys = tail ? m_blocks[oldMidEnd].firstKey : m_keys.size();
+            std::vector<uint64_t> midKeys;
+            for (size_t b = 0; b < mid.size(); ++b) {
+                Block& blk = mid[b];
+                blk.firstKey = static_cast<uint32_t>(headKeys + midKeys.size());
+                if (matchOf[b] != SIZE_MAX) {
+                    const Block& o = m_blocks[matchOf[b]];
+                    midKeys.insert(midKeys.end(), m_keys.begin() + o.firstKey, m_keys.begin() + o.firstKey + o.keyCount);
+                } else {
+                    ParseMappingRange(data, (size_t)blk.start, (size_t)blk.end, m_columns, [&](uint64_t key, const char*, size_t) {
+                        midKeys.push_back(key);
+                        affected.emplace(key, -1);
+                    });
+                }
+                blk.keyCount = static_cast<uint32_t>(headKeys + midKeys.size() - blk.firstKey);
+            }
+            std::vector<uint64_t> tailKeyList(m_keys.begin() + tailKeys, m_keys.end());
+            std::vector<Block> tailBlocks(m_blocks.begin() + oldMidEnd, m_blocks.end());
+            m_keys.resize(headKeys);
+            m_keys.insert(m_keys.end(), midKeys.begin(), midKeys.end());
+            m_blocks.resize(head);
+            m_blocks.insert(m_blocks.end(), mid.begin(), mid.end());
+            const size_t tailBase = m_keys.size();
+            m_keys.insert(m_keys.end(), tailKeyList.begin(), tailKeyList.end());
+            for (Block b : tailBlocks) {
+                b.start = b.start + n - oldN;
+                b.end = b.end + n - oldN;
+                b.firstKey = static_cast<uint32_t>(tailBase + b.firstKey - tailKeys);
+                m_blocks.push_back(b);
+            }
+            st.blocks = m_blocks.size();
+            st.blocksParsed = fresh;
+
+            Apply(data, affected, st, changed, records);
+            m_stable = true;
+            if (m_table.GarbageChars() * 2 > m_table.NameChars()) {
+                m_table.ShrinkToFit();
+                m_stable = false;
+            }
+            return true;
+        }
+
+        // Find the winning name of every affected ID and patch the table: walk blocks from the
+        // end until each has been seen (a filter skips the map for unaffected IDs), then parse
+        // each winning block once to pick up its names.
+        void Apply(const char* data, std::unordered_map<uint64_t, int64_t>& affected, ReloadStats& st, std::vector<uint64_t>* changed,
+                   std::vector<ReloadRecord>* records) {
+            KeyFilter filter;
+            filter.Reset(affected.size());
+            for (const auto& kv : affected) filter.Add(kv.first);
+            size_t unresolved = affected.size();
+            for (size_t b = m_blocks.size(); b-- > 0 && unresolved;) {
+                const Block& blk = m_blocks[b];
+                for (uint32_t k = blk.keyCount; k-- > 0;) {
+                    uint64_t key = m_keys[blk.firstKey + k];
+                    if (!filter.MayContain(key)) continue;
+                    auto it = affected.find(key);
+                    if (it != affected.end() && it->second < 0) { it->second = int64_t(b); --unresolved; }
+                }
+            }
+
+            std::vector<std::pair<int64_t, uint64_t>> order; // (winning block, key); -1 first = gone
+            order.reserve(affected.size());
+            for (const auto& kv : affected) order.emplace_back(kv.second, kv.first);
+            std::sort(order.begin(), order.end());
+            size_t pos = 0;
+            for (; pos < order.size() && order[pos].first < 0; ++pos) {
+                if (records) records->push_back({ order[pos].second, nullptr, 0, false });
+                if (!m_table.Erase(order[pos].second)) continue;
+                ++st.deleted;
+                if (changed) changed->push_back(order[pos].second);
+            }
+            struct Line { const char* name; size_t len; const char* columns; size_t columnsLen; };
+            std::unordered_map<uint64_t, Line> names;
+            std::u16string wide;
+            while (pos < order.size()) {
+                const Block& blk = m_blocks[(size_t)order[pos].first];
+                size_t end = pos;
+                names.clear();
+                while (end < order.size() && order[end].first == order[pos].first) names.emplace(order[end++].second, Line{});
+                ParseMappingRecords(data, (size_t)blk.start, (size_t)blk.end, m_columns,
+                                    [&](uint64_t key, const char* name, size_t len, const char* columns, size_t columnsLen) {
+                    auto it = names.find(key);
+                    if (it != names.end()) it->second = { name, len, columns, columnsLen };
+                });
+                for (; pos < end; ++pos) {
+                    uint64_t key = order[pos].second;
+                    const Line& utf8 = names[key];
+                    if (records) records->push_back({ key, utf8.columns, utf8.columnsLen, true });
+                    wide.resize(utf8.len);
+                    wide.resize(ConvertUtf8(utf8.name, utf8.len, &wide[0]));
+                    const char16_t* old; size_t oldLen;
+                    bool had = m_table.Find(key, &old, &oldLen);
+                    if (had && wide.compare(0, wide.size(), old, oldLen) == 0) continue;
+                    m_table.Set(key, wide.data(), wide.size());
+                    ++(had ? st.updated : st.inserted);
+                    if (changed) changed->push_back(key);
+                }
+            }
+        }
+
+        TitleTable m_table;
+        std::vector<Block> m_blocks;
+        std::vector<uint64_t> m_keys;
+        bool m_valid = false;  // m_blocks/m_keys describe a successfully loaded file
+        bool m_stable = false; // see OffsetsStable
+        bool m_columns = false; // the file declares columns (DeclaresColumns), so names end at the first
+    };
+
+} // namespace titledb
@@ -0,0 +1,160 @@
+// TitleScan.h – find title IDs inside longer folder names and paths.
+// A candidate is a run of exactly 8 hex digits with a delimiter (or the end of the text) on each
+// side, as in `Halo 2 [4D530064]`, `4D530064_backup` or `Content\4D530064\000D0000`. The text is
+// classified 64 characters at a time into a bit mask of hex digits (SSE2 when available, 16
+// characters per compare, UTF-16 narrowed with a saturating pack), and runs are read off the
+// mask with bit scans, so an ordinary name costs a few compares per 16 characters and only the
+// edges of 8-digit runs are looked at one by one. Delimiters are a configurable ASCII set; path
+// separators always count. When a name holds several candidates, a policy picks among those
+// the database knows. Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace titledb {
+
+    class TitleScanner {
+    public:
+        // Which candidate a name stands for when several are known:
+        //   LastKnown  - the rightmost (in a path, the one nearest the item).
+        //   FirstKnown - the leftmost.
+        //   OnlyKnown  - none unless exactly one distinct known ID is named.
+        enum Policy { LastKnown, FirstKnown, OnlyKnown };
+
+        static constexpr const char* kDefaultDelimiters = " _-.,;+#~[](){}";
+
+        explicit TitleScanner(std::string_view delimiters = kDefaultDelimiters, Policy policy = LastKnown) {
+            SetDelimiters(delimiters);
+            m_policy = policy;
+        }
+
+        // ASCII characters that may border an ID; others are ignored. '\' and '/' are always in.
+        void SetDelimiters(std::string_view delimiters) {
+            m_delims[0] = m_delims[1] = 0;
+            for (char c : delimiters) Add(static_cast<unsigned char>(c));
+            Add('\\');
+            Add('/');
+        }
+
+        void SetPolicy(Policy policy) { m_policy = policy; }
+        Policy GetPolicy() const { return m_policy; }
+
+        template <class CharT>
+        bool IsDelimiter(CharT c) const {
+            auto u = static_cast<uint32_t>(c);
+            return u < 128 && ((m_delims[u >> 6] >> (u & 63)) & 1);
+        }
+
+        // Call fn(uint64_t key, size_t pos) for every candidate, left to right, with the packed ID
+        // (see PackTitleId) and where it starts; stops early when fn returns false. simd = false
+        // classifies with the plain loop (for comparison).
+        template <class CharT, class Fn>
+        void ForEachCandidate(const CharT* s, size_t n, Fn&& fn, bool simd = true) const {
+            size_t runStart = SIZE_MAX; // start of the hex run in progress
+            auto run = [&](size_t begin, size_t end) {
+                uint64_t key;
+                if (end - begin != 8) return true;
+                if (begin > 0 && !IsDelimiter(s[begin - 1])) return true;
+                if (end < n && !IsDelimiter(s[end])) return true;
+                return !PackTitleId(s + begin, 8, &key) || fn(key, begin);
+            };
+            for (size_t base = 0; base < n; base += 64) {
+                size_t width = n - base < 64 ? n - base : 64;
+                uint64_t m = HexMask(s + base, width, simd);
+                size_t i = 0;
+                while (i < width) {
+                    if (runStart == SIZE_MAX) {
+                        uint64_t rest = m >> i;
+                        if (!rest) break;
+                        i += LowestBit64(rest);
+                        runStart = base + i;
+                    }
+                    uint64_t rest = ~m >> i;
+                    if (!rest) break; // the run goes on into the next 64 characters
+                    i += LowestBit64(rest);
+                    if (!run(runStart, base + i)) return;
+                    runStart = SIZE_MAX;
+                }
+            }
+            if (runStart != SIZE_MAX) run(runStart, n);
+        }
+
+        // The candidate the policy picks among those for which known(key) is true. Each candidate
+        // is checked once, in the same left-to-right pass.
+        template <class CharT, class Known>
+        bool Find(const CharT* s, size_t n, Known&& known, uint64_t* key, size_t* pos = nullptr) const {
+            bool found = false, ambiguous = false;
+            ForEachCandidate(s, n, [&](uint64_t k, size_t at) {
+                if (found && m_policy == OnlyKnown && k == *key) return true;
+                if (!known(k)) return true;
+                if (found && m_policy == OnlyKnown) { ambiguous = true; return false; }
+                found = true;
+                *key = k;
+                if (pos) *pos = at;
+                return m_policy != FirstKnown;
+            });
+            return found && !ambiguous;
+        }
+
+        // Bit i set iff s[i] is an ASCII hex digit, for i < n <= 64.
+        template <class CharT>
+        static uint64_t HexMask(const CharT* s, size_t n, bool simd = true) {
+            uint64_t m = 0;
+            size_t i = 0;
+#if defined(TITLEDB_AVX2) || defined(TITLEDB_SSE2)
+            if constexpr (sizeof(CharT) <= 2) {
+                if (simd) for (; i + 16 <= n; i += 16) m |= uint64_t(HexMask16(s + i)) << i;
+            }
+#else
+            (void)simd;
+#endif
+            for (; i < n; ++i) {
+                auto c = static_cast<uint32_t>(s[i]);
+                uint32_t lower = c | 0x20;
+                if ((c >= '0' && c <= '9') || (lower >= 'a' && lower <= 'f')) m |= uint64_t(1) << i;
+            }
+            return m;
+        }
+
+    private:
+        void Add(unsigned char c) {
+            if (c < 128) m_delims[c >> 6] |= uint64_t(1) << (c & 63);
+        }
+
+        static unsigned LowestBit64(uint64_t m) {
+#if defined(_MSC_VER)
+            unsigned long i; _BitScanForward64(&i, m); return static_cast<unsigned>(i);
+#else
+            return static_cast<unsigned>(__builtin_ctzll(m));
+#endif
+        }
+
+#if defined(TITLEDB_AVX2) || defined(TITLEDB_SSE2)
+        // Sixteen characters: bytes as they are, UTF-16 units packed to bytes (saturating, so
+        // nothing above 0xFF lands on a digit). Signed compares: bytes >= 0x80 are never digits.
+        template <class CharT>
+        static uint32_t HexMask16(const CharT* p) {
+            __m128i v;
+            if constexpr (sizeof(CharT) == 1) {
+                v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            } else {
+                __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8));
+                v = _mm_packus_epi16(lo, hi);
+            }
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+            __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(digit, alpha)));
+        }
+#endif
+
+        uint64_t m_delims[2] = {};
+        Policy m_policy = LastKnown;
+    };
+
+} // namespace titledb
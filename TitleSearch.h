@@ -0,0 +1,245 @@
+// TitleSearch.h – find titles by name: ranked prefix and substring search returning IDs.
+// The index is built on the first query from any table with Find/ForEach (TitleTable, IndexView,
+// LayeredTable...). Titles are numbered in case-folded name order; a prefix query is a binary
+// search over that order, and a substring query intersects the two rarest of its trigram posting
+// lists (delta-coded title numbers) and checks each candidate's name. Because posting lists are
+// in name order, the first `limit` confirmed candidates are already the best ranked ones, so a
+// query stops early however common its words are. Besides the table's own names the index costs
+// one ID per title plus a few bytes per distinct trigram of each name. Platform-independent.
+
+#pragma once
+
+#include "TitleDb.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace titledb {
+
+    // Simple case folding for search: ASCII, Latin-1, Latin Extended-A, Greek, Cyrillic and
+    // fullwidth Latin letters map to lower case; everything else is left alone.
+    inline char16_t FoldChar(char16_t c) {
+        if (c < 0x80) return c >= u'A' && c <= u'Z' ? char16_t(c + 32) : c;
+        if (c >= 0xC0 && c <= 0xDE && c != 0xD7) return char16_t(c + 32);
+        if ((c >= 0x100 && c <= 0x137) || (c >= 0x14A && c <= 0x177)) return char16_t(c | 1);
+        if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17E)) return (c & 1) ? char16_t(c + 1) : c;
+        if (c >= 0x391 && c <= 0x3AB && c != 0x3A2) return char16_t(c + 32);
+        if (c >= 0x410 && c <= 0x42F) return char16_t(c + 32);
+        if (c >= 0x400 && c <= 0x40F) return char16_t(c + 80);
+        if (c >= 0xFF21 && c <= 0xFF3A) return char16_t(c + 32);
+        return c;
+    }
+
+    inline void FoldName(const char16_t* s, size_t n, std::u16string& out) {
+        out.resize(n);
+        for (size_t i = 0; i < n; ++i) out[i] = FoldChar(s[i]);
+    }
+
+    struct SearchHit {
+        enum Match { Exact, Prefix, Substring };
+        uint64_t key = 0;
+        const char16_t* name = nullptr;
+        size_t nameLen = 0;
+        Match match = Substring;
+    };
+
+    // Name search over `table`, which must outlive the search and not change while it is used.
+    template <class Table>
+    class NameSearch {
+    public:
+        explicit NameSearch(const Table& table) : m_table(table) {}
+        NameSearch(const NameSearch&) = delete;
+        NameSearch& operator=(const NameSearch&) = delete;
+
+        // Up to `limit` titles whose name contains `query` ignoring case, best first: names equal
+        // to it, then names starting with it, then names containing it elsewhere; each group in
+        // folded name order, then by ID. A query shorter than three characters only matches
+        // prefixes. Safe to call from several threads; the first call builds the index.
+        std::vector<SearchHit> Search(const char16_t* query, size_t n, size_t limit) const {
+            Build();
+            std::vector<SearchHit> hits;
+            if (n == 0 || limit == 0) return hits;
+            std::u16string q, folded;
+            FoldName(query, n, q);
+
+            // Names starting with q form one run of m_order; equal names come first in it.
+            size_t lo = 0, hi = m_order.size();
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (CompareFolded(mid, q, folded) < 0) lo = mid + 1; else hi = mid;
+            }
+            for (size_t i = lo; i < m_order.size() && hits.size() < limit; ++i) {
+                SearchHit h = Hit(i);
+                FoldName(h.name, h.nameLen, folded);
+                if (folded.compare(0, q.size(), q) != 0) break;
+                h.match = folded.size() == q.size() ? SearchHit::Exact : SearchHit::Prefix;
+                hits.push_back(h);
+            }
+            if (hits.size() >= limit || q.size() < 3) return hits;
+
+            // Substring matches elsewhere in the name, from the two rarest trigrams of q.
+            const Gram* rare[2] = { nullptr, nullptr };
+            for (size_t i = 0; i + 3 <= q.size(); ++i) {
+                const Gram* g = FindGram(Trigram(&q[i]));
+                if (!g) return hits;
+                if (!rare[0] || g->count < rare[0]->count) { rare[1] = rare[0]; rare[0] = g; }
+                else if (g != rare[0] && (!rare[1] || g->count < rare[1]->count)) rare[1] = g;
+            }
+            Cursor a(m_postings.data(), *rare[0]), b(m_postings.data(), rare[1] ? *rare[1] : *rare[0]);
+            while (hits.size() < limit && a.Next()) {
+                while (b.id < a.id || !b.started) if (!b.Next()) return hits;
+                if (b.id != a.id) continue;
+                SearchHit h = Hit(a.id);
+                FoldName(h.name, h.nameLen, folded);
+                if (folded.compare(0, q.size(), q) == 0 || folded.find(q, 1) == std::u16string::npos) continue; // prefixes came first
+                h.match = SearchHit::Substring;
+                hits.push_back(h);
+            }
+            return hits;
+        }
+
+        // Build the index now instead of on the first query.
+        void Build() const { std::call_once(m_once, [this] { BuildIndex(); }); }
+
+        // Heap bytes of the index (the names stay in the table).
+        size_t MemoryBytes() const {
+            return m_order.capacity() * sizeof(uint64_t) + m_grams.capacity() * sizeof(Gram) + m_postings.capacity();
+        }
+
+    private:
+        struct Gram {
+            uint64_t gram;   // three folded UTF-16 units
+            uint32_t offset; // into m_postings
+            uint32_t count;  // titles in the list
+        };
+
+        // Walks one posting list: title numbers as LEB128 deltas (the first one absolute).
+        struct Cursor {
+            const uint8_t* p;
+            uint32_t left, id = 0;
+            bool started = false;
+            Cursor(const uint8_t* base, const Gram& g) : p(base + g.offset), left(g.count) {}
+            bool Next() {
+                if (left == 0) return false;
+                --left;
+                uint32_t v = 0;
+                for (int shift = 0;; shift += 7) {
+                    uint8_t b = *p++;
+                    v |= uint32_t(b & 0x7F) << shift;
+                    if (!(b & 0x80)) break;
+                }
+                id = started ? id + v : v;
+                started = true;
+                return true;
+            }
+        };
+
+        static uint64_t Trigram(const char16_t* s) {
+            return (uint64_t(s[0]) << 32) | (uint64_t(s[1]) << 16) | uint64_t(s[2]);
+        }
+
+        SearchHit Hit(size_t i) const {
+            SearchHit h;
+            h.key = m_order[i];
+            if (!m_table.Find(h.key, &h.name, &h.nameLen)) { h.name = u""; h.nameLen = 0; }
+            return h;
+        }
+
+        int CompareFolded(size_t i, const std::u16string& q, std::u16string& scratch) const {
+            SearchHit h = Hit(i);
+            FoldName(h.name, h.nameLen, scratch);
+            return scratch.compare(q);
+        }
+
+        const Gram* FindGram(uint64_t gram) const {
+            auto it = std::lower_bound(m_grams.begin(), m_grams.end(), gram, [](const Gram& g, uint64_t v) { return g.gram < v; });
+            return it != m_grams.end() && it->gram == gram ? &*it : nullptr;
+        }
+
+        void BuildIndex() const {
+            // Folded names in one temporary arena, sorted to number the titles.
+            // The first eight units are packed into `head`, so most comparisons stay in the entry.
+            struct Entry { uint64_t head[2], key; uint32_t offset, length; };
+            std::vector<Entry> entries;
+            entries.reserve(m_table.Size());
+            std::u16string arena, folded;
+            m_table.ForEach([&](uint64_t key, const char16_t* name, size_t len) {
+                FoldName(name, len, folded);
+                Entry e{ { 0, 0 }, key, static_cast<uint32_t>(arena.size()), static_cast<uint32_t>(len) };
+                for (size_t i = 0; i < 8; ++i) e.head[i / 4] = (e.head[i / 4] << 16) | (i < len ? folded[i] : 0);
+                entries.push_back(e);
+                arena += folded;
+            });
+            std::sort(entries.begin(), entries.end(), [&](const Entry& a, const Entry& b) {
+                if (a.head[0] != b.head[0]) return a.head[0] < b.head[0];
+                if (a.head[1] != b.head[1]) return a.head[1] < b.head[1];
+                int c = std::u16string_view(arena).substr(a.offset, a.length).compare(std::u16string_view(arena).substr(b.offset, b.length));
+                return c != 0 ? c < 0 : a.key < b.key;
+            });
+            m_order.resize(entries.size());
+            for (size_t i = 0; i < entries.size(); ++i) m_order[i] = entries[i].key;
+
+            // One posting list per trigram, each title listed once, in title order. Two passes over
+            // the names: the first sizes every list, the second writes it in place. Grams are
+            // found through a linear-probing table of indexes into m_grams.
+            struct Pending { uint32_t last, bytes; };
+            std::vector<Pending> pending;
+            std::vector<uint32_t> slots(1024, UINT32_MAX);
+            auto slotOf = [&](uint64_t gram) -> uint32_t& {
+                size_t mask = slots.size() - 1, i = size_t((gram * 0x9E3779B97F4A7C15ULL) >> 40) & mask;
+                while (slots[i] != UINT32_MAX && m_grams[slots[i]].gram != gram) i = (i + 1) & mask;
+                return slots[i];
+            };
+            for (int pass = 0; pass < 2; ++pass) {
+                for (uint32_t id = 0; id < entries.size(); ++id) {
+                    const char16_t* s = arena.data() + entries[id].offset;
+                    for (size_t i = 0; i + 3 <= entries[id].length; ++i) {
+                        uint64_t g = Trigram(s + i);
+                        uint32_t& slot = slotOf(g);
+                        uint32_t k = slot;
+                        if (k == UINT32_MAX) {
+                            k = slot = static_cast<uint32_t>(m_grams.size());
+                            m_grams.push_back({ g, 0, 0 });
+                            pending.push_back({ 0, 0 });
+                            if (m_grams.size() * 2 > slots.size()) { // grow, keep load <= 1/2
+                                slots.assign(slots.size() * 2, UINT32_MAX);
+                                for (uint32_t j = 0; j < m_grams.size(); ++j) slotOf(m_grams[j].gram) = j;
+                            }
+                        }
+                        Gram& l = m_grams[k];
+                        Pending& p = pending[k];
+                        if (l.count && p.last == id) continue; // repeated within this name
+                        uint32_t v = l.count ? id - p.last : id;
+                        p.last = id;
+                        ++l.count;
+                        if (pass == 0) {
+                            do { ++p.bytes; v >>= 7; } while (v);
+                            continue;
+                        }
+                        for (; v >= 0x80; v >>= 7) m_postings[l.offset++] = uint8_t(v | 0x80);
+                        m_postings[l.offset++] = uint8_t(v);
+                    }
+                }
+                uint32_t at = 0;
+                for (size_t k = 0; k < m_grams.size(); ++k) {
+                    if (pass == 0) { m_grams[k].offset = at; m_grams[k].count = 0; }
+                    else m_grams[k].offset -= pending[k].bytes; // back from the write cursor to the start
+                    at += pending[k].bytes;
+                }
+                if (pass == 0) m_postings.resize(at);
+            }
+            std::sort(m_grams.begin(), m_grams.end(), [](const Gram& a, const Gram& b) { return a.gram < b.gram; });
+            m_grams.shrink_to_fit();
+        }
+
+        const Table& m_table;
+        mutable std::once_flag m_once;
+        mutable std::vector<uint64_t> m_order;   // title number -> ID, in folded name order
+        mutable std::vector<Gram> m_grams;       // sorted by gram
+        mutable std::vector<uint8_t> m_postings; // every posting list, back to back
+    };
+
+} // namespace titledb
@@ -0,0 +1,335 @@
+// TitleShared.h – one compiled title table shared read-only by every process that loads it.
+// The first process to need the table compiles it (CompileIndex, whose image is position
+// independent) into a named shared memory section "<name>.<generation>", then bumps the
+// generation in a small control section "<name>". Every other process maps the current
+// generation read-only and queries it in place with an IndexView, so the names exist once per
+// machine session rather than once per process. A rebuilt table is published under the next
+// generation; readers notice the counter move on their next check and switch over, and the old
+// section goes away with its last mapping. Builders serialise on a named lock and look at the
+// current generation again under it, so when several processes see the same change only one
+// compiles. Anything that goes wrong (no right to create sections, a section that vanished between
+// reading the counter and opening it, an image that does not validate) comes back as nullptr and
+// the caller loads a private table instead. Win32 named sections and a named mutex on Windows;
+// POSIX shared memory and flock elsewhere, so the protocol can be exercised with many processes
+// on any system.
+
+#pragma once
+
+#include "TitleIndex.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace titledb {
+
+    // What a shared table was built from, as the publisher describes it (the handler stores the
+    // mapping file's size, write time, volume and file ID). Compared whole, never interpreted.
+    struct SharedTag {
+        uint64_t v[4] = {};
+
+        bool operator==(const SharedTag& o) const { return std::memcmp(v, o.v, sizeof(v)) == 0; }
+        bool operator!=(const SharedTag& o) const { return !(*this == o); }
+    };
+
+    constexpr char kSharedMagic[4] = { 'X', 'T', 'S', 'H' };
+
+    // Start of every table section; the index image follows it.
+    struct SharedTableHeader {
+        char magic[4];
+        uint32_t headerSize;
+        uint64_t generation;
+        uint64_t imageSize;
+        SharedTag tag;
+        uint64_t reserved;
+    };
+    static_assert(sizeof(SharedTableHeader) == 64, "keeps the index image 8-byte aligned");
+
+    // The control section. Zero-filled when created: generation 0 means nothing is published.
+    struct SharedControl {
+        std::atomic<uint64_t> generation;
+        uint64_t reserved[7];
+    };
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the counter is shared between processes");
+    static_assert(sizeof(SharedControl) == 64, "control section layout");
+
+    // One generation mapped read-only. Immutable; unmapped when the last owner lets go.
+    class SharedTable {
+    public:
+        SharedTable(const SharedTable&) = delete;
+        SharedTable& operator=(const SharedTable&) = delete;
+        ~SharedTable() {
+#ifdef _WIN32
+            if (m_view) UnmapViewOfFile(m_view);
+            if (m_section) CloseHandle(m_section);
+#else
+            if (m_view) munmap(m_view, m_size);
+#endif
+        }
+
+        uint64_t Generation() const { return Header()->generation; }
+        const SharedTag& Tag() const { return Header()->tag; }
+        const IndexView& Index() const { return m_index; }
+        size_t MappedBytes() const { return m_size; }
+
+    private:
+        friend class SharedTitles;
+        SharedTable() = default;
+
+        const SharedTableHeader* Header() const { return static_cast<const SharedTableHeader*>(m_view); }
+
+#ifdef _WIN32
+        HANDLE m_section = nullptr;
+#endif
+        void* m_view = nullptr;
+        size_t m_size = 0;
+        IndexView m_index;
+    };
+
+    class SharedTitles {
+    public:
+        static constexpr unsigned kAttachTries = 4;    // a generation replaced while being opened
+        static constexpr uint32_t kLockTimeoutMs = 10000;
+
+        // name: "Local\\Something" on Windows, "/something" for POSIX shared memory.
+        explicit SharedTitles(std::string name) : m_name(std::move(name)) {}
+        SharedTitles(const SharedTitles&) = delete;
+        SharedTitles& operator=(const SharedTitles&) = delete;
+        ~SharedTitles() { Close(); }
+
+        // Create or open the control section and the builder lock. False: shared mode is not
+        // available here (the caller loads privately).
+        bool Open() {
+            Close();
+#ifdef _WIN32
+            HANDLE section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(SharedControl), m_name.c_str());
+            if (!section) return false;
+            m_control = static_cast<SharedControl*>(MapViewOfFile(section, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, sizeof(SharedControl)));
+            CloseHandle(section); // the view keeps the section
+            m_lock = m_control ? CreateMutexA(nullptr, FALSE, (m_name + ".Lock").c_str()) : nullptr;
+            if (!m_lock) { Close(); return false; }
+#else
+            m_fd = shm_open(m_name.c_str(), O_RDWR | O_CREAT, 0600);
+            if (m_fd < 0) return false;
+            struct stat st;
+            // Every opener sizes it the same, and growing an object zero-fills, so racing here is harmless.
+            if (fstat(m_fd, &st) != 0 || (st.st_size < off_t(sizeof(SharedControl)) && ftruncate(m_fd, sizeof(SharedControl)) != 0)) {
+                Close();
+                return false;
+            }
+            void* p = mmap(nullptr, sizeof(SharedControl), PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+            if (p == MAP_FAILED) { Close(); return false; }
+            m_control = static_cast<SharedControl*>(p);
+#endif
+            return true;
+        }
+
+        bool IsOpen() const { return m_control != nullptr; }
+
+        // The last published generation; 0 if none (or not open). One atomic load.
+        uint64_t Generation() const {
+            return m_control ? m_control->generation.load(std::memory_order_acquire) : 0;
+        }
+
+        // How many times an attach found its generation replaced before it could open it.
+        uint64_t Retries() const { return m_retries.load(std::memory_order_relaxed); }
+
+        // Map the current generation. nullptr if nothing is published or it cannot be used.
+        std::unique_ptr<const SharedTable> Attach() const {
+            for (unsigned i = 0; i < kAttachTries; ++i) {
+                uint64_t g = Generation();
+                if (g == 0) return nullptr;
+                if (auto table = MapGeneration(g)) return table;
+                if (Generation() == g) return nullptr; // still current, so gone for good
+                m_retries.fetch_add(1, std::memory_order_relaxed);
+            }
+            return nullptr;
+        }
+
+        // The current generation if it was built from `want`; otherwise build(std::vector<unsigned
+        // char>& image, SharedTag& tag) -> bool compiles a table (setting tag to what it was
+        // actually built from) and it is published as the next generation. Runs under the builder
+        // lock, so a caller that queued behind another builder of the same table adopts its result.
+        // *built (if given) says which happened. nullptr if the lock, the build or the section
+        // cannot be had.
+        template <class Build>
+        std::unique_ptr<const SharedTable> Publish(const SharedTag& want, Build&& build, bool* built = nullptr) {
+            if (built) *built = false;
+            if (!m_control || !Lock()) return nullptr;
+            uint64_t g = Generation();
+            std::unique_ptr<const SharedTable> table = g ? MapGeneration(g) : nullptr;
+            if (!table || table->Tag() != want) {
+                std::vector<unsigned char> image;
+                SharedTag tag = want;
+                table = nullptr;
+                if (build(image, tag)) table = CreateGeneration(g + 1, tag, image);
+                if (table) {
+                    m_control->generation.store(g + 1, std::memory_order_release);
+#ifndef _WIN32
+                    if (g) shm_unlink(SectionName(g).c_str()); // mapped copies stay valid
+#endif
+                    if (built) *built = true;
+                }
+            }
+            Unlock();
+            return table;
+        }
+
+        // Remove every name the protocol left behind (POSIX shared memory outlives its processes;
+        // Win32 sections go with their last handle, so there it does nothing). For tests.
+        static void Remove(const std::string& name) {
+#ifndef _WIN32
+            SharedTitles shared(name);
+            if (shared.Open()) {
+                uint64_t g = shared.Generation();
+                if (g) shm_unlink(shared.SectionName(g).c_str());
+                shm_unlink(shared.SectionName(g + 1).c_str()); // a builder that died half way
+            }
+            shm_unlink(name.c_str());
+#else
+            (void)name;
+#endif
+        }
+
+    private:
+        std::string SectionName(uint64_t g) const { return m_name + "." + std::to_string(g); }
+
+        void Close() {
+#ifdef _WIN32
+            if (m_control) UnmapViewOfFile(m_control);
+            if (m_lock) CloseHandle(m_lock);
+            m_lock = nullptr;
+#else
+            if (m_control) munmap(m_control, sizeof(SharedControl));
+            if (m_fd >= 0) close(m_fd);
+            m_fd = -1;
+#endif
+            m_control = nullptr;
+        }
+
+        // A mutex left by a builder that died counts as acquired: sections are only published
+        // after they are complete, so there is nothing half done to repair. flock is dropped by
+        // the kernel when its holder dies.
+        bool Lock() {
+#ifdef _WIN32
+            DWORD r = WaitForSingleObject(m_lock, kLockTimeoutMs);
+            return r == WAIT_OBJECT_0 || r == WAIT_ABANDONED;
+#else
+            while (flock(m_fd, LOCK_EX) != 0) if (errno != EINTR) return false;
+            return true;
+#endif
+        }
+
+        void Unlock() {
+#ifdef _WIN32
+            ReleaseMutex(m_lock);
+#else
+            flock(m_fd, LOCK_UN);
+#endif
+        }
+
+        // Map generation g read-only and check it is what it claims to be.
+        std::unique_ptr<const SharedTable> MapGeneration(uint64_t g) const {
+            std::unique_ptr<SharedTable> t(new SharedTable());
+            std::string name = SectionName(g);
+#ifdef _WIN32
+            t->m_section = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+            if (!t->m_section) return nullptr;
+            t->m_view = MapViewOfFile(t->m_section, FILE_MAP_READ, 0, 0, 0);
+            MEMORY_BASIC_INFORMATION mbi{};
+            if (!t->m_view || !VirtualQuery(t->m_view, &mbi, sizeof(mbi))) return nullptr;
+            t->m_size = mbi.RegionSize;
+#else
+            int fd = shm_open(name.c_str(), O_RDONLY, 0);
+            if (fd < 0) return nullptr;
+            struct stat st;
+            void* p = MAP_FAILED;
+            if (fstat(fd, &st) == 0 && st.st_size >= off_t(sizeof(SharedTableHeader)))
+                p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            close(fd);
+            if (p == MAP_FAILED) return nullptr;
+            t->m_view = p;
+            t->m_size = size_t(st.st_size);
+#endif
+            const SharedTableHeader* h = t->Header();
+            if (t->m_size < sizeof(SharedTableHeader) || std::memcmp(h->magic, kSharedMagic, sizeof(h->magic)) != 0 ||
+                h->headerSize != sizeof(SharedTableHeader) || h->generation != g ||
+                h->imageSize > t->m_size - sizeof(SharedTableHeader) ||
+                !t->m_index.Open(static_cast<const char*>(t->m_view) + sizeof(SharedTableHeader), size_t(h->imageSize), false)) {
+                return nullptr;
+            }
+            return t;
+        }
+
+        // Write generation g and map it back read-only. Caller holds the lock.
+        std::unique_ptr<const SharedTable> CreateGeneration(uint64_t g, const SharedTag& tag, const std::vector<unsigned char>& image) {
+            SharedTableHeader h{};
+            std::memcpy(h.magic, kSharedMagic, sizeof(h.magic));
+            h.headerSize = sizeof(SharedTableHeader);
+            h.generation = g;
+            h.imageSize = image.size();
+            h.tag = tag;
+            size_t size = sizeof(h) + image.size();
+            std::string name = SectionName(g);
+#ifdef _WIN32
+            HANDLE section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, DWORD(uint64_t(size) >> 32),
+                                                DWORD(size), name.c_str());
+            if (!section) return nullptr;
+            if (GetLastError() == ERROR_ALREADY_EXISTS) { CloseHandle(section); return nullptr; } // not ours to fill
+            void* w = MapViewOfFile(section, FILE_MAP_WRITE, 0, 0, size);
+            if (!w) { CloseHandle(section); return nullptr; }
+            std::memcpy(w, &h, sizeof(h));
+            std::memcpy(static_cast<char*>(w) + sizeof(h), image.data(), image.size());
+            UnmapViewOfFile(w);
+            auto t = MapGeneration(g); // opens the section by name while this handle keeps it alive
+            CloseHandle(section);
+            return t;
+#else
+            shm_unlink(name.c_str()); // left by a builder that died before publishing it
+            int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd < 0) return nullptr;
+            void* w = MAP_FAILED;
+            if (ftruncate(fd, off_t(size)) == 0) w = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            if (w == MAP_FAILED) { shm_unlink(name.c_str()); return nullptr; }
+            std::memcpy(w, &h, sizeof(h));
+            std::memcpy(static_cast<char*>(w) + sizeof(h), image.data(), image.size());
+            munmap(w, size);
+            auto t = MapGeneration(g);
+            if (!t) shm_unlink(name.c_str());
+            return t;
+#endif
+        }
+
+        std::string m_name;
+        SharedControl* m_control = nullptr;
+        mutable std::atomic<uint64_t> m_retries{ 0 };
+#ifdef _WIN32
+        HANDLE m_lock = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+
+} // namespace titledb
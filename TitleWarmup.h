@@ -0,0 +1,79 @@
+// TitleWarmup.h – state of a table load that runs in the background from first use.
+// The first caller of Start() owns the load (it hands it to a thread of its own) and reports the
+// end with Finish(). Anyone can ask whether the table is ready, wait for it for a bounded time, or
+// cancel the load; the loader polls Cancelled() between steps. A cancelled load goes back to idle,
+// so the next use starts it again. The table itself is published through a SnapshotCell as usual:
+// this only tells callers whether it is there yet, and checking that is one atomic load.
+// Platform-independent.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace titledb {
+
+    class Warmup {
+    public:
+        enum State { Idle, Loading, Ready };
+        static constexpr uint32_t kForever = UINT32_MAX;
+
+        Warmup() = default;
+        Warmup(const Warmup&) = delete;
+        Warmup& operator=(const Warmup&) = delete;
+
+        State Get() const { return m_state.load(std::memory_order_acquire); }
+        bool IsReady() const { return Get() == Ready; }
+
+        // Idle -> Loading. True for the one caller that must now run the load and call Finish.
+        bool Start() {
+            if (Get() != Idle) return false;
+            std::lock_guard<std::mutex> lk(m_mutex);
+            if (m_state.load(std::memory_order_relaxed) != Idle) return false;
+            m_cancel.store(false, std::memory_order_relaxed);
+            m_state.store(Loading, std::memory_order_release);
+            return true;
+        }
+
+        // End of the load: Ready if it completed, otherwise (cancelled) back to Idle. Wakes waiters.
+        void Finish(bool completed) {
+            {
+                std::lock_guard<std::mutex> lk(m_mutex);
+                m_state.store(completed ? Ready : Idle, std::memory_order_release);
+                m_cancel.store(false, std::memory_order_relaxed);
+            }
+            m_done.notify_all();
+        }
+
+        // Wait up to ms (kForever: no limit) for a running load to end. Whether the table is ready.
+        bool Wait(uint32_t ms) {
+            State s = Get();
+            if (s != Loading || ms == 0) return s == Ready;
+            std::unique_lock<std::mutex> lk(m_mutex);
+            auto done = [&] { return m_state.load(std::memory_order_relaxed) != Loading; };
+            if (ms == kForever) m_done.wait(lk, done);
+            else m_done.wait_for(lk, std::chrono::milliseconds(ms), done);
+            return m_state.load(std::memory_order_relaxed) == Ready;
+        }
+
+        // Ask a running load to stop. Whether one is running (and so has not stopped yet).
+        bool Cancel() {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            if (m_state.load(std::memory_order_relaxed) != Loading) return false;
+            m_cancel.store(true, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool Cancelled() const { return m_cancel.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<State> m_state{ Idle };
+        std::atomic<bool> m_cancel{ false };
+        std::mutex m_mutex;
+        std::condition_variable m_done;
+    };
+
+} // namespace titledb
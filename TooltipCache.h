@@ -0,0 +1,285 @@
+// TooltipCache.h – bounded LRU cache of finished tooltip strings, keyed by item path.
+// An entry remembers the write time and size the item had when its tooltip was built and is only
+// returned while the item still has them, so a changed file is re-formatted on its next hover.
+// The cache is split into kShards shards by path hash, each with its own lock, LRU list and slab
+// arena: path and tooltip are stored together in one fixed-size slot of the smallest size class
+// that fits, taken from pages the shard keeps for reuse, so a hit copies out of the arena without
+// allocating and an insert only allocates when the shard grows a page. Each shard evicts least
+// recently used entries to stay within its share of the entry and byte limits. Platform-independent.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace titledb {
+
+    struct TooltipCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;    // not cached
+        uint64_t stale = 0;     // cached, but the item's write time or size changed
+        uint64_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;       // arena pages held
+    };
+
+    template <class CharT>
+    class TooltipCache {
+    public:
+        static constexpr size_t kShards = 16;
+        static constexpr size_t kClasses = 6;                          // slots of 64, 128 ... 2048 characters
+        static constexpr size_t kMaxChars = size_t(64) << (kClasses - 1); // path + tooltip; longer ones are not cached
+
+        explicit TooltipCache(size_t maxEntries = 4096, size_t maxBytes = size_t(2) << 20) {
+            size_t perShard = (maxEntries + kShards - 1) / kShards;
+            if (perShard == 0) perShard = 1;
+            size_t slots = 4;
+            while (slots < perShard * 2) slots *= 2;
+            for (Shard& s : m_shards) {
+                s.entries.resize(perShard);
+                s.freeEntries.reserve(perShard);
+                for (size_t i = perShard; i-- > 0;) s.freeEntries.push_back(static_cast<uint32_t>(i));
+                s.index.assign(slots, kNone);
+                s.maxBytes = maxBytes / kShards;
+            }
+        }
+        TooltipCache(const TooltipCache&) = delete;
+        TooltipCache& operator=(const TooltipCache&) = delete;
+
+        // If path is cached with this write time and size, call fn(const CharT* tooltip, size_t len)
+        // while the entry is held and return true. A cached entry with another stamp is dropped.
+        template <class Fn>
+        bool Find(const CharT* path, size_t n, uint64_t writeTime, uint64_t size, Fn&& fn) {
+            uint64_t h = Hash(path, n);
+            Shard& s = ShardOf(h);
+            std::lock_guard<std::mutex> lk(s.mutex);
+            size_t at = s.Probe(h, path, n);
+            uint32_t e = s.index[at];
+            if (e == kNone) { ++s.stats.misses; return false; }
+            Entry& entry = s.entries[e];
+            if (entry.writeTime != writeTime || entry.size != size) {
+                ++s.stats.stale;
+                s.Remove(at);
+                return false;
+            }
+            s.Touch(e);
+            ++s.stats.hits;
+            fn(static_cast<const CharT*>(s.SlotData(entry) + entry.pathLen), static_cast<size_t>(entry.textLen));
+            return true;
+        }
+
+        // Copy of the cached tooltip into out (whose capacity is reused).
+        bool Find(const CharT* path, size_t n, uint64_t writeTime, uint64_t size, std::basic_string<CharT>& out) {
+            return Find(path, n, writeTime, size, [&](const CharT* text, size_t len) { out.assign(text, len); });
+        }
+
+        // Cache tooltip for path as it is at writeTime/size, replacing any previous entry (which
+        // is dropped even when this one is too long to cache).
+        void Insert(const CharT* path, size_t n, uint64_t writeTime, uint64_t size, const CharT* tooltip, size_t len) {
+            if (n == 0) return;
+            uint64_t h = Hash(path, n);
+            Shard& s = ShardOf(h);
+            std::lock_guard<std::mutex> lk(s.mutex);
+            size_t at = s.Probe(h, path, n);
+            if (s.index[at] != kNone) s.Remove(at);
+            if (n + len > kMaxChars) return;
+            while (s.freeEntries.empty()) s.EvictOldest();
+            size_t cls = 0;
+            while ((size_t(64) << cls) < n + len) ++cls;
+            uint32_t slot = s.AllocSlot(cls);
+
+            uint32_t e = s.freeEntries.back();
+            s.freeEntries.pop_back();
+            Entry& entry = s.entries[e];
+            entry.hash = h;
+            entry.writeTime = writeTime;
+            entry.size = size;
+            entry.slot = slot;
+            entry.cls = static_cast<uint8_t>(cls);
+            entry.pathLen = static_cast<uint16_t>(n);
+            entry.textLen = static_cast<uint16_t>(len);
+            CharT* data = s.SlotData(entry);
+            std::memcpy(data, path, n * sizeof(CharT));
+            std::memcpy(data + n, tooltip, len * sizeof(CharT));
+            s.index[s.Probe(h, path, n)] = e; // the slot Probe found may have moved with evictions
+            s.PushFront(e);
+            ++s.count;
+        }
+
+        void Clear() {
+            for (Shard& s : m_shards) {
+                std::lock_guard<std::mutex> lk(s.mutex);
+                while (s.tail != kNone) s.Remove(s.Find(s.tail));
+                s.ReleasePages();
+            }
+        }
+
+        TooltipCacheStats Stats() const {
+            TooltipCacheStats total;
+            for (const Shard& s : m_shards) {
+                std::lock_guard<std::mutex> lk(s.mutex);
+                total.hits += s.stats.hits;
+                total.misses += s.stats.misses;
+                total.stale += s.stats.stale;
+                total.evictions += s.stats.evictions;
+                total.entries += s.count;
+                total.bytes += s.bytes;
+            }
+            return total;
+        }
+
+    private:
+        static constexpr uint32_t kNone = UINT32_MAX;
+        static constexpr size_t kPageChars = 4096;
+
+        struct Entry {
+            uint64_t hash = 0;
+            uint64_t writeTime = 0;
+            uint64_t size = 0;
+            uint32_t prev = kNone, next = kNone; // LRU list, most recent first
+            uint32_t slot = 0;                   // within its class
+            uint16_t pathLen = 0, textLen = 0;
+            uint8_t cls = 0;
+        };
+
+        // Fixed-size slots of one class, carved from kPageChars pages.
+        struct Slab {
+            std::vector<std::unique_ptr<CharT[]>> pages;
+            std::vector<uint32_t> free;
+        };
+
+        struct alignas(64) Shard {
+            mutable std::mutex mutex;
+            std::vector<Entry> entries;
+            std::vector<uint32_t> freeEntries;
+            std::vector<uint32_t> index; // linear probing over entry numbers, by hash
+            Slab slabs[kClasses];
+            uint32_t head = kNone, tail = kNone;
+            size_t count = 0, bytes = 0, maxBytes = 0;
+            TooltipCacheStats stats;
+
+            static size_t SlotChars(size_t cls) { return size_t(64) << cls; }
+            static size_t SlotsPerPage(size_t cls) { return kPageChars / SlotChars(cls); }
+
+            CharT* SlotData(const Entry& e) const {
+                size_t per = SlotsPerPage(e.cls);
+                return slabs[e.cls].pages[e.slot / per].get() + (e.slot % per) * SlotChars(e.cls);
+            }
+
+            // Index slot holding path, or the empty slot where it would go.
+            size_t Probe(uint64_t h, const CharT* path, size_t n) const {
+                size_t mask = index.size() - 1;
+                for (size_t i = size_t(h) & mask;; i = (i + 1) & mask) {
+                    uint32_t e = index[i];
+                    if (e == kNone) return i;
+                    const Entry& entry = entries[e];
+                    if (entry.hash == h && entry.pathLen == n && std::memcmp(SlotData(entry), path, n * sizeof(CharT)) == 0) return i;
+                }
+            }
+
+            size_t Find(uint32_t e) const {
+                size_t mask = index.size() - 1, i = size_t(entries[e].hash) & mask;
+                while (index[i] != e) i = (i + 1) & mask;
+                return i;
+            }
+
+            uint32_t AllocSlot(size_t cls) {
+                Slab& slab = slabs[cls];
+                while (slab.free.empty()) {
+                    if (bytes == 0 || bytes + kPageChars * sizeof(CharT) <= maxBytes) {
+                        uint32_t first = static_cast<uint32_t>(slab.pages.size() * SlotsPerPage(cls));
+                        slab.pages.emplace_back(new CharT[kPageChars]);
+                        bytes += kPageChars * sizeof(CharT);
+                        for (size_t i = SlotsPerPage(cls); i-- > 0;) slab.free.push_back(first + static_cast<uint32_t>(i));
+                    } else if (tail != kNone) {
+                        EvictOldest();
+                    } else {
+                        ReleasePages(); // the budget is all held by other classes' free slots
+                    }
+                }
+                uint32_t slot = slab.free.back();
+                slab.free.pop_back();
+                return slot;
+            }
+
+            void ReleasePages() {
+                for (Slab& slab : slabs) { slab.pages.clear(); slab.free.clear(); }
+                bytes = 0;
+            }
+
+            void EvictOldest() {
+                ++stats.evictions;
+                Remove(Find(tail));
+            }
+
+            // Drop the entry in index slot `at`: free its slot and entry and close the probe gap.
+            void Remove(size_t at) {
+                uint32_t e = index[at];
+                Entry& entry = entries[e];
+                Unlink(e);
+                slabs[entry.cls].free.push_back(entry.slot);
+                freeEntries.push_back(e);
+                --count;
+                size_t mask = index.size() - 1, hole = at;
+                index[hole] = kNone;
+                for (size_t j = (hole + 1) & mask; index[j] != kNone; j = (j + 1) & mask) {
+                    size_t home = size_t(entries[index[j]].hash) & mask;
+                    if (((j - home) & mask) >= ((j - hole) & mask)) {
+                        index[hole] = index[j];
+                        index[j] = kNone;
+                        hole = j;
+                    }
+                }
+            }
+
+            void Unlink(uint32_t e) {
+                Entry& entry = entries[e];
+                if (entry.prev != kNone) entries[entry.prev].next = entry.next; else head = entry.next;
+                if (entry.next != kNone) entries[entry.next].prev = entry.prev; else tail = entry.prev;
+                entry.prev = entry.next = kNone;
+            }
+
+            void PushFront(uint32_t e) {
+                Entry& entry = entries[e];
+                entry.prev = kNone;
+                entry.next = head;
+                if (head != kNone) entries[head].prev = e; else tail = e;
+                head = e;
+            }
+
+            void Touch(uint32_t e) {
+                if (head == e) return;
+                Unlink(e);
+                PushFront(e);
+            }
+        };
+
+        // Eight bytes at a time; the top bits pick the shard, the low bits the index slot.
+        static uint64_t Hash(const CharT* path, size_t n) {
+            const unsigned char* p = reinterpret_cast<const unsigned char*>(path);
+            size_t bytes = n * sizeof(CharT);
+            uint64_t h = 0x9E3779B97F4A7C15ULL ^ bytes;
+            for (; bytes >= 8; bytes -= 8, p += 8) {
+                uint64_t w;
+                std::memcpy(&w, p, 8);
+                h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+                h ^= h >> 32;
+            }
+            uint64_t tail = 0;
+            std::memcpy(&tail, p, bytes);
+            h = (h ^ tail) * 0xC4CEB9FE1A85EC53ULL;
+            return h ^ (h >> 29);
+        }
+
+        static_assert(kShards == 16, "ShardOf takes the top four bits of the hash");
+        Shard& ShardOf(uint64_t h) { return m_shards[h >> 60]; }
+
+        Shard m_shards[kShards];
+    };
+
+} // namespace titledb
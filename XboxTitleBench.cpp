@@ -0,0 +1,2442 @@
+// XboxTitleBench.cpp – benchmarks for the platform-independent parts of the InfoTip handler:
+// parsing, the compiled index, lookups, snapshot reloads, layered databases, tooltip assembly,
+// logging, metrics recording, the default-tooltip cache, the batch resolver, title IDs found
+// inside longer names, title details (loading the optional columns and formatting the tooltip), the first lookup in
+// a fresh process (with and without the built-in list), the time to the first answer with the
+// load on the hovering thread or in the background, loading files of several hundred MB, and many
+// processes attaching to (and republishing) one table in shared memory.
+// Build (Linux):
+//   g++ -std=c++17 -O2 -pthread XboxTitleBench.cpp -o XboxTitleBench
+// Build (x64 Dev Prompt):
+//   cl /EHsc /permissive- /std:c++17 /O2 XboxTitleBench.cpp
+//
+// Usage: XboxTitleBench [--quick] [--check] [--file XboxTitleIDs.txt] [--filter substring] [--threads N]
+// --check runs no benchmarks: it compares the parsers with a copy of the handler's original one
+// over edge-case, generated and randomly edited files and exits with 1 on any difference.
+// Writes one JSON document to stdout (progress goes to stderr). Every scenario reports
+// ops, ns_per_op, p50_ns, p99_ns and allocs_per_op; some add scenario-specific fields. Some
+// scenarios also check what they measure (no bytes read while a file is unchanged, ...); a
+// failed check is listed under "failures" and makes the exit code 1.
+
+#include "TitleCompact.h"
+#include "TitleIndex.h"
+#include "TitleLayers.h"
+#include "TitleReload.h"
+#include "TitleFreshness.h"
+#include "TitleSearch.h"
+#include "BatchResolve.h"
+#include "LogRing.h"
+#include "Metrics.h"
+#include "HandlerMetrics.h"
+#include "TooltipCache.h"
+#include "TitleWarmup.h"
+#include "TitleScan.h"
+#include "TitleShared.h"
+#include "TitleMeta.h"
+#include "TitleLookup.h"
+#include "PortableFile.h"
+#include "XboxTitleIDsEmbedded.h"
+
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <cwchar>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// ---------------- Allocation counting ----------------
+// Every operator new in the process goes through here so scenarios can report allocations.
+namespace {
+    std::atomic<uint64_t> g_allocs{ 0 };
+    std::atomic<int64_t> g_liveBytes{ 0 };
+
+    void* CountedAlloc(size_t n) {
+        void* p = std::malloc(n + 16);
+        if (!p) throw std::bad_alloc();
+        *static_cast<size_t*>(p) = n;
+        g_allocs.fetch_add(1, std::memory_order_relaxed);
+        g_liveBytes.fetch_add((int64_t)n, std::memory_order_relaxed);
+        return static_cast<char*>(p) + 16;
+    }
+
+    void CountedFree(void* p) {
+        if (!p) return;
+        void* base = static_cast<char*>(p) - 16;
+        g_liveBytes.fetch_sub((int64_t)*static_cast<size_t*>(base), std::memory_order_relaxed);
+        std::free(base);
+    }
+}
+
+void* operator new(size_t n) { return CountedAlloc(n); }
+void* operator new[](size_t n) { return CountedAlloc(n); }
+void operator delete(void* p) noexcept { CountedFree(p); }
+void operator delete[](void* p) noexcept { CountedFree(p); }
+void operator delete(void* p, size_t) noexcept { CountedFree(p); }
+void operator delete[](void* p, size_t) noexcept { CountedFree(p); }
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    std::atomic<uint64_t> g_sink{ 0 }; // results fed here so lookups are not optimized away
+
+    double NsSince(Clock::time_point t0) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+    }
+
+    // ---------------- Report ----------------
+    struct Result {
+        std::string name;
+        uint64_t ops = 0;
+        double nsPerOp = 0, p50 = 0, p99 = 0, allocsPerOp = 0;
+        std::vector<std::pair<std::string, double>> extra;
+    };
+
+    struct Options {
+        bool quick = false;
+        std::string file = "XboxTitleIDs.txt";
+        std::string filter;
+        unsigned threads = 4;
+    };
+
+    class Report {
+    public:
+        explicit Report(const Options& opt) : m_opt(opt) {}
+
+        bool Wants(const char* name) const {
+            return m_opt.filter.empty() || std::strstr(name, m_opt.filter.c_str()) != nullptr;
+        }
+
+        void Add(Result r) {
+            std::fprintf(stderr, "%-40s %12.1f ns/op  p99 %10.1f ns\n", r.name.c_str(), r.nsPerOp, r.p99);
+            m_results.push_back(std::move(r));
+        }
+
+        // A check a scenario makes on what it measured did not hold.
+        void Fail(const std::string& scenario, const std::string& what) {
+            std::fprintf(stderr, "FAILED %s: %s\n", scenario.c_str(), what.c_str());
+            m_failures.push_back(scenario + ": " + what);
+        }
+        bool Failed() const { return !m_failures.empty(); }
+
+        void Print() const {
+            std::printf("{\n  \"quick\": %s,\n  \"threads\": %u,\n  \"simd\": \"%s\",\n  \"scenarios\": [\n",
+                        m_opt.quick ? "true" : "false", m_opt.threads, SimdName());
+            for (size_t i = 0; i < m_results.size(); ++i) {
+                const Result& r = m_results[i];
+                std::printf("    {\"name\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.2f, \"p50_ns\": %.2f, "
+                            "\"p99_ns\": %.2f, \"allocs_per_op\": %.4f",
+                            r.name.c_str(), (unsigned long long)r.ops, r.nsPerOp, r.p50, r.p99, r.allocsPerOp);
+                for (auto& kv : r.extra) std::printf(", \"%s\": %.4f", kv.first.c_str(), kv.second);
+                std::printf("}%s\n", i + 1 < m_results.size() ? "," : "");
+            }
+            std::printf("  ],\n  \"failures\": [");
+            for (size_t i = 0; i < m_failures.size(); ++i) std::printf("%s\"%s\"", i ? ", " : "", m_failures[i].c_str());
+            std::printf("]\n}\n");
+        }
+
+    private:
+        static const char* SimdName() {
+#if defined(TITLEDB_AVX2)
+            return "avx2";
+#elif defined(TITLEDB_SSE2)
+            return "sse2";
+#else
+            return "none";
+#endif
+        }
+
+        const Options& m_opt;
+        std::vector<Result> m_results;
+        std::vector<std::string> m_failures;
+    };
+
+    // Fill p50/p99 from per-sample latencies (ns).
+    void SetPercentiles(Result& r, std::vector<double>& samples) {
+        if (samples.empty()) return;
+        std::sort(samples.begin(), samples.end());
+        r.p50 = samples[samples.size() / 2];
+        r.p99 = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    }
+
+    // Run fn() `reps` times, timing each call; one call is one op.
+    template <class Fn>
+    Result Measure(const char* name, size_t reps, Fn&& fn) {
+        Result r; r.name = name;
+        std::vector<double> samples;
+        samples.reserve(reps);
+        uint64_t a0 = g_allocs.load();
+        double total = 0;
+        for (size_t i = 0; i < reps; ++i) {
+            auto t0 = Clock::now();
+            fn();
+            double ns = NsSince(t0);
+            total += ns;
+            samples.push_back(ns);
+        }
+        r.ops = reps;
+        r.nsPerOp = total / double(reps);
+        r.allocsPerOp = double(g_allocs.load() - a0) / double(reps);
+        SetPercentiles(r, samples);
+        return r;
+    }
+
+    // Run fn(i) for i in [0, ops), timing batches of `batch` calls; latency samples are per call.
+    template <class Fn>
+    Result MeasureBatched(const char* name, size_t ops, size_t batch, Fn&& fn) {
+        Result r; r.name = name;
+        std::vector<double> samples;
+        samples.reserve(ops / batch + 1);
+        uint64_t a0 = g_allocs.load();
+        auto start = Clock::now();
+        for (size_t i = 0; i < ops; i += batch) {
+            size_t end = std::min(ops, i + batch);
+            auto t0 = Clock::now();
+            for (size_t k = i; k < end; ++k) fn(k);
+            samples.push_back(NsSince(t0) / double(end - i));
+        }
+        r.nsPerOp = NsSince(start) / double(ops);
+        r.ops = ops;
+        r.allocsPerOp = double(g_allocs.load() - a0) / double(ops);
+        SetPercentiles(r, samples);
+        return r;
+    }
+
+    // ---------------- Inputs ----------------
+    // A synthetic mapping file: `count` hex IDs (some repeat, so last-wins is exercised), comments and
+    // non-ASCII names, in the shape of XboxTitleIDs.txt.
+    // Lines [first, first + count) of a synthetic mapping file, appended to text.
+    void AppendMappingLines(std::string& text, size_t first, size_t count, std::mt19937& rng) {
+        static const char* const kWords[] = { "Halo", "Forza", "Racing", "Legends", "Championship", "Pro",
+                                              "Edition", "Deluxe", "Caf\xC3\xA9", "\xC3\x9C" "ber", "Night", "2" };
+        char line[160];
+        for (size_t i = first; i < first + count; ++i) {
+            // Publisher-like prefixes so the distribution resembles the shipped file.
+            uint32_t id = (uint32_t(0x4D53 + (rng() % 64)) << 16) | uint32_t(i & 0xFFFF);
+            id ^= uint32_t(i >> 16) << 24;
+            int n = std::snprintf(line, sizeof(line), "%08X=", id);
+            int words = 1 + int(rng() % 4);
+            for (int w = 0; w < words; ++w) {
+                n += std::snprintf(line + n, sizeof(line) - n, "%s%s", w ? " " : "", kWords[rng() % (sizeof(kWords) / sizeof(kWords[0]))]);
+            }
+            n += std::snprintf(line + n, sizeof(line) - n, " %u\r\n", unsigned(i));
+            text.append(line, n);
+            if (i % 53 == 0) { text.append(line, 9); text += "Renamed Title\r\n"; } // later duplicate wins
+            if (i % 97 == 0) text += "; comment line\r\n";
+        }
+    }
+
+    const char kMappingHeader[] = "\xEF\xBB\xBF# synthetic XboxTitleIDs.txt\r\n";
+
+    std::string MakeMappingText(size_t count, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::string text = kMappingHeader;
+        text.reserve(count * 40);
+        AppendMappingLines(text, 0, count, rng);
+        return text;
+    }
+
+    // The same shape written straight to a file of at least `bytes` bytes, never held whole: the
+    // first `distinct` lines (a multiple of 100000) over and over, so the table stays that size.
+    bool WriteMappingFile(const std::string& path, size_t bytes, size_t distinct, uint32_t seed) {
+        FILE* f = std::fopen(path.c_str(), "wb");
+        if (!f) return false;
+        std::mt19937 rng(seed);
+        std::string text = kMappingHeader;
+        size_t written = 0, lines = 0;
+        bool ok = true;
+        while (ok && written < bytes) {
+            if (lines % distinct == 0) rng.seed(seed);
+            AppendMappingLines(text, lines % distinct, 100000, rng);
+            lines += 100000;
+            ok = std::fwrite(text.data(), 1, text.size(), f) == text.size();
+            written += text.size();
+            text.clear();
+        }
+        return (std::fclose(f) == 0) && ok;
+    }
+
+    // 8-character UTF-16 IDs to look up: `missPercent` of them are not in the table.
+    std::vector<std::u16string> MakeQueries(const std::vector<uint64_t>& keys, size_t n, unsigned missPercent, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::vector<std::u16string> q;
+        q.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            char16_t id[8];
+            if (rng() % 100 < missPercent || keys.empty()) {
+                uint64_t k = 0;
+                for (int c = 0; c < 8; ++c) k = (k << 8) | uint64_t("0123456789ABCDEFGHJKLMNPQRSTUVWXYZ"[rng() % 34]);
+                k = (k & ~0xFFULL) | 'Z'; // mapping files only hold hex IDs, so this never hits
+                titledb::UnpackTitleId(k, id);
+            } else {
+                titledb::UnpackTitleId(keys[rng() % keys.size()], id);
+                if (rng() % 2) for (auto& ch : id) if (ch >= u'A' && ch <= u'Z') ch = char16_t(ch + 32);
+            }
+            q.emplace_back(id, 8);
+        }
+        return q;
+    }
+
+    std::vector<uint64_t> KeysOf(const titledb::TitleTable& t) {
+        std::vector<uint64_t> keys;
+        t.ForEach([&](uint64_t k, const char16_t*, size_t) { keys.push_back(k); });
+        return keys;
+    }
+
+    struct Dataset {
+        std::string name;
+        std::string text;
+    };
+
+    // ---------------- Scenarios ----------------
+    void BenchParse(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string name = "parse/" + ds.name;
+        if (!rep.Wants(name.c_str())) return;
+        size_t reps = opt.quick ? 3 : 10;
+        titledb::TitleTable t;
+        Result r = Measure(name.c_str(), reps, [&] { t.LoadUtf8(ds.text.data(), ds.text.size()); });
+        r.extra.push_back({ "mb_per_s", double(ds.text.size()) / (r.p50 / 1e9) / 1e6 });
+        r.extra.push_back({ "entries", double(t.Size()) });
+        r.extra.push_back({ "table_bytes", double(t.MemoryBytes()) });
+        r.extra.push_back({ "bytes_per_entry", double(t.MemoryBytes()) / double(std::max<size_t>(1, t.Size())) });
+        rep.Add(std::move(r));
+    }
+
+    // The pre-TitleTable container, kept here as the baseline.
+    using WideMap = std::unordered_map<std::u16string, std::u16string>;
+
+    void BuildWideMap(const std::string& text, WideMap& m) {
+        m.clear();
+        titledb::ParseMapping(text.data(), text.size(), [&](uint64_t key, const char* name, size_t len) {
+            char16_t id[8]; titledb::UnpackTitleId(key, id);
+            std::u16string wide(len, u'\0');
+            wide.resize(titledb::ConvertUtf8(name, len, &wide[0]));
+            m[std::u16string(id, 8)] = std::move(wide);
+        });
+    }
+
+    void BenchContainers(Report& rep, const Dataset& ds, const Options& opt) {
+        titledb::TitleTable table;
+        table.LoadUtf8(ds.text.data(), ds.text.size());
+        std::vector<uint64_t> keys = KeysOf(table);
+        size_t ops = opt.quick ? 200000 : 2000000;
+
+        std::string mapBuild = "map_build/" + ds.name;
+        WideMap map;
+        if (rep.Wants(mapBuild.c_str()) || rep.Wants("lookup/")) {
+            int64_t live0 = g_liveBytes.load();
+            uint64_t a0 = g_allocs.load();
+            auto t0 = Clock::now();
+            BuildWideMap(ds.text, map);
+            Result r; r.name = mapBuild; r.ops = 1; r.nsPerOp = r.p50 = r.p99 = NsSince(t0);
+            r.allocsPerOp = double(g_allocs.load() - a0);
+            r.extra.push_back({ "entries", double(map.size()) });
+            r.extra.push_back({ "map_bytes", double(g_liveBytes.load() - live0) });
+            r.extra.push_back({ "bytes_per_entry", double(g_liveBytes.load() - live0) / double(std::max<size_t>(1, map.size())) });
+            if (rep.Wants(mapBuild.c_str())) rep.Add(std::move(r));
+        }
+
+        for (unsigned miss : { 0u, 50u, 99u }) {
+            auto queries = MakeQueries(keys, 1 << 16, miss, 11 + miss);
+            std::string suffix = ds.name + "/miss" + std::to_string(miss);
+            std::string tn = "lookup/table/" + suffix;
+            if (rep.Wants(tn.c_str())) {
+                size_t hits = 0;
+                Result r = MeasureBatched(tn.c_str(), ops, 32, [&](size_t i) {
+                    const std::u16string& q = queries[i & (queries.size() - 1)];
+                    const char16_t* name; size_t len;
+                    hits += table.Find(q.data(), q.size(), &name, &len);
+                });
+                r.extra.push_back({ "hit_rate", double(hits) / double(ops) });
+                rep.Add(std::move(r));
+            }
+            std::string mn = "lookup/map/" + suffix;
+            if (rep.Wants(mn.c_str())) {
+                size_t hits = 0;
+                // As the old LookupName did: upper-case a copy, then find.
+                Result r = MeasureBatched(mn.c_str(), ops, 32, [&](size_t i) {
+                    std::u16string id = queries[i & (queries.size() - 1)];
+                    for (auto& ch : id) if (ch >= u'a' && ch <= u'z') ch = char16_t(ch - 32);
+                    hits += map.find(id) != map.end();
+                });
+                r.extra.push_back({ "hit_rate", double(hits) / double(ops) });
+                rep.Add(std::move(r));
+            }
+        }
+    }
+
+    // Publisher-partitioned storage against TitleTable and the old map: build cost and bytes per
+    // entry, then lookups that expand the name (as a tooltip would) at the same miss rates.
+    void BenchCompact(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string buildName = "compact_build/" + ds.name;
+        bool any = rep.Wants(buildName.c_str());
+        for (unsigned miss : { 0u, 50u, 99u }) any |= rep.Wants(("lookup/compact/" + ds.name + "/miss" + std::to_string(miss)).c_str());
+        if (!any) return;
+        titledb::TitleTable table;
+        table.LoadUtf8(ds.text.data(), ds.text.size());
+        std::vector<uint64_t> keys = KeysOf(table);
+        titledb::PublisherTable compact;
+
+        Result r = Measure(buildName.c_str(), opt.quick ? 1 : 3, [&] { compact.Build(table); });
+        if (rep.Wants(buildName.c_str())) {
+            int64_t live0 = g_liveBytes.load();
+            {
+                WideMap map;
+                BuildWideMap(ds.text, map);
+                double entries = double(std::max<size_t>(1, compact.Size()));
+                r.extra.push_back({ "entries", double(compact.Size()) });
+                r.extra.push_back({ "publishers", double(compact.PublisherCount()) });
+                r.extra.push_back({ "compact_bytes", double(compact.MemoryBytes()) });
+                r.extra.push_back({ "bytes_per_entry", double(compact.MemoryBytes()) / entries });
+                r.extra.push_back({ "table_bytes_per_entry", double(table.MemoryBytes()) / entries });
+                r.extra.push_back({ "map_bytes_per_entry", double(g_liveBytes.load() - live0) / entries });
+            }
+            rep.Add(std::move(r));
+        }
+
+        size_t ops = opt.quick ? 200000 : 2000000;
+        for (unsigned miss : { 0u, 50u, 99u }) {
+            std::string name = "lookup/compact/" + ds.name + "/miss" + std::to_string(miss);
+            if (!rep.Wants(name.c_str())) continue;
+            auto queries = MakeQueries(keys, 1 << 16, miss, 11 + miss);
+            std::u16string out;
+            size_t hits = 0;
+            Result lr = MeasureBatched(name.c_str(), ops, 32, [&](size_t i) {
+                const std::u16string& q = queries[i & (queries.size() - 1)];
+                uint64_t key;
+                hits += titledb::PackTitleId(q.data(), q.size(), &key) && compact.Find(key, out);
+            });
+            lr.extra.push_back({ "hit_rate", double(hits) / double(ops) });
+            rep.Add(std::move(lr));
+        }
+    }
+
+    void BenchIndex(Report& rep, const Dataset& ds, const Options& opt) {
+        std::vector<unsigned char> image;
+        titledb::CompileIndex(ds.text.data(), ds.text.size(), ds.text.size(), 0, image);
+        size_t reps = opt.quick ? 5 : 20;
+        std::string n1 = "index_open/" + ds.name;
+        if (rep.Wants(n1.c_str())) {
+            titledb::IndexView v;
+            Result r = Measure(n1.c_str(), reps, [&] { v.Open(image.data(), image.size()); });
+            r.extra.push_back({ "index_bytes", double(image.size()) });
+            rep.Add(std::move(r));
+        }
+        std::string n2 = "index_open_nochecksum/" + ds.name;
+        if (rep.Wants(n2.c_str())) {
+            titledb::IndexView v;
+            rep.Add(Measure(n2.c_str(), reps, [&] { v.Open(image.data(), image.size(), false); }));
+        }
+        std::string n3 = "lookup/index/" + ds.name + "/miss50";
+        if (rep.Wants(n3.c_str())) {
+            titledb::IndexView v;
+            v.Open(image.data(), image.size());
+            titledb::TitleTable t; t.LoadUtf8(ds.text.data(), ds.text.size());
+            auto queries = MakeQueries(KeysOf(t), 1 << 16, 50, 5);
+            size_t ops = opt.quick ? 200000 : 2000000, hits = 0;
+            rep.Add(MeasureBatched(n3.c_str(), ops, 32, [&](size_t i) {
+                const std::u16string& q = queries[i & (queries.size() - 1)];
+                uint64_t key; const char16_t* name; size_t len;
+                hits += titledb::PackTitleId(q.data(), q.size(), &key) && v.Find(key, &name, &len);
+            }));
+        }
+    }
+
+    // Paths of the kind a hover sees: camera and phone captures (date stamps are 8 digits, so they
+    // are candidates the database rejects), documents, downloads, music, hashes and GUID folders,
+    // system folders, and 5% Xbox archive items that name a known ID inside a longer name.
+    std::vector<std::u16string> MakeNameCorpus(const std::vector<uint64_t>& keys, size_t n, uint32_t seed) {
+        static const char* const kDirs[] = { "C:\\Users\\alex\\Pictures\\2023", "C:\\Users\\alex\\Downloads",
+                                             "D:\\Music\\Various Artists", "C:\\Program Files\\Common Files",
+                                             "E:\\Projects\\titledb\\.git\\objects", "C:\\Windows\\System32\\DriverStore" };
+        static const char* const kArchive[] = { "%s [%s]", "%s_backup", "%s (%s) - Copy", "Content\\%s\\000D0000", "%s - %s.iso" };
+        static const char* const kTitles[] = { "Halo 2", "Forza Motorsport 4", "Fable II", "Gears of War 3", "Crackdown" };
+        std::mt19937 rng(seed);
+        std::vector<std::u16string> corpus;
+        char leaf[128], id[9] = {};
+        for (size_t i = 0; i < n; ++i) {
+            unsigned kind = rng() % 100;
+            const char* dir = kDirs[rng() % 6];
+            if (kind < 5) {
+                titledb::UnpackTitleId(keys[rng() % keys.size()], id);
+                const char* fmt = kArchive[rng() % 5];
+                const char* title = kTitles[rng() % 5];
+                if (fmt[0] == '%' && fmt[1] == 's' && fmt[2] == '_') std::snprintf(leaf, sizeof(leaf), fmt, id);
+                else if (fmt[0] == 'C') std::snprintf(leaf, sizeof(leaf), fmt, id);
+                else std::snprintf(leaf, sizeof(leaf), fmt, title, id);
+                dir = "F:\\Xbox Archive\\Games";
+            } else if (kind < 35) {
+                std::snprintf(leaf, sizeof(leaf), "IMG_2023%02u%02u_%06u.jpg", unsigned(rng() % 12 + 1), unsigned(rng() % 28 + 1), unsigned(rng() % 1000000));
+            } else if (kind < 50) {
+                static const char* const kDocs[] = { "Quarterly Report Q3 (final) v2.docx", "Invoice-2023-0412.pdf", "notes.txt",
+                                                     "Screenshot 2023-07-04 141530.png", "Budget 2024 - Draft.xlsx" };
+                std::snprintf(leaf, sizeof(leaf), "%s", kDocs[rng() % 5]);
+            } else if (kind < 65) {
+                std::snprintf(leaf, sizeof(leaf), "setup_x64_v%u.%u.%u.exe", unsigned(rng() % 9), unsigned(rng() % 20), unsigned(rng() % 100));
+            } else if (kind < 75) {
+                std::snprintf(leaf, sizeof(leaf), "%02u - Artist Name - Track Title (Remastered %u).mp3", unsigned(rng() % 20 + 1), unsigned(1990 + rng() % 30));
+            } else if (kind < 85) {
+                std::snprintf(leaf, sizeof(leaf), "%08x%08x%08x%08x%08x", unsigned(rng()), unsigned(rng()), unsigned(rng()), unsigned(rng()), unsigned(rng()));
+            } else if (kind < 92) {
+                std::snprintf(leaf, sizeof(leaf), "{%08X-%04X-%04X-%04X-%08X%04X}", unsigned(rng()), unsigned(rng() & 0xFFFF), unsigned(rng() & 0xFFFF),
+                              unsigned(rng() & 0xFFFF), unsigned(rng()), unsigned(rng() & 0xFFFF));
+            } else {
+                static const char* const kSystem[] = { "$RECYCLE.BIN", "System Volume Information", "desktop.ini", "node_modules", "Thumbs.db" };
+                std::snprintf(leaf, sizeof(leaf), "%s", kSystem[rng() % 5]);
+            }
+            std::string path = std::string(dir) + "\\" + leaf;
+            corpus.emplace_back(path.begin(), path.end());
+        }
+        return corpus;
+    }
+
+    // Title IDs inside longer names over MakeNameCorpus: "exact" is the whole-name test alone (what
+    // the handler did before), "leaf" scans the item's name and "path" the whole path, each with
+    // the SSE2 classification and with the plain loop, checking every candidate against the table.
+    // As in the handler, a name that is an ID by itself is not scanned, except by "path" when the
+    // ID is unknown (Content\<id>\000D0000). ops is one path; candidates and matches are per path.
+    void BenchNameScan(Report& rep, const Dataset& ds, const Options& opt) {
+        static const char* const kModes[] = { "exact", "leaf/simd", "leaf/plain", "path/simd", "path/plain" };
+        bool any = false;
+        for (const char* mode : kModes) any |= rep.Wants(("name_scan/" + ds.name + "/" + mode).c_str());
+        if (!any) return;
+        titledb::TitleTable table;
+        table.LoadUtf8(ds.text.data(), ds.text.size());
+        auto corpus = MakeNameCorpus(KeysOf(table), 4096, 41);
+        double chars = 0;
+        for (const auto& p : corpus) chars += double(p.size());
+        titledb::TitleScanner scanner;
+        size_t ops = opt.quick ? 200000 : 2000000;
+        for (const char* mode : kModes) {
+            std::string name = "name_scan/" + ds.name + "/" + mode;
+            if (!rep.Wants(name.c_str())) continue;
+            bool exact = !std::strcmp(mode, "exact"), leafOnly = !std::strncmp(mode, "leaf", 4);
+            bool simd = std::strstr(mode, "simd") != nullptr;
+            uint64_t candidates = 0, matches = 0;
+            Result r = MeasureBatched(name.c_str(), ops, 32, [&](size_t i) {
+                const std::u16string& path = corpus[i & (corpus.size() - 1)];
+                std::u16string_view leaf = titledb::LeafName<char16_t>(path);
+                uint64_t key;
+                const char16_t* n; size_t len;
+                if (titledb::PackTitleId(leaf.data(), leaf.size(), &key)) {
+                    bool known = table.Find(key, &n, &len);
+                    if (known || exact || leafOnly) { matches += known; return; }
+                }
+                if (exact) return;
+                std::u16string_view text = leafOnly ? leaf : std::u16string_view(path);
+                bool found = false;
+                scanner.ForEachCandidate(text.data(), text.size(), [&](uint64_t k, size_t) {
+                    ++candidates;
+                    if (table.Find(k, &n, &len)) { key = k; found = true; }
+                    return true;
+                }, simd);
+                matches += found;
+            });
+            r.extra.push_back({ "chars_per_path", chars / double(corpus.size()) });
+            r.extra.push_back({ "candidates", double(candidates) / double(ops) });
+            r.extra.push_back({ "matches", double(matches) / double(ops) });
+            rep.Add(std::move(r));
+        }
+    }
+
+    // The same mapping file declaring columns, with every title given platform, region and year
+    // columns and one in three a publisher from a pool of 300 (the rest fall back to their ID prefix).
+    std::string AddMetaColumns(const std::string& text, uint32_t seed) {
+        static const char* const kPlatforms[] = { "xbox", "360", "one", "series", "pc" };
+        static const char* const kRegions[] = { "ntsc-u", "pal", "ntsc-j", "free", "asia" };
+        std::mt19937 rng(seed);
+        size_t at = text.compare(0, 3, "\xEF\xBB\xBF") == 0 ? 3 : 0; // the declaration goes after a BOM
+        std::string out = text.substr(0, at) + "#columns platform region year publisher\r\n";
+        out.reserve(text.size() + text.size() / 2);
+        while (at < text.size()) {
+            size_t end = text.find('\n', at);
+            end = end == std::string::npos ? text.size() : end + 1;
+            size_t body = end;
+            while (body > at && (text[body - 1] == '\n' || text[body - 1] == '\r')) --body;
+            out.append(text, at, body - at);
+            if (body > at && text[at] != '#' && text[at] != ';' && text.find('=', at) < body) {
+                out += "\tplatform=";
+                out += kPlatforms[rng() % 5];
+                out += "\tregion=";
+                out += kRegions[rng() % 5];
+                out += "\tyear=" + std::to_string(2001 + rng() % 24);
+                if (rng() % 3 == 0) out += "\tpublisher=Publisher " + std::to_string(rng() % 300);
+            }
+            out.append(text, body, end - body);
+            at = end;
+        }
+        return out;
+    }
+
+    // Title details. load: the names alone into a TitleTable (the handler before details), then the
+    // table plus TitleMetaTable for the same file without columns (legacy) and with every title
+    // described (columns); bytes_per_entry is table plus details per title. The details are loaded
+    // as the handler does next to an index, shared table or built-in list (TitleMetaTable::LoadFile),
+    // and meta_bytes_read counts what they read of the file: fails if that is more than the head of
+    // the legacy file, whose body must not be touched, or less than all of the columns one.
+    // format: a tooltip for a hover, 10% misses: the name alone copied into the output buffer
+    // (name_only, TipDetails 0) against the details looked up and formatted straight into it.
+    void BenchMeta(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string loadNames = "meta/load/" + ds.name + "/names", loadLegacy = "meta/load/" + ds.name + "/legacy",
+                    loadColumns = "meta/load/" + ds.name + "/columns", formatName = "meta/format/" + ds.name + "/name_only",
+                    formatDetails = "meta/format/" + ds.name + "/details";
+        bool any = false;
+        for (const std::string* n : { &loadNames, &loadLegacy, &loadColumns, &formatName, &formatDetails }) any |= rep.Wants(n->c_str());
+        if (!any) return;
+        std::string columns = AddMetaColumns(ds.text, 23);
+        size_t reps = opt.quick ? 3 : 10;
+        titledb::TitleTable table;
+        titledb::TitleMetaTable meta;
+        size_t metaBytesRead = 0;
+        auto load = [&](const std::string& name, const std::string& text, bool withMeta) {
+            if (!rep.Wants(name.c_str())) return;
+            Result r = Measure(name.c_str(), reps, [&] {
+                table.LoadUtf8(text.data(), text.size());
+                if (!withMeta) return;
+                metaBytesRead = 0;
+                meta.LoadFile([&](char* buf, size_t cap) {
+                                  size_t n = std::min(cap, text.size());
+                                  std::memcpy(buf, text.data(), n);
+                                  metaBytesRead += n;
+                                  return n;
+                              },
+                              [&](auto&& fn) {
+                                  metaBytesRead += text.size();
+                                  fn(text.data(), text.size());
+                                  return true;
+                              });
+            });
+            if (withMeta) {
+                r.extra.push_back({ "meta_bytes_read", double(metaBytesRead) });
+                if (meta.HasColumns() ? metaBytesRead < text.size() : metaBytesRead > titledb::kDeclarationBytes) {
+                    rep.Fail(name.c_str(), "details read " + std::to_string(metaBytesRead) + " of " +
+                                               std::to_string(text.size()) + " bytes");
+                }
+            }
+            size_t bytes = table.MemoryBytes() + (withMeta ? meta.MemoryBytes() : 0);
+            r.extra.push_back({ "mb_per_s", double(text.size()) / (r.p50 / 1e9) / 1e6 });
+            r.extra.push_back({ "entries", double(table.Size()) });
+            r.extra.push_back({ "described", withMeta ? double(meta.Size()) : 0.0 });
+            r.extra.push_back({ "publishers", withMeta ? double(meta.PublisherCount()) : 0.0 });
+            r.extra.push_back({ "bytes_per_entry", double(bytes) / double(std::max<size_t>(1, table.Size())) });
+            rep.Add(std::move(r));
+        };
+        load(loadNames, ds.text, false);
+        load(loadLegacy, ds.text, true);
+        load(loadColumns, columns, true);
+
+        table.LoadUtf8(columns.data(), columns.size());
+        meta.LoadUtf8(columns.data(), columns.size());
+        auto queries = MakeQueries(KeysOf(table), 4096, 10, 29);
+        std::vector<uint64_t> keys;
+        for (auto& q : queries) { uint64_t k = 0; titledb::PackTitleId(q.data(), q.size(), &k); keys.push_back(k); }
+        std::vector<char16_t> out(4096);
+        size_t ops = opt.quick ? 200000 : 2000000;
+        uint64_t chars = 0, tips = 0;
+        auto format = [&](const std::string& name, bool details) {
+            if (!rep.Wants(name.c_str())) return;
+            chars = tips = 0;
+            Result r = MeasureBatched(name.c_str(), ops, 16, [&](size_t i) {
+                uint64_t key = keys[i & (keys.size() - 1)];
+                const char16_t* n; size_t len;
+                if (!table.Find(key, &n, &len) || !len) return;
+                titledb::TitleMeta m = details ? meta.Describe(key) : titledb::TitleMeta();
+                size_t total = titledb::FormatTitleTip<char16_t>(n, len, m, nullptr);
+                if (total + 1 > out.size()) return;
+                titledb::FormatTitleTip(n, len, m, out.data());
+                out[total] = 0;
+                chars += total;
+                ++tips;
+            });
+            r.extra.push_back({ "chars_per_tip", tips ? double(chars) / double(tips) : 0.0 });
+            if (r.allocsPerOp != 0) rep.Fail(name.c_str(), "formatting a tooltip allocated");
+            rep.Add(std::move(r));
+        };
+        format(formatName, false);
+        format(formatDetails, true);
+        g_sink += out[0];
+    }
+
+    // A list as the handler holds one for the hover path: the names and the file's columns.
+    struct TipLayer {
+        titledb::TitleTable table;
+        titledb::TitleMetaTable meta;
+
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const { return table.Find(key, name, len); }
+        bool Contains(uint64_t key) const { const char16_t* n; size_t len; return table.Find(key, &n, &len); }
+        size_t Size() const { return table.Size(); }
+        template <class Fn>
+        void ForEach(Fn&& fn) const { table.ForEach(fn); }
+        const char16_t* NameData() const { return table.NameData(); }
+    };
+
+    // What a generation of the handler holds for the lookup: the merged lists and their key filter.
+    struct TipGeneration {
+        titledb::LayeredTable<TipLayer> merged;
+        titledb::KeyFilter filter;
+    };
+
+    // Tooltip assembly for a title folder, malloc standing in for CoTaskMemAlloc (so it is not in
+    // allocs_per_op, which counts operator new). "copying" is the old GetInfoTip: path, leaf name
+    // and name copied into strings, then into a fresh output buffer. "direct" is the current one,
+    // the handler's own code (TitleLookup.h) over a published generation of a file with columns:
+    // the ID from the path (one in eight an ID inside a longer name, MatchInName 1), the name and
+    // details from the lists and the built-in list, formatted once straight into the output buffer
+    // while the generation is held. 10% of hovers miss. Fails if "direct" allocates anything.
+    void BenchTooltip(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string copyingName = "tooltip/copying/" + ds.name, directName = "tooltip/direct/" + ds.name;
+        if (!rep.Wants(copyingName.c_str()) && !rep.Wants(directName.c_str())) return;
+        std::string columns = AddMetaColumns(ds.text, 23);
+        auto layer = std::make_shared<TipLayer>();
+        layer->table.LoadUtf8(columns.data(), columns.size());
+        layer->meta.LoadUtf8(columns.data(), columns.size());
+        titledb::SnapshotCell<titledb::TitleTable> cell;
+        auto t = std::make_unique<titledb::TitleTable>();
+        t->LoadUtf8(ds.text.data(), ds.text.size());
+        auto queries = MakeQueries(KeysOf(*t), 4096, 10, 21);
+        cell.Publish(std::move(t));
+        titledb::SnapshotCell<TipGeneration> generation;
+        auto g = std::make_unique<TipGeneration>();
+        g->merged.SetLayer(0, layer);
+        g->filter.Reset(g->merged.Size());
+        g->merged.ForEach([&](uint64_t key, const char16_t*, size_t) { g->filter.Add(key); });
+        generation.Publish(std::move(g));
+        titledb::TitleScanner scanner;
+        std::vector<std::u16string> paths;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            paths.push_back(i % 8 == 7 ? u"F:\\Xbox Archive\\Games\\Halo 2 [" + queries[i] + u"]"
+                                       : u"D:\\Archive\\Xbox\\Content\\" + queries[i]);
+        }
+        size_t ops = opt.quick ? 100000 : 1000000;
+        uint64_t buffers = 0;
+        auto add = [&](Result r) {
+            r.extra.push_back({ "out_buffers_per_op", double(buffers) / double(r.ops) });
+            rep.Add(std::move(r));
+        };
+        if (rep.Wants(copyingName.c_str())) {
+            buffers = 0;
+            add(MeasureBatched(copyingName.c_str(), ops, 16, [&](size_t i) {
+                std::u16string path = paths[i & (paths.size() - 1)];
+                std::u16string leaf(titledb::LeafName<char16_t>(path));
+                std::u16string title;
+                {
+                    auto snap = cell.Read();
+                    const char16_t* n; size_t len;
+                    if (snap->Find(leaf.data(), leaf.size(), &n, &len)) title.assign(n, len);
+                }
+                if (title.empty()) return;
+                auto out = static_cast<char16_t*>(std::malloc((title.size() + 1) * sizeof(char16_t)));
+                std::memcpy(out, title.c_str(), (title.size() + 1) * sizeof(char16_t));
+                ++buffers;
+                g_sink += out[0];
+                std::free(out);
+            }));
+        }
+        if (rep.Wants(directName.c_str())) {
+            buffers = 0;
+            Result r = MeasureBatched(directName.c_str(), ops, 16, [&](size_t i) {
+                std::u16string_view path = paths[i & (paths.size() - 1)];
+                char16_t* out = nullptr;
+                {
+                    auto snap = generation.Read();
+                    titledb::TitleSources<TipLayer> src;
+                    src.merged = &snap->merged;
+                    src.filter = &snap->filter;
+                    src.builtIn = &titledb::kEmbeddedTitles;
+                    auto known = [&](uint64_t k) {
+                        const char16_t* n; size_t len;
+                        bool builtIn;
+                        return titledb::FindTitle(src, k, &n, &len, &builtIn);
+                    };
+                    uint64_t key;
+                    bool builtIn;
+                    if (!titledb::TitleIdOfPath(path, 1, scanner, known, &key)) return;
+                    titledb::LookupTitle(src, key, true, &builtIn, [&](const char16_t* n, size_t len, const titledb::TitleMeta& meta) {
+                        out = titledb::AllocTitleTip<char16_t>(n, len, meta, [](size_t bytes) { return std::malloc(bytes); });
+                    });
+                }
+                if (!out) return;
+                ++buffers;
+                g_sink += out[0];
+                std::free(out);
+            });
+            if (r.allocsPerOp != 0) rep.Fail(directName.c_str(), "the hover path allocated");
+            add(std::move(r));
+        }
+    }
+
+    // Default tooltips for a synthetic 10k-item folder listing. A hover stats the item (StatPath
+    // stands in for GetFileAttributesExW) and builds its tooltip: size string, upper-cased
+    // extension and local date/time (strftime stands in for GetDateFormatW/GetTimeFormatW).
+    // "viewport" hovers at random within 40 visible rows while the view scrolls one row every 20
+    // hovers; "random" picks any of the 10k items. "uncached" formats every time, "cached" goes
+    // through TooltipCache (4096 entries, the handler's default), "hit" is a cached lookup alone.
+    void BenchTooltipCache(Report& rep, const Options& opt) {
+        namespace fs = std::filesystem;
+        const char* const kNames[] = { "tooltip_cache/viewport/uncached", "tooltip_cache/viewport/cached",
+                                       "tooltip_cache/random/cached", "tooltip_cache/hit" };
+        bool any = false;
+        for (const char* n : kNames) any |= rep.Wants(n);
+        if (!any) return;
+
+        std::error_code ec;
+        fs::path root = fs::temp_directory_path(ec) / "XboxTitleBench.listing";
+        fs::remove_all(root, ec);
+        fs::create_directories(root, ec);
+        static const char* const kExt[] = { "jpg", "png", "txt", "iso", "xex", "mp4", "zip", "" };
+        const size_t kItems = 10000;
+        std::vector<std::string> paths;
+        std::vector<std::u16string> wide;
+        for (size_t i = 0; i < kItems; ++i) {
+            char leaf[48];
+            const char* ext = kExt[i % 8];
+            std::snprintf(leaf, sizeof(leaf), "Capture %05u%s%s", unsigned(i), *ext ? "." : "", ext);
+            fs::path p = root / leaf;
+            if (i % 8 == 7) fs::create_directories(p, ec);
+            else if (FILE* f = std::fopen(p.string().c_str(), "wb")) { std::fwrite(leaf, 1, i % 3000, f); std::fclose(f); }
+            paths.push_back(p.string());
+            wide.emplace_back(paths.back().begin(), paths.back().end());
+        }
+        if (ec) { std::fprintf(stderr, "note: cannot create %s, skipping tooltip_cache\n", root.string().c_str()); return; }
+
+        auto format = [](const std::u16string& path, const titledb::FileInfo& fi, bool dir) {
+            char buf[160];
+            int n = 0;
+            if (dir) {
+                n = std::snprintf(buf, sizeof(buf), "File folder");
+            } else {
+                size_t dot = path.find_last_of(u'.'), slash = path.find_last_of(u"\\/");
+                if (dot != std::u16string::npos && (slash == std::u16string::npos || dot > slash)) {
+                    for (size_t k = dot + 1; k < path.size() && n < 16; ++k) {
+                        char16_t ch = path[k];
+                        buf[n++] = char(ch >= u'a' && ch <= u'z' ? ch - 32 : ch);
+                    }
+                    n += std::snprintf(buf + n, sizeof(buf) - n, " file\r\n");
+                }
+                n += std::snprintf(buf + n, sizeof(buf) - n, fi.size < 1024 ? "%.0f bytes" : "%.1f KB",
+                                   fi.size < 1024 ? double(fi.size) : double(fi.size) / 1024.0);
+            }
+            std::time_t t = std::time_t((fi.writeTime - 116444736000000000ULL) / 10000000ULL);
+            n += int(std::strftime(buf + n, sizeof(buf) - n, "\r\nDate modified: %x %H:%M", std::localtime(&t)));
+            return std::u16string(buf, buf + n);
+        };
+        auto stamp = [&](size_t k, titledb::FileInfo* fi, bool* dir) {
+            *dir = k % 8 == 7; // GetFileAttributesExW reports this with the rest
+            return titledb::StatPath(paths[k], fi);
+        };
+        auto viewport = [&](size_t i, std::mt19937& rng) { return (i / 20 + rng() % 40) % kItems; };
+        size_t ops = opt.quick ? 20000 : 200000;
+
+        if (rep.Wants(kNames[0])) {
+            std::mt19937 rng(41);
+            rep.Add(MeasureBatched(kNames[0], ops, 16, [&](size_t i) {
+                size_t k = viewport(i, rng);
+                titledb::FileInfo fi; bool dir;
+                if (stamp(k, &fi, &dir)) g_sink += format(wide[k], fi, dir).size();
+            }));
+        }
+        for (int random = 0; random < 2; ++random) {
+            const char* name = kNames[1 + random];
+            if (!rep.Wants(name)) continue;
+            titledb::TooltipCache<char16_t> cache;
+            std::mt19937 rng(41);
+            char16_t out[2048];
+            Result r = MeasureBatched(name, ops, 16, [&](size_t i) {
+                size_t k = random ? rng() % kItems : viewport(i, rng);
+                titledb::FileInfo fi; bool dir;
+                if (!stamp(k, &fi, &dir)) return;
+                uint64_t size = fi.size | (dir ? 1ULL << 63 : 0);
+                size_t len = 0;
+                if (cache.Find(wide[k].data(), wide[k].size(), fi.writeTime, size,
+                               [&](const char16_t* t, size_t n) { std::memcpy(out, t, n * sizeof(char16_t)); len = n; })) {
+                    g_sink += len;
+                    return;
+                }
+                std::u16string tip = format(wide[k], fi, dir);
+                cache.Insert(wide[k].data(), wide[k].size(), fi.writeTime, size, tip.data(), tip.size());
+                g_sink += tip.size();
+            });
+            titledb::TooltipCacheStats st = cache.Stats();
+            r.extra.push_back({ "hit_rate", double(st.hits) / double(std::max<uint64_t>(1, st.hits + st.misses + st.stale)) });
+            r.extra.push_back({ "entries", double(st.entries) });
+            r.extra.push_back({ "arena_bytes", double(st.bytes) });
+            r.extra.push_back({ "evictions", double(st.evictions) });
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants(kNames[3])) {
+            titledb::TooltipCache<char16_t> cache;
+            std::vector<titledb::FileInfo> infos(1024);
+            for (size_t k = 0; k < 1024; ++k) {
+                bool dir;
+                stamp(k, &infos[k], &dir);
+                std::u16string tip = format(wide[k], infos[k], dir);
+                cache.Insert(wide[k].data(), wide[k].size(), infos[k].writeTime, infos[k].size, tip.data(), tip.size());
+            }
+            char16_t out[2048];
+            rep.Add(MeasureBatched(kNames[3], ops * 10, 64, [&](size_t i) {
+                size_t k = (i * 7919) & 1023;
+                cache.Find(wide[k].data(), wide[k].size(), infos[k].writeTime, infos[k].size,
+                           [&](const char16_t* t, size_t n) { std::memcpy(out, t, n * sizeof(char16_t)); g_sink += n; });
+            }));
+        }
+        fs::remove_all(root, ec);
+    }
+
+    // Layered databases: the dataset as the system layer plus a per-user file that renames 10% of
+    // its IDs and adds a few of its own. "full_rebuild" re-parses both files and merges them, as
+    // a reload did before layers; "user_reload" re-parses only the user file and re-merges it into
+    // a copy of the previous merged table, as the handler does when only that file changed.
+    void BenchLayers(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string fullName = "layers/full_rebuild/" + ds.name;
+        std::string userName = "layers/user_reload/" + ds.name;
+        if (!rep.Wants(fullName.c_str()) && !rep.Wants(userName.c_str())) return;
+
+        auto system = std::make_shared<titledb::TitleTable>();
+        system->LoadUtf8(ds.text.data(), ds.text.size());
+        std::vector<uint64_t> keys = KeysOf(*system);
+        std::string userText;
+        char line[64];
+        for (size_t i = 0; i < keys.size(); i += 10) {
+            char id[9] = {};
+            titledb::UnpackTitleId(keys[i], id);
+            userText.append(line, size_t(std::snprintf(line, sizeof(line), "%s=My Copy %zu\r\n", id, i)));
+        }
+        for (unsigned i = 0; i < 100; ++i) userText.append(line, size_t(std::snprintf(line, sizeof(line), "ZZ%06u=Homebrew %u\r\n", i, i)));
+
+        auto merge = [](titledb::LayeredTable<titledb::TitleTable>& merged, titledb::KeyFilter& filter) {
+            filter.Reset(merged.Size());
+            merged.ForEach([&](uint64_t key, const char16_t*, size_t) { filter.Add(key); });
+        };
+        titledb::LayeredTable<titledb::TitleTable> base;
+        titledb::KeyFilter filter;
+        base.SetLayer(0, system);
+        auto user = std::make_shared<titledb::TitleTable>();
+        user->LoadUtf8(userText.data(), userText.size());
+        base.SetLayer(1, user);
+        merge(base, filter);
+        size_t reps = opt.quick ? 5 : 10;
+
+        if (rep.Wants(fullName.c_str())) {
+            Result r = Measure(fullName.c_str(), reps, [&] {
+                auto s0 = std::make_shared<titledb::TitleTable>();
+                s0->LoadUtf8(ds.text.data(), ds.text.size());
+                auto u = std::make_shared<titledb::TitleTable>();
+                u->LoadUtf8(userText.data(), userText.size());
+                titledb::LayeredTable<titledb::TitleTable> merged;
+                titledb::KeyFilter f;
+                merged.SetLayer(0, std::move(s0));
+                merged.SetLayer(1, std::move(u));
+                merge(merged, f);
+                g_sink += merged.Size();
+            });
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants(userName.c_str())) {
+            size_t touched = 0;
+            Result r = Measure(userName.c_str(), reps, [&] {
+                auto u = std::make_shared<titledb::TitleTable>();
+                u->LoadUtf8(userText.data(), userText.size());
+                titledb::LayeredTable<titledb::TitleTable> merged(base);
+                titledb::KeyFilter f;
+                touched = merged.SetLayer(1, std::move(u));
+                merge(merged, f);
+                g_sink += merged.Size();
+            });
+            // Memory: the layers plus the merged slots, against one table holding the merged result.
+            titledb::TitleTable single;
+            base.ForEach([&](uint64_t key, const char16_t* name, size_t len) { single.Set(key, name, len); });
+            single.ShrinkToFit();
+            r.extra.push_back({ "entries_touched", double(touched) });
+            r.extra.push_back({ "merged_entries", double(base.Size()) });
+            r.extra.push_back({ "layered_bytes", double(system->MemoryBytes() + user->MemoryBytes() + base.MemoryBytes() + filter.MemoryBytes()) });
+            r.extra.push_back({ "single_table_bytes", double(single.MemoryBytes()) });
+            rep.Add(std::move(r));
+        }
+    }
+
+    // Reloading a mapping file after a small change, at several file sizes. "full" parses the new
+    // file from scratch; "append" adds 10 lines to the end on every rep; "edit" rewrites 5 names
+    // in the middle of the file (alternating between two versions). Both incremental scenarios
+    // Load into the same IncrementalTable, so they exclude the copy the handler makes to publish
+    // a new generation; "copy" is that cost on its own.
+    void BenchReload(Report& rep, const Options& opt) {
+        std::vector<size_t> sizes = { 10000, 100000 };
+        if (!opt.quick) sizes.push_back(1000000);
+        for (size_t lines : sizes) {
+            std::string suffix = "/lines=" + std::to_string(lines);
+            std::string fullName = "reload/full" + suffix, appendName = "reload/append" + suffix;
+            std::string editName = "reload/edit" + suffix, copyName = "reload/copy" + suffix;
+            std::string patchName = "reload/columns/patch" + suffix, rebuildName = "reload/columns/rebuild" + suffix;
+            if (!rep.Wants(fullName.c_str()) && !rep.Wants(appendName.c_str()) && !rep.Wants(editName.c_str()) &&
+                !rep.Wants(copyName.c_str()) && !rep.Wants(patchName.c_str()) && !rep.Wants(rebuildName.c_str())) continue;
+            std::string text = MakeMappingText(lines, 11);
+            size_t reps = opt.quick ? 5 : 20;
+            auto addStats = [](Result& r, const titledb::ReloadStats& st) {
+                r.extra.push_back({ "records_touched", double(st.Touched()) });
+                r.extra.push_back({ "blocks_parsed", double(st.blocksParsed) });
+                r.extra.push_back({ "blocks", double(st.blocks) });
+            };
+
+            if (rep.Wants(fullName.c_str())) {
+                titledb::TitleTable t;
+                Result r = Measure(fullName.c_str(), reps, [&] { t.LoadUtf8(text.data(), text.size()); });
+                r.extra.push_back({ "entries", double(t.Size()) });
+                rep.Add(std::move(r));
+            }
+            if (rep.Wants(appendName.c_str())) {
+                titledb::IncrementalTable t;
+                std::string grown = text;
+                grown.reserve(text.size() + reps * 10 * 40);
+                t.Load(grown.data(), grown.size());
+                titledb::ReloadStats st;
+                char line[64];
+                unsigned next = 0;
+                Result r = Measure(appendName.c_str(), reps, [&] {
+                    for (int k = 0; k < 10; ++k, ++next) grown.append(line, size_t(std::snprintf(line, sizeof(line), "7E%06X=Appended %u\r\n", next, next)));
+                    t.Load(grown.data(), grown.size(), &st);
+                });
+                addStats(r, st);
+                rep.Add(std::move(r));
+            }
+            if (rep.Wants(editName.c_str())) {
+                // Second version: 5 names between 40% and 60% of the file get a different first letter.
+                std::string edited = text;
+                for (int k = 0; k < 5; ++k) {
+                    size_t eq = edited.find('=', edited.size() * (40 + 5 * k) / 100);
+                    while (eq != std::string::npos && (unsigned char)edited[eq + 1] >= 0x80) eq = edited.find('=', eq + 1);
+                    if (eq != std::string::npos) edited[eq + 1] = edited[eq + 1] == 'Q' ? 'X' : 'Q';
+                }
+                titledb::IncrementalTable t;
+                t.Load(text.data(), text.size());
+                titledb::ReloadStats st;
+                bool flip = false;
+                Result r = Measure(editName.c_str(), reps, [&] {
+                    const std::string& now = (flip = !flip) ? edited : text;
+                    t.Load(now.data(), now.size(), &st);
+                });
+                addStats(r, st);
+                rep.Add(std::move(r));
+            }
+            if (rep.Wants(copyName.c_str())) {
+                titledb::IncrementalTable t;
+                t.Load(text.data(), text.size());
+                Result r = Measure(copyName.c_str(), reps, [&] {
+                    titledb::IncrementalTable c(t);
+                    g_sink += c.Size();
+                });
+                r.extra.push_back({ "table_bytes", double(t.MemoryBytes()) });
+                rep.Add(std::move(r));
+            }
+            // The same kind of edit in a file with columns, reloaded as the handler does: names
+            // incremental, then the columns patched from the lines the reload re-read (the previous
+            // table copied and patched) or rebuilt from the whole file.
+            for (bool patch : { true, false }) {
+                const std::string& name = patch ? patchName : rebuildName;
+                if (!rep.Wants(name.c_str())) continue;
+                std::string columns = AddMetaColumns(text, 13), edited = columns;
+                size_t year = edited.find("\tyear=", edited.size() / 2);
+                if (year != std::string::npos) edited[year + 8] = edited[year + 8] == '0' ? '1' : '0';
+                titledb::IncrementalTable t;
+                titledb::TitleMetaTable meta;
+                t.Load(columns.data(), columns.size());
+                meta.LoadUtf8(columns.data(), columns.size());
+                titledb::ReloadStats st;
+                std::vector<titledb::ReloadRecord> records;
+                bool flip = false;
+                Result r = Measure(name.c_str(), reps, [&] {
+                    const std::string& now = (flip = !flip) ? edited : columns;
+                    t.Load(now.data(), now.size(), &st, nullptr, &records);
+                    if (patch && st.kind != titledb::ReloadStats::Full) {
+                        titledb::TitleMetaTable next = meta;
+                        next.Patch(std::move(records));
+                        meta = std::move(next);
+                    } else {
+                        meta.LoadUtf8(now.data(), now.size());
+                    }
+                });
+                addStats(r, st);
+                r.extra.push_back({ "described", double(meta.Size()) });
+                rep.Add(std::move(r));
+            }
+        }
+    }
+
+    // Name search: building the index on first use, then prefix queries (the first 4 characters
+    // of a random name) and substring queries (5 characters from inside a random name), 20 hits
+    // at most, as the search command asks.
+    void BenchSearch(Report& rep, const Dataset& ds, const Options& opt) {
+        std::string buildName = "search/build/" + ds.name, prefixName = "search/prefix/" + ds.name;
+        std::string substringName = "search/substring/" + ds.name;
+        if (!rep.Wants(buildName.c_str()) && !rep.Wants(prefixName.c_str()) && !rep.Wants(substringName.c_str())) return;
+        titledb::TitleTable table;
+        table.LoadUtf8(ds.text.data(), ds.text.size());
+        std::vector<uint64_t> keys = KeysOf(table);
+        if (keys.empty()) return;
+
+        if (rep.Wants(buildName.c_str())) {
+            size_t bytes = 0;
+            Result r = Measure(buildName.c_str(), opt.quick ? 1 : 3, [&] {
+                titledb::NameSearch<titledb::TitleTable> s(table);
+                s.Build();
+                bytes = s.MemoryBytes();
+            });
+            r.extra.push_back({ "index_bytes", double(bytes) });
+            r.extra.push_back({ "table_bytes", double(table.MemoryBytes()) });
+            r.extra.push_back({ "index_bytes_per_title", double(bytes) / double(keys.size()) });
+            rep.Add(std::move(r));
+        }
+
+        titledb::NameSearch<titledb::TitleTable> search(table);
+        search.Build();
+        std::mt19937 rng(13);
+        std::vector<std::u16string> prefixes, substrings;
+        for (size_t i = 0; i < 1000; ++i) {
+            const char16_t* name; size_t len;
+            table.Find(keys[rng() % keys.size()], &name, &len);
+            prefixes.emplace_back(name, std::min<size_t>(len, 4));
+            size_t at = len > 6 ? 1 + rng() % (len - 6) : 0;
+            substrings.emplace_back(name + at, std::min<size_t>(len - at, 5));
+        }
+        size_t ops = opt.quick ? 2000 : 20000;
+        for (int kind = 0; kind < 2; ++kind) {
+            const std::string& name = kind ? substringName : prefixName;
+            if (!rep.Wants(name.c_str())) continue;
+            const auto& queries = kind ? substrings : prefixes;
+            uint64_t found = 0;
+            Result r = MeasureBatched(name.c_str(), ops, 1, [&](size_t i) {
+                const std::u16string& q = queries[i % queries.size()];
+                found += search.Search(q.data(), q.size(), 20).size();
+            });
+            r.extra.push_back({ "hits_per_query", double(found) / double(ops) });
+            g_sink += found;
+            rep.Add(std::move(r));
+        }
+    }
+
+    // GetInfoTip over a folder where 99% of items are not known titles: ordinary files, folders,
+    // title-shaped words and unknown IDs, plus 1% real title folders. "unstaged" is the old order
+    // (attributes first, then name checks, then the default tooltip's own stat); "staged" rejects
+    // on the name and the key filter and only stats for the default tooltip or a known title.
+    // std::filesystem::status stands in for GetFileAttributesW, StatPath for GetFileAttributesExW.
+    void BenchInfoTipMiss(Report& rep, const Dataset& ds, const Options& opt) {
+        namespace fs = std::filesystem;
+        std::string unstagedName = "infotip_99miss/unstaged/" + ds.name;
+        std::string stagedName = "infotip_99miss/staged/" + ds.name;
+        std::string classifyName = "infotip_99miss/classify_only/" + ds.name;
+        if (!rep.Wants(unstagedName.c_str()) && !rep.Wants(stagedName.c_str()) && !rep.Wants(classifyName.c_str())) return;
+
+        titledb::TitleTable table;
+        table.LoadUtf8(ds.text.data(), ds.text.size());
+        titledb::KeyFilter filter;
+        filter.Reset(table.Size());
+        table.ForEach([&](uint64_t key, const char16_t*, size_t) { filter.Add(key); });
+        std::vector<uint64_t> keys = KeysOf(table);
+
+        std::error_code ec;
+        fs::path root = fs::temp_directory_path(ec) / "XboxTitleBench.items";
+        fs::remove_all(root, ec);
+        fs::create_directories(root, ec);
+        static const char* const kShaped[] = { "Document", "Pictures", "Programs", "Settings", "Download",
+                                               "DCIM0001", "Untitled", "Projects", "Archives", "Contacts" };
+        std::mt19937 rng(33);
+        std::vector<std::string> paths;
+        std::vector<std::u16string> leaves;
+        const size_t kItems = 2048;
+        for (size_t i = 0; i < kItems; ++i) {
+            std::string leaf;
+            bool dir = false;
+            unsigned kind = rng() % 100;
+            char buf[32];
+            if (kind == 0) { // a known title folder
+                titledb::UnpackTitleId(keys[rng() % keys.size()], buf); buf[8] = 0;
+                leaf = buf; dir = true;
+            } else if (kind < 60) { // ordinary file
+                std::snprintf(buf, sizeof(buf), "IMG_%04u.jpg", unsigned(i)); leaf = buf;
+            } else if (kind < 80) { // ordinary folder
+                std::snprintf(buf, sizeof(buf), "Folder %u", unsigned(i)); leaf = buf; dir = true;
+            } else if (kind < 90) { // 8 letters/digits but a word
+                leaf = kShaped[rng() % 10]; dir = true;
+                leaf[7] = char('0' + i % 10);
+            } else { // hex ID that is not in the mapping
+                std::snprintf(buf, sizeof(buf), "%08X", unsigned(rng()) | 0xF0000000u); leaf = buf; dir = true;
+            }
+            fs::path p = root / leaf;
+            if (dir) fs::create_directories(p, ec);
+            else if (FILE* f = std::fopen(p.string().c_str(), "wb")) { std::fputs("x", f); std::fclose(f); }
+            paths.push_back(p.string());
+            leaves.emplace_back(leaf.begin(), leaf.end());
+        }
+        if (ec) { std::fprintf(stderr, "note: cannot create %s, skipping infotip_99miss\n", root.string().c_str()); return; }
+
+        auto defaultTip = [&](const std::string& path) {
+            titledb::FileInfo fi;
+            char tip[64] = {};
+            if (titledb::StatPath(path, &fi)) std::snprintf(tip, sizeof(tip), "%.1f KB", double(fi.size) / 1024.0);
+            g_sink += uint64_t(tip[0]);
+        };
+        auto lookup = [&](uint64_t key, std::u16string& title) {
+            const char16_t* n; size_t len;
+            if (table.Find(key, &n, &len)) title.assign(n, len);
+        };
+        size_t ops = opt.quick ? 20000 : 200000;
+        uint64_t fsCalls = 0;
+
+        if (rep.Wants(unstagedName.c_str())) {
+            fsCalls = 0;
+            Result r = MeasureBatched(unstagedName.c_str(), ops, 16, [&](size_t i) {
+                size_t k = i & (kItems - 1);
+                ++fsCalls;
+                if (fs::is_directory(fs::status(paths[k], ec))) {
+                    const std::u16string& leaf = leaves[k];
+                    uint64_t key;
+                    std::u16string title;
+                    if (titledb::PackTitleId(leaf.data(), leaf.size(), &key)) lookup(key, title);
+                    if (!title.empty()) { g_sink += title.size(); return; }
+                }
+                ++fsCalls;
+                defaultTip(paths[k]);
+            });
+            r.extra.push_back({ "fs_calls_per_item", double(fsCalls) / double(ops) });
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants(stagedName.c_str())) {
+            fsCalls = 0;
+            Result r = MeasureBatched(stagedName.c_str(), ops, 16, [&](size_t i) {
+                size_t k = i & (kItems - 1);
+                const std::u16string& leaf = leaves[k];
+                uint64_t key;
+                if (titledb::PackTitleId(leaf.data(), leaf.size(), &key) && filter.MayContain(key)) {
+                    std::u16string title;
+                    lookup(key, title);
+                    if (!title.empty()) {
+                        ++fsCalls;
+                        if (fs::is_directory(fs::status(paths[k], ec))) { g_sink += title.size(); return; }
+                    }
+                }
+                ++fsCalls;
+                defaultTip(paths[k]);
+            });
+            r.extra.push_back({ "fs_calls_per_item", double(fsCalls) / double(ops) });
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants(classifyName.c_str())) {
+            uint64_t shapeRejects = 0, filterRejects = 0, falsePositives = 0;
+            Result r = MeasureBatched(classifyName.c_str(), ops * 10, 64, [&](size_t i) {
+                const std::u16string& leaf = leaves[i & (kItems - 1)];
+                uint64_t key;
+                const char16_t* n; size_t len;
+                if (!titledb::PackTitleId(leaf.data(), leaf.size(), &key)) ++shapeRejects;
+                else if (!filter.MayContain(key)) ++filterRejects;
+                else if (!table.Find(key, &n, &len)) ++falsePositives;
+            });
+            r.extra.push_back({ "rejected_by_shape", double(shapeRejects) / double(r.ops) });
+            r.extra.push_back({ "rejected_by_filter", double(filterRejects) / double(r.ops) });
+            r.extra.push_back({ "filter_false_positives", double(falsePositives) / double(r.ops) });
+            r.extra.push_back({ "filter_bytes", double(filter.MemoryBytes()) });
+            rep.Add(std::move(r));
+        }
+        fs::remove_all(root, ec);
+    }
+
+    // Readers hammer lookups for a fixed time, optionally while a writer reloads in a loop.
+    // The "mutex" variant reproduces the old design: one lock around lookups and rebuilds.
+    void BenchConcurrent(Report& rep, const Dataset& ds, const Options& opt, bool storm, bool useMutex) {
+        std::string name = std::string(useMutex ? "concurrent_mutex/" : "concurrent/") + ds.name +
+                           (storm ? "/reload_storm" : "/readers_only");
+        if (!rep.Wants(name.c_str())) return;
+        auto ms = std::chrono::milliseconds(opt.quick ? 300 : 1500);
+
+        titledb::SnapshotCell<titledb::TitleTable> cell;
+        titledb::TitleTable locked;
+        std::mutex mtx;
+        auto first = std::make_unique<titledb::TitleTable>();
+        first->LoadUtf8(ds.text.data(), ds.text.size());
+        auto queries = MakeQueries(KeysOf(*first), 1 << 16, 50, 3);
+        locked.LoadUtf8(ds.text.data(), ds.text.size());
+        cell.Publish(std::move(first));
+
+        std::atomic<bool> stop{ false };
+        std::atomic<uint64_t> lookups{ 0 };
+        std::vector<std::thread> readers;
+        for (unsigned t = 0; t < opt.threads; ++t) {
+            readers.emplace_back([&, t] {
+                uint64_t n = 0, hits = 0;
+                size_t i = t * 7919;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    for (int k = 0; k < 64; ++k, ++i) {
+                        const std::u16string& q = queries[i & (queries.size() - 1)];
+                        const char16_t* nm; size_t len;
+                        if (useMutex) {
+                            std::lock_guard<std::mutex> lk(mtx);
+                            hits += locked.Find(q.data(), q.size(), &nm, &len);
+                        } else {
+                            auto snap = cell.Read();
+                            hits += snap->Find(q.data(), q.size(), &nm, &len);
+                        }
+                    }
+                    n += 64;
+                }
+                lookups.fetch_add(n);
+                g_sink.fetch_add(hits, std::memory_order_relaxed);
+            });
+        }
+        std::vector<double> reloadNs;
+        auto start = Clock::now();
+        while (Clock::now() - start < ms) {
+            if (!storm) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); continue; }
+            auto t0 = Clock::now();
+            if (useMutex) {
+                std::lock_guard<std::mutex> lk(mtx);
+                locked.LoadUtf8(ds.text.data(), ds.text.size());
+            } else {
+                auto next = std::make_unique<titledb::TitleTable>();
+                next->LoadUtf8(ds.text.data(), ds.text.size());
+                cell.Publish(std::move(next));
+            }
+            reloadNs.push_back(NsSince(t0));
+        }
+        stop = true;
+        for (auto& th : readers) th.join();
+        double elapsed = NsSince(start);
+
+        Result r; r.name = name;
+        r.ops = lookups.load();
+        r.nsPerOp = elapsed * opt.threads / double(std::max<uint64_t>(1, r.ops));
+        r.extra.push_back({ "lookups_per_s", double(r.ops) / (elapsed / 1e9) });
+        r.extra.push_back({ "reloads", double(reloadNs.size()) });
+        if (!reloadNs.empty()) {
+            Result tmp; SetPercentiles(tmp, reloadNs);
+            r.extra.push_back({ "reload_p50_ns", tmp.p50 });
+            r.extra.push_back({ "reload_p99_ns", tmp.p99 });
+        }
+        rep.Add(std::move(r));
+    }
+
+    // Cost of a log call: formatting into the ring (a consumer drains it), a call filtered by
+    // level, and the old open/append/close per call.
+    void BenchLogging(Report& rep, const Options& opt) {
+        size_t ops = opt.quick ? 100000 : 1000000;
+        const wchar_t* path = L"C:\\Archive\\Xbox\\4D530064";
+        if (rep.Wants("log/ring_formatted")) {
+            static titledb::LogRing<wchar_t, 512, 512> ring;
+            std::atomic<bool> stop{ false };
+            std::thread consumer([&] {
+                while (!stop.load()) {
+                    if (!ring.Drain([](titledb::LogLevel, uint64_t, const wchar_t*, size_t) {})) std::this_thread::yield();
+                }
+            });
+            Result r = MeasureBatched("log/ring_formatted", ops, 16, [&](size_t i) {
+                ring.Push(titledb::LogLevel::Info, i, [&](wchar_t* buf, size_t cap) {
+                    int n = std::swprintf(buf, cap, L"[Query] Directory Name: %ls", path);
+                    return n < 0 ? cap - 1 : size_t(n);
+                });
+            });
+            stop = true;
+            consumer.join();
+            r.extra.push_back({ "dropped", double(ring.Dropped()) });
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants("log/level_filtered")) {
+            volatile int minLevel = int(titledb::LogLevel::Warn);
+            size_t written = 0;
+            rep.Add(MeasureBatched("log/level_filtered", ops, 16, [&](size_t) {
+                if (int(titledb::LogLevel::Info) >= minLevel) ++written;
+            }));
+        }
+        if (rep.Wants("log/open_write_close")) {
+            std::string file = "XboxTitleBench.log.tmp";
+            rep.Add(Measure("log/open_write_close", opt.quick ? 2000 : 20000, [&] {
+                wchar_t buf[1024];
+                int n = std::swprintf(buf, 1024, L"[Query] Directory Name: %ls\r\n", path);
+                FILE* f = std::fopen(file.c_str(), "ab");
+                if (f) { std::fwrite(buf, sizeof(wchar_t), size_t(n), f); std::fclose(f); }
+            }));
+            std::remove(file.c_str());
+        }
+    }
+
+    // Cost of recording: a counter, a histogram sample, a timed scope (two clock reads and a
+    // sample), the same from every thread at once, and taking a snapshot as JSON. Uses the
+    // handler's own layout (HandlerMetrics.h), so the snapshot has its size and names.
+    void BenchMetrics(Report& rep, const Options& opt) {
+        using H = titledb::HandlerMetrics;
+        using M = titledb::Metrics<H>;
+        static M metrics;
+        size_t ops = opt.quick ? 1000000 : 10000000;
+        if (rep.Wants("metrics/counter")) {
+            rep.Add(MeasureBatched("metrics/counter", ops, 256, [&](size_t) { metrics.Add(H::LookupHits); }));
+        }
+        if (rep.Wants("metrics/record")) {
+            rep.Add(MeasureBatched("metrics/record", ops, 256, [&](size_t i) {
+                metrics.Record(H::Lookup, (i * 2654435761u) & 0xFFFFF); // 0..1 ms
+            }));
+        }
+        if (rep.Wants("metrics/timed_scope")) {
+            rep.Add(MeasureBatched("metrics/timed_scope", ops / 4, 256, [&](size_t) {
+                M::Timer t(metrics, H::InfoTip);
+            }));
+        }
+        std::string threaded = "metrics/record_threads=" + std::to_string(opt.threads);
+        if (rep.Wants(threaded.c_str())) {
+            std::vector<std::thread> threads;
+            auto start = Clock::now();
+            for (unsigned t = 0; t < opt.threads; ++t) {
+                threads.emplace_back([&, t] {
+                    for (size_t i = 0; i < ops; ++i) {
+                        metrics.Add(H::InfoTipCalls);
+                        metrics.Record(H::Freshness, (i + t) & 0xFFFF);
+                    }
+                });
+            }
+            for (auto& th : threads) th.join();
+            Result r; r.name = threaded;
+            r.ops = ops * opt.threads;
+            r.nsPerOp = NsSince(start) * opt.threads / double(r.ops); // per thread: counter + sample
+            rep.Add(std::move(r));
+        }
+        if (rep.Wants("metrics/snapshot_json")) {
+            std::string json;
+            Result r = Measure("metrics/snapshot_json", opt.quick ? 200 : 2000, [&] {
+                json = "{";
+                metrics.Snapshot().AppendJson(json);
+                json += "}";
+            });
+            r.extra.push_back({ "json_bytes", double(json.size()) });
+            r.extra.push_back({ "bytes", double(sizeof(M)) });
+            rep.Add(std::move(r));
+        }
+    }
+
+    // Per-call cost of the two freshness strategies: metadata only vs reading the whole file.
+    // unchanged: 100k lookups against a table loaded from a file, revalidated the way the handler
+    // does it (RevalidateClock and IsStale over the file's stamp) with the interval at 0, so every
+    // lookup checks. Fails unless no byte of the file is read while it stays as it is, and unless
+    // rewriting it makes exactly one lookup read it again.
+    void BenchFreshness(Report& rep, const Options& opt) {
+        titledb::FileInfo info;
+        if (titledb::StatPath(opt.file, &info)) {
+            size_t reps = opt.quick ? 2000 : 20000;
+            if (rep.Wants("freshness/stat")) {
+                rep.Add(Measure("freshness/stat", reps, [&] { titledb::FileInfo fi; titledb::StatPath(opt.file, &fi); }));
+            }
+            if (rep.Wants("freshness/read_all")) {
+                std::string bytes;
+                Result r = Measure("freshness/read_all", reps / 10, [&] { titledb::ReadFileBytes(opt.file, bytes); });
+                r.extra.push_back({ "bytes_per_call", double(info.size) });
+                rep.Add(std::move(r));
+            }
+        }
+
+        const char* const kUnchanged = "freshness/unchanged";
+        if (!rep.Wants(kUnchanged)) return;
+        std::error_code ec;
+        std::string path = (std::filesystem::temp_directory_path(ec) / "XboxTitleBench.fresh.txt").string();
+        std::string text = MakeMappingText(10000, 31);
+        if (FILE* f = std::fopen(path.c_str(), "wb")) { std::fwrite(text.data(), 1, text.size(), f); std::fclose(f); }
+        auto same = [](const titledb::FileInfo& a, const titledb::FileInfo& b) { return a.size == b.size && a.writeTime == b.writeTime; };
+
+        titledb::TitleTable table;
+        titledb::LoadedStamp<titledb::FileInfo> loaded;
+        titledb::RevalidateClock clock;
+        clock.SetInterval(0);
+        uint64_t bytesRead = 0, reloads = 0;
+        auto load = [&] {
+            std::string bytes;
+            loaded.present = titledb::StatPath(path, &loaded.stamp) && titledb::ReadFileBytes(path, bytes);
+            bytesRead += bytes.size();
+            ++reloads;
+            table.LoadUtf8(bytes.data(), bytes.size());
+        };
+        load();
+        std::vector<uint64_t> keys = KeysOf(table);
+        auto lookup = [&](size_t i) {
+            if (clock.ShouldCheck(uint64_t(i) + 1)) { // a fresh millisecond per lookup
+                titledb::FileInfo now;
+                bool exists = titledb::StatPath(path, &now);
+                if (titledb::IsStale(loaded, exists, now, same)) load();
+            }
+            const char16_t* name; size_t len;
+            if (table.Find(keys[i % keys.size()], &name, &len)) g_sink += len;
+        };
+        const size_t kLookups = 100000;
+        bytesRead = reloads = 0;
+        Result r = MeasureBatched(kUnchanged, kLookups, 64, lookup);
+        r.extra.push_back({ "bytes_read", double(bytesRead) });
+        r.extra.push_back({ "reloads", double(reloads) });
+        rep.Add(std::move(r));
+        if (bytesRead) rep.Fail(kUnchanged, std::to_string(bytesRead) + " bytes read while the file was unchanged");
+
+        text += "FFFF0001=Freshness Check\r\n"; // grows the file, so the stamp differs whatever the clock's resolution
+        if (FILE* f = std::fopen(path.c_str(), "wb")) { std::fwrite(text.data(), 1, text.size(), f); std::fclose(f); }
+        bytesRead = reloads = 0;
+        for (size_t i = 0; i < 1000; ++i) lookup(kLookups + i);
+        if (reloads != 1 || bytesRead != text.size()) {
+            rep.Fail(kUnchanged, "rewriting the file caused " + std::to_string(reloads) + " reloads of " +
+                                 std::to_string(bytesRead) + " bytes instead of one of " + std::to_string(text.size()));
+        }
+        std::remove(path.c_str());
+    }
+
+    // Peak resident memory of this process so far.
+    uint64_t PeakRssBytes() {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS pmc{};
+        pmc.cb = sizeof(pmc);
+        return K32GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? uint64_t(pmc.PeakWorkingSetSize) : 0;
+#else
+        struct rusage ru {};
+        getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+        return uint64_t(ru.ru_maxrss);
+#else
+        return uint64_t(ru.ru_maxrss) * 1024;
+#endif
+#endif
+    }
+
+    const uint32_t kWarmupWaitMs = 50; // warmup_wait: the bounded wait (LoadWaitMs in the handler)
+    const size_t kChurnRounds = 200;   // shared_churn: attaches per process
+    const size_t kChurnTitles = 5000;  // shared_churn: titles per published table
+
+    // Shared memory name of the table the shared_* children of one bench run use for FILE.
+    std::string SharedNameFor(const std::string& path) {
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llX", (unsigned long long)titledb::Fnv1a64(path.data(), path.size()));
+#ifdef _WIN32
+        return std::string("Local\\XboxTitleBench.") + hex;
+#else
+        return std::string("/XboxTitleBench.") + hex;
+#endif
+    }
+
+    // shared_churn tables: variant v names title i "Title i v<v>", so a reader can check any name
+    // it finds against the variant in the table's tag without a copy of its own.
+    uint64_t ChurnKey(size_t i) {
+        char id[9];
+        uint64_t key = 0;
+        std::snprintf(id, sizeof(id), "%08X", unsigned(0x20000000 + i * 37));
+        titledb::PackTitleId(id, 8, &key);
+        return key;
+    }
+
+    std::string ChurnName(size_t i, uint64_t variant) {
+        return "Title " + std::to_string(i) + " v" + std::to_string(variant);
+    }
+
+    std::string ChurnText(uint64_t variant) {
+        std::string text;
+        char id[9] = {};
+        for (size_t i = 0; i < kChurnTitles; ++i) {
+            titledb::UnpackTitleId(ChurnKey(i), id);
+            text.append(id).append("=").append(ChurnName(i, variant)).append("\n");
+        }
+        return text;
+    }
+
+    // Child side of the fresh-process scenarios (--child MODE FILE): do what MODE names with FILE
+    // and print "ns peak_rss_bytes table_bytes entries allocs ready_ns loading_lookups
+    // loading_max_ns published retries errors" (ready_ns to loading_max_ns only for the warmup
+    // modes, the last three only for the shared modes). Peak RSS only ever grows and a first lookup
+    // is only first once, so each run needs a process of its own.
+    //   none            nothing (the process baseline)
+    //   read_all        whole file read into memory, then parsed (the handler before mapping)
+    //   mapped          file mapped and parsed in place into an IncrementalTable (the handler)
+    //   stream          read and parsed in 1 MB chunks into a TitleTable (XboxTitleTool)
+    //   first_parse     first lookup after parsing the mapping file (no index, no built-in list)
+    //   first_index     first lookup in a compiled index (FILE is the .bin)
+    //   first_matched   first lookup with the built-in list after checking the file is its source
+    //   first_embedded  first lookup with the built-in list and no file
+    //   warmup_sync     file mapped and loaded, then the first lookup (the handler with LoadAsync 0)
+    //   warmup_async    load on a worker; the first lookup answers at once, from the built-in list
+    //                   while the table is not published, and lookups go on until it is
+    //   warmup_wait     as warmup_async, but the first lookup waits up to kWarmupWaitMs for the table
+    //   shared_attach   the table for FILE from shared memory, compiled and published first if no
+    //                   process has yet (the handler with SharedTable 1)
+    //   shared_churn    kChurnRounds attaches to a synthetic shared table, republishing the next
+    //                   variant one time in 16; ns is the mean attach and check, errors counts
+    //                   names that do not match their table's variant and tables that could not be had
+    int RunChild(const std::string& mode, const std::string& path) {
+        const uint64_t key = [] {
+            uint64_t k = 0;
+            size_t i = 0;
+            titledb::kEmbeddedTitles.ForEach([&](uint64_t key, const char16_t*, size_t) { if (i++ == titledb::kEmbeddedTitles.Size() / 2) k = key; });
+            return k;
+        }();
+        uint64_t a0 = g_allocs.load();
+        auto t0 = Clock::now();
+        size_t tableBytes = 0, entries = 0;
+        const char16_t* name = nullptr;
+        size_t len = 0;
+        bool ok = true;
+        double answerNs = -1, readyNs = 0, loadingMaxNs = 0;
+        uint64_t loadingLookups = 0, published = 0, retries = 0, errors = 0;
+        if (mode == "warmup_sync" || mode == "warmup_async" || mode == "warmup_wait") {
+            titledb::SnapshotCell<titledb::IncrementalTable> cell;
+            titledb::Warmup warmup;
+            titledb::MappedFile file;
+            std::atomic<bool> loaded{ false };
+            auto load = [&] {
+                auto table = std::make_unique<titledb::IncrementalTable>();
+                if (file.Open(path) && table->Load(file.Data(), file.Size())) {
+                    entries = table->Size();
+                    tableBytes = table->MemoryBytes();
+                    cell.Publish(std::move(table));
+                    loaded = true;
+                }
+                readyNs = NsSince(t0);
+                warmup.Finish(true);
+            };
+            // As LookupName: the published table, else the built-in list.
+            auto lookup = [&] {
+                auto snap = cell.Read();
+                return (snap && snap->Find(key, &name, &len)) || titledb::kEmbeddedTitles.Find(key, &name, &len);
+            };
+            warmup.Start();
+            std::thread worker;
+            if (mode == "warmup_sync") load();
+            else worker = std::thread(load);
+            if (mode == "warmup_wait") warmup.Wait(kWarmupWaitMs);
+            lookup();
+            answerNs = NsSince(t0);
+            while (!warmup.IsReady()) {
+                auto l0 = Clock::now();
+                lookup();
+                loadingMaxNs = std::max(loadingMaxNs, NsSince(l0));
+                ++loadingLookups;
+                std::this_thread::yield(); // hovers, not a spin: leave the core to the loader
+            }
+            if (worker.joinable()) worker.join();
+            ok = loaded;
+        } else if (mode == "shared_attach") {
+            titledb::SharedTitles shared(SharedNameFor(path));
+            titledb::FileInfo info;
+            ok = shared.Open() && titledb::StatPath(path, &info);
+            titledb::SharedTag want;
+            want.v[0] = info.size;
+            want.v[1] = info.writeTime;
+            auto table = ok ? shared.Attach() : nullptr;
+            if (ok && (!table || table->Tag() != want)) {
+                bool built = false;
+                table = shared.Publish(want, [&](std::vector<unsigned char>& image, titledb::SharedTag&) {
+                    titledb::MappedFile file;
+                    return file.Open(path) && titledb::CompileIndex(file.Data(), file.Size(), info.size, info.writeTime, image);
+                }, &built);
+                published = built;
+            }
+            ok = table != nullptr;
+            if (ok) {
+                table->Index().Find(key, &name, &len);
+                entries = table->Index().Size();
+            }
+            retries = shared.Retries();
+        } else if (mode == "shared_churn") {
+            titledb::SharedTitles shared(SharedNameFor(path));
+            ok = shared.Open();
+            std::mt19937 rng(std::random_device{}());
+            std::u16string expect;
+            double total = 0;
+            for (size_t round = 0; ok && round < kChurnRounds; ++round) {
+                auto r0 = Clock::now();
+                auto table = shared.Attach();
+                if (!table || rng() % 16 == 0) {
+                    // First in, or the "file" changed: publish the variant after the one seen.
+                    // Processes that want the same variant at once build it once between them.
+                    titledb::SharedTag want;
+                    want.v[0] = (table ? table->Tag().v[0] : 0) + 1;
+                    bool built = false;
+                    table = shared.Publish(want, [&](std::vector<unsigned char>& image, titledb::SharedTag& tag) {
+                        std::string text = ChurnText(tag.v[0]);
+                        return titledb::CompileIndex(text.data(), text.size(), 0, 0, image);
+                    }, &built);
+                    published += built;
+                    if (!table) { ++errors; continue; }
+                }
+                uint64_t variant = table->Tag().v[0];
+                for (int check = 0; check < 8; ++check) {
+                    size_t i = rng() % kChurnTitles;
+                    std::string want = ChurnName(i, variant);
+                    expect.assign(want.begin(), want.end());
+                    if (!table->Index().Find(ChurnKey(i), &name, &len) || expect.compare(0, expect.size(), name, len) != 0) ++errors;
+                }
+                total += NsSince(r0);
+            }
+            answerNs = total / double(kChurnRounds);
+            entries = kChurnTitles;
+            retries = shared.Retries();
+        } else if (mode == "read_all" || mode == "first_parse") {
+            std::string bytes;
+            titledb::IncrementalTable table;
+            ok = titledb::ReadFileBytes(path, bytes) && table.Load(bytes.data(), bytes.size());
+            if (mode == "first_parse") ok = ok && table.Find(key, &name, &len);
+            tableBytes = table.MemoryBytes();
+            entries = table.Size();
+        } else if (mode == "mapped") {
+            titledb::MappedFile file;
+            titledb::IncrementalTable table;
+            ok = file.Open(path) && table.Load(file.Data(), file.Size());
+            tableBytes = table.MemoryBytes();
+            entries = table.Size();
+        } else if (mode == "stream") {
+            titledb::FileReader reader(path);
+            titledb::TitleTable table;
+            ok = reader.IsOpen() && table.LoadStream(reader);
+            tableBytes = table.MemoryBytes();
+            entries = table.Size();
+        } else if (mode == "first_index") {
+            titledb::MappedFile file;
+            titledb::IndexView index;
+            ok = file.Open(path) && index.Open(file.Data(), file.Size()) && index.Find(key, &name, &len);
+            entries = index.Size();
+        } else if (mode == "first_matched") {
+            titledb::MappedFile file;
+            ok = file.Open(path) && titledb::kEmbeddedTitles.IsSource(file.Data(), file.Size()) &&
+                 titledb::kEmbeddedTitles.Find(key, &name, &len);
+            entries = titledb::kEmbeddedTitles.Size();
+        } else if (mode == "first_embedded") {
+            ok = titledb::kEmbeddedTitles.Find(key, &name, &len);
+            entries = titledb::kEmbeddedTitles.Size();
+        } else {
+            ok = mode == "none";
+        }
+        double ns = answerNs >= 0 ? answerNs : NsSince(t0);
+        uint64_t allocs = g_allocs.load() - a0;
+        if (!ok) return 1;
+        g_sink += len;
+        std::printf("%.0f %llu %llu %llu %llu %.0f %llu %.0f %llu %llu %llu\n", ns, (unsigned long long)PeakRssBytes(),
+                    (unsigned long long)tableBytes, (unsigned long long)entries, (unsigned long long)allocs, readyNs,
+                    (unsigned long long)loadingLookups, loadingMaxNs, (unsigned long long)published,
+                    (unsigned long long)retries, (unsigned long long)errors);
+        return 0;
+    }
+
+    struct ChildRun {
+        double ns = 0, peakRss = 0, tableBytes = 0, entries = 0, allocs = 0;
+        double readyNs = 0, loadingLookups = 0, loadingMaxNs = 0;
+        double published = 0, retries = 0, errors = 0;
+    };
+
+    // Start a child (--child MODE FILE) without waiting for it; FinishChild collects its report.
+    FILE* StartChild(const std::string& self, const char* mode, const std::string& path) {
+        std::string cmd = "\"" + self + "\" --child " + mode + " \"" + path + "\"";
+#ifdef _WIN32
+        cmd = "\"" + cmd + "\""; // cmd.exe strips the outer quotes
+        return _popen(cmd.c_str(), "r");
+#else
+        return popen(cmd.c_str(), "r");
+#endif
+    }
+
+    bool FinishChild(FILE* p, ChildRun* out) {
+        if (!p) return false;
+        int n = std::fscanf(p, "%lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf", &out->ns, &out->peakRss, &out->tableBytes,
+                            &out->entries, &out->allocs, &out->readyNs, &out->loadingLookups, &out->loadingMaxNs,
+                            &out->published, &out->retries, &out->errors);
+#ifdef _WIN32
+        int status = _pclose(p);
+#else
+        int status = pclose(p);
+#endif
+        return n == 11 && status == 0;
+    }
+
+    bool RunChildProcess(const std::string& self, const char* mode, const std::string& path, ChildRun* out) {
+        return FinishChild(StartChild(self, mode, path), out);
+    }
+
+    // Loading a file of several hundred MB holding a million titles: time, peak RSS of the loading
+    // process and the resulting table size for each way of getting the bytes in. ops is one load.
+    void BenchLargeLoad(Report& rep, const Options& opt, const std::string& self) {
+        static const char* const kModes[] = { "read_all", "mapped", "stream" };
+        size_t mb = opt.quick ? 64 : 400;
+        std::string prefix = "large_load/" + std::to_string(mb) + "MB/";
+        bool any = false;
+        for (const char* mode : kModes) any |= rep.Wants((prefix + mode).c_str());
+        if (!any) return;
+        std::error_code ec;
+        std::string path = (std::filesystem::temp_directory_path(ec) / "XboxTitleBench.large.txt").string();
+        if (ec || !WriteMappingFile(path, mb << 20, 1000000, 13)) {
+            std::fprintf(stderr, "note: cannot write %s, skipping large_load scenarios\n", path.c_str());
+            return;
+        }
+        titledb::FileInfo info;
+        titledb::StatPath(path, &info);
+        ChildRun base;
+        if (!RunChildProcess(self, "none", path, &base)) {
+            std::fprintf(stderr, "note: cannot run %s as a child, skipping large_load scenarios\n", self.c_str());
+            std::filesystem::remove(path, ec);
+            return;
+        }
+        for (const char* mode : kModes) {
+            std::string name = prefix + mode;
+            if (!rep.Wants(name.c_str())) continue;
+            ChildRun c;
+            if (!RunChildProcess(self, mode, path, &c)) {
+                std::fprintf(stderr, "note: %s failed\n", name.c_str());
+                continue;
+            }
+            Result r;
+            r.name = name;
+            r.ops = 1;
+            r.nsPerOp = r.p50 = r.p99 = c.ns;
+            const double kMB = 1024.0 * 1024.0;
+            r.extra.push_back({ "file_mb", double(info.size) / kMB });
+            r.extra.push_back({ "entries", c.entries });
+            r.extra.push_back({ "table_mb", c.tableBytes / kMB });
+            r.extra.push_back({ "peak_rss_mb", c.peakRss / kMB });
+            r.extra.push_back({ "baseline_rss_mb", base.peakRss / kMB });
+            r.extra.push_back({ "mb_per_s", double(info.size) / kMB / (c.ns / 1e9) });
+            rep.Add(std::move(r));
+        }
+        std::filesystem::remove(path, ec);
+    }
+
+    // Many processes loading one mapping file at once, each with a table of its own (private: the
+    // handler without SharedTable) and with one table in shared memory that the first of them
+    // compiles and the rest attach to (attach); then many processes attaching to a shared table
+    // while they keep republishing it (churn). Children run concurrently; ns_per_op is the mean time
+    // to a usable table (churn: to attach and check one), table_mb the mean private heap of the
+    // table per process, published the generations built between them, retries the attaches that
+    // found their generation replaced under them and errors anything that went wrong (must be 0).
+    void BenchShared(Report& rep, const Options& opt, const std::string& self) {
+        struct Mode { const char* label; const char* mode; };
+        static const Mode kModes[] = { { "private", "mapped" }, { "attach", "shared_attach" }, { "churn", "shared_churn" } };
+        size_t procs = opt.quick ? 8 : 32;
+        std::string suffix = "/" + std::to_string(procs) + "procs";
+        bool any = false;
+        for (const Mode& m : kModes) any |= rep.Wants((std::string("shared/") + m.label + suffix).c_str());
+        if (!any) return;
+        std::error_code ec;
+        std::string path = (std::filesystem::temp_directory_path(ec) / "XboxTitleBench.shared.txt").string();
+        if (ec || !WriteMappingFile(path, (opt.quick ? 8u : 32u) << 20, 200000, 19)) {
+            std::fprintf(stderr, "note: cannot write %s, skipping shared scenarios\n", path.c_str());
+            return;
+        }
+        std::string shm = SharedNameFor(path);
+        for (const Mode& m : kModes) {
+            std::string name = std::string("shared/") + m.label + suffix;
+            if (!rep.Wants(name.c_str())) continue;
+            titledb::SharedTitles::Remove(shm);
+            std::vector<FILE*> children;
+            for (size_t i = 0; i < procs; ++i) children.push_back(StartChild(self, m.mode, path));
+            std::vector<double> samples;
+            ChildRun sum;
+            size_t failed = 0;
+            for (FILE* p : children) {
+                ChildRun c;
+                if (!FinishChild(p, &c)) { ++failed; continue; }
+                samples.push_back(c.ns);
+                sum.ns += c.ns;
+                sum.tableBytes += c.tableBytes;
+                sum.peakRss += c.peakRss;
+                sum.entries = c.entries;
+                sum.published += c.published;
+                sum.retries += c.retries;
+                sum.errors += c.errors;
+            }
+            titledb::SharedTitles::Remove(shm);
+            if (samples.empty()) {
+                std::fprintf(stderr, "note: %s failed\n", name.c_str());
+                continue;
+            }
+            double n = double(samples.size());
+            Result r;
+            r.name = name;
+            r.ops = samples.size();
+            r.nsPerOp = sum.ns / n;
+            SetPercentiles(r, samples);
+            const double kMB = 1024.0 * 1024.0;
+            r.extra.push_back({ "processes", n });
+            r.extra.push_back({ "entries", sum.entries });
+            r.extra.push_back({ "table_mb", sum.tableBytes / n / kMB });
+            r.extra.push_back({ "peak_rss_mb", sum.peakRss / n / kMB });
+            r.extra.push_back({ "published", sum.published });
+            r.extra.push_back({ "retries", sum.retries });
+            r.extra.push_back({ "errors", sum.errors + double(failed) });
+            if (sum.errors + double(failed) > 0) std::fprintf(stderr, "warning: %s: %.0f errors\n", name.c_str(), sum.errors + double(failed));
+            rep.Add(std::move(r));
+        }
+        std::filesystem::remove(path, ec);
+    }
+
+    // First lookup in a fresh process, each run in a process of its own, for every way the handler
+    // can get its list: parsing XboxTitleIDs.txt, mapping the compiled index, and the list compiled
+    // in (after checking the installed file is its source, or with no file). ns_per_op is the mean
+    // in-process time from nothing loaded to the name found; process_us is the whole child run.
+    void BenchFirstLookup(Report& rep, const Options& opt, const std::string& self) {
+        static const char* const kModes[] = { "first_parse", "first_index", "first_matched", "first_embedded" };
+        bool any = false;
+        for (const char* mode : kModes) any |= rep.Wants((std::string("first_lookup/") + (mode + 6)).c_str());
+        if (!any) return;
+        titledb::FileInfo info;
+        std::string text;
+        if (!titledb::StatPath(opt.file, &info) || !titledb::ReadFileBytes(opt.file, text)) return;
+        if (!titledb::kEmbeddedTitles.IsSource(text.data(), text.size())) {
+            std::fprintf(stderr, "note: %s is not the file XboxTitleIDsEmbedded.h was generated from, skipping first_lookup scenarios\n",
+                         opt.file.c_str());
+            return;
+        }
+        std::error_code ec;
+        std::string bin = (std::filesystem::temp_directory_path(ec) / "XboxTitleBench.first.bin").string();
+        std::vector<unsigned char> image;
+        if (ec || !titledb::CompileIndex(text.data(), text.size(), info.size, info.writeTime, image) ||
+            !titledb::WriteFileBytes(bin, image.data(), image.size())) {
+            std::fprintf(stderr, "note: cannot write %s, skipping first_lookup scenarios\n", bin.c_str());
+            return;
+        }
+        size_t runs = opt.quick ? 5 : 20;
+        for (const char* mode : kModes) {
+            std::string name = std::string("first_lookup/") + (mode + 6);
+            if (!rep.Wants(name.c_str())) continue;
+            std::vector<double> samples, process;
+            ChildRun c;
+            for (size_t i = 0; i < runs; ++i) {
+                auto t0 = Clock::now();
+                if (!RunChildProcess(self, mode, std::strcmp(mode, "first_index") ? opt.file : bin, &c)) break;
+                process.push_back(NsSince(t0));
+                samples.push_back(c.ns);
+            }
+            if (samples.size() != runs) {
+                std::fprintf(stderr, "note: %s failed\n", name.c_str());
+                continue;
+            }
+            Result r;
+            r.name = name;
+            r.ops = runs;
+            for (double ns : samples) r.nsPerOp += ns / double(runs);
+            SetPercentiles(r, samples);
+            r.allocsPerOp = c.allocs;
+            std::sort(process.begin(), process.end());
+            r.extra.push_back({ "process_us", process[process.size() / 2] / 1000.0 });
+            r.extra.push_back({ "entries", c.entries });
+            rep.Add(std::move(r));
+        }
+        std::filesystem::remove(bin, ec);
+    }
+
+    // Time to the first answer in a fresh process with the load on the hovering thread (sync), on a
+    // worker with the first lookup answered from the built-in list at once (async), and on a
+    // worker with a bounded wait of kWarmupWaitMs (wait50ms), for the shipped file and a large
+    // synthetic one. ns_per_op is the mean time from nothing loaded to the first answer; ready_ms
+    // is when the table was published, loading_lookups how many more lookups the hovering thread
+    // answered before that and loading_max_ns the slowest of them.
+    void BenchWarmup(Report& rep, const Options& opt, const std::string& self) {
+        static const char* const kModes[] = { "warmup_sync", "warmup_async", "warmup_wait" };
+        static const char* const kNames[] = { "sync", "async", "wait50ms" };
+        size_t mb = opt.quick ? 16 : 64;
+        struct Source { std::string label, path; };
+        std::vector<Source> sources = { { "shipped", opt.file }, { std::to_string(mb) + "MB", "" } };
+        bool wantLarge = false;
+        for (const char* n : kNames) wantLarge |= rep.Wants(("warmup/" + sources[1].label + "/" + n).c_str());
+        std::error_code ec;
+        if (wantLarge) {
+            sources[1].path = (std::filesystem::temp_directory_path(ec) / "XboxTitleBench.warmup.txt").string();
+            if (ec || !WriteMappingFile(sources[1].path, mb << 20, 1000000, 17)) {
+                std::fprintf(stderr, "note: cannot write %s, skipping its warmup scenarios\n", sources[1].path.c_str());
+                sources[1].path.clear();
+            }
+        }
+        titledb::FileInfo info;
+        if (!titledb::StatPath(opt.file, &info)) sources[0].path.clear();
+        for (const Source& src : sources) {
+            if (src.path.empty()) continue;
+            size_t runs = src.label == "shipped" ? (opt.quick ? 5 : 20) : 3;
+            for (size_t m = 0; m < 3; ++m) {
+                std::string name = "warmup/" + src.label + "/" + kNames[m];
+                if (!rep.Wants(name.c_str())) continue;
+                std::vector<double> samples;
+                double readyNs = 0, lookups = 0, maxNs = 0, allocs = 0, entries = 0;
+                for (size_t i = 0; i < runs; ++i) {
+                    ChildRun c;
+                    if (!RunChildProcess(self, kModes[m], src.path, &c)) break;
+                    samples.push_back(c.ns);
+                    readyNs += c.readyNs / double(runs);
+                    lookups += c.loadingLookups / double(runs);
+                    maxNs = std::max(maxNs, c.loadingMaxNs);
+                    allocs = c.allocs;
+                    entries = c.entries;
+                }
+                if (samples.size() != runs) {
+                    std::fprintf(stderr, "note: %s failed\n", name.c_str());
+                    continue;
+                }
+                Result r;
+                r.name = name;
+                r.ops = runs;
+                for (double ns : samples) r.nsPerOp += ns / double(runs);
+                SetPercentiles(r, samples);
+                r.allocsPerOp = allocs;
+                r.extra.push_back({ "ready_ms", readyNs / 1e6 });
+                r.extra.push_back({ "loading_lookups", lookups });
+                r.extra.push_back({ "loading_max_ns", maxNs });
+                r.extra.push_back({ "entries", entries });
+                rep.Add(std::move(r));
+            }
+        }
+        if (!sources[1].path.empty()) std::filesystem::remove(sources[1].path, ec);
+    }
+
+    // Batch resolver scaling: one generated tree (archive/publisher/title/content, the layout of a
+    // real Xbox archive) walked with 1, 2, 4 and 8 threads. ops is directories walked.
+    void BenchResolve(Report& rep, const Options& opt) {
+        namespace fs = std::filesystem;
+        const unsigned kThreads[] = { 1, 2, 4, 8 };
+        bool any = false;
+        for (unsigned threads : kThreads) any |= rep.Wants(("resolve/threads=" + std::to_string(threads)).c_str());
+        if (!any) return;
+        titledb::TitleTable table;
+        std::string text = MakeMappingText(10000, 5);
+        table.LoadUtf8(text.data(), text.size());
+        std::vector<uint64_t> keys = KeysOf(table);
+
+        std::error_code ec;
+        fs::path root = fs::temp_directory_path(ec) / "XboxTitleBench.tree";
+        fs::remove_all(root, ec);
+        size_t archives = opt.quick ? 4 : 16, titles = opt.quick ? 50 : 200;
+        std::mt19937 rng(9);
+        for (size_t a = 0; a < archives; ++a) {
+            for (size_t t = 0; t < titles; ++t) {
+                char id[9] = {};
+                if (rng() % 10 == 0) std::snprintf(id, sizeof(id), "%08X", unsigned(rng() | 0x10)); // mostly unknown
+                else titledb::UnpackTitleId(keys[rng() % keys.size()], id);
+                fs::path dir = root / ("archive" + std::to_string(a)) / "Content" / id;
+                fs::create_directories(dir / "000D0000", ec);
+                fs::create_directories(dir / "00007000", ec);
+                fs::create_directories(dir / "Saves", ec);
+            }
+        }
+        if (ec) { std::fprintf(stderr, "note: cannot create %s, skipping resolve scenarios\n", root.string().c_str()); return; }
+
+        for (unsigned threads : kThreads) {
+            std::string name = "resolve/threads=" + std::to_string(threads);
+            if (!rep.Wants(name.c_str())) continue;
+            titledb::ResolveStats st;
+            uint64_t emitted = 0;
+            Result r = Measure(name.c_str(), opt.quick ? 3 : 5, [&] {
+                st = titledb::ResolveTree(root, threads,
+                    [&](uint64_t key, const char16_t** n, size_t* len) { return table.Find(key, n, len); },
+                    [&](const std::vector<titledb::ResolveHit>& batch) { emitted += batch.size(); });
+            });
+            // Measure times whole walks; rescale so the per-op fields are per directory.
+            double walkNs = r.nsPerOp, dirs = double(st.directories);
+            r.ops *= st.directories;
+            r.nsPerOp /= dirs; r.p50 /= dirs; r.p99 /= dirs;
+            r.allocsPerOp /= dirs;
+            r.extra.push_back({ "dirs_per_s", double(st.directories) / (walkNs / 1e9) });
+            r.extra.push_back({ "title_folders", double(st.matches) });
+            r.extra.push_back({ "known", double(st.known) });
+            g_sink += emitted;
+            rep.Add(std::move(r));
+        }
+        fs::remove_all(root, ec);
+    }
+
+    // ---------------- Parser check (--check) ----------------
+    // The wide-string parser the handler had before ParseMapping (ParseMappingLocked), kept as the
+    // reference for its semantics: the file converted whole by MultiByteToWideChar with
+    // MB_ERR_INVALID_CHARS (any invalid byte empties the table), a BOM dropped from the first
+    // line, lines split on CR, LF or CRLF, trimmed of spaces and tabs, '#'/';' comments, the ID
+    // trimmed and upper-cased, the rest of the line the name, the last line for an ID winning.
+    using LegacyMap = std::map<std::u16string, std::u16string>;
+
+    // UTF-8 to UTF-16 the way MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS) does it: all or
+    // nothing. Written out from the UTF-8 definition rather than with DecodeUtf8, which is under test.
+    bool LegacyUtf8ToWide(const std::string& s, std::u16string& out) {
+        out.clear();
+        for (size_t i = 0; i < s.size();) {
+            unsigned char b = static_cast<unsigned char>(s[i]);
+            size_t len = b < 0x80 ? 1 : (b & 0xE0) == 0xC0 ? 2 : (b & 0xF0) == 0xE0 ? 3 : (b & 0xF8) == 0xF0 ? 4 : 0;
+            if (len == 0 || i + len > s.size()) return false;
+            uint32_t cp = len == 1 ? b : b & (0xFF >> (len + 1));
+            for (size_t k = 1; k < len; ++k) {
+                unsigned char c = static_cast<unsigned char>(s[i + k]);
+                if ((c & 0xC0) != 0x80) return false;
+                cp = (cp << 6) | (c & 0x3F);
+            }
+            static const uint32_t kMin[] = { 0, 0, 0x80, 0x800, 0x10000 };
+            if (cp < kMin[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return false; // overlong, range, surrogate
+            if (cp >= 0x10000) {
+                out.push_back(char16_t(0xD800 + ((cp - 0x10000) >> 10)));
+                out.push_back(char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF)));
+            } else {
+                out.push_back(char16_t(cp));
+            }
+            i += len;
+        }
+        return true;
+    }
+
+    LegacyMap LegacyParse(const std::string& bytes) {
+        LegacyMap cache;
+        std::u16string text;
+        if (!LegacyUtf8ToWide(bytes, text)) return cache;
+        const char16_t* const kBlank = u" \t";
+        size_t i = 0, n = text.size();
+        while (i < n) {
+            size_t ls = i;
+            while (i < n && text[i] != u'\n' && text[i] != u'\r') ++i;
+            size_t le = i;
+            if (i < n && text[i] == u'\r') ++i;
+            if (i < n && text[i] == u'\n') ++i;
+
+            if (le <= ls) continue;
+            std::u16string line = text.substr(ls, le - ls);
+            if (ls == 0 && !line.empty() && line[0] == 0xFEFF) line.erase(0, 1);
+
+            auto lpos = line.find_first_not_of(kBlank);
+            if (lpos == std::u16string::npos) continue;
+            auto rpos = line.find_last_not_of(kBlank);
+            std::u16string trimmed = line.substr(lpos, rpos - lpos + 1);
+            if (trimmed[0] == u'#' || trimmed[0] == u';') continue;
+
+            size_t eq = trimmed.find(u'=');
+            if (eq == std::u16string::npos) continue;
+            std::u16string id = trimmed.substr(0, eq);
+            std::u16string name = trimmed.substr(eq + 1);
+            auto idl = id.find_first_not_of(kBlank);
+            if (idl == std::u16string::npos) continue;
+            id = id.substr(idl, id.find_last_not_of(kBlank) - idl + 1);
+            if (id.size() != 8) continue;
+            bool ok = true;
+            for (auto& ch : id) {
+                if (ch >= u'a' && ch <= u'z') ch = char16_t(ch - u'a' + u'A');
+                ok &= (ch >= u'0' && ch <= u'9') || (ch >= u'A' && ch <= u'Z');
+            }
+            if (ok) cache[id] = name;
+        }
+        return cache;
+    }
+
+    // What the loaders must give for a file: LegacyParse, and for a file whose first line (after a
+    // BOM) is a "#columns" comment, each name cut before its first TAB followed by lower-case
+    // letters and '=', along with the blanks before that TAB.
+    LegacyMap ExpectedNames(const std::string& bytes) {
+        LegacyMap cache = LegacyParse(bytes);
+        std::u16string text;
+        if (!LegacyUtf8ToWide(bytes, text)) return cache;
+        if (!text.empty() && text[0] == 0xFEFF) text.erase(0, 1);
+        if (text.compare(0, 8, u"#columns") != 0 || (text.size() > 8 && std::u16string_view(u" \t\r\n").find(text[8]) == std::u16string_view::npos)) {
+            return cache;
+        }
+        for (auto& kv : cache) {
+            std::u16string& name = kv.second;
+            for (size_t t = name.find(u'\t'); t != std::u16string::npos; t = name.find(u'\t', t + 1)) {
+                size_t k = t + 1;
+                while (k < name.size() && name[k] >= u'a' && name[k] <= u'z') ++k;
+                if (k == t + 1 || k == name.size() || name[k] != u'=') continue;
+                while (t > 0 && (name[t - 1] == u' ' || name[t - 1] == u'\t')) --t;
+                name.resize(t);
+                break;
+            }
+        }
+        return cache;
+    }
+
+    std::u16string KeyText(uint64_t key) {
+        char16_t id[8];
+        titledb::UnpackTitleId(key, id);
+        return std::u16string(id, 8);
+    }
+
+    template <class Table>
+    LegacyMap MapOf(const Table& table) {
+        LegacyMap m;
+        table.ForEach([&](uint64_t key, const char16_t* name, size_t len) { m[KeyText(key)] = std::u16string(name, len); });
+        return m;
+    }
+
+    // The details of every title of names, formatted as the lines of its tooltip, to compare two
+    // TitleMetaTables.
+    LegacyMap DetailsOf(const titledb::TitleMetaTable& meta, const LegacyMap& names) {
+        LegacyMap m;
+        for (const auto& kv : names) {
+            uint64_t key = 0;
+            titledb::PackTitleId(kv.first.data(), kv.first.size(), &key);
+            titledb::TitleMeta d = meta.Describe(key);
+            std::u16string lines(titledb::FormatTitleTip<char16_t>(u"", 0, d, nullptr), u'\0');
+            titledb::FormatTitleTip(u"", 0, d, &lines[0]);
+            m[kv.first] = std::move(lines);
+        }
+        return m;
+    }
+
+    // Records of the new parser folded last-wins, the way every loader keeps them.
+    struct RecordFold {
+        LegacyMap map;
+        void operator()(uint64_t key, const char* name, size_t len) {
+            std::u16string wide(len, u'\0');
+            wide.resize(titledb::ConvertUtf8(name, len, &wide[0]));
+            map[KeyText(key)] = std::move(wide);
+        }
+    };
+
+    // Hands out a string in reads of 1..cap bytes (random lengths when seeded), so lines, CRLF
+    // pairs and UTF-8 sequences land across chunk boundaries.
+    struct PieceReader {
+        const std::string& text;
+        size_t at = 0;
+        std::mt19937 rng;
+        bool shortReads;
+        PieceReader(const std::string& t, uint32_t seed, bool shortReads) : text(t), rng(seed), shortReads(shortReads) {}
+        bool operator()(char* buf, size_t cap, size_t* got) {
+            size_t n = std::min(cap, text.size() - at);
+            if (shortReads && n > 1) n = 1 + rng() % n;
+            std::memcpy(buf, text.data() + at, n);
+            at += n;
+            *got = n;
+            return true;
+        }
+    };
+
+    std::string Printable(const std::string& s) {
+        std::string out;
+        for (unsigned char c : s.substr(0, 120)) {
+            char hex[8];
+            if (c >= 0x20 && c < 0x7F && c != '\\') out += char(c);
+            else { std::snprintf(hex, sizeof(hex), "\\x%02X", c); out += hex; }
+        }
+        return s.size() > 120 ? out + "..." : out;
+    }
+
+    // The edge cases: BOMs, every kind of line break (and a lone CR), blank and comment lines,
+    // IDs of the wrong length or with other characters, empty names and names with '=' or TABs,
+    // columns with and without the "#columns" line that declares them, embedded NUL, and valid,
+    // truncated, overlong, surrogate and out-of-range UTF-8.
+    std::vector<std::string> ParserEdgeCases() {
+        using namespace std::string_literals;
+        return {
+            ""s, "\r\n\n\r"s, "\xEF\xBB\xBF"s, "\xEF\xBB\xBF\r\n4D530064=Halo\n"s, "\xEF\xBB\xBF" "4D530064=Halo 2\r\n"s,
+            "4D530064=A\r\n\xEF\xBB\xBF" "4D530065=B\r\n"s, "\xEF\xBB" "4D530064=Half BOM\r\n"s,
+            "4D530064=A\r4D530065=B\r\r4D530066=C"s, "4D530064=A\r\n\r\n4D530065=B\n\r4D530066=C\r\n"s,
+            "4D530064=A\n\r\n\r\r\n4D530065=B"s, "4D530064=Lone CR at the end\r"s,
+            "4D530064=\r\n4D530065 = \r\n4D530066=\t\r\n"s, "  4d530064  =  Lower case ID, spaced name  \t\r\n"s,
+            "#4D530064=comment\r\n;4D530065=comment\r\n \t#4D530066=indented\r\n 4D530067=kept"s,
+            "4D53006=short\r\n4D5300644=long\r\n4D53-064=dash\r\n4D53 064=space\r\n=no ID\r\n4D530064\r\n"s,
+            "4D530064=a=b=c\r\n4D530065==\r\n"s, "4D530064=First\r\n4d530064=Second\r\n4D530064 =Third\r\n"s,
+            "4D530064=Name\twith a TAB\r\n4D530065=\tLeading TAB\r\n"s, "4D530064=A\0B\r\n4D530065=\0\r\n"s,
+            "4D530064=Caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80\r\n"s, "4D530064=Caf\xC3\r\n"s, "4D530064=\xE2\x82\r\n"s,
+            "4D530064=End\xF0\x9F\x98"s, "4D530064=\xC0\xAF\r\n"s, "4D530064=\xED\xA0\x80\r\n"s,
+            "4D530064=\xF4\x90\x80\x80\r\n"s, "4D530064=\x80\r\n"s, "4D530064=\xFF\r\n"s, "\xC3\xA9" "4D53006=\r\n"s,
+            "4D530064=" + std::string(5000, 'x') + "\r\n4D530065=after a long line"s,
+            "4D530064=Halo 2\tplatform=xbox\tyear=2004\r\n4D530065=Name \tyear=2004\r\n"s,
+            "#columns\r\n4D530064=Halo 2\tplatform=xbox\tyear=2004\r\n4D530065=Name\twith a TAB \tyear=2004\r\n"s,
+            "\xEF\xBB\xBF#columns platform year\n4D530064=Halo 2 \t year=2004\n4D530065=\tyear=2004\n"s,
+            "#columns\r4D530064=A\tyear=2004\r"s, "#columnsX\r\n4D530064=A\tyear=2004\r\n"s, "#columns"s,
+            "\r\n#columns\r\n4D530064=A\tyear=2004\r\n"s, " #columns\r\n4D530064=A\tyear=2004\r\n"s,
+        };
+    }
+
+    // Random edits of a generated file: structural bytes and pieces of UTF-8 sequences, so some
+    // results are invalid and most are not.
+    std::string Mutate(std::string text, std::mt19937& rng) {
+        static const char* const kPieces[] = { "\r", "\n", "\r\n", "\t", " ", "=", "#", ";", "\tyear=2004", "#columns\r\n",
+                                               "\xEF\xBB\xBF", "\xC3\xA9", "\xC3", "\xE2\x82\xAC", "\x82", "\xF0\x9F\x98\x80",
+                                               "\xED\xA0\x80", "a", "Z", "0" };
+        size_t edits = 1 + rng() % 8;
+        bool asciiOnly = rng() % 2 == 0;
+        for (size_t e = 0; e < edits && !text.empty(); ++e) {
+            size_t at = rng() % text.size();
+            const char* piece = kPieces[rng() % (asciiOnly ? 10 : sizeof(kPieces) / sizeof(kPieces[0]))];
+            if (rng() % 3 == 0) text.erase(at, 1 + rng() % 4);
+            else text.insert(at, piece);
+        }
+        return text;
+    }
+
+    // A small edit of a file with columns, as a user makes one: a column added, a line added or
+    // a few bytes deleted somewhere. Always valid UTF-8, so a reload of it stays incremental.
+    std::string EditColumns(std::string text, std::mt19937& rng) {
+        static const char* const kPieces[] = { "\tyear=1999", "\tpublisher=Other Publisher", "\tpublisher=Microsoft",
+                                               "\tplatform=pc", "\tregion=pal", "\r\n4D5300FF=Added\tyear=2010\r\n", "x" };
+        size_t at = rng() % text.size();
+        if (rng() % 4 == 0) {
+            size_t n = 1 + rng() % 12;
+            while (at > 0 && (static_cast<unsigned char>(text[at]) & 0xC0) == 0x80) --at; // keep sequences whole
+            size_t end = std::min(text.size(), at + n);
+            while (end < text.size() && (static_cast<unsigned char>(text[end]) & 0xC0) == 0x80) ++end;
+            text.erase(at, end - at);
+        } else {
+            while (at > 0 && (static_cast<unsigned char>(text[at]) & 0xC0) == 0x80) --at;
+            text.insert(at, kPieces[rng() % (sizeof(kPieces) / sizeof(kPieces[0]))]);
+        }
+        return text;
+    }
+
+    // Every loader against ExpectedNames over the edge cases, generated files (half of them
+    // declaring columns, then the same file without and with the declaration again, then edited
+    // one step at a time) and random edits of them: ParseMapping, ParseMappingStream at several
+    // chunk sizes and with short reads, TitleTable::LoadUtf8 and LoadStream, and IncrementalTable
+    // loading each file fresh and as a reload of the one before, with the columns patched from
+    // that reload (TitleMetaTable::Patch) and loaded from the file's head first (LoadFile, which
+    // must read the body only of a file that declares columns) against loading them whole.
+    // Returns the number of mismatches (each is printed).
+    size_t RunParserCheck(const Options& opt) {
+        std::vector<std::string> files = ParserEdgeCases();
+        size_t edgeCases = files.size();
+        std::mt19937 rng(41);
+        for (uint32_t seed = 1; seed <= 4; ++seed) {
+            files.push_back(MakeMappingText(300, seed));
+            std::string columns = AddMetaColumns(MakeMappingText(300, seed), seed);
+            std::string undeclared = columns;
+            undeclared[4] = 'C'; // a plain comment: every name changes, only the first block's bytes do
+            files.push_back(columns);
+            files.push_back(undeclared);
+            files.push_back(columns);
+        }
+        std::string edited = AddMetaColumns(MakeMappingText(2000, 5), 5);
+        for (int edit = 0; edit < 40; ++edit) files.push_back(edited = EditColumns(edited, rng)); // each a reload of the one before
+        size_t mutations = opt.quick ? 300 : 3000;
+        for (size_t i = 0; i < mutations; ++i) {
+            std::string text = MakeMappingText(40, uint32_t(i));
+            files.push_back(Mutate(i % 2 ? AddMetaColumns(text, uint32_t(i)) : text, rng));
+        }
+
+        size_t failures = 0, compared = 0, patched = 0;
+        titledb::IncrementalTable incremental;
+        titledb::TitleMetaTable details; // kept up to date with incremental, as the handler does
+        auto expect = [&](size_t file, const char* how, const LegacyMap& want, const LegacyMap& got) {
+            ++compared;
+            if (got == want) return;
+            if (++failures <= 20) {
+                std::fprintf(stderr, "MISMATCH %s, file %zu%s (%zu vs %zu entries): %s\n", how, file,
+                             file < edgeCases ? " (edge case)" : "", got.size(), want.size(), Printable(files[file]).c_str());
+            }
+        };
+        static const size_t kChunks[] = { 1, 2, 3, 4, 5, 7, 8, 16, 31, 64, 4096 };
+        for (size_t f = 0; f < files.size(); ++f) {
+            const std::string& text = files[f];
+            LegacyMap want = ExpectedNames(text);
+
+            RecordFold fold;
+            titledb::ParseMapping(text.data(), text.size(), std::ref(fold));
+            expect(f, "ParseMapping", want, fold.map);
+            for (size_t chunk : kChunks) {
+                for (bool shortReads : { false, true }) {
+                    RecordFold streamed;
+                    PieceReader reader(text, uint32_t(f * 31 + chunk), shortReads);
+                    bool ok = titledb::ParseMappingStream(reader, chunk, std::ref(streamed));
+                    std::string how = "ParseMappingStream chunk " + std::to_string(chunk) + (shortReads ? " short reads" : "");
+                    expect(f, how.c_str(), want, ok ? streamed.map : LegacyMap());
+                }
+            }
+            titledb::TitleTable table;
+            table.LoadUtf8(text.data(), text.size());
+            expect(f, "TitleTable::LoadUtf8", want, MapOf(table));
+            PieceReader reader(text, uint32_t(f), true);
+            table.LoadStream(reader, 7);
+            expect(f, "TitleTable::LoadStream", want, MapOf(table));
+            titledb::ReloadStats st;
+            std::vector<titledb::ReloadRecord> records;
+            incremental.Load(text.data(), text.size(), &st, nullptr, &records); // a reload of the previous file
+            expect(f, "IncrementalTable reload", want, MapOf(incremental));
+            titledb::TitleMetaTable fullDetails;
+            fullDetails.LoadUtf8(text.data(), text.size());
+            if (st.kind == titledb::ReloadStats::Full) {
+                details = fullDetails;
+            } else {
+                details.Patch(std::move(records));
+                ++patched;
+            }
+            expect(f, "TitleMetaTable::Patch", DetailsOf(fullDetails, want), DetailsOf(details, want));
+            titledb::TitleMetaTable headFirst;
+            bool readWhole = false;
+            headFirst.LoadFile([&](char* buf, size_t cap) {
+                                   size_t n = std::min(cap, text.size());
+                                   std::memcpy(buf, text.data(), n);
+                                   return n;
+                               },
+                               [&](auto&& fn) {
+                                   readWhole = true;
+                                   fn(text.data(), text.size());
+                                   return true;
+                               });
+            expect(f, "TitleMetaTable::LoadFile", DetailsOf(fullDetails, want), DetailsOf(headFirst, want));
+            ++compared;
+            if (readWhole != titledb::DeclaresColumns(text.data(), text.size()) && ++failures <= 20) {
+                std::fprintf(stderr, "MISMATCH TitleMetaTable::LoadFile %s the body, file %zu: %s\n",
+                             readWhole ? "read" : "did not read", f, Printable(text).c_str());
+            }
+            titledb::IncrementalTable fresh;
+            fresh.Load(text.data(), text.size());
+            expect(f, "IncrementalTable::Load", want, MapOf(fresh));
+        }
+        std::fprintf(stderr, "parser check: %zu files (%zu edge cases, %zu reloads patched), %zu comparisons, %zu mismatches\n",
+                     files.size(), edgeCases, patched, compared, failures);
+        return failures;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc == 4 && !std::strcmp(argv[1], "--child")) return RunChild(argv[2], argv[3]);
+    Options opt;
+    bool check = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--quick")) opt.quick = true;
+        else if (!std::strcmp(argv[i], "--check")) check = true;
+        else if (!std::strcmp(argv[i], "--file") && i + 1 < argc) opt.file = argv[++i];
+        else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) opt.filter = argv[++i];
+        else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) opt.threads = unsigned(std::atoi(argv[++i]));
+        else {
+            std::fprintf(stderr, "usage: XboxTitleBench [--quick] [--check] [--file XboxTitleIDs.txt] [--filter substring] [--threads N]\n");
+            return 2;
+        }
+    }
+    if (opt.threads == 0) opt.threads = 1;
+    if (check) return RunParserCheck(opt) ? 1 : 0;
+
+    std::vector<Dataset> sets;
+    Dataset shipped{ "shipped", {} };
+    if (titledb::ReadFileBytes(opt.file, shipped.text)) sets.push_back(std::move(shipped));
+    else std::fprintf(stderr, "note: %s not found, skipping the shipped-file scenarios\n", opt.file.c_str());
+    sets.push_back({ "synthetic100k", MakeMappingText(100000, 1) });
+    if (!opt.quick) sets.push_back({ "synthetic1m", MakeMappingText(1000000, 2) });
+
+    Report rep(opt);
+    for (const Dataset& ds : sets) {
+        BenchParse(rep, ds, opt);
+        BenchContainers(rep, ds, opt);
+        BenchCompact(rep, ds, opt);
+        BenchIndex(rep, ds, opt);
+        BenchTooltip(rep, ds, opt);
+        BenchNameScan(rep, ds, opt);
+        BenchMeta(rep, ds, opt);
+        BenchInfoTipMiss(rep, ds, opt);
+        BenchLayers(rep, ds, opt);
+        BenchSearch(rep, ds, opt);
+        for (bool useMutex : { false, true }) {
+            BenchConcurrent(rep, ds, opt, false, useMutex);
+            BenchConcurrent(rep, ds, opt, true, useMutex);
+        }
+    }
+    BenchLogging(rep, opt);
+    BenchMetrics(rep, opt);
+    BenchTooltipCache(rep, opt);
+    BenchFreshness(rep, opt);
+    BenchResolve(rep, opt);
+    BenchReload(rep, opt);
+    BenchFirstLookup(rep, opt, argv[0]);
+    BenchWarmup(rep, opt, argv[0]);
+    BenchLargeLoad(rep, opt, argv[0]);
+    BenchShared(rep, opt, argv[0]);
+    rep.Print();
+    return rep.Failed() ? 1 : 0;
+}
@@ -0,0 +1,4843 @@
+// Generated by `XboxTitleTool embed XboxTitleIDs.txt`; do not edit.
+// 3884 titles from 142647 bytes.
+
+#pragma once
+
+#include "TitleEmbedded.h"
+
+namespace titledb {
+
+    namespace embedded_data {
+        inline constexpr uint64_t kKeys[] = {
+            0x3331354130374431ULL, 0x3331354130374432ULL, 0x3335343830374431ULL, 0x3335343830374435ULL,
+            0x3335343830374443ULL, 0x3335343830374444ULL, 0x3335343830374445ULL, 0x3337333330374432ULL,
+            0x3337333330374439ULL, 0x3337333430374431ULL, 0x3337333430374433ULL, 0x3337333430374434ULL,
+            0x3337333430374436ULL, 0x3337333430374438ULL, 0x3337333430374441ULL, 0x3337333430374442ULL,
+            0x3339344630374431ULL, 0x3339344630374434ULL, 0x3431333330374433ULL, 0x3431333330374439ULL,
+            0x3431343330303031ULL, 0x3431343330303032ULL, 0x3431343330303033ULL, 0x3431343330303034ULL,
+            0x3431343330303035ULL, 0x3431343330303036ULL, 0x3431343330303037ULL, 0x3431343330303041ULL,
+            0x3431343330303042ULL, 0x3431343330303043ULL, 0x3431343330303044ULL, 0x3431343330303045ULL,
+            0x3431343330303046ULL, 0x3431343330303130ULL, 0x3431343330303133ULL, 0x3431343330303134ULL,
+            0x3431343330303136ULL, 0x3431343330303137ULL, 0x3431343330303138ULL, 0x3431343330303139ULL,
+            0x3431343330303141ULL, 0x3431343330303142ULL, 0x3431343330303143ULL, 0x3431343330303144ULL,
+            0x3431343330303146ULL, 0x3431343330303233ULL, 0x3431343430303032ULL, 0x3431343830303032ULL,
+            0x3431353030303031ULL, 0x3431353130303031ULL, 0x3431353130303032ULL, 0x3431353130303033ULL,
+            0x3431353330303031ULL, 0x3431353430303031ULL, 0x3431353430303032ULL, 0x3431353430303033ULL,
+            0x3431353430303034ULL, 0x3431353430374431ULL, 0x3431353430374432ULL, 0x3431353430374436ULL,
+            0x3431353430374437ULL, 0x3431353430374438ULL, 0x3431353430374445ULL, 0x3431353430374530ULL,
+            0x3431353430374532ULL, 0x3431353630303031ULL, 0x3431353630303032ULL, 0x3431353630303033ULL,
+            0x3431353630303034ULL, 0x3431353630303035ULL, 0x3431353630303036ULL, 0x3431353630303037ULL,
+            0x3431353630303038ULL, 0x3431353630303039ULL, 0x3431353630303041ULL, 0x3431353630303042ULL,
+            0x3431353630303043ULL, 0x3431353630303044ULL, 0x3431353630303045ULL, 0x3431353630303046ULL,
+            0x3431353630303130ULL, 0x3431353630303134ULL, 0x3431353630303135ULL, 0x3431353630303137ULL,
+            0x3431353630303138ULL, 0x3431353630303139ULL, 0x3431353630303141ULL, 0x3431353630303142ULL,
+            0x3431353630303145ULL, 0x3431353630303146ULL, 0x3431353630303230ULL, 0x3431353630303232ULL,
+            0x3431353630303236ULL, 0x3431353630303237ULL, 0x3431353630303241ULL, 0x3431353630303242ULL,
+            0x3431353630303244ULL, 0x3431353630303330ULL, 0x3431353630303335ULL, 0x3431353630303336ULL,
+            0x3431353630303337ULL, 0x3431353630303338ULL, 0x3431353630303341ULL, 0x3431353630303342ULL,
+            0x3431353630303343ULL, 0x3431353630303344ULL, 0x3431353630303345ULL, 0x3431353630303346ULL,
+            0x3431353630303430ULL, 0x3431353630303431ULL, 0x3431353630303432ULL, 0x3431353630303435ULL,
+            0x3431353630303436ULL, 0x3431353630303437ULL, 0x3431353630303438ULL, 0x3431353630303439ULL,
+            0x3431353630303442ULL, 0x3431353630303444ULL, 0x3431353630303445ULL, 0x3431353630303446ULL,
+            0x3431353630303530ULL, 0x3431353630303531ULL, 0x3431353630303532ULL, 0x3431353630303534ULL,
+            0x3431353630303535ULL, 0x3431353630303537ULL, 0x3431353630303538ULL, 0x3431353630303542ULL,
+            0x3431353630303543ULL, 0x3431353630303544ULL, 0x3431353630303545ULL, 0x3431353630374431ULL,
+            0x3431353630374432ULL, 0x3431353630374433ULL, 0x3431353630374434ULL, 0x3431353630374436ULL,
+            0x3431353630374439ULL, 0x3431353630374441ULL, 0x3431353630374442ULL, 0x3431353630374443ULL,
+            0x3431353630374444ULL, 0x3431353630374445ULL, 0x3431353630374446ULL, 0x3431353630374531ULL,
+            0x3431353630374532ULL, 0x3431353630374534ULL, 0x3431353630374535ULL, 0x3431353630374536ULL,
+            0x3431353630374537ULL, 0x3431353630374538ULL, 0x3431353630374542ULL, 0x3431353630374546ULL,
+            0x3431353630374630ULL, 0x3431353630374631ULL, 0x3431353630374632ULL, 0x3431353630374635ULL,
+            0x3431353630374637ULL, 0x3431353630374641ULL, 0x3431353630374646ULL, 0x3431353630383030ULL,
+            0x3431353630383034ULL, 0x3431353630383135ULL, 0x3431353630383136ULL, 0x3431353630383137ULL,
+            0x3431353630383138ULL, 0x3431353630383139ULL, 0x3431353630383141ULL, 0x3431353630383143ULL,
+            0x3431353630383144ULL, 0x3431353630383146ULL, 0x3431353630383230ULL, 0x3431353630383231ULL,
+            0x3431353630383233ULL, 0x3431353630383234ULL, 0x3431353630383235ULL, 0x3431353630383236ULL,
+            0x3431353630383237ULL, 0x3431353630383241ULL, 0x3431353630383246ULL, 0x3431353630383330ULL,
+            0x3431353630383334ULL, 0x3431353630383344ULL, 0x3431353630383345ULL, 0x3431353630383346ULL,
+            0x3431353630383430ULL, 0x3431353630383435ULL, 0x3431353630383443ULL, 0x3431353630383445ULL,
+            0x3431353630383535ULL, 0x3431353630383537ULL, 0x3431353630383541ULL, 0x3431353630383542ULL,
+            0x3431353630383543ULL, 0x3431353630383546ULL, 0x3431353630383730ULL, 0x3431353630383731ULL,
+            0x3431353630383736ULL, 0x3431353630383737ULL, 0x3431353630383746ULL, 0x3431353630383831ULL,
+            0x3431353630383833ULL, 0x3431353630383836ULL, 0x3431353630383839ULL, 0x3431353630383842ULL,
+            0x3431353630383843ULL, 0x3431353630383844ULL, 0x3431353630383846ULL, 0x3431353630383930ULL,
+            0x3431353630383931ULL, 0x3431353630383933ULL, 0x3431353630383938ULL, 0x3431353630383943ULL,
+            0x3431353630384134ULL, 0x3431353630384137ULL, 0x3431353630384141ULL, 0x3431353630384142ULL,
+            0x3431353630384144ULL, 0x3431353630384145ULL, 0x3431353630384146ULL, 0x3431353630384232ULL,
+            0x3431353630384234ULL, 0x3431353630384235ULL, 0x3431353630384242ULL, 0x3431353630384244ULL,
+            0x3431353630384245ULL, 0x3431353630384332ULL, 0x3431353630384333ULL, 0x3431353630384335ULL,
+            0x3431353630384336ULL, 0x3431353630384337ULL, 0x3431353630384342ULL, 0x3431353630384343ULL,
+            0x3431353630384345ULL, 0x3431353630384431ULL, 0x3431353630384432ULL, 0x3431353630384433ULL,
+            0x3431353630384437ULL, 0x3431353630384438ULL, 0x3431353630384441ULL, 0x3431353630384442ULL,
+            0x3431353630384443ULL, 0x3431353630384444ULL, 0x3431353630384531ULL, 0x3431353630384534ULL,
+            0x3431353630384539ULL, 0x3431353630384543ULL, 0x3431353630384544ULL, 0x3431353630384638ULL,
+            0x3431353630384641ULL, 0x3431353630384643ULL, 0x3431353630384645ULL, 0x3431353630384646ULL,
+            0x3431353630393030ULL, 0x3431353630393034ULL, 0x3431353630393035ULL, 0x3431353630393043ULL,
+            0x3431353630393044ULL, 0x3431353630393131ULL, 0x3431353630393132ULL, 0x3431353630393134ULL,
+            0x3431353630393139ULL, 0x3431353630393142ULL, 0x3431353630393143ULL, 0x3431353630393144ULL,
+            0x3431353630393145ULL, 0x3431353630393146ULL, 0x3431353630393230ULL, 0x3431353630393232ULL,
+            0x3431353630393233ULL, 0x3431353630393234ULL, 0x3431353630393236ULL, 0x3431353630393237ULL,
+            0x3431353630393238ULL, 0x3431353730303031ULL, 0x3431353730374431ULL, 0x3431353730374434ULL,
+            0x3431353730374441ULL, 0x3431353730374443ULL, 0x3431353730374444ULL, 0x3431353830374435ULL,
+            0x3431353830374437ULL, 0x3431353830374438ULL, 0x3431353830374439ULL, 0x3431353930303032ULL,
+            0x3431353930303034ULL, 0x3431353930374435ULL, 0x3431353930374437ULL, 0x3431353930374438ULL,
+            0x3432343130303031ULL, 0x3432343130303032ULL, 0x3432343130374443ULL, 0x3432343130374444ULL,
+            0x3432343230303032ULL, 0x3432343530374431ULL, 0x3432343730374431ULL, 0x3432343930374434ULL,
+            0x3432344430303031ULL, 0x3432344430303032ULL, 0x3432344430303033ULL, 0x3432344430303036ULL,
+            0x3432353230303031ULL, 0x3432353330303031ULL, 0x3432353330303034ULL, 0x3432353330303035ULL,
+            0x3432353330303036ULL, 0x3432353330303037ULL, 0x3432353330303039ULL, 0x3432353330303041ULL,
+            0x3432353330303042ULL, 0x3432353330303043ULL, 0x3432353330303046ULL, 0x3432353330303131ULL,
+            0x3432353330303132ULL, 0x3432353330303134ULL, 0x3432353330374431ULL, 0x3432353330374433ULL,
+            0x3432353330374435ULL, 0x3432353330374437ULL, 0x3432353330374439ULL, 0x3432353330374442ULL,
+            0x3432353330374530ULL, 0x3432353330374533ULL, 0x3432353330374535ULL, 0x3432353330374536ULL,
+            0x3432353330374543ULL, 0x3432353330374631ULL, 0x3432353330374633ULL, 0x3432353330374634ULL,
+            0x3432353330374635ULL, 0x3432353430374434ULL, 0x3432353530303031ULL, 0x3432353530303034ULL,
+            0x3432353630303031ULL, 0x3432353630303032ULL, 0x3432353630303033ULL, 0x3432353630303034ULL,
+            0x3432353630374431ULL, 0x3432353630374433ULL, 0x3432353630374434ULL, 0x3432353630374439ULL,
+            0x3432353630374442ULL, 0x3432353630374445ULL, 0x3432353630374446ULL, 0x3432353630374530ULL,
+            0x3432353630374535ULL, 0x3432353630374536ULL, 0x3432353630374537ULL, 0x3432353630374538ULL,
+            0x3432353630374539ULL, 0x3432353630374544ULL, 0x3432353630374645ULL, 0x3432353630383032ULL,
+            0x3432353630383033ULL, 0x3432353630383037ULL, 0x3432353630383136ULL, 0x3432353630383137ULL,
+            0x3432353630383139ULL, 0x3432353630383145ULL, 0x3432353630383234ULL, 0x3432353630383243ULL,
+            0x3432353630383332ULL, 0x3432353730303031ULL, 0x3433343130374433ULL, 0x3433343330303031ULL,
+            0x3433343330303032ULL, 0x3433343330303033ULL, 0x3433343330303034ULL, 0x3433343330303035ULL,
+            0x3433343330303037ULL, 0x3433343330303038ULL, 0x3433343330303039ULL, 0x3433343330303041ULL,
+            0x3433343330303042ULL, 0x3433343330303043ULL, 0x3433343330303045ULL, 0x3433343330303046ULL,
+            0x3433343330303130ULL, 0x3433343330303131ULL, 0x3433343330303133ULL, 0x3433343330303134ULL,
+            0x3433343330303135ULL, 0x3433343330303136ULL, 0x3433343330303138ULL, 0x3433343330303139ULL,
+            0x3433343330374432ULL, 0x3433343330374433ULL, 0x3433343330374434ULL, 0x3433343330374444ULL,
+            0x3433343330374445ULL, 0x3433343330374446ULL, 0x3433343330374530ULL, 0x3433343330374531ULL,
+            0x3433343330374536ULL, 0x3433343330374543ULL, 0x3433343330374544ULL, 0x3433343330374630ULL,
+            0x3433343330374643ULL, 0x3433343330383036ULL, 0x3433343330383042ULL, 0x3433343330383046ULL,
+            0x3433343330383134ULL, 0x3433343330383136ULL, 0x3433343330383137ULL, 0x3433343330383139ULL,
+            0x3433343330383143ULL, 0x3433343330383144ULL, 0x3433343330383145ULL, 0x3433343330383146ULL,
+            0x3433343330383231ULL, 0x3433343330383232ULL, 0x3433343330383234ULL, 0x3433343330383242ULL,
+            0x3433343330383246ULL, 0x3433343330383330ULL, 0x3433343330383333ULL, 0x3433343330383431ULL,
+            0x3433343330383432ULL, 0x3433343430374436ULL, 0x3433344230303031ULL, 0x3433344430303031ULL,
+            0x3433344430303032ULL, 0x3433344430303033ULL, 0x3433344430303034ULL, 0x3433344430303036ULL,
+            0x3433344430303038ULL, 0x3433344430303043ULL, 0x3433344430303044ULL, 0x3433344430303045ULL,
+            0x3433344430303046ULL, 0x3433344430303130ULL, 0x3433344430303131ULL, 0x3433344430303132ULL,
+            0x3433344430303133ULL, 0x3433344430303134ULL, 0x3433344430303135ULL, 0x3433344430303136ULL,
+            0x3433344430303137ULL, 0x3433344430303138ULL, 0x3433344430303139ULL, 0x3433344430303142ULL,
+            0x3433344430303143ULL, 0x3433344430303144ULL, 0x3433344430303145ULL, 0x3433344430303146ULL,
+            0x3433344430303230ULL, 0x3433344430303231ULL, 0x3433344430303232ULL, 0x3433344430303233ULL,
+            0x3433344430303234ULL, 0x3433344430303238ULL, 0x3433344430303239ULL, 0x3433344430303241ULL,
+            0x3433344430303242ULL, 0x3433344430303246ULL, 0x3433344430303330ULL, 0x3433344430303331ULL,
+            0x3433344430303332ULL, 0x3433344430303333ULL, 0x3433344430303335ULL, 0x3433344430303336ULL,
+            0x3433344430303337ULL, 0x3433344430303338ULL, 0x3433344430303339ULL, 0x3433344430303341ULL,
+            0x3433344430303342ULL, 0x3433344430303343ULL, 0x3433344430303344ULL, 0x3433344430303345ULL,
+            0x3433344430303346ULL, 0x3433344430303430ULL, 0x3433344430303431ULL, 0x3433344430303432ULL,
+            0x3433344430303433ULL, 0x3433344430303434ULL, 0x3433344430303435ULL, 0x3433344430303436ULL,
+            0x3433344430303437ULL, 0x3433344430303439ULL, 0x3433344430303441ULL, 0x3433344430303442ULL,
+            0x3433344430303443ULL, 0x3433344430303444ULL, 0x3433344430303445ULL, 0x3433344430303530ULL,
+            0x3433344430303532ULL, 0x3433344430303534ULL, 0x3433344430303537ULL, 0x3433344430303541ULL,
+            0x3433344430303542ULL, 0x3433344430374432ULL, 0x3433344430374435ULL, 0x3433344430374438ULL,
+            0x3433344430374442ULL, 0x3433344430374445ULL, 0x3433344430374530ULL, 0x3433344430374539ULL,
+            0x3433344430374646ULL, 0x3433344430383036ULL, 0x3433344430383038ULL, 0x3433344430383039ULL,
+            0x3433344430383044ULL, 0x3433344430383131ULL, 0x3433344430383139ULL, 0x3433344430383232ULL,
+            0x3433344430383242ULL, 0x3433344430383244ULL, 0x3433344430383338ULL, 0x3433344430383339ULL,
+            0x3433344430383344ULL, 0x3433344430383432ULL, 0x3433344430383434ULL, 0x3433344430383435ULL,
+            0x3433344430383437ULL, 0x3433344430383439ULL, 0x3433344430383446ULL, 0x3433344430383531ULL,
+            0x3433344430383532ULL, 0x3433353430303031ULL, 0x3433353630303031ULL, 0x3433353630303032ULL,
+            0x3433353630303035ULL, 0x3433353630303036ULL, 0x3433353630303037ULL, 0x3433353630303038ULL,
+            0x3433353630303039ULL, 0x3433353630303041ULL, 0x3433353630303044ULL, 0x3433353630303045ULL,
+            0x3433353630303130ULL, 0x3433353630303131ULL, 0x3433353630374441ULL, 0x3433353630374442ULL,
+            0x3433353930374431ULL, 0x3433353930374432ULL, 0x3433353930374434ULL, 0x3433353930374435ULL,
+            0x3433354130374439ULL, 0x3434333630374430ULL, 0x3434333630374434ULL, 0x3434333630374436ULL,
+            0x3434333630374437ULL, 0x3434343330303032ULL, 0x3434343330303033ULL, 0x3434343330303034ULL,
+            0x3434343530374433ULL, 0x3434343530374435ULL, 0x3434344430374433ULL, 0x3434353030374433ULL,
+            0x3434353030374434ULL, 0x3434353030374541ULL, 0x3434353030374542ULL, 0x3434353030374631ULL,
+            0x3434353030374637ULL, 0x3434353030374639ULL, 0x3434353030374641ULL, 0x3434353030374643ULL,
+            0x3434353030383031ULL, 0x3434353030383032ULL, 0x3434353030383033ULL, 0x3434353030383034ULL,
+            0x3434353030383035ULL, 0x3434353030383036ULL, 0x3434353030383037ULL, 0x3434353030383038ULL,
+            0x3434353430374431ULL, 0x3434353430374433ULL, 0x3434353430374434ULL, 0x3434353430374439ULL,
+            0x3434353430374441ULL, 0x3434353830303031ULL, 0x3435333930374432ULL, 0x3435343130303031ULL,
+            0x3435343130303032ULL, 0x3435343130303033ULL, 0x3435343130303034ULL, 0x3435343130303035ULL,
+            0x3435343130303037ULL, 0x3435343130303039ULL, 0x3435343130303041ULL, 0x3435343130303042ULL,
+            0x3435343130303044ULL, 0x3435343130303045ULL, 0x3435343130303130ULL, 0x3435343130303131ULL,
+            0x3435343130303132ULL, 0x3435343130303133ULL, 0x3435343130303134ULL, 0x3435343130303135ULL,
+            0x3435343130303137ULL, 0x3435343130303139ULL, 0x3435343130303141ULL, 0x3435343130303142ULL,
+            0x3435343130303143ULL, 0x3435343130303144ULL, 0x3435343130303145ULL, 0x3435343130303231ULL,
+            0x3435343130303232ULL, 0x3435343130303236ULL, 0x3435343130303237ULL, 0x3435343130303238ULL,
+            0x3435343130303239ULL, 0x3435343130303241ULL, 0x3435343130303243ULL, 0x3435343130303244ULL,
+            0x3435343130303245ULL, 0x3435343130303246ULL, 0x3435343130303330ULL, 0x3435343130303331ULL,
+            0x3435343130303332ULL, 0x3435343130303335ULL, 0x3435343130303336ULL, 0x3435343130303337ULL,
+            0x3435343130303338ULL, 0x3435343130303339ULL, 0x3435343130303341ULL, 0x3435343130303342ULL,
+            0x3435343130303343ULL, 0x3435343130303344ULL, 0x3435343130303345ULL, 0x3435343130303346ULL,
+            0x3435343130303431ULL, 0x3435343130303432ULL, 0x3435343130303433ULL, 0x3435343130303434ULL,
+            0x3435343130303435ULL, 0x3435343130303437ULL, 0x3435343130303438ULL, 0x3435343130303439ULL,
+            0x3435343130303441ULL, 0x3435343130303442ULL, 0x3435343130303443ULL, 0x3435343130303444ULL,
+            0x3435343130303445ULL, 0x3435343130303446ULL, 0x3435343130303530ULL, 0x3435343130303531ULL,
+            0x3435343130303532ULL, 0x3435343130303533ULL, 0x3435343130303534ULL, 0x3435343130303535ULL,
+            0x3435343130303536ULL, 0x3435343130303537ULL, 0x3435343130303538ULL, 0x3435343130303541ULL,
+            0x3435343130303542ULL, 0x3435343130303543ULL, 0x3435343130303544ULL, 0x3435343130303545ULL,
+            0x3435343130303546ULL, 0x3435343130303630ULL, 0x3435343130303631ULL, 0x3435343130303632ULL,
+            0x3435343130303633ULL, 0x3435343130303635ULL, 0x3435343130303636ULL, 0x3435343130303644ULL,
+            0x3435343130303646ULL, 0x3435343130303730ULL, 0x3435343130303731ULL, 0x3435343130303732ULL,
+            0x3435343130303734ULL, 0x3435343130303735ULL, 0x3435343130303736ULL, 0x3435343130303737ULL,
+            0x3435343130303738ULL, 0x3435343130303739ULL, 0x3435343130303741ULL, 0x3435343130303742ULL,
+            0x3435343130303743ULL, 0x3435343130303744ULL, 0x3435343130303745ULL, 0x3435343130303830ULL,
+            0x3435343130303832ULL, 0x3435343130303833ULL, 0x3435343130303835ULL, 0x3435343130303836ULL,
+            0x3435343130303837ULL, 0x3435343130303842ULL, 0x3435343130303844ULL, 0x3435343130303845ULL,
+            0x3435343130303930ULL, 0x3435343130303931ULL, 0x3435343130303933ULL, 0x3435343130303934ULL,
+            0x3435343130303935ULL, 0x3435343130303943ULL, 0x3435343130303945ULL, 0x3435343130303946ULL,
+            0x3435343130304130ULL, 0x3435343130304131ULL, 0x3435343130304132ULL, 0x3435343130304133ULL,
+            0x3435343130304134ULL, 0x3435343130304135ULL, 0x3435343130304136ULL, 0x3435343130304138ULL,
+            0x3435343130304142ULL, 0x3435343130304143ULL, 0x3435343130323342ULL, 0x3435343130333839ULL,
+            0x3435343130333841ULL, 0x3435343130333842ULL, 0x3435343130374432ULL, 0x3435343130374436ULL,
+            0x3435343130374437ULL, 0x3435343130374438ULL, 0x3435343130374442ULL, 0x3435343130374443ULL,
+            0x3435343130374445ULL, 0x3435343130374446ULL, 0x3435343130374536ULL, 0x3435343130374538ULL,
+            0x3435343130374539ULL, 0x3435343130374542ULL, 0x3435343130374543ULL, 0x3435343130374544ULL,
+            0x3435343130374545ULL, 0x3435343130374546ULL, 0x3435343130374631ULL, 0x3435343130374632ULL,
+            0x3435343130374633ULL, 0x3435343130374634ULL, 0x3435343130374636ULL, 0x3435343130374637ULL,
+            0x3435343130374638ULL, 0x3435343130374639ULL, 0x3435343130374641ULL, 0x3435343130383036ULL,
+            0x3435343130383045ULL, 0x3435343130383046ULL, 0x3435343130383131ULL, 0x3435343130383133ULL,
+            0x3435343130383134ULL, 0x3435343130383139ULL, 0x3435343130383141ULL, 0x3435343130383144ULL,
+            0x3435343130383146ULL, 0x3435343130383230ULL, 0x3435343130383231ULL, 0x3435343130383232ULL,
+            0x3435343130383238ULL, 0x3435343130383239ULL, 0x3435343130383242ULL, 0x3435343130383330ULL,
+            0x3435343130383335ULL, 0x3435343130383337ULL, 0x3435343130383341ULL, 0x3435343130383342ULL,
+            0x3435343130383346ULL, 0x3435343130383431ULL, 0x3435343130383435ULL, 0x3435343130383443ULL,
+            0x3435343130383530ULL, 0x3435343130383532ULL, 0x3435343130383537ULL, 0x3435343130383542ULL,
+            0x3435343130383544ULL, 0x3435343130383630ULL, 0x3435343130383631ULL, 0x3435343130383634ULL,
+            0x3435343130383636ULL, 0x3435343130383639ULL, 0x3435343130383646ULL, 0x3435343130383730ULL,
+            0x3435343130383732ULL, 0x3435343130383736ULL, 0x3435343130383741ULL, 0x3435343130383746ULL,
+            0x3435343130383839ULL, 0x3435343130383841ULL, 0x3435343130383846ULL, 0x3435343130383931ULL,
+            0x3435343130383934ULL, 0x3435343130383938ULL, 0x3435343130383942ULL, 0x3435343130384138ULL,
+            0x3435343130384144ULL, 0x3435343130384230ULL, 0x3435343130384231ULL, 0x3435343130384234ULL,
+            0x3435343130384241ULL, 0x3435343130384243ULL, 0x3435343130384330ULL, 0x3435343130384331ULL,
+            0x3435343130384333ULL, 0x3435343130384335ULL, 0x3435343130384336ULL, 0x3435343130384341ULL,
+            0x3435343130384344ULL, 0x3435343130384345ULL, 0x3435343130384346ULL, 0x3435343130384434ULL,
+            0x3435343130384438ULL, 0x3435343130384439ULL, 0x3435343130384446ULL, 0x3435343130384532ULL,
+            0x3435343130384533ULL, 0x3435343130384534ULL, 0x3435343130384535ULL, 0x3435343130384536ULL,
+            0x3435343130384537ULL, 0x3435343130384545ULL, 0x3435343130384546ULL, 0x3435343130384633ULL,
+            0x3435343130384635ULL, 0x3435343130384637ULL, 0x3435343130384639ULL, 0x3435343130384643ULL,
+            0x3435343130384644ULL, 0x3435343130384645ULL, 0x3435343130393030ULL, 0x3435343130393033ULL,
+            0x3435343130393042ULL, 0x3435343130393043ULL, 0x3435343130393131ULL, 0x3435343130393132ULL,
+            0x3435343130393134ULL, 0x3435343130393135ULL, 0x3435343130393136ULL, 0x3435343130393139ULL,
+            0x3435343130393233ULL, 0x3435343130393239ULL, 0x3435343130393241ULL, 0x3435343130393334ULL,
+            0x3435343130393337ULL, 0x3435343130393341ULL, 0x3435343130393345ULL, 0x3435343130393441ULL,
+            0x3435343130393443ULL, 0x3435343130393444ULL, 0x3435343130393445ULL, 0x3435343130393530ULL,
+            0x3435343130393535ULL, 0x3435343130393544ULL, 0x3435343130393631ULL, 0x3435343130393632ULL,
+            0x3435343130393634ULL, 0x3435343130393636ULL, 0x3435343130393637ULL, 0x3435343130393638ULL,
+            0x3435343130393639ULL, 0x3435343130393643ULL, 0x3435343130393644ULL, 0x3435343130393645ULL,
+            0x3435343130393732ULL, 0x3435343130393742ULL, 0x3435343130393841ULL, 0x3435343130393842ULL,
+            0x3435343130393845ULL, 0x3435343130393933ULL, 0x3435343130393937ULL, 0x3435343130393938ULL,
+            0x3435343130393939ULL, 0x3435343130393942ULL, 0x3435343130393943ULL, 0x3435343130393944ULL,
+            0x3435343130393946ULL, 0x3435343130394139ULL, 0x3435343130394142ULL, 0x3435343130394236ULL,
+            0x3435343130394241ULL, 0x3435343130394245ULL, 0x3435343130394331ULL, 0x3435343130394333ULL,
+            0x3435343130394336ULL, 0x3435343130394339ULL, 0x3435343130394430ULL, 0x3435343130394434ULL,
+            0x3435343130394439ULL, 0x3435343130394442ULL, 0x3435343130394443ULL, 0x3435343130394530ULL,
+            0x3435343130394542ULL, 0x3435343130394543ULL, 0x3435343130394545ULL, 0x3435343130394634ULL,
+            0x3435343330303031ULL, 0x3435343330303032ULL, 0x3435343330303034ULL, 0x3435343630303031ULL,
+            0x3435344330303031ULL, 0x3435344430303031ULL, 0x3435344430303032ULL, 0x3435344430303033ULL,
+            0x3435344430303034ULL, 0x3435344430303035ULL, 0x3435344430303037ULL, 0x3435344430303038ULL,
+            0x3435344430303039ULL, 0x3435344430303041ULL, 0x3435344430303044ULL, 0x3435344430303136ULL,
+            0x3435344430303137ULL, 0x3435344430303142ULL, 0x3435344430303143ULL, 0x3435344430303144ULL,
+            0x3435344430303145ULL, 0x3435344430303146ULL, 0x3435344430303230ULL, 0x3435344430303232ULL,
+            0x3435344430374432ULL, 0x3435353330303031ULL, 0x3435353330303032ULL, 0x3435353330303034ULL,
+            0x3435353330303035ULL, 0x3435353330303036ULL, 0x3435353330303038ULL, 0x3435353330303039ULL,
+            0x3435353330303041ULL, 0x3435353330303043ULL, 0x3435353330303044ULL, 0x3435353330303045ULL,
+            0x3435353330303046ULL, 0x3435353330303131ULL, 0x3435353330303132ULL, 0x3435353330303133ULL,
+            0x3435353330303134ULL, 0x3435353330303136ULL, 0x3435353330303138ULL, 0x3435353330303139ULL,
+            0x3435353330303141ULL, 0x3435353330303144ULL, 0x3435353630374431ULL, 0x3435353630374433ULL,
+            0x3435353630374435ULL, 0x3435353630374436ULL, 0x3435353630374437ULL, 0x3435353630374438ULL,
+            0x3435353630374442ULL, 0x3436343530374431ULL, 0x3436343530374433ULL, 0x3436343530374436ULL,
+            0x3436343530374438ULL, 0x3436343530374443ULL, 0x3436343530374444ULL, 0x3436343530374445ULL,
+            0x3436343530374531ULL, 0x3436343930303032ULL, 0x3436344130374431ULL, 0x3436344330303032ULL,
+            0x3436344630374431ULL, 0x3436344630374437ULL, 0x3436344630374438ULL, 0x3436344630374439ULL,
+            0x3436344630374441ULL, 0x3436344630374442ULL, 0x3436344630374531ULL, 0x3436344630374534ULL,
+            0x3436344630374537ULL, 0x3436344630374538ULL, 0x3436344630374543ULL, 0x3436344630374544ULL,
+            0x3436344630374632ULL, 0x3436344630374636ULL, 0x3436344630374645ULL, 0x3436344630383030ULL,
+            0x3436344630383032ULL, 0x3436344630383033ULL, 0x3436353330303031ULL, 0x3436353330303032ULL,
+            0x3436353330303033ULL, 0x3436353330303034ULL, 0x3436353330303035ULL, 0x3436353330303036ULL,
+            0x3436353330374436ULL, 0x3436353330374437ULL, 0x3436353330374439ULL, 0x3436353330374441ULL,
+            0x3436353330374534ULL, 0x3436353630374445ULL, 0x3437343530303031ULL, 0x3437343530303033ULL,
+            0x3437343530374432ULL, 0x3437343930374431ULL, 0x3437353030374432ULL, 0x3437353030374433ULL,
+            0x3437353030374434ULL, 0x3437353030374435ULL, 0x3437353230374635ULL, 0x3437353630303031ULL,
+            0x3437353630303033ULL, 0x3437353630303034ULL, 0x3437353630303039ULL, 0x3437353630303041ULL,
+            0x3437353630303042ULL, 0x3437353730374431ULL, 0x3437353830374431ULL, 0x3438343530303031ULL,
+            0x3438343530303034ULL, 0x3438343530303035ULL, 0x3438343530374431ULL, 0x3438343530374432ULL,
+            0x3438343530374434ULL, 0x3438343530374437ULL, 0x3438343530374441ULL, 0x3438343530374442ULL,
+            0x3438353030303031ULL, 0x3438353030303032ULL, 0x3438353030303035ULL, 0x3438353530303031ULL,
+            0x3438353530374431ULL, 0x3438353530374434ULL, 0x3438353530374446ULL, 0x3438353730303031ULL,
+            0x3439343130303031ULL, 0x3439343630303031ULL, 0x3439343630374431ULL, 0x3439343730303031ULL,
+            0x3439343730303034ULL, 0x3439343730303035ULL, 0x3439343730303036ULL, 0x3439343730303037ULL,
+            0x3439343730303039ULL, 0x3439343730303042ULL, 0x3439343730303044ULL, 0x3439343730303045ULL,
+            0x3439343730303046ULL, 0x3439343730303130ULL, 0x3439343730303131ULL, 0x3439343730303132ULL,
+            0x3439343730303133ULL, 0x3439343730303135ULL, 0x3439343730303136ULL, 0x3439343730303137ULL,
+            0x3439343730303138ULL, 0x3439343730303142ULL, 0x3439343730303143ULL, 0x3439343730303146ULL,
+            0x3439343730303232ULL, 0x3439343730303233ULL, 0x3439343730303234ULL, 0x3439343730303235ULL,
+            0x3439343730303236ULL, 0x3439343730303237ULL, 0x3439343730303238ULL, 0x3439343730303239ULL,
+            0x3439343730303242ULL, 0x3439343730303243ULL, 0x3439343730303245ULL, 0x3439343730303334ULL,
+            0x3439343730303338ULL, 0x3439343730303339ULL, 0x3439343730303342ULL, 0x3439343730303343ULL,
+            0x3439343730303344ULL, 0x3439343730303345ULL, 0x3439343730303430ULL, 0x3439343730303431ULL,
+            0x3439343730303732ULL, 0x3439343730303733ULL, 0x3439343730303734ULL, 0x3439343730303735ULL,
+            0x3439343730303739ULL, 0x3439343730303741ULL, 0x3439343730303742ULL, 0x3439343730303743ULL,
+            0x3439343730303744ULL, 0x3439343730303746ULL, 0x3439343730374431ULL, 0x3439343730374434ULL,
+            0x3439343730374442ULL, 0x3439343730374534ULL, 0x3439343730374545ULL, 0x3439343730374634ULL,
+            0x3439343730383033ULL, 0x3439343730383034ULL, 0x3439343730383036ULL, 0x3439343730383042ULL,
+            0x3439344330303031ULL, 0x3439344330303032ULL, 0x3439344330303036ULL, 0x3439344630303033ULL,
+            0x3439344630303035ULL, 0x3439344630374431ULL, 0x3439344630374434ULL, 0x3439344630374538ULL,
+            0x3439353030303036ULL, 0x3439353030303038ULL, 0x3439353030303041ULL, 0x3439353830303031ULL,
+            0x3441343130303031ULL, 0x3441343130303032ULL, 0x3441343130303034ULL, 0x3441343130303035ULL,
+            0x3441343130303036ULL, 0x3441343130303037ULL, 0x3441353730303032ULL, 0x3441353730303033ULL,
+            0x3441353730303034ULL, 0x3441353730303035ULL, 0x3441353730303039ULL, 0x3441353730303041ULL,
+            0x3441353730374432ULL, 0x3442343130303031ULL, 0x3442343130303032ULL, 0x3442343230303031ULL,
+            0x3442343230303032ULL, 0x3442343230303033ULL, 0x3442343230303034ULL, 0x3442343230303035ULL,
+            0x3442343230303036ULL, 0x3442343230303037ULL, 0x3442343430303032ULL, 0x3442343930303031ULL,
+            0x3442343930303032ULL, 0x3442344230303031ULL, 0x3442344230303032ULL, 0x3442344230303033ULL,
+            0x3442344430374431ULL, 0x3442344430374438ULL, 0x3442344430374445ULL, 0x3442344430374446ULL,
+            0x3442344430374530ULL, 0x3442344430374535ULL, 0x3442344430374536ULL, 0x3442344430374537ULL,
+            0x3442344430374539ULL, 0x3442344430374542ULL, 0x3442344430374632ULL, 0x3442344430374635ULL,
+            0x3442344430374636ULL, 0x3442344430374644ULL, 0x3442344430374645ULL, 0x3442344430383030ULL,
+            0x3442344530303031ULL, 0x3442344530303032ULL, 0x3442344530303033ULL, 0x3442344530303034ULL,
+            0x3442344530303035ULL, 0x3442344530303036ULL, 0x3442344530303037ULL, 0x3442344530303038ULL,
+            0x3442344530303039ULL, 0x3442344530303041ULL, 0x3442344530303042ULL, 0x3442344530303045ULL,
+            0x3442344530303046ULL, 0x3442344530303130ULL, 0x3442344530303131ULL, 0x3442344530303132ULL,
+            0x3442344530303133ULL, 0x3442344530303139ULL, 0x3442344530303141ULL, 0x3442344530303142ULL,
+            0x3442344530303143ULL, 0x3442344530303144ULL, 0x3442344530303145ULL, 0x3442344530303146ULL,
+            0x3442344530303230ULL, 0x3442344530303231ULL, 0x3442344530303232ULL, 0x3442344530303233ULL,
+            0x3442344530303234ULL, 0x3442344530303235ULL, 0x3442344530303237ULL, 0x3442344530303239ULL,
+            0x3442344530303241ULL, 0x3442344530303243ULL, 0x3442344530303244ULL, 0x3442344530303245ULL,
+            0x3442344530303246ULL, 0x3442344530303330ULL, 0x3442344530303334ULL, 0x3442344530303337ULL,
+            0x3442344530303338ULL, 0x3442344530374431ULL, 0x3442344530374433ULL, 0x3442344530374441ULL,
+            0x3442344530374443ULL, 0x3442344530374446ULL, 0x3442344530374530ULL, 0x3442344530374532ULL,
+            0x3442344530374535ULL, 0x3442344530374536ULL, 0x3442344530374537ULL, 0x3442344530374546ULL,
+            0x3442344530374630ULL, 0x3442344530374633ULL, 0x3442344530374641ULL, 0x3442344530383031ULL,
+            0x3442344530383032ULL, 0x3442344530383033ULL, 0x3442344530383035ULL, 0x3442344530383036ULL,
+            0x3442344530383037ULL, 0x3442344530383039ULL, 0x3442344530383041ULL, 0x3442344530383130ULL,
+            0x3442344530383136ULL, 0x3442344530383137ULL, 0x3442344530383139ULL, 0x3442344530383144ULL,
+            0x3442344530383145ULL, 0x3442344530383146ULL, 0x3442344530383230ULL, 0x3442344530383232ULL,
+            0x3442344530383233ULL, 0x3442344530383243ULL, 0x3442344530383337ULL, 0x3442344530383338ULL,
+            0x3442344530383339ULL, 0x3442344530383341ULL, 0x3442344530383343ULL, 0x3442344530383346ULL,
+            0x3442344530383430ULL, 0x3442344530383431ULL, 0x3442344530383432ULL, 0x3442344530383435ULL,
+            0x3442344530383443ULL, 0x3442344530383444ULL, 0x3442344530383536ULL, 0x3442344530383543ULL,
+            0x3442344530383545ULL, 0x3442344530383546ULL, 0x3442344530383631ULL, 0x3442344630303031ULL,
+            0x3442344630303032ULL, 0x3442344630303033ULL, 0x3442344630303034ULL, 0x3442344630303035ULL,
+            0x3442344630303036ULL, 0x3442344630303037ULL, 0x3442344630303038ULL, 0x3442344630374433ULL,
+            0x3442344630374435ULL, 0x3442344630374436ULL, 0x3442344630374437ULL, 0x3442344630374438ULL,
+            0x3442344630374439ULL, 0x3442344630374530ULL, 0x3442344630374531ULL, 0x3442344630374533ULL,
+            0x3442344630374537ULL, 0x3442344630374630ULL, 0x3442344630374641ULL, 0x3442344630374645ULL,
+            0x3442353430303031ULL, 0x3442353530303031ULL, 0x3442353630374432ULL, 0x3442353630374434ULL,
+            0x3442353630374435ULL, 0x3442353630374439ULL, 0x3442353630374441ULL, 0x3442353630374446ULL,
+            0x3442353630374532ULL, 0x3442353630374533ULL, 0x3442353630374534ULL, 0x3442353630374535ULL,
+            0x3442353630374538ULL, 0x3442353930374436ULL, 0x3442353930374438ULL, 0x3442353930374441ULL,
+            0x3442353930374443ULL, 0x3442353930374446ULL, 0x3442353930374530ULL, 0x3442353930374535ULL,
+            0x3442353930374536ULL, 0x3442353930374541ULL, 0x3443343130303031ULL, 0x3443343130303032ULL,
+            0x3443343130303033ULL, 0x3443343130303034ULL, 0x3443343130303035ULL, 0x3443343130303036ULL,
+            0x3443343130303037ULL, 0x3443343130303038ULL, 0x3443343130303039ULL, 0x3443343130303042ULL,
+            0x3443343130303044ULL, 0x3443343130303046ULL, 0x3443343130303131ULL, 0x3443343130303133ULL,
+            0x3443343130303134ULL, 0x3443343130303135ULL, 0x3443343130303137ULL, 0x3443343130303139ULL,
+            0x3443343130303141ULL, 0x3443343130303146ULL, 0x3443343130303232ULL, 0x3443343130374431ULL,
+            0x3443343130374432ULL, 0x3443343130374434ULL, 0x3443343130374436ULL, 0x3443343130374437ULL,
+            0x3443343130374446ULL, 0x3443343130374532ULL, 0x3443343130374544ULL, 0x3443343130374632ULL,
+            0x3443343130374633ULL, 0x3443353330303032ULL, 0x3443353330374431ULL, 0x3443353330374434ULL,
+            0x3443353330374437ULL, 0x3443353330374438ULL, 0x3443353330374442ULL, 0x3443353330374444ULL,
+            0x3443353330374445ULL, 0x3443353330374535ULL, 0x3443353330374542ULL, 0x3443353330374543ULL,
+            0x3443353330374544ULL, 0x3444343230374437ULL, 0x3444343430303033ULL, 0x3444343430303034ULL,
+            0x3444343530303031ULL, 0x3444343630374433ULL, 0x3444343630374435ULL, 0x3444343930303033ULL,
+            0x3444343930303034ULL, 0x3444343930303036ULL, 0x3444343930303038ULL, 0x3444343930303039ULL,
+            0x3444343930303042ULL, 0x3444343930303043ULL, 0x3444343930303044ULL, 0x3444344130303031ULL,
+            0x3444344130303032ULL, 0x3444344130303033ULL, 0x3444344130303038ULL, 0x3444344130303039ULL,
+            0x3444344130303042ULL, 0x3444344130303043ULL, 0x3444344130303044ULL, 0x3444344130303046ULL,
+            0x3444344130303131ULL, 0x3444344130303132ULL, 0x3444344130303133ULL, 0x3444344130303134ULL,
+            0x3444344130303137ULL, 0x3444344130374435ULL, 0x3444344130374438ULL, 0x3444344130374439ULL,
+            0x3444344130374441ULL, 0x3444344130374444ULL, 0x3444344130374532ULL, 0x3444344130374533ULL,
+            0x3444344130374534ULL, 0x3444344130374535ULL, 0x3444344130374536ULL, 0x3444344130374537ULL,
+            0x3444344130374538ULL, 0x3444344130374630ULL, 0x3444344130374634ULL, 0x3444344130374636ULL,
+            0x3444344230374430ULL, 0x3444344230374432ULL, 0x3444344230374433ULL, 0x3444344230374434ULL,
+            0x3444344430303031ULL, 0x3444344630374431ULL, 0x3444353030303031ULL, 0x3444353030303032ULL,
+            0x3444353330303031ULL, 0x3444353330303032ULL, 0x3444353330303033ULL, 0x3444353330303034ULL,
+            0x3444353330303035ULL, 0x3444353330303036ULL, 0x3444353330303037ULL, 0x3444353330303038ULL,
+            0x3444353330303041ULL, 0x3444353330303042ULL, 0x3444353330303043ULL, 0x3444353330303044ULL,
+            0x3444353330303046ULL, 0x3444353330303130ULL, 0x3444353330303131ULL, 0x3444353330303133ULL,
+            0x3444353330303134ULL, 0x3444353330303135ULL, 0x3444353330303137ULL, 0x3444353330303145ULL,
+            0x3444353330303231ULL, 0x3444353330303233ULL, 0x3444353330303237ULL, 0x3444353330303238ULL,
+            0x3444353330303241ULL, 0x3444353330303244ULL, 0x3444353330303245ULL, 0x3444353330303246ULL,
+            0x3444353330303330ULL, 0x3444353330303331ULL, 0x3444353330303332ULL, 0x3444353330303334ULL,
+            0x3444353330303335ULL, 0x3444353330303336ULL, 0x3444353330303339ULL, 0x3444353330303343ULL,
+            0x3444353330303344ULL, 0x3444353330303431ULL, 0x3444353330303435ULL, 0x3444353330303436ULL,
+            0x3444353330303438ULL, 0x3444353330303441ULL, 0x3444353330303442ULL, 0x3444353330303444ULL,
+            0x3444353330303445ULL, 0x3444353330303531ULL, 0x3444353330303533ULL, 0x3444353330303537ULL,
+            0x3444353330303538ULL, 0x3444353330303539ULL, 0x3444353330303541ULL, 0x3444353330303544ULL,
+            0x3444353330303546ULL, 0x3444353330303634ULL, 0x3444353330303635ULL, 0x3444353330303636ULL,
+            0x3444353330303639ULL, 0x3444353330303642ULL, 0x3444353330303644ULL, 0x3444353330303645ULL,
+            0x3444353330303743ULL, 0x3444353330303834ULL, 0x3444353330304338ULL, 0x3444353330304431ULL,
+            0x3444353330304432ULL, 0x3444353330304433ULL, 0x3444353330304434ULL, 0x3444353330374431ULL,
+            0x3444353330374432ULL, 0x3444353330374433ULL, 0x3444353330374435ULL, 0x3444353330374436ULL,
+            0x3444353330374442ULL, 0x3444353330374443ULL, 0x3444353330374445ULL, 0x3444353330374446ULL,
+            0x3444353330374536ULL, 0x3444353330374538ULL, 0x3444353330374541ULL, 0x3444353330374544ULL,
+            0x3444353330374631ULL, 0x3444353330374632ULL, 0x3444353330374639ULL, 0x3444353330374641ULL,
+            0x3444353330383035ULL, 0x3444353330383038ULL, 0x3444353330383139ULL, 0x3444353330383244ULL,
+            0x3444353330383332ULL, 0x3444353330383444ULL, 0x3444353330383542ULL, 0x3444353330383546ULL,
+            0x3444353330383630ULL, 0x3444353330383737ULL, 0x3444353330383838ULL, 0x3444353330384142ULL,
+            0x3444353330384146ULL, 0x3444353330384233ULL, 0x3444353330384243ULL, 0x3444353330384339ULL,
+            0x3444353330384345ULL, 0x3444353330384436ULL, 0x3444353330384544ULL, 0x3444353330393031ULL,
+            0x3444353330393045ULL, 0x3444353330393046ULL, 0x3444353330393130ULL, 0x3444353330393139ULL,
+            0x3444353330393342ULL, 0x3444353330394231ULL, 0x3444353330394236ULL, 0x3444353330394331ULL,
+            0x3444353330394335ULL, 0x3444353330394339ULL, 0x3444353330394344ULL, 0x3444353330394436ULL,
+            0x3444353330394441ULL, 0x3444353330394446ULL, 0x3444353330394544ULL, 0x3444353330413141ULL,
+            0x3444353330413236ULL, 0x3444353330413535ULL, 0x3444353330413646ULL, 0x3444353330413837ULL,
+            0x3444353330413842ULL, 0x3444353330413843ULL, 0x3444353330413935ULL, 0x3444353330414132ULL,
+            0x3444353330414134ULL, 0x3444353330414135ULL, 0x3444353330414136ULL, 0x3444353330414235ULL,
+            0x3444353338304344ULL, 0x3444353630374431ULL, 0x3444353730303031ULL, 0x3444353730303032ULL,
+            0x3444353730303033ULL, 0x3444353730303034ULL, 0x3444353730303035ULL, 0x3444353730303036ULL,
+            0x3444353730303037ULL, 0x3444353730303038ULL, 0x3444353730303039ULL, 0x3444353730303041ULL,
+            0x3444353730303042ULL, 0x3444353730303043ULL, 0x3444353730303044ULL, 0x3444353730303045ULL,
+            0x3444353730303046ULL, 0x3444353730303130ULL, 0x3444353730303131ULL, 0x3444353730303132ULL,
+            0x3444353730303134ULL, 0x3444353730303135ULL, 0x3444353730303136ULL, 0x3444353730303137ULL,
+            0x3444353730303138ULL, 0x3444353730303139ULL, 0x3444353730303141ULL, 0x3444353730303142ULL,
+            0x3444353730303143ULL, 0x3444353730303144ULL, 0x3444353730303230ULL, 0x3444353730303231ULL,
+            0x3444353730303232ULL, 0x3444353730303233ULL, 0x3444353730303234ULL, 0x3444353730303235ULL,
+            0x3444353730303236ULL, 0x3444353730303239ULL, 0x3444353730303243ULL, 0x3444353730303244ULL,
+            0x3444353730303245ULL, 0x3444353730303332ULL, 0x3444353730303333ULL, 0x3444353730303334ULL,
+            0x3444353730303337ULL, 0x3444353730303338ULL, 0x3444353730374433ULL, 0x3444353730374434ULL,
+            0x3444353730374436ULL, 0x3444353730374437ULL, 0x3444353730374439ULL, 0x3444353730374441ULL,
+            0x3444353730374442ULL, 0x3444353730374446ULL, 0x3444353730374534ULL, 0x3444353730374538ULL,
+            0x3444353730374539ULL, 0x3444353830303031ULL, 0x3444353930374433ULL, 0x3445344230303031ULL,
+            0x3445344330303032ULL, 0x3445344430303031ULL, 0x3445344430303033ULL, 0x3445344430303035ULL,
+            0x3445344430303036ULL, 0x3445344430303037ULL, 0x3445344430303038ULL, 0x3445344430303039ULL,
+            0x3445344430303042ULL, 0x3445344430303043ULL, 0x3445344430303046ULL, 0x3445344430303133ULL,
+            0x3445344430303135ULL, 0x3445344430303136ULL, 0x3445344430303137ULL, 0x3445344430303139ULL,
+            0x3445344430374431ULL, 0x3445344430374433ULL, 0x3445344430374438ULL, 0x3445344430374443ULL,
+            0x3445344430374446ULL, 0x3445344430374530ULL, 0x3445344430374532ULL, 0x3445344430374534ULL,
+            0x3445344430374535ULL, 0x3445344430374539ULL, 0x3445344430374544ULL, 0x3445344430374630ULL,
+            0x3445344430374631ULL, 0x3445344430374635ULL, 0x3445344430374643ULL, 0x3445344430383030ULL,
+            0x3445344430383031ULL, 0x3445344430383033ULL, 0x3445344430383035ULL, 0x3445344430383042ULL,
+            0x3445344430383043ULL, 0x3445344430383136ULL, 0x3445344430383139ULL, 0x3445344430383142ULL,
+            0x3445344430383143ULL, 0x3445344430383144ULL, 0x3445344430383231ULL, 0x3445344430383236ULL,
+            0x3445344430383237ULL, 0x3445344430383334ULL, 0x3445344430383341ULL, 0x3445344430383344ULL,
+            0x3445344430383345ULL, 0x3445344430383432ULL, 0x3445344430383436ULL, 0x3445344430383438ULL,
+            0x3445344430383443ULL, 0x3445344430383445ULL, 0x3445344430383446ULL, 0x3445344430383536ULL,
+            0x3445344430383539ULL, 0x3445344430383542ULL, 0x3445344430383543ULL, 0x3445344430383630ULL,
+            0x3445344430383632ULL, 0x3445344430383634ULL, 0x3445344430383635ULL, 0x3445344430383638ULL,
+            0x3445344430383639ULL, 0x3445344430383641ULL, 0x3446343730374431ULL, 0x3446343730374434ULL,
+            0x3446343730374437ULL, 0x3446343830374431ULL, 0x3446353830303031ULL, 0x3446353830303032ULL,
+            0x3446353830303034ULL, 0x3530343330303031ULL, 0x3530343330374434ULL, 0x3530343730374436ULL,
+            0x3530344330303031ULL, 0x3530344330303032ULL, 0x3530344330303034ULL, 0x3530344330303035ULL,
+            0x3530344330303036ULL, 0x3531333130374434ULL, 0x3531333130374435ULL, 0x3531333130374438ULL,
+            0x3532333230374437ULL, 0x3532343130303033ULL, 0x3532343130303036ULL, 0x3532343130303037ULL,
+            0x3532343130303038ULL, 0x3532343430303031ULL, 0x3532343630374432ULL, 0x3532344330374431ULL,
+            0x3532344330374436ULL, 0x3532344330374438ULL, 0x3532344330374439ULL, 0x3532344330374445ULL,
+            0x3533333030374430ULL, 0x3533343130303032ULL, 0x3533343130303033ULL, 0x3533343130303036ULL,
+            0x3533343330303031ULL, 0x3533343330303033ULL, 0x3533343330303035ULL, 0x3533343330303036ULL,
+            0x3533343330303037ULL, 0x3533343330303041ULL, 0x3533343330303042ULL, 0x3533343330303043ULL,
+            0x3533343330303045ULL, 0x3533343330303046ULL, 0x3533343330303130ULL, 0x3533343330304637ULL,
+            0x3533343330304639ULL, 0x3533343330304641ULL, 0x3533343330304642ULL, 0x3533343330304644ULL,
+            0x3533343330304646ULL, 0x3533343330313030ULL, 0x3533343330374433ULL, 0x3533343330374434ULL,
+            0x3533343330374435ULL, 0x3533343330374439ULL, 0x3533343330374442ULL, 0x3533343330374530ULL,
+            0x3533343330374532ULL, 0x3533343330374534ULL, 0x3533343330374535ULL, 0x3533343330374537ULL,
+            0x3533343330374539ULL, 0x3533343330374541ULL, 0x3533343330374543ULL, 0x3533343330374636ULL,
+            0x3533343330374638ULL, 0x3533343330383042ULL, 0x3533343430374643ULL, 0x3533343530303032ULL,
+            0x3533343530303033ULL, 0x3533343530303034ULL, 0x3533343530303036ULL, 0x3533343530303037ULL,
+            0x3533343530303038ULL, 0x3533343530303041ULL, 0x3533343530303042ULL, 0x3533343530303045ULL,
+            0x3533343530303046ULL, 0x3533343530303130ULL, 0x3533343530303131ULL, 0x3533343530303133ULL,
+            0x3533343530303134ULL, 0x3533343530303137ULL, 0x3533343530303138ULL, 0x3533343530303141ULL,
+            0x3533343530303144ULL, 0x3533343530303145ULL, 0x3533343530303146ULL, 0x3533343530303230ULL,
+            0x3533343530303231ULL, 0x3533343530303232ULL, 0x3533343530303233ULL, 0x3533343530303234ULL,
+            0x3533343530303235ULL, 0x3533343530303236ULL, 0x3533343530303237ULL, 0x3533343530303238ULL,
+            0x3533343530303239ULL, 0x3533343530303241ULL, 0x3533343530303242ULL, 0x3533343530303243ULL,
+            0x3533343530303244ULL, 0x3533343530303245ULL, 0x3533343530303330ULL, 0x3533343530303331ULL,
+            0x3533343530303332ULL, 0x3533343530303333ULL, 0x3533343530303335ULL, 0x3533343530303336ULL,
+            0x3533343530303337ULL, 0x3533343530303338ULL, 0x3533343530303343ULL, 0x3533343530303830ULL,
+            0x3533343530303831ULL, 0x3533343530303834ULL, 0x3533343530303836ULL, 0x3533343530303837ULL,
+            0x3533343530303838ULL, 0x3533343530303842ULL, 0x3533343530374431ULL, 0x3533343530374432ULL,
+            0x3533343530374434ULL, 0x3533343530374435ULL, 0x3533343530374436ULL, 0x3533343530374444ULL,
+            0x3533343530374530ULL, 0x3533343530374531ULL, 0x3533343530374533ULL, 0x3533343530374535ULL,
+            0x3533343530374536ULL, 0x3533343530374544ULL, 0x3533343530374545ULL, 0x3533343530374546ULL,
+            0x3533343530374630ULL, 0x3533343530374631ULL, 0x3533343530374632ULL, 0x3533343530374634ULL,
+            0x3533343530374635ULL, 0x3533343530383036ULL, 0x3533343530383043ULL, 0x3533343530383045ULL,
+            0x3533343530383130ULL, 0x3533343530383132ULL, 0x3533343530383133ULL, 0x3533343530383134ULL,
+            0x3533343530383135ULL, 0x3533343530383141ULL, 0x3533343530383235ULL, 0x3533343530383241ULL,
+            0x3533343530383332ULL, 0x3533343530383336ULL, 0x3533343530383339ULL, 0x3533343530383346ULL,
+            0x3533343530383431ULL, 0x3533343530383433ULL, 0x3533343530383435ULL, 0x3533343530383436ULL,
+            0x3533343530383438ULL, 0x3533343530383444ULL, 0x3533343530383537ULL, 0x3533343530383538ULL,
+            0x3533343530383541ULL, 0x3533343530383543ULL, 0x3533343530383544ULL, 0x3533343530383545ULL,
+            0x3533344130374431ULL, 0x3533344530303031ULL, 0x3533344530303032ULL, 0x3533344530303033ULL,
+            0x3533344530303034ULL, 0x3533344530303035ULL, 0x3533344530303036ULL, 0x3533344530303037ULL,
+            0x3533344530303038ULL, 0x3533344530303041ULL, 0x3533344530374432ULL, 0x3533344530374435ULL,
+            0x3533344530374443ULL, 0x3533353030303031ULL, 0x3533353030374434ULL, 0x3533353030374446ULL,
+            0x3533353030374544ULL, 0x3533353130374432ULL, 0x3533353130374434ULL, 0x3533353130374435ULL,
+            0x3533353130374441ULL, 0x3533353130374442ULL, 0x3533353130374444ULL, 0x3533353130374533ULL,
+            0x3533353130374534ULL, 0x3533353130374538ULL, 0x3533353130374539ULL, 0x3533353130374631ULL,
+            0x3533353130374635ULL, 0x3533353130374641ULL, 0x3533353130383032ULL, 0x3533353130383033ULL,
+            0x3533353130383034ULL, 0x3533353130383036ULL, 0x3533353130383131ULL, 0x3533353130383142ULL,
+            0x3533353130383143ULL, 0x3533353130383145ULL, 0x3533353130383233ULL, 0x3533353330303033ULL,
+            0x3533353330303036ULL, 0x3533353330303037ULL, 0x3533353338303033ULL, 0x3533353338303035ULL,
+            0x3533353430303031ULL, 0x3533353530303031ULL, 0x3533353530303032ULL, 0x3533353530303033ULL,
+            0x3533353530303034ULL, 0x3533353530303035ULL, 0x3533353530303036ULL, 0x3533353530303037ULL,
+            0x3533353530303038ULL, 0x3533353530303039ULL, 0x3533353630374431ULL, 0x3533353630374437ULL,
+            0x3533353730303031ULL, 0x3534343130303031ULL, 0x3534343330303031ULL, 0x3534343330303033ULL,
+            0x3534343330303034ULL, 0x3534343330303036ULL, 0x3534343330303037ULL, 0x3534343330303039ULL,
+            0x3534343330303041ULL, 0x3534343330303043ULL, 0x3534343330303044ULL, 0x3534343330303045ULL,
+            0x3534343330374431ULL, 0x3534343330374432ULL, 0x3534343330374435ULL, 0x3534343330374442ULL,
+            0x3534343330374443ULL, 0x3534343430303036ULL, 0x3534344230303031ULL, 0x3534344230303034ULL,
+            0x3534344430303031ULL, 0x3534344430303032ULL, 0x3534344430303033ULL, 0x3534344430303034ULL,
+            0x3534344430303035ULL, 0x3534344430303036ULL, 0x3534344430303037ULL, 0x3534344430303038ULL,
+            0x3534344430303039ULL, 0x3534344430303041ULL, 0x3534344430303042ULL, 0x3534344430303044ULL,
+            0x3534344430303046ULL, 0x3534344430303130ULL, 0x3534344430303131ULL, 0x3534344430303132ULL,
+            0x3534344430303133ULL, 0x3534353130303031ULL, 0x3534353130303032ULL, 0x3534353130303033ULL,
+            0x3534353130303034ULL, 0x3534353130303035ULL, 0x3534353130303036ULL, 0x3534353130303037ULL,
+            0x3534353130303038ULL, 0x3534353130303039ULL, 0x3534353130303041ULL, 0x3534353130303042ULL,
+            0x3534353130303043ULL, 0x3534353130303044ULL, 0x3534353130303045ULL, 0x3534353130303046ULL,
+            0x3534353130303130ULL, 0x3534353130303133ULL, 0x3534353130303136ULL, 0x3534353130303138ULL,
+            0x3534353130303141ULL, 0x3534353130303143ULL, 0x3534353130303144ULL, 0x3534353130303145ULL,
+            0x3534353130303146ULL, 0x3534353130303230ULL, 0x3534353130303231ULL, 0x3534353130303232ULL,
+            0x3534353130303233ULL, 0x3534353130303234ULL, 0x3534353130303235ULL, 0x3534353130303236ULL,
+            0x3534353130303237ULL, 0x3534353130303238ULL, 0x3534353130303838ULL, 0x3534353130303839ULL,
+            0x3534353130303842ULL, 0x3534353130304544ULL, 0x3534353130304546ULL, 0x3534353130304632ULL,
+            0x3534353130304634ULL, 0x3534353130304635ULL, 0x3534353130304636ULL, 0x3534353130304637ULL,
+            0x3534353130304638ULL, 0x3534353130304639ULL, 0x3534353130304641ULL, 0x3534353130313031ULL,
+            0x3534353130313035ULL, 0x3534353130313036ULL, 0x3534353130313039ULL, 0x3534353130374431ULL,
+            0x3534353130374432ULL, 0x3534353130374434ULL, 0x3534353130374438ULL, 0x3534353130374441ULL,
+            0x3534353130374445ULL, 0x3534353130374530ULL, 0x3534353130374531ULL, 0x3534353130374536ULL,
+            0x3534353130374541ULL, 0x3534353130374546ULL, 0x3534353130374631ULL, 0x3534353130374634ULL,
+            0x3534353130374636ULL, 0x3534353130374643ULL, 0x3534353130374645ULL, 0x3534353130383031ULL,
+            0x3534353130383042ULL, 0x3534353130383044ULL, 0x3534353130383234ULL, 0x3534353130383236ULL,
+            0x3534353130383239ULL, 0x3534353130383241ULL, 0x3534353130383243ULL, 0x3534353130383335ULL,
+            0x3534353130383338ULL, 0x3534353130383339ULL, 0x3534353130383342ULL, 0x3534353130383430ULL,
+            0x3534353130383432ULL, 0x3534353130383434ULL, 0x3534353130383436ULL, 0x3534353130383438ULL,
+            0x3534353130383530ULL, 0x3534353130383531ULL, 0x3534353130383539ULL, 0x3534353130383542ULL,
+            0x3534353130383543ULL, 0x3534353130383544ULL, 0x3534353130383545ULL, 0x3534353130383546ULL,
+            0x3534353130383630ULL, 0x3534353130383635ULL, 0x3534353130383636ULL, 0x3534353130383639ULL,
+            0x3534353130383642ULL, 0x3534353130383644ULL, 0x3534353130383733ULL, 0x3534353130383734ULL,
+            0x3534353130383735ULL, 0x3534353130383742ULL, 0x3534353130383744ULL, 0x3534353130383842ULL,
+            0x3534353130383843ULL, 0x3534353130383930ULL, 0x3534353130383936ULL, 0x3534353130383939ULL,
+            0x3534353130383942ULL, 0x3534353130383943ULL, 0x3534353130383944ULL, 0x3534353130383945ULL,
+            0x3534353130384145ULL, 0x3534353130384146ULL, 0x3534353130384231ULL, 0x3534353130384234ULL,
+            0x3534353330303032ULL, 0x3534353330303035ULL, 0x3534353430303031ULL, 0x3534353430303033ULL,
+            0x3534353430303034ULL, 0x3534353430303035ULL, 0x3534353430303036ULL, 0x3534353430303038ULL,
+            0x3534353430303039ULL, 0x3534353430303041ULL, 0x3534353430303042ULL, 0x3534353430303043ULL,
+            0x3534353430303044ULL, 0x3534353430303045ULL, 0x3534353430303046ULL, 0x3534353430303130ULL,
+            0x3534353430303131ULL, 0x3534353430303132ULL, 0x3534353430303134ULL, 0x3534353430303135ULL,
+            0x3534353430303136ULL, 0x3534353430303137ULL, 0x3534353430303138ULL, 0x3534353430303139ULL,
+            0x3534353430303141ULL, 0x3534353430303142ULL, 0x3534353430303733ULL, 0x3534353430303736ULL,
+            0x3534353430303737ULL, 0x3534353430303739ULL, 0x3534353430303741ULL, 0x3534353430303742ULL,
+            0x3534353430303743ULL, 0x3534353430303744ULL, 0x3534353430303745ULL, 0x3534353430303746ULL,
+            0x3534353430303831ULL, 0x3534353430303832ULL, 0x3534353430303833ULL, 0x3534353430303834ULL,
+            0x3534353430303836ULL, 0x3534353430303837ULL, 0x3534353430303838ULL, 0x3534353430303839ULL,
+            0x3534353430303841ULL, 0x3534353430303843ULL, 0x3534353430303844ULL, 0x3534353430303846ULL,
+            0x3534353430303930ULL, 0x3534353430303931ULL, 0x3534353430303932ULL, 0x3534353430303933ULL,
+            0x3534353430303935ULL, 0x3534353430303936ULL, 0x3534353430303942ULL, 0x3534353430303943ULL,
+            0x3534353430304131ULL, 0x3534353430304132ULL, 0x3534353430304133ULL, 0x3534353430304134ULL,
+            0x3534353430304135ULL, 0x3534353430304137ULL, 0x3534353430304139ULL, 0x3534353430304142ULL,
+            0x3534353430304144ULL, 0x3534353430304145ULL, 0x3534353430304146ULL, 0x3534353430304230ULL,
+            0x3534353430304231ULL, 0x3534353430374432ULL, 0x3534353430374433ULL, 0x3534353430374434ULL,
+            0x3534353430374435ULL, 0x3534353430374438ULL, 0x3534353430374443ULL, 0x3534353430374444ULL,
+            0x3534353430374446ULL, 0x3534353430374530ULL, 0x3534353430374532ULL, 0x3534353430374533ULL,
+            0x3534353430374534ULL, 0x3534353430374535ULL, 0x3534353430374536ULL, 0x3534353430374537ULL,
+            0x3534353430374542ULL, 0x3534353430374545ULL, 0x3534353430374546ULL, 0x3534353430374631ULL,
+            0x3534353430374632ULL, 0x3534353430374638ULL, 0x3534353430374641ULL, 0x3534353430374646ULL,
+            0x3534353430383037ULL, 0x3534353430383039ULL, 0x3534353430383043ULL, 0x3534353430383137ULL,
+            0x3534353430383138ULL, 0x3534353430383141ULL, 0x3534353430383239ULL, 0x3534353430383242ULL,
+            0x3534353430383244ULL, 0x3534353430383245ULL, 0x3534353430383246ULL, 0x3534353430383330ULL,
+            0x3534353430383432ULL, 0x3534353430383433ULL, 0x3534353430383445ULL, 0x3534353430383532ULL,
+            0x3534353430383533ULL, 0x3534353430383535ULL, 0x3534353430383539ULL, 0x3534353430383544ULL,
+            0x3534353430383631ULL, 0x3534353430383642ULL, 0x3534353430383643ULL, 0x3534353430383741ULL,
+            0x3534353430383743ULL, 0x3534353430383832ULL, 0x3534353430383833ULL, 0x3534353430383844ULL,
+            0x3534353430383845ULL, 0x3534353430383930ULL, 0x3534353430383934ULL, 0x3534353430383935ULL,
+            0x3534353430383939ULL, 0x3534353430383945ULL, 0x3534353430384132ULL, 0x3534353430384135ULL,
+            0x3534353430384137ULL, 0x3534353430384145ULL, 0x3534353430384230ULL, 0x3534353430384232ULL,
+            0x3534353430384234ULL, 0x3534353430384235ULL, 0x3534353430384236ULL, 0x3534353430384238ULL,
+            0x3534353430384241ULL, 0x3534353630374433ULL, 0x3534353630374435ULL, 0x3534353930374431ULL,
+            0x3534354130374431ULL, 0x3534354130374433ULL, 0x3534354130374434ULL, 0x3534354130374435ULL,
+            0x3535344630374433ULL, 0x3535344630374434ULL, 0x3535353330303031ULL, 0x3535353330303032ULL,
+            0x3535353330303033ULL, 0x3535353330303034ULL, 0x3535353330303035ULL, 0x3535353330303036ULL,
+            0x3535353330303037ULL, 0x3535353330303038ULL, 0x3535353330303039ULL, 0x3535353330303041ULL,
+            0x3535353330303042ULL, 0x3535353330303043ULL, 0x3535353330303044ULL, 0x3535353330303046ULL,
+            0x3535353330303131ULL, 0x3535353330303132ULL, 0x3535353330303133ULL, 0x3535353330303134ULL,
+            0x3535353330303135ULL, 0x3535353330303136ULL, 0x3535353330303138ULL, 0x3535353330303139ULL,
+            0x3535353330303143ULL, 0x3535353330303144ULL, 0x3535353330303230ULL, 0x3535353330303334ULL,
+            0x3535353330303336ULL, 0x3535353330303337ULL, 0x3535353330303339ULL, 0x3535353330303341ULL,
+            0x3535353330303342ULL, 0x3535353330303343ULL, 0x3535353330303344ULL, 0x3535353330303346ULL,
+            0x3535353330303430ULL, 0x3535353330303431ULL, 0x3535353330303433ULL, 0x3535353330303438ULL,
+            0x3535353330303439ULL, 0x3535353330303441ULL, 0x3535353330303442ULL, 0x3535353330303443ULL,
+            0x3535353330303444ULL, 0x3535353330303534ULL, 0x3535353330303536ULL, 0x3535353330303537ULL,
+            0x3535353330303538ULL, 0x3535353330303541ULL, 0x3535353330303542ULL, 0x3535353330303543ULL,
+            0x3535353330303545ULL, 0x3535353330303546ULL, 0x3535353330303630ULL, 0x3535353330303631ULL,
+            0x3535353330374433ULL, 0x3535353330374434ULL, 0x3535353330374435ULL, 0x3535353330374436ULL,
+            0x3535353330374437ULL, 0x3535353330374442ULL, 0x3535353330374443ULL, 0x3535353330374530ULL,
+            0x3535353330374535ULL, 0x3535353330374536ULL, 0x3535353330374538ULL, 0x3535353330374541ULL,
+            0x3535353330374630ULL, 0x3535353330374633ULL, 0x3535353330374636ULL, 0x3535353330374638ULL,
+            0x3535353330374641ULL, 0x3535353330374642ULL, 0x3535353330374645ULL, 0x3535353330383031ULL,
+            0x3535353330383034ULL, 0x3535353330383037ULL, 0x3535353330383038ULL, 0x3535353330383039ULL,
+            0x3535353330383042ULL, 0x3535353330383043ULL, 0x3535353330383046ULL, 0x3535353330383130ULL,
+            0x3535353330383136ULL, 0x3535353330383143ULL, 0x3535353330383145ULL, 0x3535353330383235ULL,
+            0x3535353330383246ULL, 0x3535353330383333ULL, 0x3535353330383336ULL, 0x3535353330383342ULL,
+            0x3535353330383343ULL, 0x3535353330383345ULL, 0x3535353330383346ULL, 0x3535353330383431ULL,
+            0x3535353330383438ULL, 0x3535353330383439ULL, 0x3535353330383443ULL, 0x3535353330383445ULL,
+            0x3535353330383446ULL, 0x3535353330383530ULL, 0x3535353330383531ULL, 0x3535353330383544ULL,
+            0x3535353330383642ULL, 0x3535353330383731ULL, 0x3535353330383733ULL, 0x3535353330383734ULL,
+            0x3535353330383737ULL, 0x3535353330383739ULL, 0x3535353330383745ULL, 0x3535353330383746ULL,
+            0x3535353330383830ULL, 0x3535353330383831ULL, 0x3535353330383832ULL, 0x3535353330383833ULL,
+            0x3535353330383834ULL, 0x3535353330383836ULL, 0x3535353330383837ULL, 0x3535353330383838ULL,
+            0x3535353330383839ULL, 0x3535353330383843ULL, 0x3535353330383844ULL, 0x3535353330384144ULL,
+            0x3535353330384145ULL, 0x3535353330384232ULL, 0x3535353330384233ULL, 0x3535353330384234ULL,
+            0x3535353330384235ULL, 0x3535353330384236ULL, 0x3535353330384237ULL, 0x3535353330384244ULL,
+            0x3535353330384330ULL, 0x3535353330384331ULL, 0x3535353330384332ULL, 0x3535353330384333ULL,
+            0x3535353330384335ULL, 0x3535353330384337ULL, 0x3535353330384341ULL, 0x3535353330384342ULL,
+            0x3535353330384343ULL, 0x3535353330384344ULL, 0x3535353330384345ULL, 0x3535353330384430ULL,
+            0x3535353330384433ULL, 0x3536333330374431ULL, 0x3536343330303031ULL, 0x3536343730374431ULL,
+            0x3536343730374433ULL, 0x3536343730374434ULL, 0x3536344530303034ULL, 0x3536344530303036ULL,
+            0x3536353130374436ULL, 0x3536353130374437ULL, 0x3536353130374439ULL, 0x3536353530303033ULL,
+            0x3536353530303034ULL, 0x3536353530303035ULL, 0x3536353530303037ULL, 0x3536353530303038ULL,
+            0x3536353530303039ULL, 0x3536353530303041ULL, 0x3536353530303044ULL, 0x3536353530303045ULL,
+            0x3536353530303046ULL, 0x3536353530303130ULL, 0x3536353530303131ULL, 0x3536353530303133ULL,
+            0x3536353530303134ULL, 0x3536353530303135ULL, 0x3536353530303136ULL, 0x3536353530303137ULL,
+            0x3536353530303138ULL, 0x3536353530303139ULL, 0x3536353530303141ULL, 0x3536353530303146ULL,
+            0x3536353530303231ULL, 0x3536353530303232ULL, 0x3536353530303233ULL, 0x3536353530303236ULL,
+            0x3536353530303237ULL, 0x3536353530303238ULL, 0x3536353530303239ULL, 0x3536353530303241ULL,
+            0x3536353530303244ULL, 0x3536353530303246ULL, 0x3536353530303330ULL, 0x3536353530303331ULL,
+            0x3536353530303334ULL, 0x3536353530303336ULL, 0x3536353530303337ULL, 0x3536353530303339ULL,
+            0x3536353530303346ULL, 0x3536353530303430ULL, 0x3536353530303431ULL, 0x3536353530303432ULL,
+            0x3536353530303433ULL, 0x3536353530303438ULL, 0x3536353530303439ULL, 0x3536353530303441ULL,
+            0x3536353530303442ULL, 0x3536353530374434ULL, 0x3536353530374439ULL, 0x3536353530374441ULL,
+            0x3536353530374530ULL, 0x3536353530374534ULL, 0x3536353530374536ULL, 0x3536353530374639ULL,
+            0x3536353530374641ULL, 0x3536353538303142ULL, 0x3536353630303031ULL, 0x3536353630303032ULL,
+            0x3536353630303033ULL, 0x3536353630303035ULL, 0x3536353630303038ULL, 0x3536353630303041ULL,
+            0x3536353630303044ULL, 0x3536353630303130ULL, 0x3536353630303131ULL, 0x3536353630303231ULL,
+            0x3536353630303235ULL, 0x3536353630303239ULL, 0x3536353730374430ULL, 0x3536353730374436ULL,
+            0x3537333630374432ULL, 0x3537333630374435ULL, 0x3537333630374437ULL, 0x3537333630374438ULL,
+            0x3537333630374442ULL, 0x3537333630374532ULL, 0x3537333630374533ULL, 0x3537333630374534ULL,
+            0x3537343230374537ULL, 0x3537343530303031ULL, 0x3537343530303035ULL, 0x3537353230303031ULL,
+            0x3537353230374432ULL, 0x3537353230374433ULL, 0x3537353230374437ULL, 0x3537353230374441ULL,
+            0x3537353230374536ULL, 0x3537353230374539ULL, 0x3537353230374546ULL, 0x3537353230374630ULL,
+            0x3537353230374631ULL, 0x3537353230374632ULL, 0x3537353230374644ULL, 0x3537353230383030ULL,
+            0x3537353230383031ULL, 0x3537353230383032ULL, 0x3537353230383043ULL, 0x3537353230383044ULL,
+            0x3537353230383132ULL, 0x3537353230383137ULL, 0x3537353230383144ULL, 0x3537353230383234ULL,
+            0x3537353230383236ULL, 0x3537353230383238ULL, 0x3537353230383239ULL, 0x3537353230383243ULL,
+            0x3537353230383246ULL, 0x3537353230383333ULL, 0x3537353230383335ULL, 0x3537353230383338ULL,
+            0x3537353230383431ULL, 0x3537353230383434ULL, 0x3537353230383435ULL, 0x3537353230383442ULL,
+            0x3537353230383444ULL, 0x3537353230383446ULL, 0x3537353230383531ULL, 0x3538343130374431ULL,
+            0x3538343130374432ULL, 0x3538343130374433ULL, 0x3538343130374435ULL, 0x3538343130374441ULL,
+            0x3538343130374442ULL, 0x3538343130374444ULL, 0x3538343130374445ULL, 0x3538343130374532ULL,
+            0x3538343130374534ULL, 0x3538343130374535ULL, 0x3538343130374537ULL, 0x3538343130374539ULL,
+            0x3538343130374541ULL, 0x3538343130374543ULL, 0x3538343130374544ULL, 0x3538343130374545ULL,
+            0x3538343130374546ULL, 0x3538343130374630ULL, 0x3538343130374631ULL, 0x3538343130374632ULL,
+            0x3538343130374633ULL, 0x3538343130374634ULL, 0x3538343130374635ULL, 0x3538343130374636ULL,
+            0x3538343130374637ULL, 0x3538343130374638ULL, 0x3538343130374642ULL, 0x3538343130374645ULL,
+            0x3538343130383037ULL, 0x3538343130383043ULL, 0x3538343130383044ULL, 0x3538343130383130ULL,
+            0x3538343130383131ULL, 0x3538343130383132ULL, 0x3538343130383133ULL, 0x3538343130383134ULL,
+            0x3538343130383135ULL, 0x3538343130383136ULL, 0x3538343130383137ULL, 0x3538343130383138ULL,
+            0x3538343130383139ULL, 0x3538343130383141ULL, 0x3538343130383142ULL, 0x3538343130383145ULL,
+            0x3538343130383230ULL, 0x3538343130383231ULL, 0x3538343130383232ULL, 0x3538343130383234ULL,
+            0x3538343130383235ULL, 0x3538343130383236ULL, 0x3538343130383246ULL, 0x3538343130383330ULL,
+            0x3538343130383331ULL, 0x3538343130383334ULL, 0x3538343130383335ULL, 0x3538343130383336ULL,
+            0x3538343130383337ULL, 0x3538343130383341ULL, 0x3538343130383342ULL, 0x3538343130383344ULL,
+            0x3538343130383345ULL, 0x3538343130383346ULL, 0x3538343130383430ULL, 0x3538343130383431ULL,
+            0x3538343130383434ULL, 0x3538343130383436ULL, 0x3538343130383437ULL, 0x3538343130383443ULL,
+            0x3538343130383444ULL, 0x3538343130383445ULL, 0x3538343130383446ULL, 0x3538343130383530ULL,
+            0x3538343130383531ULL, 0x3538343130383537ULL, 0x3538343130383542ULL, 0x3538343130383543ULL,
+            0x3538343130383545ULL, 0x3538343130383630ULL, 0x3538343130383632ULL, 0x3538343130383633ULL,
+            0x3538343130383634ULL, 0x3538343130383635ULL, 0x3538343130383636ULL, 0x3538343130383637ULL,
+            0x3538343130383638ULL, 0x3538343130383639ULL, 0x3538343130383641ULL, 0x3538343130383643ULL,
+            0x3538343130383644ULL, 0x3538343130383645ULL, 0x3538343130383646ULL, 0x3538343130383732ULL,
+            0x3538343130383733ULL, 0x3538343130383734ULL, 0x3538343130383735ULL, 0x3538343130383736ULL,
+            0x3538343130383737ULL, 0x3538343130383738ULL, 0x3538343130383739ULL, 0x3538343130383742ULL,
+            0x3538343130383743ULL, 0x3538343130383744ULL, 0x3538343130383745ULL, 0x3538343130383836ULL,
+            0x3538343130383838ULL, 0x3538343130383839ULL, 0x3538343130383843ULL, 0x3538343130383845ULL,
+            0x3538343130383846ULL, 0x3538343130383930ULL, 0x3538343130383934ULL, 0x3538343130383935ULL,
+            0x3538343130383936ULL, 0x3538343130383938ULL, 0x3538343130383939ULL, 0x3538343130383941ULL,
+            0x3538343130383942ULL, 0x3538343130383943ULL, 0x3538343130383945ULL, 0x3538343130383946ULL,
+            0x3538343130384130ULL, 0x3538343130384131ULL, 0x3538343130384134ULL, 0x3538343130384135ULL,
+            0x3538343130384136ULL, 0x3538343130384137ULL, 0x3538343130384138ULL, 0x3538343130384141ULL,
+            0x3538343130384142ULL, 0x3538343130384143ULL, 0x3538343130384144ULL, 0x3538343130384145ULL,
+            0x3538343130384233ULL, 0x3538343130384234ULL, 0x3538343130384237ULL, 0x3538343130384238ULL,
+            0x3538343130384242ULL, 0x3538343130384243ULL, 0x3538343130384245ULL, 0x3538343130384332ULL,
+            0x3538343130384333ULL, 0x3538343130384337ULL, 0x3538343130384338ULL, 0x3538343130384342ULL,
+            0x3538343130384343ULL, 0x3538343130384345ULL, 0x3538343130384346ULL, 0x3538343130384430ULL,
+            0x3538343130384431ULL, 0x3538343130384433ULL, 0x3538343130384438ULL, 0x3538343130384439ULL,
+            0x3538343130384442ULL, 0x3538343130384443ULL, 0x3538343130384543ULL, 0x3538343130384546ULL,
+            0x3538343130384630ULL, 0x3538343130384631ULL, 0x3538343130384633ULL, 0x3538343130384636ULL,
+            0x3538343130384639ULL, 0x3538343130384646ULL, 0x3538343130393030ULL, 0x3538343130393031ULL,
+            0x3538343130393032ULL, 0x3538343130393034ULL, 0x3538343130393037ULL, 0x3538343130393038ULL,
+            0x3538343130393039ULL, 0x3538343130393044ULL, 0x3538343130393046ULL, 0x3538343130393130ULL,
+            0x3538343130393132ULL, 0x3538343130393142ULL, 0x3538343130393143ULL, 0x3538343130393144ULL,
+            0x3538343130393230ULL, 0x3538343130393231ULL, 0x3538343130393232ULL, 0x3538343130393237ULL,
+            0x3538343130393241ULL, 0x3538343130393242ULL, 0x3538343130393244ULL, 0x3538343130393245ULL,
+            0x3538343130393246ULL, 0x3538343130393330ULL, 0x3538343130393331ULL, 0x3538343130393332ULL,
+            0x3538343130393334ULL, 0x3538343130393339ULL, 0x3538343130393343ULL, 0x3538343130393532ULL,
+            0x3538343130393534ULL, 0x3538343130393535ULL, 0x3538343130393536ULL, 0x3538343130393537ULL,
+            0x3538343130393541ULL, 0x3538343130393545ULL, 0x3538343130393546ULL, 0x3538343130393630ULL,
+            0x3538343130393631ULL, 0x3538343130393634ULL, 0x3538343130393641ULL, 0x3538343130393644ULL,
+            0x3538343130393645ULL, 0x3538343130393646ULL, 0x3538343130393731ULL, 0x3538343130393732ULL,
+            0x3538343130393734ULL, 0x3538343130393735ULL, 0x3538343130393736ULL, 0x3538343130393737ULL,
+            0x3538343130393739ULL, 0x3538343130393741ULL, 0x3538343130393742ULL, 0x3538343130393744ULL,
+            0x3538343130393745ULL, 0x3538343130393831ULL, 0x3538343130393832ULL, 0x3538343130393833ULL,
+            0x3538343130393835ULL, 0x3538343130393837ULL, 0x3538343130393839ULL, 0x3538343130393842ULL,
+            0x3538343130393844ULL, 0x3538343130393845ULL, 0x3538343130393846ULL, 0x3538343130393930ULL,
+            0x3538343130393931ULL, 0x3538343130393934ULL, 0x3538343130393935ULL, 0x3538343130393936ULL,
+            0x3538343130393938ULL, 0x3538343130393939ULL, 0x3538343130393945ULL, 0x3538343130393946ULL,
+            0x3538343130394130ULL, 0x3538343130394131ULL, 0x3538343130394132ULL, 0x3538343130394133ULL,
+            0x3538343130394134ULL, 0x3538343130394135ULL, 0x3538343130394136ULL, 0x3538343130394137ULL,
+            0x3538343130394138ULL, 0x3538343130394141ULL, 0x3538343130394144ULL, 0x3538343130394145ULL,
+            0x3538343130394230ULL, 0x3538343130394232ULL, 0x3538343130394233ULL, 0x3538343130394234ULL,
+            0x3538343130394235ULL, 0x3538343130394236ULL, 0x3538343130394237ULL, 0x3538343130394238ULL,
+            0x3538343130394242ULL, 0x3538343130394243ULL, 0x3538343130394245ULL, 0x3538343130394246ULL,
+            0x3538343130394330ULL, 0x3538343130394331ULL, 0x3538343130394332ULL, 0x3538343130394333ULL,
+            0x3538343130394334ULL, 0x3538343130394335ULL, 0x3538343130394336ULL, 0x3538343130394337ULL,
+            0x3538343130394338ULL, 0x3538343130394339ULL, 0x3538343130394342ULL, 0x3538343130394346ULL,
+            0x3538343130394431ULL, 0x3538343130394435ULL, 0x3538343130394436ULL, 0x3538343130394439ULL,
+            0x3538343130394441ULL, 0x3538343130394442ULL, 0x3538343130394443ULL, 0x3538343130394444ULL,
+            0x3538343130394445ULL, 0x3538343130394532ULL, 0x3538343130394533ULL, 0x3538343130394534ULL,
+            0x3538343130394539ULL, 0x3538343130394541ULL, 0x3538343130394543ULL, 0x3538343130394544ULL,
+            0x3538343130394545ULL, 0x3538343130394546ULL, 0x3538343130394646ULL, 0x3538343130413032ULL,
+            0x3538343130413033ULL, 0x3538343130413035ULL, 0x3538343130413036ULL, 0x3538343130413037ULL,
+            0x3538343130413046ULL, 0x3538343130413131ULL, 0x3538343130413133ULL, 0x3538343130413136ULL,
+            0x3538343130413137ULL, 0x3538343130413138ULL, 0x3538343130413139ULL, 0x3538343130413142ULL,
+            0x3538343130413144ULL, 0x3538343130413146ULL, 0x3538343130413230ULL, 0x3538343130413231ULL,
+            0x3538343130413232ULL, 0x3538343130413233ULL, 0x3538343130413234ULL, 0x3538343130413235ULL,
+            0x3538343130413243ULL, 0x3538343130413244ULL, 0x3538343130413330ULL, 0x3538343130413334ULL,
+            0x3538343130413336ULL, 0x3538343130413337ULL, 0x3538343130413338ULL, 0x3538343130413339ULL,
+            0x3538343130413342ULL, 0x3538343130413343ULL, 0x3538343130413344ULL, 0x3538343130413444ULL,
+            0x3538343130413532ULL, 0x3538343130413533ULL, 0x3538343130413534ULL, 0x3538343130413537ULL,
+            0x3538343130413538ULL, 0x3538343130413539ULL, 0x3538343130413541ULL, 0x3538343130413542ULL,
+            0x3538343130413543ULL, 0x3538343130413630ULL, 0x3538343130413632ULL, 0x3538343130413635ULL,
+            0x3538343130413637ULL, 0x3538343130413638ULL, 0x3538343130413639ULL, 0x3538343130413642ULL,
+            0x3538343130413643ULL, 0x3538343130413646ULL, 0x3538343130413730ULL, 0x3538343130413731ULL,
+            0x3538343130413732ULL, 0x3538343130413733ULL, 0x3538343130413735ULL, 0x3538343130413737ULL,
+            0x3538343130413738ULL, 0x3538343130413739ULL, 0x3538343130413741ULL, 0x3538343130413742ULL,
+            0x3538343130413743ULL, 0x3538343130413745ULL, 0x3538343130413832ULL, 0x3538343130413833ULL,
+            0x3538343130413836ULL, 0x3538343130413837ULL, 0x3538343130413838ULL, 0x3538343130413839ULL,
+            0x3538343130413842ULL, 0x3538343130413843ULL, 0x3538343130413844ULL, 0x3538343130413931ULL,
+            0x3538343130413935ULL, 0x3538343130413941ULL, 0x3538343130413942ULL, 0x3538343130413943ULL,
+            0x3538343130413946ULL, 0x3538343130414131ULL, 0x3538343130414132ULL, 0x3538343130414133ULL,
+            0x3538343130414135ULL, 0x3538343130414139ULL, 0x3538343130414143ULL, 0x3538343130414144ULL,
+            0x3538343130414245ULL, 0x3538343130414332ULL, 0x3538343130414342ULL, 0x3538343130414539ULL,
+            0x3538343130414631ULL, 0x3538343130414632ULL, 0x3538343130414634ULL, 0x3538343130414637ULL,
+            0x3538343130414639ULL, 0x3538343130414641ULL, 0x3538343130414644ULL, 0x3538343130423030ULL,
+            0x3538343130423037ULL, 0x3538343130423042ULL, 0x3538343130423046ULL, 0x3538343130423130ULL,
+            0x3538343130423131ULL, 0x3538343130423134ULL, 0x3538343130423136ULL, 0x3538343130423139ULL,
+            0x3538343130423143ULL, 0x3538343130423144ULL, 0x3538343130423232ULL, 0x3538343130423235ULL,
+            0x3538343130423237ULL, 0x3538343130423242ULL, 0x3538343130423332ULL, 0x3538343130423334ULL,
+            0x3538343130423337ULL, 0x3538343130423339ULL, 0x3538343130423341ULL, 0x3538343130423343ULL,
+            0x3538343130423344ULL, 0x3538343130423345ULL, 0x3538343130423346ULL, 0x3538343130423431ULL,
+            0x3538343130423432ULL, 0x3538343130423435ULL, 0x3538343130423437ULL, 0x3538343130423438ULL,
+            0x3538343130423439ULL, 0x3538343130423441ULL, 0x3538343130423532ULL, 0x3538343130423541ULL,
+            0x3538343130423543ULL, 0x3538343130423544ULL, 0x3538343130423632ULL, 0x3538343130423633ULL,
+            0x3538343130423634ULL, 0x3538343130423636ULL, 0x3538343130423643ULL, 0x3538343130423644ULL,
+            0x3538343130423646ULL, 0x3538343130423730ULL, 0x3538343130423731ULL, 0x3538343130423732ULL,
+            0x3538343130423736ULL, 0x3538343130423739ULL, 0x3538343130423741ULL, 0x3538343130423742ULL,
+            0x3538343130423743ULL, 0x3538343130423746ULL, 0x3538343130423830ULL, 0x3538343130423832ULL,
+            0x3538343130423833ULL, 0x3538343130423836ULL, 0x3538343130423838ULL, 0x3538343130423841ULL,
+            0x3538343130423842ULL, 0x3538343130423843ULL, 0x3538343130423844ULL, 0x3538343130423846ULL,
+            0x3538343130423930ULL, 0x3538343130423932ULL, 0x3538343130423935ULL, 0x3538343131314435ULL,
+            0x3538343131314436ULL, 0x3538343131314438ULL, 0x3538343131314439ULL, 0x3538343131314441ULL,
+            0x3538343131314442ULL, 0x3538343131314443ULL, 0x3538343131314444ULL, 0x3538343131314445ULL,
+            0x3538343131314530ULL, 0x3538343131314531ULL, 0x3538343131314532ULL, 0x3538343131314535ULL,
+            0x3538343131314538ULL, 0x3538343131314539ULL, 0x3538343131314541ULL, 0x3538343131314542ULL,
+            0x3538343131314543ULL, 0x3538343131314545ULL, 0x3538343131314631ULL, 0x3538343131314632ULL,
+            0x3538343131314633ULL, 0x3538343131314635ULL, 0x3538343131314636ULL, 0x3538343131314637ULL,
+            0x3538343131314639ULL, 0x3538343131314642ULL, 0x3538343131314645ULL, 0x3538343131314646ULL,
+            0x3538343131323032ULL, 0x3538343131323033ULL, 0x3538343131323043ULL, 0x3538343131323132ULL,
+            0x3538343131323133ULL, 0x3538343131323136ULL, 0x3538343131323139ULL, 0x3538343131323144ULL,
+            0x3538343131323230ULL, 0x3538343131323231ULL, 0x3538343131323232ULL, 0x3538343131323236ULL,
+            0x3538343131323238ULL, 0x3538343131323244ULL, 0x3538343131323246ULL, 0x3538343131323330ULL,
+            0x3538343131323332ULL, 0x3538343131323333ULL, 0x3538343131323334ULL, 0x3538343131323335ULL,
+            0x3538343131323336ULL, 0x3538343131323338ULL, 0x3538343131323341ULL, 0x3538343131323342ULL,
+            0x3538343131323343ULL, 0x3538343131323345ULL, 0x3538343131323346ULL, 0x3538343131323430ULL,
+            0x3538343131323435ULL, 0x3538343131323437ULL, 0x3538343131323439ULL, 0x3538343131323441ULL,
+            0x3538343131323442ULL, 0x3538343131323443ULL, 0x3538343131323530ULL, 0x3538343131323532ULL,
+            0x3538343131323533ULL, 0x3538343131323536ULL, 0x3538343131323539ULL, 0x3538343131323541ULL,
+            0x3538343131323543ULL, 0x3538343131323544ULL, 0x3538343131323545ULL, 0x3538343131323630ULL,
+            0x3538343131323635ULL, 0x3538343131323636ULL, 0x3538343131323638ULL, 0x3538343131323737ULL,
+            0x3538343131323738ULL, 0x3538343131323739ULL, 0x3538343131323741ULL, 0x3538343131323744ULL,
+            0x3538343131323746ULL, 0x3538343131323832ULL, 0x3538343131323833ULL, 0x3538343131323835ULL,
+            0x3538343131323839ULL, 0x3538343131323841ULL, 0x3538343131323843ULL, 0x3538343131323844ULL,
+            0x3538343131323930ULL, 0x3538343131323931ULL, 0x3538343131323933ULL, 0x3538343131323937ULL,
+            0x3538343131323941ULL, 0x3538343131323943ULL, 0x3538343131323944ULL, 0x3538343131323945ULL,
+            0x3538343131324131ULL, 0x3538343131324135ULL, 0x3538343131324143ULL, 0x3538343131324144ULL,
+            0x3538343131324145ULL, 0x3538343131324146ULL, 0x3538343131324230ULL, 0x3538343131324231ULL,
+            0x3538343131324232ULL, 0x3538343131324233ULL, 0x3538343131324234ULL, 0x3538343131324235ULL,
+            0x3538343131324236ULL, 0x3538343131324331ULL, 0x3538343131324333ULL, 0x3538343131324335ULL,
+            0x3538343131324337ULL, 0x3538343131324338ULL, 0x3538343131324345ULL, 0x3538343131333239ULL,
+            0x3538343131334243ULL, 0x3538343131334244ULL, 0x3538343131334246ULL, 0x3538343131334330ULL,
+            0x3538343131334332ULL, 0x3538343131334333ULL, 0x3538343131334334ULL, 0x3538343131334336ULL,
+            0x3538343131334337ULL, 0x3538343131334338ULL, 0x3538343131334339ULL, 0x3538343131334341ULL,
+            0x3538343131334346ULL, 0x3538343131334436ULL, 0x3538343131334442ULL, 0x3538343131334443ULL,
+            0x3538343131334444ULL, 0x3538343131334533ULL, 0x3538343131334537ULL, 0x3538343131334538ULL,
+            0x3538343131334544ULL, 0x3538343131334545ULL, 0x3538343131334630ULL, 0x3538343131334632ULL,
+            0x3538343131334633ULL, 0x3538343131334635ULL, 0x3538343131334636ULL, 0x3538343131334638ULL,
+            0x3538343131334643ULL, 0x3538343131334645ULL, 0x3538343131343031ULL, 0x3538343131343032ULL,
+            0x3538343131343033ULL, 0x3538343131343035ULL, 0x3538343131343036ULL, 0x3538343131343037ULL,
+            0x3538343131343038ULL, 0x3538343131343039ULL, 0x3538343131343041ULL, 0x3538343131343044ULL,
+            0x3538343131343130ULL, 0x3538343131343131ULL, 0x3538343131343132ULL, 0x3538343131343133ULL,
+            0x3538343131343134ULL, 0x3538343131343141ULL, 0x3538343131343146ULL, 0x3538343131343230ULL,
+            0x3538343131343231ULL, 0x3538343131343236ULL, 0x3538343131343237ULL, 0x3538343131343238ULL,
+            0x3538343131343245ULL, 0x3538343131343330ULL, 0x3538343131343334ULL, 0x3538343131343335ULL,
+            0x3538343131343336ULL, 0x3538343131343341ULL, 0x3538343131343344ULL, 0x3538343131343345ULL,
+            0x3538343131343431ULL, 0x3538343131343432ULL, 0x3538343131343433ULL, 0x3538343131343436ULL,
+            0x3538343131343437ULL, 0x3538343131343438ULL, 0x3538343131343443ULL, 0x3538343131343445ULL,
+            0x3538343131343446ULL, 0x3538343131343531ULL, 0x3538343131343532ULL, 0x3538343131343533ULL,
+            0x3538343131343537ULL, 0x3538343131343538ULL, 0x3538343131343542ULL, 0x3538343131343545ULL,
+            0x3538343131343630ULL, 0x3538343131343633ULL, 0x3538343131343743ULL, 0x3538343131343838ULL,
+            0x3538343131343839ULL, 0x3538343131343845ULL, 0x3538343131343930ULL, 0x3538343131343938ULL,
+            0x3538343131343943ULL, 0x3538343131343945ULL, 0x3538343131343946ULL, 0x3538343131344134ULL,
+            0x3538343131344144ULL, 0x3538343131344232ULL, 0x3538343830374437ULL, 0x3538343830374531ULL,
+            0x3538343830374533ULL, 0x3538343830374543ULL, 0x3538343830383030ULL, 0x3538343830383131ULL,
+            0x3538343830383132ULL, 0x3538343830383133ULL, 0x3538343830383134ULL, 0x3538343830383136ULL,
+            0x3538343830383137ULL, 0x3538343830383138ULL, 0x3538343830383141ULL, 0x3538343830383142ULL,
+            0x3538343830383144ULL, 0x3538343830383145ULL, 0x3538343830383146ULL, 0x3538343830383331ULL,
+            0x3538343830383335ULL, 0x3538343830383336ULL, 0x3538343930303031ULL, 0x3538343930303034ULL,
+            0x3538343930303035ULL, 0x3538343930303037ULL, 0x3538344230303041ULL, 0x3538344230383341ULL,
+            0x3538344230383345ULL, 0x3538344330303042ULL, 0x3538344330303044ULL, 0x3538344330303046ULL,
+            0x3538344330374438ULL, 0x3538344338303134ULL, 0x3538344430303032ULL, 0x3538344430303033ULL,
+            0x3538353030303031ULL, 0x3538353030303034ULL, 0x3538353430374433ULL, 0x3538353430374439ULL,
+            0x3538353530384541ULL, 0x3538353530384542ULL, 0x3538353530384543ULL, 0x3538353530384544ULL,
+            0x3538353530384545ULL, 0x3538353530384546ULL, 0x3538353530384630ULL, 0x3538353530384631ULL,
+            0x3538353530384632ULL, 0x3538353530384633ULL, 0x3538353530384634ULL, 0x3538353530384635ULL,
+            0x3538353530384637ULL, 0x3538353530384639ULL, 0x3538353530384641ULL, 0x3538353530384642ULL,
+            0x3538353530384643ULL, 0x3538353530384644ULL, 0x3538353530384645ULL, 0x3538353530384646ULL,
+            0x3538353530393030ULL, 0x3538353530393031ULL, 0x3538353530393032ULL, 0x3538353530393033ULL,
+            0x3538353530393034ULL, 0x3538353530393035ULL, 0x3538353530393036ULL, 0x3538353530393037ULL,
+            0x3538353530393038ULL, 0x3538353530393039ULL, 0x3538353530393041ULL, 0x3538353530393042ULL,
+            0x3538353530393043ULL, 0x3538353530393044ULL, 0x3538353530393045ULL, 0x3538353530393046ULL,
+            0x3538353530393130ULL, 0x3538353530393131ULL, 0x3538353530393132ULL, 0x3538353530393133ULL,
+            0x3538353530393134ULL, 0x3538353530393135ULL, 0x3538353530393136ULL, 0x3538353530393137ULL,
+            0x3538353530393138ULL, 0x3538353530393139ULL, 0x3538353530393141ULL, 0x3538353530393142ULL,
+            0x3538353530393143ULL, 0x3538353530393144ULL, 0x3538353530393145ULL, 0x3538353530393146ULL,
+            0x3538353530393230ULL, 0x3538353530393231ULL, 0x3538353530393232ULL, 0x3538353530393233ULL,
+            0x3538353530393234ULL, 0x3538353530393235ULL, 0x3538353530393236ULL, 0x3538353530393237ULL,
+            0x3538353530393238ULL, 0x3538353530393239ULL, 0x3538353530393241ULL, 0x3538353530393242ULL,
+            0x3538353530393243ULL, 0x3538353530393244ULL, 0x3538353530393245ULL, 0x3538353530393246ULL,
+            0x3538353530393330ULL, 0x3538353530393331ULL, 0x3538353530393332ULL, 0x3538353530393333ULL,
+            0x3538353530393334ULL, 0x3538353530393335ULL, 0x3538353530393336ULL, 0x3538353530393337ULL,
+            0x3538353530393338ULL, 0x3538353530393339ULL, 0x3538353530393342ULL, 0x3538353530393343ULL,
+            0x3538353530393344ULL, 0x3538353530393345ULL, 0x3538353530393346ULL, 0x3538353530393430ULL,
+            0x3538353530393431ULL, 0x3538353530393432ULL, 0x3538353530393433ULL, 0x3538353530393434ULL,
+            0x3538353530393435ULL, 0x3538353530393436ULL, 0x3538353530393437ULL, 0x3538353530393439ULL,
+            0x3538353530393441ULL, 0x3538353530393442ULL, 0x3538353530393443ULL, 0x3538353530393444ULL,
+            0x3538353530393445ULL, 0x3538353530393446ULL, 0x3538353530393530ULL, 0x3538353530393531ULL,
+            0x3538353530393532ULL, 0x3538353530393533ULL, 0x3538353530393534ULL, 0x3538353530393536ULL,
+            0x3538353530393537ULL, 0x3538353530393538ULL, 0x3538353530393539ULL, 0x3538353530393541ULL,
+            0x3538353530393542ULL, 0x3538353530393543ULL, 0x3538353530393544ULL, 0x3538353530393545ULL,
+            0x3538353530393546ULL, 0x3538353530393630ULL, 0x3538353530393631ULL, 0x3538353530393632ULL,
+            0x3538353530393633ULL, 0x3538353530393634ULL, 0x3538353530393636ULL, 0x3538353530393637ULL,
+            0x3538353530393638ULL, 0x3538353530393639ULL, 0x3538353530393641ULL, 0x3538353530393642ULL,
+            0x3538353530393643ULL, 0x3538353530393644ULL, 0x3538353530393645ULL, 0x3538353530393646ULL,
+            0x3538353530393730ULL, 0x3538353530393731ULL, 0x3538353530393732ULL, 0x3538353530393733ULL,
+            0x3538353530393734ULL, 0x3538353530393735ULL, 0x3538353530393736ULL, 0x3538353530393737ULL,
+            0x3538353530393738ULL, 0x3538353530393739ULL, 0x3538353530393741ULL, 0x3538353530393742ULL,
+            0x3538353530393743ULL, 0x3538353530393744ULL, 0x3538353530393745ULL, 0x3538353530393746ULL,
+            0x3538353530393830ULL, 0x3538353530393831ULL, 0x3538353530393832ULL, 0x3538353530393833ULL,
+            0x3538353530393834ULL, 0x3538353530393835ULL, 0x3538353530393836ULL, 0x3538353530393837ULL,
+            0x3538353530393838ULL, 0x3538353530393839ULL, 0x3538353530393841ULL, 0x3538353530393842ULL,
+            0x3538353530393843ULL, 0x3538353530393844ULL, 0x3538353530393845ULL, 0x3538353530393846ULL,
+            0x3538353530393930ULL, 0x3538353530393931ULL, 0x3538353530393932ULL, 0x3538353530393933ULL,
+            0x3538353530393934ULL, 0x3538353530393935ULL, 0x3538353530393937ULL, 0x3538353530393938ULL,
+            0x3538353530393939ULL, 0x3538353530393941ULL, 0x3538353530393942ULL, 0x3538353530393943ULL,
+            0x3538353530393944ULL, 0x3538353530393945ULL, 0x3538353530393946ULL, 0x3538353530394130ULL,
+            0x3538353530394131ULL, 0x3538353530394132ULL, 0x3538353530394133ULL, 0x3538353530394134ULL,
+            0x3538353530394135ULL, 0x3538353530394136ULL, 0x3538353530394137ULL, 0x3538353530394138ULL,
+            0x3538353530394139ULL, 0x3538353530394141ULL, 0x3538353530394142ULL, 0x3538353530394143ULL,
+            0x3538353530394144ULL, 0x3538353530394146ULL, 0x3538353530394231ULL, 0x3538353530394232ULL,
+            0x3538353530394233ULL, 0x3538353530394234ULL, 0x3538353530394235ULL, 0x3538353530394236ULL,
+            0x3538353530394237ULL, 0x3538353530394238ULL, 0x3538353530394239ULL, 0x3538353530394241ULL,
+            0x3538353530394242ULL, 0x3538353530394243ULL, 0x3538353530394244ULL, 0x3538353530394245ULL,
+            0x3538353530394246ULL, 0x3538353530394330ULL, 0x3538353530394331ULL, 0x3538353530394332ULL,
+            0x3538353530394333ULL, 0x3538353530394335ULL, 0x3538353530394336ULL, 0x3538353530394337ULL,
+            0x3538353530394338ULL, 0x3538353530394339ULL, 0x3538353530394341ULL, 0x3538353530394342ULL,
+            0x3538353530394343ULL, 0x3538353530394344ULL, 0x3538353530394345ULL, 0x3538353530394346ULL,
+            0x3538353530394430ULL, 0x3538353530394431ULL, 0x3538353530394432ULL, 0x3538353530394433ULL,
+            0x3538353530394434ULL, 0x3538353530394435ULL, 0x3538353530394436ULL, 0x3538353530394437ULL,
+            0x3538353530394438ULL, 0x3538353530394439ULL, 0x3538353530394441ULL, 0x3538353530394442ULL,
+            0x3538353530394443ULL, 0x3538353530394444ULL, 0x3538353530394445ULL, 0x3538353530394446ULL,
+            0x3538353530394530ULL, 0x3538353530394531ULL, 0x3538353530394532ULL, 0x3538353530394533ULL,
+            0x3538353530394534ULL, 0x3538353530394535ULL, 0x3538353530394536ULL, 0x3538353530394537ULL,
+            0x3538353530394538ULL, 0x3538353530394539ULL, 0x3538353530394541ULL, 0x3538353530394542ULL,
+            0x3538353530394543ULL, 0x3538353530394544ULL, 0x3538353530394545ULL, 0x3538353530394546ULL,
+            0x3538353530394630ULL, 0x3538353530394631ULL, 0x3538353530394632ULL, 0x3538353530394633ULL,
+            0x3538353530394634ULL, 0x3538353530394635ULL, 0x3538353530394636ULL, 0x3538353530394637ULL,
+            0x3538353530394638ULL, 0x3538353530394639ULL, 0x3538353530394641ULL, 0x3538353530394642ULL,
+            0x3538353530394643ULL, 0x3538353530394645ULL, 0x3538353530394646ULL, 0x3538353530413030ULL,
+            0x3538353530413031ULL, 0x3538353530413032ULL, 0x3538353530413033ULL, 0x3538353530413034ULL,
+            0x3538353530413035ULL, 0x3538353530413036ULL, 0x3538353530413037ULL, 0x3538353530413038ULL,
+            0x3538353530413039ULL, 0x3538353530413041ULL, 0x3538353530413042ULL, 0x3538353530413043ULL,
+            0x3538353530413044ULL, 0x3538353530413045ULL, 0x3538353530413046ULL, 0x3538353530413130ULL,
+            0x3538353530413131ULL, 0x3538353530413132ULL, 0x3538353530413133ULL, 0x3538353530413134ULL,
+            0x3538353530413135ULL, 0x3538353530413136ULL, 0x3538353530413137ULL, 0x3538353530413138ULL,
+            0x3538353530413139ULL, 0x3538353530413141ULL, 0x3538353530413142ULL, 0x3538353530413143ULL,
+            0x3538353530413144ULL, 0x3538353530413145ULL, 0x3538353530413146ULL, 0x3538353530413231ULL,
+            0x3538353530413232ULL, 0x3538353530413233ULL, 0x3538353530413234ULL, 0x3538353530413235ULL,
+            0x3538353530413236ULL, 0x3538353530413237ULL, 0x3538353530413238ULL, 0x3538353530413241ULL,
+            0x3538353530413242ULL, 0x3538353530413243ULL, 0x3538353530413244ULL, 0x3538353530413245ULL,
+            0x3538353530413246ULL, 0x3538353530413330ULL, 0x3538353530413331ULL, 0x3538353530413332ULL,
+            0x3538353530413333ULL, 0x3538353530413334ULL, 0x3538353530413335ULL, 0x3538353530413336ULL,
+            0x3538353530413337ULL, 0x3538353530413338ULL, 0x3538353530413339ULL, 0x3538353530413341ULL,
+            0x3538353530413342ULL, 0x3538353530413343ULL, 0x3538353530413344ULL, 0x3538353530413345ULL,
+            0x3538353530413346ULL, 0x3538353530413430ULL, 0x3538353530413431ULL, 0x3538353530413432ULL,
+            0x3538353530413433ULL, 0x3538353530413434ULL, 0x3538353530413435ULL, 0x3538353530413436ULL,
+            0x3538353530413437ULL, 0x3538353530413438ULL, 0x3538353530413439ULL, 0x3538353530413441ULL,
+            0x3538353530413442ULL, 0x3538353530413444ULL, 0x3538353530413445ULL, 0x3538353530413446ULL,
+            0x3538353530413530ULL, 0x3538353530413531ULL, 0x3538353530413532ULL, 0x3538353530413533ULL,
+            0x3538353530413534ULL, 0x3538353530413535ULL, 0x3538353530413536ULL, 0x3538353530413537ULL,
+            0x3538353530413538ULL, 0x3538353530413539ULL, 0x3538353530413541ULL, 0x3538353530413542ULL,
+            0x3538353530413543ULL, 0x3538353530413544ULL, 0x3538353530413545ULL, 0x3538353530413546ULL,
+            0x3538353530413630ULL, 0x3538353530413631ULL, 0x3538353530413632ULL, 0x3538353530413634ULL,
+            0x3538353530413635ULL, 0x3538353530413636ULL, 0x3538353530413637ULL, 0x3538353530413638ULL,
+            0x3538353530413639ULL, 0x3538353530413641ULL, 0x3538353530413642ULL, 0x3538353530413643ULL,
+            0x3538353530413644ULL, 0x3538353530413645ULL, 0x3538353530413646ULL, 0x3538353530413730ULL,
+            0x3538353530413731ULL, 0x3538353530413732ULL, 0x3538353530413733ULL, 0x3538353530413734ULL,
+            0x3538353530413735ULL, 0x3538353530413736ULL, 0x3538353530413737ULL, 0x3538353530413738ULL,
+            0x3538353530413739ULL, 0x3538353530413741ULL, 0x3538353530413742ULL, 0x3538353530413743ULL,
+            0x3538353530413744ULL, 0x3538353530413745ULL, 0x3538353530413830ULL, 0x3538353530413831ULL,
+            0x3538353530413832ULL, 0x3538353530413833ULL, 0x3538353530413834ULL, 0x3538353530413835ULL,
+            0x3538353530413836ULL, 0x3538353530413837ULL, 0x3538353530413838ULL, 0x3538353530413839ULL,
+            0x3538353530413841ULL, 0x3538353530413842ULL, 0x3538353530413843ULL, 0x3538353530413844ULL,
+            0x3538353530413845ULL, 0x3538353530413846ULL, 0x3538353530413930ULL, 0x3538353530413931ULL,
+            0x3538353530413932ULL, 0x3538353530413933ULL, 0x3538353530413934ULL, 0x3538353530413935ULL,
+            0x3538353530413936ULL, 0x3538353530413937ULL, 0x3538353530413938ULL, 0x3538353530413939ULL,
+            0x3538353530413941ULL, 0x3538353530413942ULL, 0x3538353530413943ULL, 0x3538353530413944ULL,
+            0x3538353530413945ULL, 0x3538353530413946ULL, 0x3538353530414130ULL, 0x3538353530414131ULL,
+            0x3538353530414132ULL, 0x3538353530414133ULL, 0x3538353530414134ULL, 0x3538353530414135ULL,
+            0x3538353530414136ULL, 0x3538353530414137ULL, 0x3538353530414138ULL, 0x3538353530414139ULL,
+            0x3538353530414141ULL, 0x3538353530414142ULL, 0x3538353530414143ULL, 0x3538353530414144ULL,
+            0x3538353530414145ULL, 0x3538353530414146ULL, 0x3538353530414230ULL, 0x3538353530414231ULL,
+            0x3538353530414232ULL, 0x3538353530414233ULL, 0x3538353530414234ULL, 0x3538353530414235ULL,
+            0x3538353530414236ULL, 0x3538353530414237ULL, 0x3538353530414238ULL, 0x3538353530414239ULL,
+            0x3538353530414241ULL, 0x3538353530414242ULL, 0x3538353530414243ULL, 0x3538353530414244ULL,
+            0x3538353530414245ULL, 0x3538353530414246ULL, 0x3538353530414330ULL, 0x3538353530414331ULL,
+            0x3538353530414332ULL, 0x3538353530414333ULL, 0x3538353530414334ULL, 0x3538353530414335ULL,
+            0x3538353530414336ULL, 0x3538353530414337ULL, 0x3538353530414338ULL, 0x3538353530414339ULL,
+            0x3538353530414341ULL, 0x3538353530414342ULL, 0x3538353530414343ULL, 0x3538353530414344ULL,
+            0x3538353530414345ULL, 0x3538353530414346ULL, 0x3538353530414431ULL, 0x3538353530414432ULL,
+            0x3538353530414433ULL, 0x3538353530414434ULL, 0x3538353530414435ULL, 0x3538353530414436ULL,
+            0x3538353530414437ULL, 0x3538353530414438ULL, 0x3538353530414439ULL, 0x3538353530414441ULL,
+            0x3538353530414442ULL, 0x3538353530414443ULL, 0x3538353530414444ULL, 0x3538353530414445ULL,
+            0x3538353530414446ULL, 0x3538353530414530ULL, 0x3538353530414531ULL, 0x3538353530414532ULL,
+            0x3538353530414533ULL, 0x3538353530414534ULL, 0x3538353530414535ULL, 0x3538353530414536ULL,
+            0x3538353530414537ULL, 0x3538353530414538ULL, 0x3538353530414539ULL, 0x3538353530414541ULL,
+            0x3538353530414542ULL, 0x3538353530414543ULL, 0x3538353530414544ULL, 0x3538353530414545ULL,
+            0x3538353530414546ULL, 0x3538353530414630ULL, 0x3538353530414631ULL, 0x3538353530414632ULL,
+            0x3538353530414633ULL, 0x3538353530414634ULL, 0x3538353530414635ULL, 0x3538353530414636ULL,
+            0x3538353530414637ULL, 0x3538353530414638ULL, 0x3538353530414639ULL, 0x3538353530414641ULL,
+            0x3538353530414642ULL, 0x3538353530414643ULL, 0x3538353530414644ULL, 0x3538353530414645ULL,
+            0x3538353530414646ULL, 0x3538353530423030ULL, 0x3538353530423031ULL, 0x3538353530423032ULL,
+            0x3538353530423033ULL, 0x3538353530423034ULL, 0x3538353530423035ULL, 0x3538353530423036ULL,
+            0x3538353530423037ULL, 0x3538353530423038ULL, 0x3538353530423039ULL, 0x3538353530423041ULL,
+            0x3538353530423042ULL, 0x3538353530423043ULL, 0x3538353530423044ULL, 0x3538353530423045ULL,
+            0x3538353530423046ULL, 0x3538353530423130ULL, 0x3538353530423131ULL, 0x3538353530423132ULL,
+            0x3538353530423133ULL, 0x3538353530423134ULL, 0x3538353530423135ULL, 0x3538353530423136ULL,
+            0x3538353530423137ULL, 0x3538353530423138ULL, 0x3538353530423139ULL, 0x3538353530423141ULL,
+            0x3538353530423142ULL, 0x3538353530423143ULL, 0x3538353530423144ULL, 0x3538353530423145ULL,
+            0x3538353530423146ULL, 0x3538353530423230ULL, 0x3538353530423231ULL, 0x3538353530423232ULL,
+            0x3538353530423233ULL, 0x3538353530423234ULL, 0x3538353530423235ULL, 0x3538353530423236ULL,
+            0x3538353530423237ULL, 0x3538353530423238ULL, 0x3538353530423239ULL, 0x3538353530423241ULL,
+            0x3538353530423242ULL, 0x3538353530423243ULL, 0x3538353530423244ULL, 0x3538353530423245ULL,
+            0x3538353530423246ULL, 0x3538353530423330ULL, 0x3538353530423331ULL, 0x3538353530423332ULL,
+            0x3538353530423333ULL, 0x3538353530423334ULL, 0x3538353530423335ULL, 0x3538353530423336ULL,
+            0x3538353530423337ULL, 0x3538353530423338ULL, 0x3538353530423339ULL, 0x3538353530423341ULL,
+            0x3538353530423342ULL, 0x3538353530423343ULL, 0x3538353530423344ULL, 0x3538353530423345ULL,
+            0x3538353530423346ULL, 0x3538353530423430ULL, 0x3538353530423431ULL, 0x3538353530423432ULL,
+            0x3538353530423433ULL, 0x3538353530423434ULL, 0x3538353530423435ULL, 0x3538353530423436ULL,
+            0x3538353530423437ULL, 0x3538353530423438ULL, 0x3538353530423439ULL, 0x3538353530423441ULL,
+            0x3538353530423442ULL, 0x3538353530423443ULL, 0x3538353530423444ULL, 0x3538353530423445ULL,
+            0x3538353530423446ULL, 0x3538353530423530ULL, 0x3538353530423531ULL, 0x3538353530423532ULL,
+            0x3538353530423533ULL, 0x3538353530423534ULL, 0x3538353530423535ULL, 0x3538353530423536ULL,
+            0x3538353530423537ULL, 0x3538353530423538ULL, 0x3538353530423539ULL, 0x3538353530423541ULL,
+            0x3538353530423542ULL, 0x3538353530423543ULL, 0x3538353530423544ULL, 0x3538353530423545ULL,
+            0x3538353530423546ULL, 0x3538353530423630ULL, 0x3538353530423632ULL, 0x3538353530423633ULL,
+            0x3538353530423634ULL, 0x3538353530423635ULL, 0x3538353530423636ULL, 0x3538353530423637ULL,
+            0x3538353530423638ULL, 0x3538353530423639ULL, 0x3538353530423641ULL, 0x3538353530423642ULL,
+            0x3538353530423643ULL, 0x3538353530423644ULL, 0x3538353530423645ULL, 0x3538353530423646ULL,
+            0x3538353530423730ULL, 0x3538353530423731ULL, 0x3538353530423732ULL, 0x3538353530423733ULL,
+            0x3538353530423734ULL, 0x3538353530423735ULL, 0x3538353530423736ULL, 0x3538353530423737ULL,
+            0x3538353530423738ULL, 0x3538353530423739ULL, 0x3538353530423741ULL, 0x3538353530423742ULL,
+            0x3538353530423743ULL, 0x3538353530423744ULL, 0x3538353530423745ULL, 0x3538353530423746ULL,
+            0x3538353530423830ULL, 0x3538353530423831ULL, 0x3538353530423832ULL, 0x3538353530423833ULL,
+            0x3538353530423834ULL, 0x3538353530423835ULL, 0x3538353530423836ULL, 0x3538353530423837ULL,
+            0x3538353530423838ULL, 0x3538353530423839ULL, 0x3538353530423841ULL, 0x3538353530423842ULL,
+            0x3538353530423843ULL, 0x3538353530423844ULL, 0x3538353530423845ULL, 0x3538353530423846ULL,
+            0x3538353530423930ULL, 0x3538353530423931ULL, 0x3538353530423932ULL, 0x3538353530423934ULL,
+            0x3538353530423935ULL, 0x3538353530423936ULL, 0x3538353530423937ULL, 0x3538353530423938ULL,
+            0x3538353530423939ULL, 0x3538353530423941ULL, 0x3538353530423942ULL, 0x3538353530423943ULL,
+            0x3538353530423944ULL, 0x3538353530423945ULL, 0x3538353530423946ULL, 0x3538353530424130ULL,
+            0x3538353530424131ULL, 0x3538353530424132ULL, 0x3538353530424133ULL, 0x3538353530424134ULL,
+            0x3538353530424135ULL, 0x3538353530424136ULL, 0x3538353530424137ULL, 0x3538353530424138ULL,
+            0x3538353530424139ULL, 0x3538353530424141ULL, 0x3538353530424142ULL, 0x3538353530424143ULL,
+            0x3538353530424144ULL, 0x3538353530424145ULL, 0x3538353530424146ULL, 0x3538353530424230ULL,
+            0x3538353530424231ULL, 0x3538353530424232ULL, 0x3538353530424233ULL, 0x3538353530424234ULL,
+            0x3538353530424235ULL, 0x3538353530424236ULL, 0x3538353530424237ULL, 0x3538353530424238ULL,
+            0x3538353530424239ULL, 0x3538353530424242ULL, 0x3538353530424243ULL, 0x3538353530424244ULL,
+            0x3538353530424245ULL, 0x3538353530424246ULL, 0x3538353530424330ULL, 0x3538353530424331ULL,
+            0x3538353530424332ULL, 0x3538353530424333ULL, 0x3538353530424334ULL, 0x3538353530424335ULL,
+            0x3538353530424336ULL, 0x3538353530424337ULL, 0x3538353530424338ULL, 0x3538353530424339ULL,
+            0x3538353530424341ULL, 0x3538353530424342ULL, 0x3538353530424343ULL, 0x3538353530424344ULL,
+            0x3538353530424345ULL, 0x3538353530424346ULL, 0x3538353530424430ULL, 0x3538353530424431ULL,
+            0x3538353530424432ULL, 0x3538353530424433ULL, 0x3538353530424434ULL, 0x3538353530424435ULL,
+            0x3538353530424436ULL, 0x3538353530424438ULL, 0x3538353530424439ULL, 0x3538353530424441ULL,
+            0x3538353530424442ULL, 0x3538353530424443ULL, 0x3538353530424444ULL, 0x3538353530424445ULL,
+            0x3538353530424446ULL, 0x3538353530424530ULL, 0x3538353530424531ULL, 0x3538353530424532ULL,
+            0x3538353530424533ULL, 0x3538353530424534ULL, 0x3538353530424535ULL, 0x3538353530424536ULL,
+            0x3538353530424537ULL, 0x3538353530424538ULL, 0x3538353530424539ULL, 0x3538353530424541ULL,
+            0x3538353530424542ULL, 0x3538353530424543ULL, 0x3538353530424544ULL, 0x3538353530424545ULL,
+            0x3538353530424546ULL, 0x3538353530424630ULL, 0x3538353530424631ULL, 0x3538353530424632ULL,
+            0x3538353730383739ULL, 0x3538353730393937ULL, 0x3538353730393941ULL, 0x3538353730393942ULL,
+            0x3538353730393945ULL, 0x3538353830303037ULL, 0x3538353830383135ULL, 0x3538353830383232ULL,
+            0x3538353830383333ULL, 0x3538353830383342ULL, 0x3538353830383343ULL, 0x3538353830383346ULL,
+            0x3538353830383433ULL, 0x3538353830383441ULL, 0x3538353830383442ULL, 0x3538353830383546ULL,
+            0x3538353830383639ULL, 0x3538353830383739ULL, 0x3538353830383837ULL, 0x3538353830383841ULL,
+            0x3538353830383931ULL, 0x3538353830384130ULL, 0x3539343230303031ULL, 0x3539343230303032ULL,
+            0x3539344630374431ULL, 0x3539344630374437ULL, 0x3541343430303031ULL, 0x3541343430303034ULL,
+            0x3541343530374431ULL, 0x3541343530374441ULL, 0x3541353030374431ULL, 0x4646464530374431ULL,
+        };
+        inline constexpr uint32_t kOffsets[] = {
+            0, 8, 16, 45, 64, 84, 109, 138, 153, 168, 181, 194,
+            203, 233, 253, 287, 299, 309, 337, 364, 387, 413, 457, 477,
+            493, 497, 504, 521, 545, 556, 579, 592, 599, 622, 634, 641,
+            675, 680, 715, 759, 785, 814, 827, 871, 901, 930, 958, 976,
+            996, 1005, 1017, 1031, 1073, 1111, 1118, 1142, 1163, 1170, 1183, 1201,
+            1219, 1228, 1264, 1279, 1307, 1329, 1354, 1379, 1391, 1415, 1423, 1433,
+            1454, 1477, 1508, 1538, 1561, 1587, 1632, 1657, 1675, 1717, 1748, 1787,
+            1811, 1839, 1863, 1874, 1909, 1922, 1976, 1982, 1994, 2022, 2054, 2079,
+            2091, 2114, 2145, 2164, 2192, 2199, 2237, 2255, 2276, 2301, 2317, 2357,
+            2388, 2426, 2440, 2475, 2500, 2524, 2560, 2587, 2617, 2620, 2647, 2675,
+            2708, 2761, 2788, 2814, 2835, 2879, 2920, 2945, 2972, 2997, 3011, 3032,
+            3046, 3053, 3056, 3074, 3081, 3128, 3152, 3174, 3192, 3213, 3224, 3252,
+            3266, 3278, 3287, 3302, 3331, 3345, 3360, 3377, 3388, 3414, 3437, 3450,
+            3464, 3479, 3495, 3516, 3531, 3552, 3575, 3597, 3628, 3639, 3662, 3684,
+            3711, 3723, 3751, 3767, 3777, 3786, 3800, 3827, 3847, 3861, 3880, 3906,
+            3927, 3941, 3962, 3978, 3987, 4000, 4004, 4036, 4045, 4069, 4076, 4083,
+            4101, 4110, 4139, 4160, 4180, 4199, 4223, 4232, 4254, 4275, 4306, 4321,
+            4341, 4374, 4385, 4419, 4448, 4479, 4499, 4517, 4549, 4580, 4591, 4606,
+            4634, 4647, 4668, 4686, 4702, 4718, 4740, 4756, 4785, 4808, 4830, 4857,
+            4892, 4909, 4923, 4954, 4963, 4980, 4990, 5008, 5026, 5035, 5046, 5063,
+            5092, 5120, 5129, 5165, 5184, 5205, 5213, 5238, 5245, 5272, 5293, 5327,
+            5351, 5378, 5415, 5439, 5464, 5476, 5496, 5505, 5536, 5556, 5580, 5592,
+            5620, 5647, 5691, 5707, 5720, 5746, 5766, 5778, 5795, 5814, 5831, 5844,
+            5859, 5883, 5897, 5928, 5936, 5957, 5968, 5994, 6036, 6066, 6083, 6113,
+            6124, 6146, 6161, 6188, 6201, 6209, 6229, 6248, 6261, 6290, 6303, 6334,
+            6381, 6393, 6425, 6449, 6507, 6528, 6570, 6586, 6592, 6602, 6636, 6655,
+            6690, 6737, 6755, 6763, 6776, 6785, 6805, 6810, 6813, 6832, 6842, 6848,
+            6854, 6858, 6876, 6899, 6914, 6941, 6953, 6969, 7003, 7023, 7046, 7092,
+            7152, 7166, 7171, 7189, 7193, 7216, 7227, 7266, 7280, 7291, 7329, 7341,
+            7348, 7364, 7380, 7403, 7449, 7464, 7485, 7524, 7546, 7562, 7577, 7601,
+            7620, 7639, 7670, 7682, 7696, 7711, 7724, 7769, 7786, 7824, 7872, 7918,
+            7928, 7957, 7990, 8005, 8042, 8089, 8120, 8143, 8158, 8187, 8196, 8229,
+            8262, 8273, 8284, 8299, 8314, 8334, 8349, 8358, 8375, 8384, 8397, 8410,
+            8422, 8459, 8478, 8490, 8513, 8541, 8570, 8583, 8598, 8613, 8649, 8678,
+            8708, 8730, 8761, 8774, 8799, 8810, 8823, 8848, 8861, 8876, 8887, 8902,
+            8921, 8937, 8966, 8983, 8997, 9012, 9035, 9066, 9101, 9147, 9167, 9211,
+            9240, 9262, 9288, 9315, 9347, 9379, 9403, 9428, 9460, 9483, 9510, 9537,
+            9564, 9596, 9621, 9647, 9674, 9693, 9737, 9758, 9789, 9811, 9848, 9880,
+            9907, 9937, 9968, 9997, 10027, 10058, 10090, 10124, 10152, 10189, 10217, 10249,
+            10286, 10323, 10359, 10394, 10431, 10470, 10512, 10544, 10560, 10572, 10602, 10619,
+            10665, 10697, 10717, 10754, 10771, 10786, 10802, 10842, 10869, 10889, 10905, 10913,
+            10929, 10933, 10954, 10967, 10989, 10993, 11002, 11022, 11033, 11037, 11073, 11079,
+            11097, 11115, 11122, 11154, 11163, 11169, 11176, 11182, 11195, 11202, 11215, 11222,
+            11236, 11243, 11261, 11276, 11319, 11324, 11344, 11372, 11392, 11403, 11448, 11472,
+            11508, 11559, 11573, 11594, 11618, 11640, 11661, 11685, 11696, 11710, 11734, 11763,
+            11792, 11814, 11825, 11846, 11854, 11860, 11880, 11897, 11921, 11932, 11943, 11951,
+            11974, 11995, 12019, 12045, 12067, 12096, 12112, 12133, 12152, 12176, 12201, 12225,
+            12243, 12251, 12262, 12273, 12301, 12319, 12329, 12344, 12359, 12378, 12391, 12401,
+            12409, 12416, 12432, 12451, 12470, 12491, 12530, 12567, 12577, 12601, 12624, 12631,
+            12663, 12679, 12694, 12719, 12738, 12751, 12769, 12777, 12802, 12820, 12834, 12851,
+            12880, 12902, 12918, 12932, 12949, 12965, 12973, 12981, 13000, 13019, 13037, 13052,
+            13089, 13102, 13110, 13135, 13151, 13156, 13189, 13232, 13258, 13281, 13307, 13328,
+            13351, 13368, 13395, 13405, 13426, 13450, 13466, 13506, 13521, 13537, 13545, 13558,
+            13576, 13599, 13629, 13654, 13673, 13690, 13702, 13715, 13744, 13763, 13771, 13797,
+            13834, 13871, 13897, 13907, 13935, 13972, 13995, 14024, 14057, 14086, 14117, 14146,
+            14157, 14169, 14182, 14197, 14232, 14246, 14272, 14283, 14310, 14316, 14324, 14347,
+            14363, 14374, 14379, 14392, 14411, 14419, 14448, 14468, 14482, 14503, 14514, 14543,
+            14557, 14595, 14622, 14644, 14657, 14673, 14684, 14700, 14709, 14732, 14738, 14752,
+            14765, 14781, 14794, 14807, 14820, 14858, 14868, 14881, 14904, 14917, 14928, 14957,
+            14972, 14991, 15006, 15025, 15041, 15054, 15067, 15088, 15104, 15116, 15123, 15134,
+            15154, 15160, 15183, 15208, 15228, 15239, 15264, 15302, 15318, 15339, 15353, 15370,
+            15376, 15385, 15426, 15442, 15455, 15462, 15468, 15491, 15517, 15530, 15539, 15550,
+            15561, 15569, 15589, 15623, 15636, 15650, 15667, 15676, 15692, 15705, 15720, 15730,
+            15737, 15753, 15784, 15795, 15808, 15824, 15835, 15843, 15866, 15872, 15899, 15910,
+            15917, 15939, 15957, 15969, 15998, 16017, 16032, 16040, 16067, 16090, 16112, 16135,
+            16155, 16161, 16168, 16188, 16199, 16217, 16230, 16243, 16265, 16285, 16298, 16313,
+            16326, 16352, 16366, 16378, 16388, 16396, 16415, 16431, 16438, 16459, 16482, 16493,
+            16507, 16523, 16537, 16582, 16595, 16601, 16614, 16630, 16656, 16668, 16694, 16712,
+            16720, 16731, 16751, 16774, 16786, 16795, 16801, 16822, 16856, 16869, 16874, 16904,
+            16928, 16935, 16972, 16988, 17001, 17046, 17059, 17094, 17109, 17114, 17149, 17156,
+            17162, 17175, 17184, 17187, 17191, 17214, 17225, 17241, 17254, 17262, 17287, 17311,
+            17325, 17352, 17357, 17377, 17389, 17415, 17438, 17470, 17486, 17499, 17504, 17517,
+            17524, 17545, 17578, 17602, 17638, 17651, 17658, 17663, 17683, 17696, 17724, 17731,
+            17738, 17766, 17795, 17816, 17832, 17865, 17884, 17902, 17924, 17964, 17979, 17992,
+            18003, 18010, 18034, 18047, 18071, 18108, 18128, 18141, 18161, 18167, 18185, 18194,
+            18209, 18219, 18234, 18268, 18289, 18311, 18350, 18377, 18400, 18415, 18449, 18491,
+            18506, 18530, 18538, 18555, 18574, 18588, 18637, 18647, 18665, 18675, 18705, 18726,
+            18737, 18757, 18761, 18769, 18775, 18795, 18805, 18820, 18837, 18851, 18868, 18882,
+            18901, 18921, 18929, 18942, 18955, 18975, 18981, 18993, 19006, 19017, 19035, 19066,
+            19079, 19091, 19106, 19125, 19145, 19162, 19197, 19204, 19212, 19239, 19253, 19261,
+            19282, 19295, 19323, 19346, 19362, 19376, 19384, 19395, 19420, 19433, 19448, 19458,
+            19471, 19492, 19502, 19519, 19528, 19537, 19552, 19581, 19587, 19609, 19650, 19685,
+            19692, 19721, 19734, 19749, 19761, 19783, 19797, 19814, 19822, 19848, 19890, 19909,
+            19926, 19932, 19981, 20001, 20021, 20040, 20055, 20074, 20080, 20095, 20104, 20120,
+            20150, 20173, 20188, 20213, 20223, 20239, 20254, 20265, 20300, 20314, 20334, 20345,
+            20351, 20377, 20381, 20407, 20419, 20445, 20455, 20469, 20505, 20521, 20533, 20552,
+            20575, 20603, 20618, 20641, 20657, 20676, 20688, 20708, 20717, 20723, 20759, 20793,
+            20817, 20842, 20870, 20885, 20908, 20943, 20967, 20996, 21026, 21041, 21061, 21076,
+            21099, 21146, 21168, 21185, 21205, 21216, 21224, 21246, 21258, 21278, 21300, 21316,
+            21345, 21362, 21396, 21406, 21438, 21450, 21460, 21478, 21508, 21526, 21555, 21586,
+            21601, 21612, 21636, 21652, 21687, 21713, 21741, 21761, 21786, 21814, 21829, 21865,
+            21880, 21887, 21912, 21954, 21975, 22022, 22031, 22040, 22056, 22061, 22081, 22088,
+            22116, 22137, 22151, 22167, 22178, 22199, 22204, 22216, 22227, 22233, 22245, 22266,
+            22274, 22300, 22317, 22336, 22354, 22367, 22386, 22404, 22432, 22440, 22460, 22483,
+            22509, 22532, 22552, 22581, 22613, 22642, 22666, 22698, 22716, 22733, 22762, 22803,
+            22820, 22834, 22865, 22886, 22914, 22935, 22958, 22987, 23010, 23028, 23053, 23075,
+            23119, 23130, 23148, 23192, 23217, 23265, 23288, 23318, 23342, 23371, 23393, 23439,
+            23472, 23488, 23503, 23532, 23554, 23585, 23604, 23619, 23660, 23682, 23690, 23723,
+            23756, 23764, 23807, 23815, 23823, 23826, 23844, 23852, 23868, 23890, 23918, 23949,
+            23971, 23992, 24013, 24030, 24038, 24051, 24060, 24075, 24081, 24103, 24115, 24123,
+            24137, 24151, 24170, 24201, 24235, 24242, 24282, 24316, 24343, 24351, 24381, 24389,
+            24423, 24460, 24468, 24476, 24503, 24530, 24550, 24570, 24583, 24599, 24619, 24646,
+            24674, 24692, 24718, 24731, 24741, 24756, 24774, 24792, 24809, 24837, 24863, 24893,
+            24915, 24942, 24956, 24974, 24988, 25003, 25020, 25035, 25052, 25074, 25111, 25140,
+            25158, 25186, 25195, 25212, 25224, 25233, 25246, 25273, 25299, 25303, 25312, 25330,
+            25368, 25413, 25440, 25467, 25495, 25531, 25538, 25577, 25613, 25632, 25647, 25669,
+            25697, 25754, 25765, 25807, 25835, 25860, 25899, 25910, 25927, 25958, 25966, 25993,
+            26013, 26031, 26073, 26093, 26127, 26145, 26175, 26180, 26185, 26189, 26219, 26233,
+            26241, 26259, 26262, 26267, 26270, 26277, 26292, 26313, 26336, 26360, 26383, 26411,
+            26437, 26513, 26520, 26530, 26537, 26547, 26557, 26569, 26579, 26587, 26595, 26602,
+            26615, 26638, 26655, 26667, 26681, 26692, 26703, 26714, 26723, 26738, 26759, 26770,
+            26793, 26806, 26829, 26842, 26878, 26915, 26949, 26965, 26985, 27001, 27019, 27044,
+            27054, 27065, 27084, 27102, 27150, 27178, 27187, 27202, 27220, 27245, 27258, 27279,
+            27283, 27312, 27326, 27350, 27383, 27423, 27444, 27457, 27462, 27482, 27492, 27513,
+            27536, 27563, 27603, 27614, 27625, 27660, 27666, 27674, 27688, 27705, 27720, 27733,
+            27762, 27775, 27788, 27798, 27815, 27823, 27837, 27859, 27905, 27946, 27953, 27974,
+            27986, 28000, 28035, 28058, 28072, 28087, 28110, 28133, 28153, 28177, 28189, 28205,
+            28215, 28227, 28233, 28299, 28307, 28344, 28368, 28379, 28395, 28410, 28431, 28447,
+            28471, 28482, 28492, 28508, 28513, 28518, 28535, 28547, 28556, 28574, 28583, 28592,
+            28603, 28609, 28620, 28638, 28659, 28667, 28678, 28701, 28713, 28722, 28731, 28744,
+            28758, 28788, 28806, 28818, 28851, 28877, 28890, 28894, 28908, 28930, 28941, 28952,
+            28965, 28978, 28987, 29005, 29014, 29030, 29051, 29069, 29075, 29090, 29123, 29161,
+            29182, 29193, 29206, 29227, 29253, 29276, 29291, 29335, 29354, 29377, 29412, 29419,
+            29436, 29462, 29476, 29486, 29499, 29514, 29521, 29531, 29570, 29597, 29615, 29629,
+            29643, 29656, 29666, 29673, 29681, 29694, 29711, 29728, 29742, 29755, 29785, 29824,
+            29845, 29852, 29863, 29871, 29880, 29893, 29906, 29938, 29955, 29963, 29987, 29999,
+            30011, 30034, 30054, 30079, 30122, 30145, 30169, 30173, 30182, 30199, 30227, 30256,
+            30281, 30300, 30334, 30357, 30382, 30408, 30425, 30438, 30456, 30464, 30473, 30488,
+            30511, 30530, 30541, 30561, 30582, 30603, 30633, 30668, 30704, 30732, 30746, 30760,
+            30774, 30789, 30801, 30842, 30851, 30862, 30879, 30886, 30914, 30931, 30960, 30975,
+            30989, 31001, 31014, 31026, 31044, 31068, 31082, 31096, 31110, 31135, 31152, 31172,
+            31185, 31193, 31210, 31218, 31245, 31254, 31280, 31297, 31308, 31319, 31349, 31390,
+            31409, 31437, 31451, 31467, 31495, 31520, 31547, 31557, 31570, 31591, 31608, 31642,
+            31669, 31689, 31713, 31727, 31762, 31785, 31794, 31835, 31862, 31883, 31909, 31943,
+            31993, 32018, 32054, 32093, 32106, 32116, 32142, 32181, 32211, 32242, 32249, 32257,
+            32270, 32283, 32316, 32349, 32382, 32408, 32412, 32421, 32425, 32459, 32479, 32484,
+            32489, 32497, 32513, 32538, 32548, 32561, 32579, 32591, 32607, 32616, 32661, 32673,
+            32718, 32740, 32756, 32775, 32817, 32824, 32841, 32848, 32871, 32884, 32895, 32909,
+            32935, 32958, 32977, 32987, 33017, 33031, 33056, 33077, 33097, 33107, 33130, 33150,
+            33173, 33188, 33199, 33211, 33223, 33245, 33270, 33292, 33314, 33328, 33344, 33364,
+            33371, 33383, 33408, 33415, 33434, 33459, 33485, 33497, 33518, 33553, 33578, 33585,
+            33592, 33608, 33615, 33642, 33667, 33684, 33691, 33698, 33705, 33719, 33736, 33755,
+            33773, 33795, 33810, 33824, 33850, 33873, 33881, 33893, 33910, 33925, 33944, 33956,
+            33968, 33980, 34002, 34026, 34034, 34059, 34083, 34109, 34121, 34152, 34174, 34193,
+            34205, 34231, 34253, 34274, 34283, 34295, 34304, 34322, 34330, 34336, 34351, 34373,
+            34396, 34406, 34424, 34440, 34463, 34478, 34497, 34505, 34517, 34539, 34548, 34573,
+            34587, 34622, 34637, 34646, 34664, 34683, 34697, 34715, 34733, 34748, 34758, 34775,
+            34789, 34797, 34808, 34829, 34847, 34864, 34881, 34896, 34927, 34947, 34960, 34996,
+            35013, 35038, 35063, 35075, 35100, 35117, 35129, 35154, 35181, 35193, 35222, 35229,
+            35248, 35273, 35304, 35314, 35322, 35337, 35354, 35370, 35388, 35404, 35424, 35450,
+            35469, 35487, 35491, 35512, 35520, 35537, 35563, 35574, 35579, 35598, 35618, 35631,
+            35669, 35683, 35706, 35729, 35746, 35780, 35797, 35823, 35848, 35857, 35869, 35904,
+            35933, 35965, 35999, 36012, 36027, 36041, 36068, 36090, 36114, 36121, 36145, 36160,
+            36172, 36205, 36229, 36266, 36291, 36324, 36349, 36367, 36387, 36402, 36424, 36438,
+            36452, 36466, 36502, 36519, 36531, 36536, 36555, 36583, 36600, 36612, 36623, 36662,
+            36667, 36675, 36720, 36728, 36756, 36787, 36816, 36829, 36843, 36867, 36878, 36885,
+            36919, 36930, 36944, 36949, 36960, 36966, 36988, 37001, 37034, 37062, 37071, 37097,
+            37107, 37118, 37131, 37139, 37151, 37210, 37223, 37256, 37287, 37319, 37359, 37371,
+            37392, 37419, 37438, 37461, 37480, 37523, 37551, 37587, 37620, 37658, 37678, 37684,
+            37701, 37737, 37765, 37817, 37837, 37871, 37890, 37947, 37962, 38000, 38021, 38045,
+            38055, 38065, 38074, 38097, 38102, 38122, 38144, 38174, 38184, 38188, 38210, 38221,
+            38240, 38249, 38261, 38298, 38319, 38340, 38363, 38369, 38391, 38407, 38426, 38459,
+            38476, 38487, 38502, 38516, 38538, 38548, 38570, 38579, 38597, 38618, 38637, 38673,
+            38693, 38721, 38747, 38761, 38785, 38825, 38834, 38847, 38866, 38887, 38909, 38935,
+            38950, 38953, 38968, 38984, 38997, 39011, 39018, 39031, 39060, 39098, 39127, 39160,
+            39178, 39187, 39203, 39234, 39241, 39250, 39257, 39266, 39275, 39286, 39308, 39326,
+            39342, 39347, 39368, 39392, 39426, 39440, 39460, 39487, 39492, 39504, 39555, 39576,
+            39593, 39625, 39638, 39650, 39657, 39674, 39692, 39719, 39732, 39762, 39790, 39796,
+            39808, 39819, 39850, 39857, 39875, 39908, 39937, 39952, 39963, 39992, 40008, 40035,
+            40049, 40104, 40111, 40118, 40138, 40145, 40162, 40187, 40220, 40249, 40296, 40308,
+            40323, 40330, 40337, 40366, 40395, 40424, 40431, 40442, 40459, 40466, 40473, 40490,
+            40513, 40538, 40555, 40562, 40569, 40579, 40587, 40599, 40629, 40650, 40654, 40661,
+            40668, 40676, 40699, 40707, 40718, 40725, 40737, 40744, 40761, 40780, 40807, 40814,
+            40824, 40844, 40851, 40858, 40865, 40882, 40903, 40910, 40929, 40939, 40946, 40966,
+            40976, 40983, 41002, 41020, 41028, 41036, 41044, 41054, 41071, 41081, 41092, 41102,
+            41110, 41123, 41143, 41156, 41171, 41179, 41216, 41224, 41241, 41253, 41261, 41269,
+            41288, 41306, 41325, 41333, 41341, 41369, 41377, 41385, 41415, 41423, 41436, 41457,
+            41465, 41476, 41487, 41519, 41549, 41569, 41585, 41602, 41625, 41637, 41645, 41671,
+            41695, 41735, 41752, 41756, 41780, 41812, 41838, 41881, 41899, 41914, 41950, 41976,
+            41981, 42013, 42044, 42062, 42106, 42129, 42164, 42194, 42207, 42223, 42262, 42273,
+            42320, 42354, 42387, 42421, 42451, 42473, 42513, 42546, 42580, 42606, 42625, 42634,
+            42691, 42732, 42777, 42793, 42826, 42859, 42892, 42925, 42934, 42974, 43013, 43041,
+            43052, 43061, 43077, 43121, 43151, 43192, 43206, 43232, 43251, 43273, 43287, 43298,
+            43329, 43375, 43396, 43404, 43408, 43422, 43433, 43449, 43456, 43496, 43528, 43558,
+            43575, 43612, 43628, 43642, 43651, 43662, 43678, 43702, 43724, 43749, 43777, 43793,
+            43812, 43828, 43864, 43883, 43901, 43924, 43946, 43959, 43975, 44003, 44015, 44045,
+            44073, 44087, 44111, 44120, 44147, 44164, 44192, 44212, 44223, 44241, 44250, 44282,
+            44311, 44325, 44358, 44383, 44395, 44421, 44430, 44456, 44490, 44510, 44534, 44557,
+            44581, 44593, 44629, 44639, 44651, 44673, 44688, 44707, 44721, 44739, 44759, 44768,
+            44776, 44801, 44816, 44838, 44880, 44895, 44918, 44930, 44947, 44967, 44982, 45003,
+            45031, 45042, 45056, 45087, 45123, 45172, 45210, 45231, 45239, 45258, 45290, 45299,
+            45306, 45326, 45337, 45341, 45363, 45389, 45412, 45442, 45450, 45477, 45489, 45517,
+            45533, 45565, 45599, 45647, 45697, 45720, 45738, 45749, 45791, 45822, 45832, 45857,
+            45892, 45912, 45928, 45934, 45975, 46003, 46015, 46036, 46056, 46062, 46096, 46128,
+            46164, 46187, 46208, 46216, 46225, 46231, 46250, 46271, 46286, 46308, 46337, 46373,
+            46403, 46412, 46461, 46465, 46497, 46525, 46551, 46578, 46588, 46612, 46630, 46647,
+            46661, 46668, 46694, 46709, 46724, 46735, 46740, 46760, 46771, 46809, 46825, 46847,
+            46868, 46895, 46905, 46916, 46940, 46957, 46970, 47010, 47024, 47028, 47053, 47066,
+            47076, 47096, 47116, 47151, 47181, 47210, 47223, 47245, 47279, 47302, 47325, 47350,
+            47366, 47387, 47394, 47405, 47424, 47444, 47459, 47488, 47503, 47522, 47544, 47578,
+            47586, 47597, 47612, 47622, 47643, 47659, 47679, 47684, 47703, 47718, 47727, 47740,
+            47749, 47760, 47780, 47801, 47814, 47818, 47835, 47849, 47857, 47860, 47894, 47914,
+            47927, 47937, 47950, 47966, 47980, 47997, 48010, 48017, 48029, 48036, 48042, 48049,
+            48057, 48067, 48081, 48087, 48093, 48106, 48118, 48133, 48152, 48163, 48182, 48191,
+            48195, 48210, 48217, 48229, 48239, 48248, 48258, 48269, 48276, 48287, 48305, 48318,
+            48335, 48340, 48354, 48365, 48382, 48386, 48402, 48437, 48458, 48473, 48491, 48498,
+            48508, 48516, 48525, 48536, 48538, 48557, 48578, 48588, 48608, 48626, 48642, 48658,
+            48679, 48699, 48723, 48739, 48751, 48768, 48785, 48808, 48839, 48847, 48858, 48868,
+            48884, 48896, 48903, 48915, 48928, 48937, 48958, 48971, 48989, 49009, 49015, 49031,
+            49035, 49048, 49068, 49075, 49088, 49100, 49116, 49129, 49137, 49147, 49158, 49167,
+            49188, 49201, 49218, 49249, 49259, 49272, 49276, 49294, 49313, 49349, 49367, 49384,
+            49399, 49405, 49418, 49433, 49453, 49467, 49485, 49493, 49500, 49516, 49528, 49546,
+            49558, 49569, 49574, 49586, 49604, 49611, 49625, 49641, 49646, 49668, 49685, 49699,
+            49717, 49729, 49752, 49758, 49772, 49786, 49809, 49819, 49832, 49846, 49857, 49879,
+            49882, 49895, 49917, 49926, 49936, 49956, 49978, 49989, 50007, 50015, 50046, 50067,
+            50089, 50099, 50120, 50132, 50146, 50165, 50182, 50192, 50207, 50222, 50228, 50247,
+            50264, 50277, 50288, 50306, 50326, 50335, 50351, 50363, 50383, 50400, 50421, 50434,
+            50448, 50474, 50483, 50509, 50522, 50556, 50573, 50592, 50600, 50619, 50638, 50657,
+            50681, 50697, 50714, 50730, 50746, 50759, 50770, 50787, 50800, 50816, 50833, 50845,
+            50850, 50864, 50870, 50883, 50905, 50924, 50955, 50967, 50981, 51016, 51026, 51039,
+            51059, 51066, 51082, 51096, 51110, 51122, 51138, 51147, 51160, 51178, 51198, 51214,
+            51228, 51245, 51252, 51273, 51292, 51300, 51311, 51319, 51340, 51343, 51362, 51374,
+            51410, 51426, 51430, 51440, 51453, 51476, 51511, 51525, 51537, 51542, 51554, 51563,
+            51575, 51595, 51614, 51627, 51650, 51677, 51693, 51701, 51706, 51712, 51734, 51745,
+            51762, 51773, 51784, 51802, 51815, 51847, 51854, 51873, 51893, 51917, 51929, 51942,
+            51947, 51973, 51994, 52023, 52030, 52046, 52068, 52080, 52110, 52133, 52144, 52154,
+            52169, 52206, 52216, 52235, 52245, 52261, 52283, 52305, 52327, 52346, 52360, 52379,
+            52409, 52420, 52435, 52452, 52472, 52482, 52518, 52532, 52555, 52575, 52595, 52600,
+            52621, 52643, 52649, 52666, 52682, 52709, 52719, 52728, 52748, 52768, 52776, 52784,
+            52809, 52816, 52829, 52843, 52862, 52873, 52883, 52901, 52918, 52930, 52945, 52958,
+            52989, 53018, 53050, 53075, 53084, 53096, 53108, 53115, 53123, 53149, 53162, 53193,
+            53216, 53223, 53229, 53252, 53268, 53280, 53304, 53325, 53335, 53350, 53361, 53366,
+            53389, 53406, 53427, 53450, 53475, 53480, 53505, 53522, 53541, 53546, 53560, 53595,
+            53611, 53641, 53652, 53662, 53671, 53679, 53694, 53707, 53712, 53732, 53753, 53763,
+            53779, 53819, 53831, 53841, 53857, 53877, 53898, 53914, 53924, 53932, 53948, 53978,
+            53990, 54017, 54031, 54051, 54084, 54105, 54112, 54126, 54143, 54179, 54220, 54261,
+            54300, 54335, 54353, 54363, 54382, 54403, 54445, 54476, 54482, 54496, 54508, 54529,
+            54542, 54552, 54562, 54571, 54578, 54599, 54634, 54646, 54654, 54665, 54685, 54691,
+            54715, 54725, 54729, 54760, 54776, 54786, 54799, 54821, 54846, 54860, 54875, 54882,
+            54896, 54921, 54924, 54932, 54950, 54982, 55008, 55032, 55060, 55090, 55107, 55138,
+            55155, 55172, 55196, 55202, 55220, 55230, 55247, 55268, 55282, 55285, 55292, 55303,
+            55312, 55329, 55344, 55369, 55391, 55404, 55434, 55443, 55452, 55466, 55474, 55484,
+            55502, 55526, 55541, 55552, 55562, 55583, 55596, 55620, 55645, 55672, 55711, 55731,
+            55749, 55776, 55793, 55814, 55833, 55857, 55888, 55902, 55926, 55939, 55953, 55974,
+            55986, 56006, 56022, 56033, 56063, 56082, 56107, 56118, 56141, 56144, 56153, 56161,
+            56177, 56193, 56208, 56220, 56249, 56260, 56276, 56291, 56309, 56317, 56325, 56341,
+            56362, 56374, 56390, 56417, 56435, 56448, 56457, 56469, 56483, 56498, 56509, 56522,
+            56561, 56601, 56608, 56624, 56633, 56655, 56664, 56686, 56701, 56726, 56768, 56778,
+            56800, 56807, 56825, 56852, 56881, 56889, 56919, 56938, 56961, 56974, 57004, 57024,
+            57038, 57046, 57065, 57073, 57078, 57088, 57102, 57124, 57133, 57163, 57172, 57185,
+            57193, 57206, 57213, 57222, 57237, 57285, 57294, 57313, 57327, 57341, 57358, 57380,
+            57409, 57419, 57427, 57437, 57455, 57465, 57478, 57491, 57505, 57526, 57547, 57561,
+            57572, 57580, 57606, 57625, 57654, 57674, 57700, 57714, 57730, 57749, 57755, 57782,
+            57800, 57814, 57822, 57837, 57873, 57886, 57899, 57920, 57950, 57954, 57967, 57992,
+            58007, 58011, 58036, 58069, 58083, 58116, 58138, 58159, 58171, 58190, 58229, 58240,
+            58248, 58255, 58267, 58281, 58296, 58309, 58320, 58329, 58344, 58362, 58374, 58387,
+            58395, 58411, 58423, 58430, 58441, 58463, 58481, 58494, 58520, 58535, 58563, 58585,
+            58594, 58607, 58653, 58694, 58723, 58730, 58765, 58771, 58791, 58797, 58823, 58830,
+            58851, 58860, 58876, 58886, 58892, 58905, 58934, 58940, 58952, 58961, 58984, 58994,
+            59001, 59028, 59050, 59063, 59070, 59082, 59096, 59115, 59129, 59140, 59152, 59169,
+            59178, 59192, 59205, 59215, 59236, 59247, 59265, 59287, 59305, 59312, 59333, 59344,
+            59354, 59363, 59368, 59389, 59409, 59427, 59449, 59465, 59472, 59483, 59510, 59522,
+            59544, 59563, 59572, 59582, 59591, 59615, 59634, 59646, 59654, 59664, 59673, 59700,
+            59712, 59715, 59729, 59738, 59747, 59755, 59767, 59778, 59805, 59816, 59834, 59858,
+            59868, 59878, 59891, 59918, 59927, 59932, 59947, 59958, 59965, 59978, 59992, 60008,
+            60027, 60041, 60062, 60070, 60085, 60094, 60111, 60131, 60144, 60158, 60169, 60183,
+            60197, 60219, 60232, 60249, 60256, 60273, 60297, 60309, 60315, 60328, 60334, 60350,
+            60372, 60386, 60401, 60411, 60415, 60429, 60437, 60442, 60455, 60482, 60508, 60534,
+            60550, 60566, 60576, 60582, 60597, 60610, 60632, 60642, 60649, 60660, 60670, 60680,
+            60694, 60711, 60732, 60746, 60757, 60769, 60785, 60806, 60821, 60850, 60861, 60879,
+            60890, 60898, 60904, 60916, 60939, 60953, 60962, 60972, 60989, 60999, 61013, 61028,
+            61038, 61047, 61062, 61082, 61105, 61117, 61135, 61165, 61183, 61189, 61203, 61227,
+            61244, 61262, 61275, 61292, 61301, 61322, 61331, 61343, 61357, 61385, 61397, 61410,
+            61423, 61435, 61448, 61465, 61494, 61505, 61511, 61524, 61534, 61549, 61567, 61583,
+            61590, 61606, 61615, 61637, 61640, 61652, 61663, 61672, 61685, 61701, 61712, 61727,
+            61747, 61764, 61784, 61788, 61796, 61808, 61825, 61835, 61844, 61855, 61864, 61872,
+            61880, 61897, 61910, 61919, 61926, 61937, 61951, 61966, 61985, 62010, 62019, 62029,
+            62034, 62043, 62061, 62068, 62083, 62096, 62109, 62129, 62149, 62172, 62184, 62192,
+            62202, 62217, 62230, 62242, 62263, 62293, 62307, 62330, 62334, 62347, 62375, 62393,
+            62409, 62428, 62447, 62477, 62498, 62526, 62535, 62548, 62557, 62565, 62586, 62608,
+            62613, 62628, 62649, 62668, 62684, 62708, 62717, 62741, 62746, 62759, 62771, 62779,
+            62785, 62794, 62821, 62838, 62856, 62884, 62908, 62921, 62942, 62966, 62981, 62999,
+            63006, 63032, 63049, 63071, 63082, 63097, 63113, 63132, 63145, 63160, 63169, 63186,
+            63200, 63218, 63226, 63243, 63273, 63299, 63308, 63327, 63338, 63354, 63376, 63385,
+            63392, 63397, 63415, 63433, 63444, 63470, 63482, 63499, 63530, 63541, 63556, 63566,
+            63581, 63595, 63611, 63620, 63629, 63639, 63650, 63660, 63674, 63686, 63697, 63705,
+            63707, 63734, 63743, 63755, 63782, 63794, 63798, 63806, 63824, 63834, 63856, 63865,
+            63896, 63906, 63919, 63947, 63964, 63979, 63993, 64000, 64030, 64060, 64074, 64080,
+            64096, 64115, 64136, 64155, 64182, 64197, 64206, 64219, 64239, 64255, 64276, 64303,
+            64317, 64342, 64372, 64390, 64397, 64415, 64420, 64428, 64447, 64451, 64469, 64480,
+            64491, 64507, 64521, 64545, 64552, 64565, 64571, 64587, 64601, 64619, 64623, 64636,
+            64659, 64664, 64678, 64706, 64714, 64743, 64761, 64769, 64774, 64785, 64801, 64814,
+            64820, 64841, 64854, 64876, 64884, 64894, 64905, 64920, 64926, 64939, 64961, 64983,
+            64999, 65013, 65021, 65036, 65051, 65071, 65086, 65104, 65120, 65133, 65146, 65156,
+            65172, 65183, 65189, 65196, 65225, 65234, 65244, 65253, 65261, 65271, 65289, 65302,
+            65332, 65345, 65348, 65357, 65368, 65376, 65393, 65423, 65434, 65450, 65458, 65480,
+            65491, 65503, 65520, 65542, 65551, 65578, 65605, 65618, 65632, 65638, 65650, 65673,
+            65681, 65693, 65708, 65722, 65735, 65747, 65757, 65768, 65783, 65791, 65808, 65814,
+            65831, 65846, 65857, 65881, 65885, 65897, 65918, 65946, 65960, 65966, 65974, 65986,
+            65994, 66024, 66035, 66049, 66060, 66073, 66085, 66099, 66129, 66141, 66155, 66171,
+            66177, 66202, 66211, 66217, 66232, 66244, 66255, 66267, 66287, 66304, 66312, 66319,
+            66333, 66354, 66373, 66390, 66413, 66431, 66446, 66462, 66472, 66483, 66498, 66528,
+            66549, 66576, 66592, 66606, 66625, 66655, 66679, 66692, 66698, 66702, 66722, 66733,
+            66746, 66761, 66773, 66787, 66796, 66822, 66834, 66842, 66851, 66859, 66873, 66901,
+            66925, 66933, 66953, 66965, 66969, 66993, 67000, 67011, 67024, 67042, 67055, 67066,
+            67078, 67084, 67114, 67136, 67148, 67172, 67193, 67204, 67218, 67235, 67244, 67270,
+            67283, 67294, 67316, 67325, 67336, 67347, 67369, 67378, 67395, 67409, 67424, 67433,
+            67446, 67469, 67484, 67497, 67527, 67541, 67559, 67571, 67584, 67604, 67616, 67628,
+            67642, 67660, 67671, 67683, 67701, 67716, 67726, 67737, 67751, 67779, 67792, 67808,
+            67823, 67846, 67873, 67897, 67909, 67929, 67939, 67951, 67972, 68001, 68013, 68042,
+            68071, 68087, 68097, 68125, 68138, 68154, 68163, 68175, 68180, 68193, 68216, 68239,
+            68261, 68271, 68273, 68281, 68301, 68321, 68336, 68355, 68362, 68390, 68414, 68432,
+            68441, 68452, 68466, 68474, 68493, 68507, 68522, 68546, 68551, 68573, 68586, 68604,
+            68621, 68639, 68662, 68683, 68702, 68726, 68730, 68755, 68775, 68789, 68801, 68809,
+            68816, 68829, 68837, 68846, 68862, 68875, 68887, 68906, 68922, 68941, 68953, 68964,
+            68975, 68986, 69010, 69022, 69034, 69045, 69061, 69076, 69080, 69091, 69099, 69112,
+            69121, 69132, 69150, 69170, 69179, 69187, 69201, 69220, 69237, 69246, 69252, 69268,
+            69276, 69290, 69302, 69314, 69331, 69344, 69356, 69369, 69395, 69401, 69410, 69433,
+            69450, 69459, 69467, 69491, 69506, 69527, 69535, 69551, 69578, 69595, 69609, 69625,
+            69634, 69647, 69672, 69683, 69688, 69717, 69726, 69754, 69765, 69771, 69780, 69787,
+            69795, 69810, 69838, 69852, 69861, 69877, 69894, 69904, 69912, 69919, 69931, 69945,
+            69952, 69971, 69993, 70025, 70058, 70080, 70134, 70141, 70154, 70165, 70182, 70191,
+            70198, 70224, 70260, 70279, 70294, 70301, 70306, 70315, 70328, 70357, 70368, 70376,
+            70381, 70389, 70403, 70415, 70428, 70441, 70454, 70470, 70488,
+        };
+        inline constexpr char16_t kPool[] = {
+            78, 66, 65, 32, 50, 75, 49, 54, 87, 87, 69, 32, 50, 75, 49, 54, 80, 97, 105, 110,
+            107, 105, 108, 108, 101, 114, 32, 45, 32, 72, 101, 108, 108, 32, 38, 32, 68, 97, 109, 110,
+            97, 116, 105, 111, 110, 68, 101, 97, 100, 102, 97, 108, 108, 32, 65, 100, 118, 101, 110, 116,
+            117, 114, 101, 115, 77, 88, 32, 118, 115, 32, 65, 84, 86, 32, 83, 117, 112, 101, 114, 99,
+            114, 111, 115, 115, 76, 101, 103, 101, 110, 100, 32, 111, 102, 32, 75, 97, 121, 32, 65, 110,
+            110, 105, 118, 101, 114, 115, 97, 114, 121, 84, 104, 101, 32, 66, 111, 111, 107, 32, 111, 102,
+            32, 85, 110, 119, 114, 105, 116, 116, 101, 110, 32, 84, 97, 108, 101, 115, 32, 50, 68, 97,
+            110, 99, 101, 32, 67, 101, 110, 116, 114, 97, 108, 32, 50, 68, 97, 110, 99, 101, 32, 67,
+            101, 110, 116, 114, 97, 108, 32, 51, 89, 111, 117, 110, 103, 32, 74, 117, 115, 116, 105, 99,
+            101, 70, 97, 108, 108, 105, 110, 103, 32, 83, 107, 105, 101, 115, 68, 114, 97, 103, 111, 110,
+            115, 32, 50, 65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 84, 105, 109, 101, 32, 45, 32,
+            83, 101, 99, 114, 101, 116, 32, 40, 50, 48, 49, 52, 41, 65, 100, 118, 101, 110, 116, 117,
+            114, 101, 32, 84, 105, 109, 101, 32, 45, 32, 70, 74, 73, 77, 111, 110, 115, 116, 101, 114,
+            32, 72, 105, 103, 104, 32, 45, 32, 78, 101, 119, 32, 71, 104, 111, 117, 108, 32, 105, 110,
+            32, 83, 99, 104, 111, 111, 108, 66, 97, 114, 98, 105, 101, 32, 80, 117, 112, 112, 121, 68,
+            105, 97, 98, 108, 111, 32, 73, 73, 73, 68, 105, 97, 98, 108, 111, 32, 73, 73, 73, 32,
+            45, 32, 82, 101, 97, 112, 101, 114, 32, 111, 102, 32, 83, 111, 117, 108, 115, 65, 105, 114,
+            32, 67, 111, 110, 102, 108, 105, 99, 116, 115, 32, 45, 32, 83, 101, 99, 114, 101, 116, 32,
+            87, 97, 114, 115, 65, 105, 114, 32, 67, 111, 110, 102, 108, 105, 99, 116, 115, 32, 45, 32,
+            86, 105, 101, 116, 110, 97, 109, 68, 97, 118, 101, 32, 77, 105, 114, 114, 97, 32, 70, 114,
+            101, 101, 115, 116, 121, 108, 101, 32, 66, 77, 88, 32, 50, 65, 108, 108, 45, 83, 116, 97,
+            114, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 48, 48, 51, 32, 102, 101, 97, 116,
+            117, 114, 105, 110, 103, 32, 68, 101, 114, 101, 107, 32, 74, 101, 116, 101, 114, 76, 101, 103,
+            101, 110, 100, 115, 32, 111, 102, 32, 87, 114, 101, 115, 116, 108, 105, 110, 103, 84, 117, 114,
+            111, 107, 58, 32, 69, 118, 111, 108, 117, 116, 105, 111, 110, 86, 101, 120, 120, 66, 117, 114,
+            110, 111, 117, 116, 65, 103, 103, 114, 101, 115, 115, 105, 118, 101, 32, 73, 110, 108, 105, 110,
+            101, 65, 84, 86, 58, 32, 81, 117, 97, 100, 32, 80, 111, 119, 101, 114, 32, 82, 97, 99,
+            105, 110, 103, 32, 50, 83, 112, 101, 101, 100, 32, 75, 105, 110, 103, 115, 70, 114, 101, 101,
+            115, 116, 121, 108, 101, 32, 83, 116, 114, 101, 101, 116, 32, 83, 111, 99, 99, 101, 114, 65,
+            70, 76, 32, 76, 105, 118, 101, 32, 50, 48, 48, 51, 66, 77, 88, 32, 88, 88, 88, 76,
+            101, 103, 101, 110, 100, 115, 32, 111, 102, 32, 87, 114, 101, 115, 116, 108, 105, 110, 103, 32,
+            73, 73, 83, 88, 32, 83, 117, 112, 101, 114, 115, 116, 97, 114, 78, 66, 65, 32, 74, 97,
+            109, 88, 71, 82, 65, 58, 32, 69, 120, 116, 114, 101, 109, 101, 32, 71, 32, 82, 97, 99,
+            105, 110, 103, 32, 65, 115, 115, 111, 99, 105, 97, 116, 105, 111, 110, 65, 108, 105, 97, 115,
+            68, 97, 107, 97, 114, 32, 50, 58, 32, 84, 104, 101, 32, 87, 111, 114, 108, 100, 39, 115,
+            32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 82, 97, 108, 108, 121, 65, 108, 108, 45, 83,
+            116, 97, 114, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 48, 48, 52, 32, 102, 101,
+            97, 116, 117, 114, 105, 110, 103, 32, 68, 101, 114, 101, 107, 32, 74, 101, 116, 101, 114, 66,
+            117, 114, 110, 111, 117, 116, 32, 50, 58, 32, 80, 111, 105, 110, 116, 32, 111, 102, 32, 73,
+            109, 112, 97, 99, 116, 71, 108, 97, 100, 105, 97, 116, 111, 114, 58, 32, 83, 119, 111, 114,
+            100, 32, 111, 102, 32, 86, 101, 110, 103, 101, 97, 110, 99, 101, 65, 70, 76, 32, 76, 105,
+            118, 101, 32, 50, 48, 48, 52, 65, 108, 108, 45, 83, 116, 97, 114, 32, 66, 97, 115, 101,
+            98, 97, 108, 108, 32, 50, 48, 48, 53, 32, 102, 101, 97, 116, 117, 114, 105, 110, 103, 32,
+            68, 101, 114, 101, 107, 32, 74, 101, 116, 101, 114, 83, 104, 111, 119, 100, 111, 119, 110, 58,
+            32, 76, 101, 103, 101, 110, 100, 115, 32, 111, 102, 32, 87, 114, 101, 115, 116, 108, 105, 110,
+            103, 87, 67, 82, 58, 32, 87, 111, 114, 108, 100, 32, 67, 104, 97, 109, 112, 105, 111, 110,
+            115, 104, 105, 112, 32, 82, 117, 103, 98, 121, 65, 70, 76, 32, 76, 105, 118, 101, 32, 80,
+            114, 101, 109, 105, 101, 114, 115, 104, 105, 112, 32, 69, 100, 105, 116, 105, 111, 110, 80, 117,
+            109, 112, 32, 73, 116, 32, 85, 112, 58, 32, 69, 120, 99, 101, 101, 100, 80, 108, 97, 121,
+            98, 111, 121, 58, 32, 84, 104, 101, 32, 77, 97, 110, 115, 105, 111, 110, 84, 101, 110, 101,
+            114, 101, 122, 122, 97, 80, 101, 116, 105, 116, 32, 67, 111, 112, 116, 101, 114, 70, 108, 105,
+            103, 104, 116, 32, 65, 99, 97, 100, 101, 109, 121, 83, 101, 110, 116, 111, 117, 32, 89, 111,
+            117, 115, 101, 105, 32, 89, 117, 107, 105, 107, 97, 122, 101, 58, 32, 89, 111, 117, 115, 101,
+            105, 32, 110, 111, 32, 77, 97, 117, 32, 83, 111, 114, 97, 66, 114, 101, 97, 107, 32, 78,
+            105, 110, 101, 58, 32, 87, 111, 114, 108, 100, 32, 66, 105, 108, 108, 105, 97, 114, 100, 115,
+            32, 84, 111, 117, 114, 110, 97, 109, 101, 110, 116, 84, 111, 117, 103, 101, 32, 82, 83, 104,
+            105, 110, 32, 77, 101, 103, 97, 109, 105, 32, 84, 101, 110, 115, 101, 105, 58, 32, 78, 105,
+            110, 101, 80, 114, 111, 32, 70, 105, 115, 104, 105, 110, 103, 32, 67, 104, 97, 108, 108, 101,
+            110, 103, 101, 71, 97, 108, 108, 101, 111, 110, 90, 111, 105, 100, 115, 32, 65, 115, 115, 97,
+            117, 108, 116, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 68, 97, 114, 107, 110, 101, 115,
+            115, 84, 104, 101, 32, 67, 117, 114, 115, 101, 100, 32, 67, 114, 117, 115, 97, 100, 101, 67,
+            97, 116, 104, 101, 114, 105, 110, 101, 68, 105, 118, 105, 110, 105, 116, 121, 32, 73, 73, 32,
+            45, 32, 84, 104, 101, 32, 68, 114, 97, 103, 111, 110, 32, 75, 110, 105, 103, 104, 116, 32,
+            83, 97, 103, 97, 71, 97, 109, 101, 32, 79, 102, 32, 84, 104, 114, 111, 110, 101, 115, 84,
+            101, 115, 116, 97, 109, 101, 110, 116, 32, 111, 102, 32, 83, 104, 101, 114, 108, 111, 99, 107,
+            32, 72, 111, 108, 109, 101, 115, 80, 101, 114, 115, 111, 110, 97, 32, 52, 32, 65, 114, 101,
+            97, 32, 85, 108, 116, 105, 109, 97, 120, 84, 111, 110, 121, 32, 72, 97, 119, 107, 39, 115,
+            32, 80, 114, 111, 32, 83, 107, 97, 116, 101, 114, 32, 50, 120, 75, 101, 108, 108, 121, 32,
+            83, 108, 97, 116, 101, 114, 39, 115, 32, 80, 114, 111, 32, 83, 117, 114, 102, 101, 114, 83,
+            116, 114, 101, 101, 116, 32, 72, 111, 111, 112, 115, 84, 111, 110, 121, 32, 72, 97, 119, 107,
+            39, 115, 32, 80, 114, 111, 32, 83, 107, 97, 116, 101, 114, 32, 51, 66, 108, 97, 100, 101,
+            32, 73, 73, 83, 112, 105, 100, 101, 114, 45, 77, 97, 110, 88, 45, 77, 101, 110, 58, 32,
+            78, 101, 120, 116, 32, 68, 105, 109, 101, 110, 115, 105, 111, 110, 88, 50, 58, 32, 87, 111,
+            108, 118, 101, 114, 105, 110, 101, 39, 115, 32, 82, 101, 118, 101, 110, 103, 101, 82, 97, 108,
+            108, 121, 32, 70, 117, 115, 105, 111, 110, 58, 32, 82, 97, 99, 101, 32, 111, 102, 32, 67,
+            104, 97, 109, 112, 105, 111, 110, 115, 87, 114, 101, 99, 107, 108, 101, 115, 115, 58, 32, 84,
+            104, 101, 32, 89, 97, 107, 117, 122, 97, 32, 77, 105, 115, 115, 105, 111, 110, 115, 77, 97,
+            116, 32, 72, 111, 102, 102, 109, 97, 110, 39, 115, 32, 80, 114, 111, 32, 66, 77, 88, 32,
+            50, 87, 114, 101, 99, 107, 108, 101, 115, 115, 58, 32, 77, 105, 115, 115, 105, 111, 110, 32,
+            89, 97, 107, 117, 115, 97, 115, 87, 97, 107, 101, 98, 111, 97, 114, 100, 105, 110, 103, 32,
+            85, 110, 108, 101, 97, 115, 104, 101, 100, 32, 102, 101, 97, 116, 117, 114, 105, 110, 103, 32,
+            83, 104, 97, 117, 110, 32, 77, 117, 114, 114, 97, 121, 84, 114, 117, 101, 32, 67, 114, 105,
+            109, 101, 58, 32, 83, 116, 114, 101, 101, 116, 115, 32, 111, 102, 32, 76, 65, 83, 116, 97,
+            114, 32, 87, 97, 114, 115, 58, 32, 79, 98, 105, 45, 87, 97, 110, 82, 101, 116, 117, 114,
+            110, 32, 116, 111, 32, 67, 97, 115, 116, 108, 101, 32, 87, 111, 108, 102, 101, 110, 115, 116,
+            101, 105, 110, 58, 32, 84, 105, 100, 101, 115, 32, 111, 102, 32, 87, 97, 114, 77, 105, 110,
+            111, 114, 105, 116, 121, 32, 82, 101, 112, 111, 114, 116, 58, 32, 69, 118, 101, 114, 121, 98,
+            111, 100, 121, 32, 82, 117, 110, 115, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 74,
+            101, 100, 105, 32, 75, 110, 105, 103, 104, 116, 32, 73, 73, 58, 32, 74, 101, 100, 105, 32,
+            79, 117, 116, 99, 97, 115, 116, 84, 111, 110, 121, 32, 72, 97, 119, 107, 39, 115, 32, 80,
+            114, 111, 32, 83, 107, 97, 116, 101, 114, 32, 52, 80, 105, 116, 102, 97, 108, 108, 58, 32,
+            84, 104, 101, 32, 76, 111, 115, 116, 32, 69, 120, 112, 101, 100, 105, 116, 105, 111, 110, 67,
+            97, 98, 101, 108, 97, 39, 115, 32, 68, 97, 110, 103, 101, 114, 111, 117, 115, 32, 72, 117,
+            110, 116, 115, 70, 97, 110, 116, 97, 115, 116, 105, 99, 32, 52, 83, 111, 108, 100, 105, 101,
+            114, 32, 111, 102, 32, 70, 111, 114, 116, 117, 110, 101, 32, 73, 73, 58, 32, 68, 111, 117,
+            98, 108, 101, 32, 72, 101, 108, 105, 120, 88, 45, 77, 101, 110, 32, 76, 101, 103, 101, 110,
+            100, 115, 85, 110, 97, 32, 83, 101, 114, 105, 101, 32, 100, 101, 32, 67, 97, 116, 97, 115,
+            116, 114, 243, 102, 105, 99, 97, 115, 32, 68, 101, 115, 100, 105, 99, 104, 97, 115, 32, 100,
+            101, 32, 76, 101, 109, 111, 110, 121, 32, 83, 110, 105, 99, 107, 101, 116, 68, 111, 111, 109,
+            32, 51, 77, 84, 88, 32, 77, 111, 116, 111, 116, 114, 97, 120, 84, 101, 110, 99, 104, 117,
+            58, 32, 82, 101, 116, 117, 114, 110, 32, 102, 114, 111, 109, 32, 68, 97, 114, 107, 110, 101,
+            115, 115, 68, 105, 115, 110, 101, 121, 39, 115, 32, 69, 120, 116, 114, 101, 109, 101, 32, 83,
+            107, 97, 116, 101, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 67, 97, 108, 108, 32, 111,
+            102, 32, 68, 117, 116, 121, 58, 32, 70, 105, 110, 101, 115, 116, 32, 72, 111, 117, 114, 83,
+            112, 105, 100, 101, 114, 45, 77, 97, 110, 32, 50, 84, 111, 110, 121, 32, 72, 97, 119, 107,
+            39, 115, 32, 85, 110, 100, 101, 114, 103, 114, 111, 117, 110, 100, 67, 97, 98, 101, 108, 97,
+            39, 115, 32, 68, 101, 101, 114, 32, 72, 117, 110, 116, 58, 32, 50, 48, 48, 52, 32, 83,
+            101, 97, 115, 111, 110, 85, 108, 116, 105, 109, 97, 116, 101, 32, 83, 112, 105, 100, 101, 114,
+            45, 77, 97, 110, 84, 101, 110, 99, 104, 117, 58, 32, 82, 101, 116, 117, 114, 110, 32, 102,
+            114, 111, 109, 32, 68, 97, 114, 107, 110, 101, 115, 115, 83, 104, 114, 101, 107, 32, 50, 68,
+            114, 101, 97, 109, 87, 111, 114, 107, 115, 32, 83, 104, 97, 114, 107, 32, 84, 97, 108, 101,
+            58, 32, 72, 97, 106, 97, 114, 32, 115, 111, 109, 32, 72, 97, 106, 97, 114, 82, 97, 112,
+            97, 108, 97, 32, 80, 114, 111, 32, 70, 105, 115, 104, 105, 110, 103, 68, 114, 101, 97, 109,
+            87, 111, 114, 107, 115, 32, 77, 97, 100, 97, 103, 97, 115, 99, 97, 114, 84, 111, 110, 121,
+            32, 72, 97, 119, 107, 39, 115, 32, 85, 110, 100, 101, 114, 103, 114, 111, 117, 110, 100, 32,
+            50, 65, 109, 101, 114, 105, 99, 97, 110, 32, 67, 104, 111, 112, 112, 101, 114, 67, 97, 98,
+            101, 108, 97, 39, 115, 32, 66, 105, 103, 32, 71, 97, 109, 101, 32, 72, 117, 110, 116, 101,
+            114, 32, 50, 48, 48, 53, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 67, 97, 98,
+            101, 108, 97, 39, 115, 32, 68, 101, 101, 114, 32, 72, 117, 110, 116, 58, 32, 50, 48, 48,
+            53, 32, 83, 101, 97, 115, 111, 110, 66, 105, 99, 121, 99, 108, 101, 32, 67, 97, 115, 105,
+            110, 111, 32, 73, 110, 99, 108, 117, 100, 101, 115, 58, 32, 84, 101, 120, 97, 115, 32, 72,
+            111, 108, 100, 39, 101, 109, 77, 111, 110, 115, 116, 101, 114, 32, 71, 97, 114, 97, 103, 101,
+            71, 114, 101, 103, 32, 72, 97, 115, 116, 105, 110, 103, 115, 39, 32, 84, 111, 117, 114, 110,
+            97, 109, 101, 110, 116, 32, 80, 97, 105, 110, 116, 98, 97, 108, 108, 84, 114, 117, 101, 32,
+            67, 114, 105, 109, 101, 58, 32, 78, 101, 119, 32, 89, 111, 114, 107, 32, 67, 105, 116, 121,
+            88, 45, 77, 101, 110, 58, 32, 84, 104, 101, 32, 79, 102, 102, 105, 99, 105, 97, 108, 32,
+            71, 97, 109, 101, 88, 45, 77, 101, 110, 32, 76, 101, 103, 101, 110, 100, 115, 32, 73, 73,
+            58, 32, 82, 105, 115, 101, 32, 111, 102, 32, 65, 112, 111, 99, 97, 108, 121, 112, 115, 101,
+            68, 114, 101, 97, 109, 87, 111, 114, 107, 115, 32, 83, 104, 114, 101, 107, 58, 32, 83, 117,
+            112, 101, 114, 83, 108, 97, 109, 84, 111, 110, 121, 32, 72, 97, 119, 107, 39, 115, 32, 65,
+            109, 101, 114, 105, 99, 97, 110, 32, 87, 97, 115, 116, 101, 108, 97, 110, 100, 71, 117, 110,
+            67, 97, 98, 101, 108, 97, 39, 115, 32, 79, 117, 116, 100, 111, 111, 114, 32, 65, 100, 118,
+            101, 110, 116, 117, 114, 101, 115, 68, 111, 111, 109, 32, 51, 58, 32, 82, 101, 115, 117, 114,
+            114, 101, 99, 116, 105, 111, 110, 32, 111, 102, 32, 69, 118, 105, 108, 65, 109, 101, 114, 105,
+            99, 97, 110, 32, 67, 104, 111, 112, 112, 101, 114, 32, 50, 58, 32, 70, 117, 108, 108, 32,
+            84, 104, 114, 111, 116, 116, 108, 101, 83, 101, 97, 87, 111, 114, 108, 100, 32, 65, 100, 118,
+            101, 110, 116, 117, 114, 101, 32, 80, 97, 114, 107, 115, 58, 32, 83, 104, 97, 109, 117, 39,
+            115, 32, 68, 101, 101, 112, 32, 83, 101, 97, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101,
+            115, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 50, 58, 32, 66, 105, 103,
+            32, 82, 101, 100, 32, 79, 110, 101, 67, 97, 98, 101, 108, 97, 39, 115, 32, 68, 97, 110,
+            103, 101, 114, 111, 117, 115, 32, 72, 117, 110, 116, 115, 32, 50, 87, 111, 114, 108, 100, 32,
+            83, 101, 114, 105, 101, 115, 32, 111, 102, 32, 80, 111, 107, 101, 114, 84, 89, 32, 116, 104,
+            101, 32, 84, 97, 115, 109, 97, 110, 105, 97, 110, 32, 84, 105, 103, 101, 114, 58, 32, 78,
+            105, 103, 104, 116, 32, 111, 102, 32, 116, 104, 101, 32, 81, 117, 105, 110, 107, 97, 110, 71,
+            114, 101, 103, 32, 72, 97, 115, 116, 105, 110, 103, 115, 39, 32, 84, 111, 117, 114, 110, 97,
+            109, 101, 110, 116, 32, 80, 97, 105, 110, 116, 98, 97, 108, 108, 32, 77, 97, 120, 39, 100,
+            68, 114, 101, 97, 109, 87, 111, 114, 107, 115, 32, 79, 118, 101, 114, 32, 116, 104, 101, 32,
+            72, 101, 100, 103, 101, 84, 104, 101, 32, 72, 117, 115, 116, 108, 101, 58, 32, 68, 101, 116,
+            114, 111, 105, 116, 32, 83, 116, 114, 101, 101, 116, 115, 77, 97, 114, 118, 101, 108, 58, 32,
+            85, 108, 116, 105, 109, 97, 116, 101, 32, 65, 108, 108, 105, 97, 110, 99, 101, 67, 97, 108,
+            108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 51, 84, 111, 110, 121, 32, 72, 97, 119, 107,
+            39, 115, 32, 80, 114, 111, 106, 101, 99, 116, 32, 56, 67, 97, 108, 108, 32, 111, 102, 32,
+            68, 117, 116, 121, 32, 50, 81, 117, 97, 107, 101, 32, 52, 71, 117, 110, 65, 109, 101, 114,
+            105, 99, 97, 110, 32, 87, 97, 115, 116, 101, 108, 97, 110, 100, 81, 117, 97, 107, 101, 32,
+            50, 87, 111, 114, 108, 100, 32, 83, 101, 114, 105, 101, 115, 32, 111, 102, 32, 80, 111, 107,
+            101, 114, 32, 45, 32, 84, 111, 117, 114, 110, 97, 109, 101, 110, 116, 32, 111, 102, 32, 67,
+            104, 97, 109, 112, 105, 111, 110, 115, 77, 97, 114, 118, 101, 108, 32, 85, 108, 116, 105, 109,
+            97, 116, 101, 32, 65, 108, 108, 105, 97, 110, 99, 101, 88, 45, 77, 101, 110, 32, 45, 84,
+            104, 101, 111, 102, 102, 105, 99, 105, 97, 108, 103, 97, 109, 101, 65, 108, 97, 115, 107, 97,
+            110, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 84, 111, 110, 121, 32, 72, 97, 119,
+            107, 39, 115, 32, 80, 114, 111, 106, 101, 99, 116, 32, 56, 87, 111, 108, 102, 101, 110, 115,
+            116, 101, 105, 110, 69, 110, 101, 109, 121, 32, 84, 101, 114, 114, 105, 116, 111, 114, 121, 32,
+            45, 32, 81, 117, 97, 107, 101, 32, 87, 97, 114, 115, 67, 97, 108, 108, 32, 111, 102, 32,
+            68, 117, 116, 121, 32, 51, 83, 112, 105, 100, 101, 114, 45, 77, 97, 110, 32, 51, 67, 105,
+            118, 105, 108, 32, 87, 97, 114, 67, 97, 98, 101, 108, 97, 39, 115, 32, 83, 97, 102, 97,
+            114, 105, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 45, 32, 77, 111, 100,
+            101, 114, 110, 32, 87, 97, 114, 102, 97, 114, 101, 71, 117, 105, 116, 97, 114, 32, 72, 101,
+            114, 111, 32, 73, 105, 83, 72, 82, 101, 75, 32, 116, 104, 101, 32, 84, 72, 105, 82, 68,
+            82, 97, 112, 97, 108, 97, 32, 84, 111, 117, 114, 110, 97, 109, 101, 110, 116, 83, 105, 110,
+            103, 117, 108, 97, 114, 105, 116, 121, 84, 111, 110, 121, 32, 72, 97, 119, 107, 39, 115, 32,
+            80, 114, 111, 118, 105, 110, 103, 32, 71, 114, 111, 117, 110, 100, 84, 114, 97, 110, 115, 102,
+            111, 114, 109, 101, 114, 115, 32, 45, 32, 84, 104, 101, 32, 71, 97, 109, 101, 75, 117, 110,
+            103, 32, 70, 117, 32, 80, 97, 110, 100, 97, 66, 101, 101, 32, 77, 111, 118, 105, 101, 32,
+            71, 97, 109, 101, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 73, 105, 105, 83,
+            112, 105, 100, 101, 114, 45, 77, 97, 110, 32, 45, 32, 70, 111, 102, 48, 48, 55, 32, 81,
+            117, 97, 110, 116, 117, 109, 32, 111, 102, 32, 83, 111, 108, 97, 99, 101, 66, 105, 103, 32,
+            71, 97, 109, 101, 32, 72, 117, 110, 116, 101, 114, 67, 97, 98, 101, 108, 97, 39, 115, 32,
+            84, 114, 111, 112, 104, 121, 32, 66, 117, 99, 107, 115, 83, 112, 105, 100, 101, 121, 32, 45,
+            32, 87, 101, 98, 32, 79, 102, 32, 83, 104, 97, 100, 111, 119, 115, 88, 109, 101, 110, 32,
+            79, 114, 105, 103, 105, 110, 115, 32, 87, 111, 108, 118, 101, 114, 105, 110, 101, 67, 97, 108,
+            108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 45, 32, 77, 111, 100, 101, 114, 110, 32, 87,
+            97, 114, 102, 97, 114, 101, 32, 50, 83, 111, 102, 32, 80, 97, 121, 98, 97, 99, 107, 71,
+            117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 45, 32, 65, 101, 114, 111, 115, 109, 105,
+            116, 104, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 87, 111, 114, 108, 100, 32,
+            84, 111, 117, 114, 67, 97, 108, 108, 32, 79, 102, 32, 68, 117, 116, 121, 32, 45, 32, 87,
+            111, 114, 108, 100, 32, 97, 116, 32, 87, 97, 114, 77, 97, 100, 97, 103, 97, 115, 99, 97,
+            114, 32, 50, 74, 97, 109, 101, 115, 32, 66, 111, 110, 100, 32, 48, 48, 55, 32, 45, 32,
+            66, 108, 111, 111, 100, 32, 83, 116, 111, 110, 101, 84, 111, 110, 121, 32, 72, 97, 119, 107,
+            32, 45, 32, 82, 105, 100, 101, 84, 114, 117, 101, 32, 67, 114, 105, 109, 101, 66, 97, 106,
+            97, 32, 49, 48, 48, 48, 83, 101, 99, 114, 101, 116, 32, 83, 101, 114, 118, 105, 99, 101,
+            67, 105, 118, 105, 108, 32, 87, 97, 114, 32, 45, 32, 83, 101, 99, 114, 101, 116, 32, 77,
+            105, 115, 115, 105, 111, 110, 115, 68, 97, 110, 103, 101, 114, 111, 117, 115, 32, 72, 117, 110,
+            116, 115, 32, 50, 48, 48, 57, 80, 97, 105, 110, 116, 98, 97, 108, 108, 32, 50, 48, 48,
+            57, 77, 111, 110, 115, 116, 101, 114, 115, 32, 118, 115, 46, 32, 65, 108, 105, 101, 110, 115,
+            77, 97, 114, 118, 101, 108, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 65, 108, 108, 105,
+            97, 110, 99, 101, 32, 50, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 77, 101,
+            116, 97, 108, 108, 105, 99, 97, 84, 114, 97, 110, 115, 102, 111, 114, 109, 101, 114, 115, 32,
+            50, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 86, 97, 110, 32, 72, 97, 108,
+            101, 110, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 72, 105, 116, 115, 73, 99,
+            101, 32, 65, 103, 101, 32, 51, 71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 53,
+            66, 108, 117, 114, 84, 114, 97, 110, 115, 102, 111, 114, 109, 101, 114, 115, 32, 45, 32, 87,
+            97, 114, 32, 102, 111, 114, 32, 67, 121, 98, 101, 114, 116, 114, 111, 110, 80, 82, 79, 84,
+            79, 84, 89, 80, 69, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 45, 32,
+            66, 108, 97, 99, 107, 32, 79, 112, 115, 66, 97, 107, 117, 103, 97, 110, 67, 104, 97, 111,
+            116, 105, 99, 79, 117, 116, 100, 111, 111, 114, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101,
+            115, 66, 97, 110, 100, 32, 72, 101, 114, 111, 67, 97, 98, 101, 108, 97, 39, 115, 32, 66,
+            105, 103, 32, 71, 97, 109, 101, 32, 72, 117, 110, 116, 101, 114, 32, 50, 48, 49, 48, 74,
+            117, 114, 97, 115, 115, 105, 99, 32, 45, 32, 84, 104, 101, 32, 72, 117, 110, 116, 101, 100,
+            71, 117, 105, 116, 97, 114, 32, 72, 101, 114, 111, 32, 86, 105, 112, 32, 80, 97, 115, 115,
+            83, 104, 114, 101, 107, 32, 70, 111, 114, 101, 118, 101, 114, 32, 65, 102, 116, 101, 114, 72,
+            111, 119, 32, 116, 111, 32, 84, 114, 97, 105, 110, 32, 121, 111, 117, 114, 32, 68, 114, 97,
+            103, 111, 110, 68, 106, 32, 72, 101, 114, 111, 32, 50, 83, 112, 105, 100, 101, 114, 45, 77,
+            97, 110, 32, 45, 68, 105, 109, 101, 110, 115, 105, 111, 110, 115, 71, 104, 32, 45, 32, 87,
+            97, 114, 114, 105, 111, 114, 115, 32, 79, 102, 32, 82, 111, 99, 107, 76, 105, 116, 116, 108,
+            101, 32, 76, 101, 97, 103, 117, 101, 32, 87, 111, 114, 108, 100, 32, 83, 101, 114, 105, 101,
+            115, 32, 50, 48, 49, 48, 82, 97, 112, 97, 108, 97, 32, 80, 114, 111, 32, 66, 97, 115,
+            115, 65, 112, 97, 99, 104, 101, 32, 45, 32, 65, 105, 114, 32, 65, 115, 115, 97, 117, 108,
+            116, 77, 111, 110, 115, 116, 101, 114, 32, 74, 97, 109, 32, 45, 32, 80, 97, 116, 104, 32,
+            111, 102, 32, 68, 101, 115, 116, 114, 117, 99, 116, 105, 111, 110, 66, 108, 111, 111, 100, 32,
+            68, 114, 105, 118, 101, 67, 97, 98, 101, 108, 97, 39, 115, 32, 78, 111, 114, 116, 104, 32,
+            65, 109, 101, 114, 105, 99, 97, 110, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 67,
+            97, 98, 101, 108, 97, 39, 115, 32, 68, 97, 110, 103, 101, 114, 111, 117, 115, 32, 72, 117,
+            110, 116, 115, 32, 50, 48, 49, 49, 66, 97, 107, 117, 103, 97, 110, 32, 45, 32, 68, 101,
+            102, 101, 110, 100, 101, 114, 115, 32, 111, 102, 32, 116, 104, 101, 32, 67, 111, 114, 101, 78,
+            97, 115, 99, 97, 114, 32, 84, 104, 101, 32, 71, 97, 109, 101, 32, 50, 48, 49, 49, 67,
+            97, 108, 108, 32, 79, 102, 32, 68, 117, 116, 121, 32, 69, 108, 105, 116, 101, 84, 82, 65,
+            78, 83, 70, 79, 82, 77, 69, 82, 83, 32, 45, 32, 70, 97, 108, 108, 32, 111, 102, 32,
+            67, 121, 98, 101, 114, 116, 114, 111, 110, 84, 82, 65, 78, 83, 70, 79, 82, 77, 69, 82,
+            83, 32, 45, 32, 68, 97, 114, 107, 32, 111, 102, 32, 116, 104, 101, 32, 77, 111, 111, 110,
+            80, 82, 79, 84, 79, 84, 89, 80, 69, 32, 50, 88, 45, 77, 101, 110, 32, 45, 32, 68,
+            101, 115, 116, 105, 110, 121, 83, 107, 121, 108, 97, 110, 100, 101, 114, 115, 32, 83, 112, 121,
+            114, 111, 39, 115, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 71, 101, 110, 101, 114, 97,
+            116, 111, 114, 32, 82, 101, 120, 87, 105, 112, 101, 111, 117, 116, 32, 45, 32, 73, 110, 32,
+            84, 104, 101, 32, 90, 111, 110, 101, 71, 111, 108, 100, 101, 110, 69, 121, 101, 32, 82, 101,
+            108, 111, 97, 100, 101, 100, 83, 112, 105, 100, 101, 114, 45, 77, 97, 110, 32, 45, 32, 69,
+            111, 116, 68, 114, 101, 97, 109, 87, 111, 114, 107, 115, 32, 75, 97, 114, 116, 122, 84, 104,
+            101, 32, 65, 109, 97, 122, 105, 110, 103, 32, 83, 112, 105, 100, 101, 114, 45, 77, 97, 110,
+            78, 65, 83, 67, 65, 82, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 67, 97, 98, 101,
+            108, 97, 39, 115, 32, 66, 105, 103, 32, 71, 97, 109, 101, 32, 72, 117, 110, 116, 101, 114,
+            32, 50, 48, 49, 50, 67, 97, 98, 101, 108, 97, 39, 115, 32, 83, 117, 114, 118, 105, 118,
+            97, 108, 32, 45, 32, 83, 111, 75, 67, 97, 98, 101, 108, 97, 39, 115, 32, 72, 117, 110,
+            116, 105, 110, 103, 32, 80, 97, 114, 116, 121, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117,
+            116, 121, 32, 45, 32, 66, 108, 97, 99, 107, 32, 79, 112, 115, 32, 73, 73, 70, 97, 109,
+            105, 108, 121, 32, 71, 117, 121, 32, 45, 32, 66, 97, 99, 107, 32, 84, 111, 32, 84, 104,
+            101, 32, 77, 117, 108, 116, 105, 118, 101, 114, 115, 101, 82, 97, 112, 97, 108, 97, 32, 70,
+            111, 114, 32, 75, 105, 110, 101, 99, 116, 65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 67,
+            97, 109, 112, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 45, 32, 77, 111,
+            100, 101, 114, 110, 32, 87, 97, 114, 102, 97, 114, 101, 32, 51, 87, 105, 112, 101, 111, 117,
+            116, 32, 50, 66, 105, 103, 32, 76, 101, 97, 103, 117, 101, 32, 83, 112, 111, 114, 116, 115,
+            66, 97, 116, 116, 108, 101, 115, 104, 105, 112, 78, 65, 83, 67, 65, 82, 32, 73, 110, 115,
+            105, 100, 101, 32, 76, 105, 110, 101, 77, 105, 98, 32, 45, 32, 65, 108, 105, 101, 110, 32,
+            67, 114, 105, 115, 105, 115, 73, 99, 101, 32, 65, 103, 101, 32, 52, 48, 48, 55, 32, 76,
+            101, 103, 101, 110, 100, 115, 83, 107, 121, 108, 97, 110, 100, 101, 114, 115, 32, 71, 105, 97,
+            110, 116, 115, 67, 97, 98, 101, 108, 97, 39, 115, 32, 68, 97, 110, 103, 101, 114, 111, 117,
+            115, 32, 72, 117, 110, 116, 115, 32, 50, 48, 49, 51, 67, 97, 98, 101, 108, 97, 39, 115,
+            32, 72, 117, 110, 116, 105, 110, 103, 32, 69, 120, 112, 101, 100, 105, 116, 105, 111, 110, 115,
+            87, 105, 112, 101, 111, 117, 116, 32, 51, 84, 104, 101, 32, 87, 97, 108, 107, 105, 110, 103,
+            32, 68, 101, 97, 100, 32, 45, 32, 83, 117, 114, 118, 105, 118, 97, 108, 32, 73, 110, 115,
+            116, 105, 110, 99, 116, 65, 110, 103, 114, 121, 32, 66, 105, 114, 100, 115, 32, 84, 114, 105,
+            108, 111, 103, 121, 83, 107, 121, 108, 97, 110, 100, 101, 114, 115, 32, 83, 87, 65, 80, 32,
+            70, 111, 114, 99, 101, 68, 101, 97, 100, 112, 111, 111, 108, 70, 97, 115, 116, 32, 38, 32,
+            70, 117, 114, 105, 111, 117, 115, 32, 45, 32, 83, 104, 111, 119, 100, 111, 119, 110, 68, 101,
+            115, 116, 105, 110, 121, 67, 97, 98, 101, 108, 97, 39, 115, 32, 65, 102, 114, 105, 99, 97,
+            110, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 67, 97, 108, 108, 32, 111, 102, 32,
+            68, 117, 116, 121, 32, 45, 32, 71, 104, 111, 115, 116, 115, 67, 97, 98, 101, 108, 97, 39,
+            115, 32, 66, 105, 103, 32, 71, 97, 109, 101, 32, 72, 117, 110, 116, 101, 114, 32, 80, 114,
+            111, 32, 72, 117, 110, 116, 115, 87, 105, 112, 101, 111, 117, 116, 32, 45, 32, 67, 114, 101,
+            97, 116, 101, 32, 38, 32, 67, 114, 97, 115, 104, 83, 112, 111, 110, 103, 101, 66, 111, 98,
+            32, 45, 32, 82, 111, 98, 111, 116, 105, 99, 32, 82, 101, 118, 101, 110, 103, 101, 84, 82,
+            65, 78, 83, 70, 79, 82, 77, 69, 82, 83, 32, 45, 32, 82, 105, 115, 101, 32, 111, 102,
+            32, 116, 104, 101, 32, 68, 97, 114, 107, 32, 83, 112, 97, 114, 107, 84, 104, 101, 32, 65,
+            109, 97, 122, 105, 110, 103, 32, 83, 112, 105, 100, 101, 114, 45, 77, 97, 110, 32, 50, 84,
+            77, 78, 84, 32, 45, 32, 68, 97, 110, 103, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32,
+            79, 111, 122, 101, 68, 117, 99, 107, 32, 68, 121, 110, 97, 115, 116, 121, 83, 107, 121, 108,
+            97, 110, 100, 101, 114, 115, 32, 84, 114, 97, 112, 32, 84, 101, 97, 109, 84, 104, 101, 32,
+            86, 111, 105, 99, 101, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 45, 32,
+            65, 100, 118, 97, 110, 99, 101, 100, 32, 87, 97, 114, 102, 97, 114, 101, 83, 112, 111, 110,
+            103, 101, 66, 111, 98, 32, 72, 101, 114, 111, 32, 80, 97, 110, 116, 115, 84, 111, 110, 121,
+            32, 72, 97, 119, 107, 39, 115, 32, 80, 114, 111, 32, 83, 107, 97, 116, 101, 114, 32, 53,
+            68, 101, 115, 116, 105, 110, 121, 32, 68, 101, 109, 111, 67, 97, 108, 108, 32, 111, 102, 32,
+            68, 117, 116, 121, 32, 45, 32, 66, 108, 97, 99, 107, 32, 79, 112, 115, 32, 73, 73, 73,
+            84, 77, 78, 84, 32, 45, 32, 77, 117, 116, 97, 110, 116, 115, 32, 105, 110, 32, 77, 97,
+            110, 104, 97, 116, 116, 97, 110, 83, 107, 121, 108, 97, 110, 100, 101, 114, 115, 32, 83, 117,
+            112, 101, 114, 67, 104, 97, 114, 103, 101, 114, 115, 32, 80, 111, 114, 116, 97, 108, 32, 79,
+            119, 110, 101, 114, 39, 115, 32, 80, 97, 99, 107, 71, 117, 105, 116, 97, 114, 32, 72, 101,
+            114, 111, 32, 76, 105, 118, 101, 80, 101, 97, 110, 117, 116, 115, 32, 77, 111, 118, 105, 101,
+            84, 82, 65, 78, 83, 70, 79, 82, 77, 69, 82, 83, 32, 45, 32, 68, 101, 118, 97, 115,
+            116, 97, 116, 105, 111, 110, 75, 105, 110, 103, 39, 115, 32, 81, 117, 101, 115, 116, 32, 45,
+            32, 67, 104, 46, 32, 49, 75, 105, 110, 103, 39, 115, 32, 81, 117, 101, 115, 116, 76, 101,
+            103, 101, 110, 100, 97, 114, 121, 32, 69, 100, 105, 116, 105, 111, 110, 67, 111, 108, 108, 101,
+            99, 116, 111, 114, 39, 115, 32, 69, 100, 105, 116, 105, 111, 110, 71, 117, 105, 108, 116, 121,
+            32, 71, 101, 97, 114, 32, 73, 115, 117, 107, 97, 71, 117, 105, 108, 116, 121, 32, 71, 101,
+            97, 114, 32, 50, 66, 97, 116, 116, 108, 101, 32, 70, 97, 110, 116, 97, 115, 105, 97, 66,
+            108, 97, 122, 66, 108, 117, 101, 32, 67, 111, 110, 116, 105, 110, 117, 117, 109, 32, 83, 104,
+            105, 102, 116, 65, 114, 99, 97, 110, 97, 32, 72, 101, 97, 114, 116, 32, 51, 66, 108, 97,
+            122, 66, 108, 117, 101, 32, 67, 111, 110, 116, 105, 110, 117, 117, 109, 32, 83, 104, 105, 102,
+            116, 32, 69, 120, 116, 101, 110, 100, 66, 108, 97, 122, 66, 108, 117, 101, 82, 101, 99, 111,
+            114, 100, 32, 111, 102, 32, 65, 103, 97, 114, 101, 115, 116, 32, 87, 97, 114, 68, 101, 97,
+            116, 104, 83, 109, 105, 108, 101, 115, 82, 101, 99, 111, 114, 100, 32, 111, 102, 32, 65, 103,
+            97, 114, 101, 115, 116, 32, 87, 97, 114, 32, 90, 101, 114, 111, 83, 116, 117, 98, 98, 115,
+            32, 116, 104, 101, 32, 90, 111, 109, 98, 105, 101, 32, 105, 110, 32, 82, 101, 98, 101, 108,
+            32, 87, 105, 116, 104, 111, 117, 116, 32, 97, 32, 80, 117, 108, 115, 101, 68, 114, 101, 97,
+            109, 102, 97, 108, 108, 58, 32, 84, 104, 101, 32, 76, 111, 110, 103, 101, 115, 116, 32, 74,
+            111, 117, 114, 110, 101, 121, 83, 117, 112, 114, 101, 109, 101, 32, 67, 111, 109, 109, 97, 110,
+            100, 101, 114, 66, 67, 70, 88, 32, 84, 104, 101, 32, 68, 111, 117, 103, 32, 87, 105, 108,
+            108, 105, 97, 109, 115, 32, 69, 100, 105, 116, 105, 111, 110, 68, 114, 101, 97, 109, 107, 105,
+            108, 108, 101, 114, 68, 105, 103, 105, 109, 111, 110, 32, 82, 117, 109, 98, 108, 101, 32, 65,
+            114, 101, 110, 97, 32, 50, 68, 105, 103, 105, 109, 111, 110, 32, 87, 111, 114, 108, 100, 32,
+            52, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32, 90, 32, 45, 32, 66, 117, 114,
+            115, 116, 32, 76, 105, 109, 105, 116, 67, 117, 108, 100, 99, 101, 112, 116, 32, 83, 65, 71,
+            65, 68, 97, 110, 99, 101, 58, 85, 75, 75, 85, 70, 32, 45, 32, 67, 105, 114, 99, 108,
+            101, 32, 111, 102, 32, 68, 111, 111, 109, 66, 114, 97, 100, 121, 103, 97, 109, 101, 115, 32,
+            83, 116, 114, 97, 116, 101, 103, 121, 87, 115, 99, 32, 82, 101, 97, 108, 32, 50, 48, 49,
+            49, 67, 104, 97, 115, 101, 58, 32, 72, 111, 108, 108, 121, 119, 111, 111, 100, 32, 83, 116,
+            117, 110, 116, 32, 68, 114, 105, 118, 101, 114, 82, 101, 105, 103, 110, 32, 111, 102, 32, 70,
+            105, 114, 101, 87, 97, 108, 108, 97, 99, 101, 32, 38, 32, 71, 114, 111, 109, 105, 116, 32,
+            105, 110, 32, 80, 114, 111, 106, 101, 99, 116, 32, 90, 111, 111, 67, 97, 114, 109, 101, 110,
+            32, 83, 97, 110, 100, 105, 101, 103, 111, 58, 32, 84, 104, 101, 32, 83, 101, 99, 114, 101,
+            116, 32, 111, 102, 32, 116, 104, 101, 32, 83, 116, 111, 108, 101, 110, 32, 68, 114, 117, 109,
+            115, 71, 97, 108, 97, 120, 121, 32, 65, 110, 103, 101, 108, 84, 104, 101, 32, 69, 108, 100,
+            101, 114, 32, 83, 99, 114, 111, 108, 108, 115, 32, 73, 73, 73, 58, 32, 77, 111, 114, 114,
+            111, 119, 105, 110, 100, 80, 105, 114, 97, 116, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32,
+            67, 97, 114, 105, 98, 98, 101, 97, 110, 84, 104, 101, 32, 69, 108, 100, 101, 114, 32, 83,
+            99, 114, 111, 108, 108, 115, 32, 73, 73, 73, 58, 32, 77, 111, 114, 114, 111, 119, 105, 110,
+            100, 58, 32, 71, 97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 89, 101, 97, 114, 32,
+            69, 100, 105, 116, 105, 111, 110, 73, 72, 82, 65, 32, 68, 114, 97, 103, 32, 82, 97, 99,
+            105, 110, 103, 32, 50, 48, 48, 52, 67, 97, 108, 108, 32, 111, 102, 32, 67, 116, 104, 117,
+            108, 104, 117, 58, 32, 68, 97, 114, 107, 32, 67, 111, 114, 110, 101, 114, 115, 32, 111, 102,
+            32, 116, 104, 101, 32, 69, 97, 114, 116, 104, 65, 77, 70, 32, 66, 111, 119, 108, 105, 110,
+            103, 32, 50, 48, 48, 52, 77, 97, 108, 105, 99, 101, 80, 111, 119, 101, 114, 100, 114, 111,
+            109, 101, 73, 72, 82, 65, 32, 80, 114, 111, 102, 101, 115, 115, 105, 111, 110, 97, 108, 32,
+            68, 114, 97, 103, 32, 82, 97, 99, 105, 110, 103, 32, 50, 48, 48, 53, 72, 105, 103, 104,
+            32, 82, 111, 108, 108, 101, 114, 115, 32, 67, 97, 115, 105, 110, 111, 73, 72, 82, 65, 32,
+            68, 114, 97, 103, 32, 82, 97, 99, 105, 110, 103, 58, 32, 83, 112, 111, 114, 116, 115, 109,
+            97, 110, 32, 69, 100, 105, 116, 105, 111, 110, 66, 114, 101, 101, 100, 101, 114, 115, 39, 32,
+            67, 117, 112, 58, 32, 87, 111, 114, 108, 100, 32, 84, 104, 111, 114, 111, 117, 103, 104, 98,
+            114, 101, 100, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 115, 65, 77, 70,
+            32, 88, 116, 114, 101, 109, 101, 32, 66, 111, 119, 108, 105, 110, 103, 79, 98, 108, 105, 118,
+            105, 111, 110, 82, 111, 103, 117, 101, 32, 87, 97, 114, 114, 105, 111, 114, 70, 97, 108, 108,
+            111, 117, 116, 32, 51, 72, 117, 110, 116, 101, 100, 32, 68, 101, 109, 111, 110, 39, 115, 32,
+            70, 111, 114, 103, 101, 66, 114, 105, 110, 107, 87, 69, 84, 70, 97, 108, 108, 111, 117, 116,
+            32, 45, 32, 78, 101, 119, 32, 86, 101, 103, 97, 115, 68, 105, 115, 104, 111, 110, 111, 114,
+            101, 100, 80, 114, 101, 121, 32, 50, 83, 107, 121, 114, 105, 109, 82, 65, 71, 69, 68, 79,
+            79, 77, 32, 51, 32, 66, 70, 71, 32, 69, 100, 105, 116, 105, 111, 110, 68, 105, 115, 104,
+            111, 110, 111, 114, 101, 100, 32, 71, 79, 84, 89, 32, 69, 100, 105, 116, 105, 111, 110, 84,
+            104, 101, 32, 69, 118, 105, 108, 32, 87, 105, 116, 104, 105, 110, 87, 111, 108, 102, 101, 110,
+            115, 116, 101, 105, 110, 32, 45, 32, 84, 104, 101, 32, 78, 101, 119, 32, 79, 114, 100, 101,
+            114, 83, 112, 97, 99, 101, 32, 67, 104, 105, 109, 112, 115, 68, 111, 117, 98, 108, 101, 45,
+            83, 46, 84, 46, 69, 46, 65, 46, 76, 68, 111, 117, 98, 108, 101, 45, 83, 46, 84, 46,
+            69, 46, 65, 46, 76, 58, 32, 84, 104, 101, 32, 83, 101, 99, 111, 110, 100, 32, 67, 108,
+            97, 115, 104, 84, 114, 111, 110, 32, 50, 46, 48, 58, 32, 75, 105, 108, 108, 101, 114, 32,
+            65, 112, 112, 68, 105, 115, 110, 101, 121, 115, 32, 72, 105, 109, 109, 101, 108, 32, 117, 110,
+            100, 32, 72, 117, 104, 110, 68, 105, 101, 32, 67, 104, 114, 111, 110, 105, 107, 101, 110, 32,
+            118, 111, 110, 32, 78, 97, 114, 110, 105, 97, 58, 32, 68, 101, 114, 32, 75, 246, 110, 105,
+            103, 32, 118, 111, 110, 32, 78, 97, 114, 110, 105, 97, 84, 105, 109, 32, 66, 117, 114, 116,
+            111, 110, 39, 115, 32, 84, 104, 101, 32, 78, 105, 103, 104, 116, 109, 97, 114, 101, 32, 66,
+            101, 102, 111, 114, 101, 32, 67, 104, 114, 105, 115, 116, 109, 97, 115, 58, 32, 79, 111, 103,
+            105, 101, 39, 115, 32, 82, 101, 118, 101, 110, 103, 101, 65, 116, 32, 87, 111, 114, 108, 100,
+            39, 115, 32, 69, 110, 100, 84, 117, 114, 111, 107, 77, 101, 101, 116, 32, 116, 104, 101, 32,
+            82, 111, 98, 105, 110, 115, 111, 110, 115, 80, 117, 114, 101, 78, 97, 114, 110, 105, 97, 32,
+            45, 32, 80, 114, 105, 110, 99, 101, 32, 67, 97, 115, 112, 105, 97, 110, 68, 105, 115, 110,
+            101, 121, 32, 66, 111, 108, 116, 72, 105, 103, 104, 32, 83, 99, 104, 111, 111, 108, 32, 77,
+            117, 115, 105, 99, 97, 108, 32, 51, 32, 83, 101, 110, 105, 111, 114, 32, 89, 101, 97, 114,
+            32, 68, 97, 110, 99, 101, 68, 105, 115, 110, 101, 121, 32, 83, 105, 110, 103, 32, 73, 116,
+            84, 111, 121, 32, 83, 116, 111, 114, 121, 32, 51, 68, 105, 115, 110, 101, 121, 32, 83, 105,
+            110, 103, 32, 73, 116, 32, 45, 32, 72, 105, 103, 104, 32, 83, 99, 104, 111, 111, 108, 32,
+            77, 117, 115, 105, 99, 97, 108, 32, 51, 83, 112, 108, 105, 116, 47, 83, 101, 99, 111, 110,
+            100, 71, 45, 70, 111, 114, 99, 101, 72, 97, 110, 110, 97, 104, 32, 84, 104, 101, 32, 77,
+            111, 118, 105, 101, 84, 114, 111, 110, 32, 45, 32, 69, 118, 111, 108, 117, 116, 105, 111, 110,
+            67, 97, 114, 115, 32, 50, 32, 45, 32, 84, 104, 101, 32, 86, 105, 100, 101, 111, 32, 71,
+            97, 109, 101, 76, 69, 71, 79, 32, 80, 105, 114, 97, 116, 101, 115, 32, 111, 102, 32, 116,
+            104, 101, 32, 67, 97, 114, 105, 98, 98, 101, 97, 110, 32, 45, 32, 84, 104, 101, 32, 86,
+            105, 100, 101, 111, 32, 71, 97, 109, 101, 68, 105, 115, 110, 101, 121, 32, 85, 110, 105, 118,
+            101, 114, 115, 101, 68, 105, 115, 110, 101, 121, 32, 80, 104, 105, 110, 101, 97, 115, 32, 38,
+            32, 70, 101, 114, 98, 68, 105, 115, 110, 101, 121, 32, 69, 112, 105, 99, 32, 77, 105, 99,
+            107, 101, 121, 32, 50, 32, 45, 32, 84, 104, 101, 32, 80, 111, 119, 101, 114, 32, 111, 102,
+            32, 84, 119, 111, 66, 114, 97, 118, 101, 32, 45, 32, 84, 104, 101, 32, 86, 105, 100, 101,
+            111, 32, 71, 97, 109, 101, 84, 111, 121, 32, 83, 116, 111, 114, 121, 32, 77, 97, 110, 105,
+            97, 33, 68, 105, 115, 110, 101, 121, 32, 73, 110, 102, 105, 110, 105, 116, 121, 70, 97, 110,
+            116, 97, 115, 105, 97, 32, 45, 32, 77, 117, 115, 105, 99, 32, 69, 118, 111, 108, 118, 101,
+            100, 68, 105, 115, 110, 101, 121, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 50, 46, 48,
+            68, 105, 115, 110, 101, 121, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 51, 46, 48, 82,
+            111, 98, 111, 116, 32, 87, 97, 114, 115, 58, 32, 69, 120, 116, 114, 101, 109, 101, 32, 68,
+            101, 115, 116, 114, 117, 99, 116, 105, 111, 110, 86, 97, 109, 112, 105, 114, 101, 32, 82, 97,
+            105, 110, 71, 101, 110, 109, 97, 32, 79, 110, 105, 109, 117, 115, 104, 97, 83, 116, 101, 101,
+            108, 32, 66, 97, 116, 116, 97, 108, 105, 111, 110, 68, 105, 110, 111, 32, 67, 114, 105, 115,
+            105, 115, 32, 51, 85, 70, 67, 58, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 70, 105,
+            103, 104, 116, 105, 110, 103, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 58,
+            32, 84, 97, 112, 111, 117, 116, 32, 50, 71, 114, 111, 117, 112, 32, 83, 32, 67, 104, 97,
+            108, 108, 101, 110, 103, 101, 77, 97, 114, 118, 101, 108, 32, 118, 115, 46, 32, 67, 97, 112,
+            99, 111, 109, 32, 50, 58, 32, 78, 101, 119, 32, 65, 103, 101, 32, 111, 102, 32, 72, 101,
+            114, 111, 101, 115, 67, 97, 112, 99, 111, 109, 32, 118, 115, 46, 32, 83, 78, 75, 32, 50,
+            32, 69, 79, 58, 32, 77, 97, 114, 107, 32, 111, 102, 32, 116, 104, 101, 32, 77, 105, 108,
+            108, 101, 110, 110, 105, 117, 109, 32, 50, 48, 48, 49, 84, 101, 107, 107, 105, 32, 84, 97,
+            105, 115, 101, 110, 58, 32, 83, 116, 101, 101, 108, 32, 66, 97, 116, 116, 97, 108, 105, 111,
+            110, 58, 32, 76, 105, 110, 101, 32, 111, 102, 32, 67, 111, 110, 116, 97, 99, 116, 83, 112,
+            105, 100, 101, 114, 45, 77, 97, 110, 80, 114, 111, 32, 67, 97, 115, 116, 58, 32, 83, 112,
+            111, 114, 116, 115, 32, 70, 105, 115, 104, 105, 110, 103, 32, 71, 97, 109, 101, 82, 111, 98,
+            105, 110, 32, 72, 111, 111, 100, 58, 32, 68, 101, 102, 101, 110, 100, 101, 114, 32, 111, 102,
+            32, 116, 104, 101, 32, 67, 114, 111, 119, 110, 65, 117, 116, 111, 32, 77, 111, 100, 101, 108,
+            108, 105, 115, 116, 97, 83, 116, 114, 101, 101, 116, 32, 70, 105, 103, 104, 116, 101, 114, 32,
+            65, 110, 110, 105, 118, 101, 114, 115, 97, 114, 121, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            111, 110, 67, 97, 112, 99, 111, 109, 32, 70, 105, 103, 104, 116, 105, 110, 103, 32, 69, 118,
+            111, 108, 117, 116, 105, 111, 110, 32, 126, 32, 67, 97, 112, 99, 111, 109, 32, 70, 105, 103,
+            104, 116, 105, 110, 103, 32, 74, 97, 109, 77, 101, 103, 97, 32, 77, 97, 110, 32, 65, 110,
+            110, 105, 118, 101, 114, 115, 97, 114, 121, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110,
+            70, 105, 110, 97, 108, 32, 70, 105, 103, 104, 116, 58, 32, 83, 116, 114, 101, 101, 116, 119,
+            105, 115, 101, 87, 105, 116, 104, 111, 117, 116, 32, 87, 97, 114, 110, 105, 110, 103, 66, 101,
+            97, 116, 32, 68, 111, 119, 110, 58, 32, 70, 105, 115, 116, 115, 32, 111, 102, 32, 86, 101,
+            110, 103, 101, 97, 110, 99, 101, 68, 97, 114, 107, 119, 97, 116, 99, 104, 67, 97, 112, 99,
+            111, 109, 32, 67, 108, 97, 115, 115, 105, 99, 115, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            111, 110, 32, 86, 111, 108, 46, 32, 49, 67, 97, 112, 99, 111, 109, 32, 67, 108, 97, 115,
+            115, 105, 99, 115, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 32, 86, 111, 108, 46,
+            32, 50, 68, 101, 97, 100, 32, 82, 105, 115, 105, 110, 103, 76, 79, 83, 84, 32, 80, 76,
+            65, 78, 69, 84, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69, 118, 105, 108, 32, 53, 66,
+            105, 111, 110, 105, 99, 32, 67, 111, 109, 109, 97, 110, 100, 111, 76, 79, 83, 84, 32, 80,
+            76, 65, 78, 69, 84, 32, 67, 79, 76, 79, 78, 73, 69, 83, 68, 101, 118, 105, 108, 32,
+            77, 97, 121, 32, 67, 114, 121, 32, 52, 68, 97, 114, 107, 32, 86, 111, 105, 100, 83, 116,
+            114, 101, 101, 116, 32, 70, 105, 103, 104, 116, 101, 114, 32, 73, 86, 77, 111, 116, 111, 71,
+            80, 32, 48, 56, 68, 101, 97, 100, 32, 82, 105, 115, 105, 110, 103, 32, 50, 76, 79, 83,
+            84, 32, 80, 76, 65, 78, 69, 84, 32, 50, 77, 111, 116, 111, 103, 112, 32, 48, 57, 47,
+            49, 48, 83, 117, 112, 101, 114, 32, 83, 116, 114, 101, 101, 116, 102, 105, 103, 104, 116, 101,
+            114, 32, 73, 86, 32, 65, 114, 99, 97, 100, 101, 32, 69, 100, 105, 116, 105, 111, 110, 77,
+            97, 114, 118, 101, 108, 32, 86, 115, 46, 32, 67, 97, 112, 99, 111, 109, 32, 51, 77, 111,
+            116, 111, 103, 112, 32, 49, 48, 47, 49, 49, 83, 116, 114, 101, 101, 116, 32, 70, 105, 103,
+            104, 116, 101, 114, 32, 88, 32, 84, 101, 107, 107, 101, 110, 68, 114, 97, 103, 111, 110, 39,
+            115, 32, 68, 111, 103, 109, 97, 32, 45, 32, 68, 97, 114, 107, 32, 65, 114, 105, 115, 101,
+            110, 83, 116, 101, 101, 108, 32, 66, 97, 116, 116, 97, 108, 105, 111, 110, 32, 45, 32, 72,
+            101, 97, 118, 121, 32, 65, 114, 109, 111, 114, 65, 115, 117, 114, 97, 39, 115, 32, 87, 114,
+            97, 116, 104, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69, 118, 105, 108, 32, 54, 82, 101,
+            115, 105, 100, 101, 110, 116, 32, 69, 118, 105, 108, 32, 52, 82, 101, 115, 105, 100, 101, 110,
+            116, 32, 69, 118, 105, 108, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 82, 97, 99,
+            99, 111, 111, 110, 32, 67, 105, 116, 121, 68, 101, 118, 105, 108, 32, 77, 97, 121, 32, 67,
+            114, 121, 32, 45, 32, 72, 68, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 68, 101,
+            97, 100, 32, 82, 105, 115, 105, 110, 103, 32, 50, 32, 45, 32, 79, 102, 102, 32, 84, 104,
+            101, 32, 82, 101, 99, 111, 114, 100, 85, 46, 32, 77, 97, 114, 118, 101, 108, 32, 86, 115,
+            46, 32, 67, 97, 112, 99, 111, 109, 32, 51, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69,
+            118, 105, 108, 32, 67, 111, 100, 101, 32, 45, 32, 86, 101, 114, 111, 110, 105, 99, 97, 32,
+            88, 68, 101, 118, 105, 108, 32, 77, 97, 121, 32, 67, 114, 121, 67, 65, 80, 67, 79, 77,
+            32, 68, 105, 103, 105, 116, 97, 108, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 82,
+            101, 109, 101, 109, 98, 101, 114, 32, 77, 101, 76, 111, 115, 116, 32, 80, 108, 97, 110, 101,
+            116, 32, 51, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69, 118, 105, 108, 32, 82, 101, 118,
+            101, 108, 97, 116, 105, 111, 110, 115, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69, 118, 105,
+            108, 82, 101, 115, 105, 100, 101, 110, 116, 32, 69, 118, 105, 108, 32, 48, 68, 105, 118, 105,
+            110, 105, 116, 121, 32, 73, 73, 68, 97, 105, 115, 101, 110, 114, 121, 97, 107, 117, 32, 86,
+            73, 73, 67, 111, 108, 105, 110, 32, 77, 99, 82, 97, 101, 32, 82, 97, 108, 108, 121, 32,
+            51, 84, 79, 67, 65, 32, 82, 97, 99, 101, 32, 68, 114, 105, 118, 101, 114, 77, 105, 107,
+            101, 32, 84, 121, 115, 111, 110, 32, 72, 101, 97, 118, 121, 119, 101, 105, 103, 104, 116, 32,
+            66, 111, 120, 105, 110, 103, 66, 68, 70, 76, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50,
+            48, 48, 51, 73, 110, 100, 121, 67, 97, 114, 32, 83, 101, 114, 105, 101, 115, 80, 114, 105,
+            115, 111, 110, 101, 114, 32, 111, 102, 32, 87, 97, 114, 67, 108, 117, 98, 32, 70, 111, 111,
+            116, 98, 97, 108, 108, 58, 32, 65, 67, 32, 77, 105, 108, 97, 110, 87, 111, 114, 108, 100,
+            32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 83, 110, 111, 111, 107, 101,
+            114, 32, 50, 48, 48, 51, 86, 56, 32, 83, 117, 112, 101, 114, 99, 97, 114, 115, 32, 65,
+            117, 115, 116, 114, 97, 108, 105, 97, 58, 32, 82, 97, 99, 101, 32, 68, 114, 105, 118, 101,
+            114, 82, 111, 103, 101, 114, 32, 76, 101, 109, 101, 114, 114, 101, 58, 32, 76, 97, 32, 83,
+            233, 108, 101, 99, 116, 105, 111, 110, 32, 100, 101, 115, 32, 67, 104, 97, 109, 112, 105, 111,
+            110, 115, 32, 50, 48, 48, 52, 67, 111, 108, 105, 110, 32, 77, 99, 82, 97, 101, 32, 82,
+            97, 108, 108, 121, 32, 48, 52, 68, 84, 77, 32, 82, 97, 99, 101, 32, 68, 114, 105, 118,
+            101, 114, 32, 50, 58, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 82, 97, 99, 105, 110,
+            103, 32, 83, 105, 109, 117, 108, 97, 116, 111, 114, 67, 108, 117, 98, 32, 70, 111, 111, 116,
+            98, 97, 108, 108, 58, 32, 65, 106, 97, 120, 32, 65, 109, 115, 116, 101, 114, 100, 97, 109,
+            67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 65, 114, 115, 101, 110,
+            97, 108, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 65, 115, 116,
+            111, 110, 32, 86, 105, 108, 108, 97, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108,
+            108, 58, 32, 70, 67, 32, 66, 97, 114, 99, 101, 108, 111, 110, 97, 67, 108, 117, 98, 32,
+            70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 70, 67, 32, 66, 97, 121, 101, 114, 110, 32,
+            77, 252, 110, 99, 104, 101, 110, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            58, 32, 66, 111, 114, 117, 115, 115, 105, 97, 32, 68, 111, 114, 116, 109, 117, 110, 100, 67,
+            108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 67, 101, 108, 116, 105, 99,
+            32, 70, 67, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 67, 104,
+            101, 108, 115, 101, 97, 32, 70, 67, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108,
+            108, 58, 32, 70, 67, 32, 73, 110, 116, 101, 114, 110, 97, 122, 105, 111, 110, 97, 108, 101,
+            67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 74, 117, 118, 101, 110,
+            116, 117, 115, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 76, 101,
+            101, 100, 115, 32, 85, 110, 105, 116, 101, 100, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98,
+            97, 108, 108, 58, 32, 76, 105, 118, 101, 114, 112, 111, 111, 108, 32, 70, 67, 67, 108, 117,
+            98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 76, 105, 118, 101, 114, 112, 111, 111,
+            108, 32, 70, 67, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 77,
+            97, 110, 99, 104, 101, 115, 116, 101, 114, 32, 85, 110, 105, 116, 101, 100, 67, 108, 117, 98,
+            32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 82, 97, 110, 103, 101, 114, 115, 32, 70,
+            67, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 58, 32, 82, 101, 97, 108,
+            32, 77, 97, 100, 114, 105, 100, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            58, 32, 72, 97, 109, 98, 117, 114, 103, 101, 114, 32, 83, 86, 73, 110, 100, 121, 67, 97,
+            114, 32, 83, 101, 114, 105, 101, 115, 32, 50, 48, 48, 53, 69, 110, 103, 108, 97, 110, 100,
+            32, 73, 110, 116, 101, 114, 110, 97, 116, 105, 111, 110, 97, 108, 32, 70, 111, 111, 116, 98,
+            97, 108, 108, 58, 32, 50, 48, 48, 52, 32, 69, 100, 105, 116, 105, 111, 110, 77, 84, 86,
+            32, 77, 117, 115, 105, 99, 32, 71, 101, 110, 101, 114, 97, 116, 111, 114, 32, 51, 87, 111,
+            114, 108, 100, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 83, 110, 111,
+            111, 107, 101, 114, 32, 50, 48, 48, 52, 67, 111, 108, 105, 110, 32, 77, 99, 82, 97, 101,
+            32, 82, 97, 108, 108, 121, 32, 50, 48, 48, 53, 67, 108, 117, 98, 32, 70, 111, 111, 116,
+            98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 77, 97, 110, 99, 104, 101, 115, 116, 101,
+            114, 32, 85, 110, 105, 116, 101, 100, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108,
+            108, 32, 50, 48, 48, 53, 58, 32, 76, 105, 118, 101, 114, 112, 111, 111, 108, 32, 70, 67,
+            67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32,
+            65, 114, 115, 101, 110, 97, 108, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            32, 50, 48, 48, 53, 58, 32, 67, 104, 101, 108, 115, 101, 97, 32, 70, 67, 67, 108, 117,
+            98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 65, 115, 116,
+            111, 110, 32, 86, 105, 108, 108, 97, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108,
+            108, 32, 50, 48, 48, 53, 58, 32, 67, 101, 108, 116, 105, 99, 32, 70, 67, 67, 108, 117,
+            98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 82, 97, 110,
+            103, 101, 114, 115, 32, 70, 67, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            32, 50, 48, 48, 53, 58, 32, 82, 101, 97, 108, 32, 77, 97, 100, 114, 105, 100, 67, 108,
+            117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 70, 67,
+            32, 66, 97, 114, 99, 101, 108, 111, 110, 97, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98,
+            97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 65, 106, 97, 120, 32, 65, 109, 115, 116, 101,
+            114, 100, 97, 109, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48,
+            48, 53, 58, 32, 65, 67, 32, 77, 105, 108, 97, 110, 67, 108, 117, 98, 32, 70, 111, 111,
+            116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 70, 67, 32, 73, 110, 116, 101, 114,
+            110, 97, 122, 105, 111, 110, 97, 108, 101, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97,
+            108, 108, 32, 50, 48, 48, 53, 58, 32, 74, 117, 118, 101, 110, 116, 117, 115, 67, 108, 117,
+            98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 72, 97, 109,
+            98, 117, 114, 103, 101, 114, 32, 83, 86, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97,
+            108, 108, 32, 50, 48, 48, 53, 58, 32, 70, 67, 32, 66, 97, 121, 101, 114, 110, 32, 77,
+            252, 110, 99, 104, 101, 110, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32,
+            50, 48, 48, 53, 58, 32, 66, 111, 114, 117, 115, 115, 105, 97, 32, 68, 111, 114, 116, 109,
+            117, 110, 100, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48,
+            53, 58, 32, 78, 101, 119, 99, 97, 115, 116, 108, 101, 32, 85, 110, 105, 116, 101, 100, 67,
+            108, 117, 98, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 66,
+            105, 114, 109, 105, 110, 103, 104, 97, 109, 32, 67, 105, 116, 121, 67, 108, 117, 98, 32, 70,
+            111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 84, 111, 116, 116, 101, 110,
+            104, 97, 109, 32, 72, 111, 116, 115, 112, 117, 114, 67, 108, 117, 98, 32, 70, 111, 111, 116,
+            98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 80, 97, 114, 105, 115, 32, 83, 97, 105,
+            110, 116, 45, 71, 101, 114, 109, 97, 105, 110, 67, 108, 117, 98, 32, 70, 111, 111, 116, 98,
+            97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 79, 108, 121, 109, 112, 105, 113, 117, 101, 32,
+            100, 101, 32, 77, 97, 114, 115, 101, 105, 108, 108, 101, 67, 108, 117, 98, 32, 70, 111, 111,
+            116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 58, 32, 76, 105, 118, 101, 114, 112, 111, 111,
+            108, 32, 70, 67, 76, 77, 65, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48, 53,
+            83, 101, 99, 111, 110, 100, 32, 83, 105, 103, 104, 116, 77, 97, 110, 99, 104, 101, 115, 116,
+            101, 114, 32, 85, 110, 105, 116, 101, 100, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48,
+            48, 53, 66, 68, 70, 76, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48, 53, 82,
+            111, 103, 101, 114, 32, 76, 101, 109, 101, 114, 114, 101, 58, 32, 76, 97, 32, 83, 233, 108,
+            101, 99, 116, 105, 111, 110, 32, 100, 101, 115, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115,
+            32, 50, 48, 48, 53, 70, 111, 111, 116, 98, 97, 108, 108, 32, 77, 97, 110, 97, 103, 101,
+            114, 32, 67, 97, 109, 112, 105, 111, 110, 97, 116, 111, 32, 50, 48, 48, 53, 77, 225, 110,
+            97, 103, 101, 114, 32, 100, 101, 32, 76, 105, 103, 97, 32, 50, 48, 48, 53, 66, 114, 105,
+            97, 110, 32, 76, 97, 114, 97, 32, 73, 110, 116, 101, 114, 110, 97, 116, 105, 111, 110, 97,
+            108, 32, 67, 114, 105, 99, 107, 101, 116, 32, 50, 48, 48, 53, 68, 84, 77, 32, 82, 97,
+            99, 101, 32, 68, 114, 105, 118, 101, 114, 32, 51, 87, 111, 114, 109, 115, 32, 52, 58, 32,
+            77, 97, 121, 104, 101, 109, 76, 77, 65, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48,
+            48, 54, 82, 105, 99, 107, 121, 32, 80, 111, 110, 116, 105, 110, 103, 32, 73, 110, 116, 101,
+            114, 110, 97, 116, 105, 111, 110, 97, 108, 32, 67, 114, 105, 99, 107, 101, 116, 32, 50, 48,
+            48, 53, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 70, 108, 97, 115, 104, 112, 111, 105,
+            110, 116, 58, 32, 69, 108, 105, 116, 101, 83, 101, 110, 115, 105, 98, 108, 101, 32, 83, 111,
+            99, 99, 101, 114, 32, 50, 48, 48, 54, 76, 109, 97, 32, 77, 97, 110, 97, 103, 101, 114,
+            32, 50, 48, 48, 55, 79, 118, 101, 114, 108, 111, 114, 100, 73, 99, 99, 32, 67, 114, 105,
+            99, 107, 101, 116, 32, 50, 48, 48, 55, 68, 105, 82, 84, 82, 105, 115, 101, 32, 111, 102,
+            32, 116, 104, 101, 32, 65, 114, 103, 111, 110, 97, 117, 116, 115, 84, 117, 114, 110, 105, 110,
+            103, 32, 80, 111, 105, 110, 116, 67, 108, 105, 118, 101, 32, 66, 97, 114, 107, 101, 114, 39,
+            115, 32, 74, 101, 114, 105, 99, 104, 111, 71, 82, 73, 68, 68, 97, 109, 110, 97, 116, 105,
+            111, 110, 89, 111, 117, 39, 114, 101, 32, 73, 110, 32, 84, 104, 101, 32, 77, 111, 118, 105,
+            101, 115, 79, 118, 101, 114, 108, 111, 114, 100, 32, 73, 73, 70, 85, 69, 76, 79, 112, 101,
+            114, 97, 116, 105, 111, 110, 32, 70, 108, 97, 115, 104, 112, 111, 105, 110, 116, 32, 45, 32,
+            68, 114, 97, 103, 111, 110, 32, 82, 105, 115, 105, 110, 103, 68, 105, 82, 84, 32, 50, 76,
+            101, 105, 115, 117, 114, 101, 32, 83, 117, 105, 116, 32, 76, 97, 114, 114, 121, 65, 115, 104,
+            101, 115, 32, 67, 114, 105, 99, 107, 101, 116, 32, 50, 48, 48, 57, 70, 49, 32, 50, 48,
+            49, 48, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 70, 108, 97, 115, 104, 112, 111, 105,
+            110, 116, 32, 45, 32, 82, 101, 100, 32, 82, 105, 118, 101, 114, 66, 111, 100, 121, 99, 111,
+            117, 110, 116, 68, 105, 82, 84, 32, 51, 70, 49, 32, 50, 48, 49, 49, 71, 82, 73, 68,
+            32, 50, 68, 105, 82, 84, 32, 83, 104, 111, 119, 100, 111, 119, 110, 70, 49, 32, 50, 48,
+            49, 50, 70, 49, 32, 82, 65, 67, 69, 32, 83, 84, 65, 82, 83, 70, 49, 32, 50, 48,
+            49, 51, 71, 82, 73, 68, 32, 65, 117, 116, 111, 115, 112, 111, 114, 116, 70, 49, 32, 50,
+            48, 49, 52, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 79, 98, 105, 45, 87, 97,
+            110, 75, 97, 98, 117, 107, 105, 32, 87, 97, 114, 114, 105, 111, 114, 115, 85, 70, 67, 58,
+            32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 70, 105, 103, 104, 116, 105, 110, 103, 32, 67,
+            104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 58, 32, 84, 97, 112, 111, 117, 116, 77,
+            111, 106, 111, 33, 73, 110, 116, 101, 108, 108, 105, 118, 105, 115, 105, 111, 110, 32, 76, 105,
+            118, 101, 115, 33, 70, 117, 116, 117, 114, 101, 32, 84, 97, 99, 116, 105, 99, 115, 58, 32,
+            84, 104, 101, 32, 85, 112, 114, 105, 115, 105, 110, 103, 83, 116, 114, 105, 107, 101, 32, 70,
+            111, 114, 99, 101, 32, 66, 111, 119, 108, 105, 110, 103, 84, 114, 105, 103, 103, 101, 114, 32,
+            77, 97, 110, 80, 105, 110, 98, 97, 108, 108, 32, 72, 97, 108, 108, 32, 111, 102, 32, 70,
+            97, 109, 101, 58, 32, 84, 104, 101, 32, 71, 111, 116, 116, 108, 105, 101, 98, 32, 67, 111,
+            108, 108, 101, 99, 116, 105, 111, 110, 87, 111, 114, 108, 100, 32, 67, 104, 97, 109, 112, 105,
+            111, 110, 115, 104, 105, 112, 32, 80, 111, 107, 101, 114, 77, 88, 32, 87, 111, 114, 108, 100,
+            32, 84, 111, 117, 114, 32, 102, 101, 97, 116, 117, 114, 105, 110, 103, 32, 74, 97, 109, 105,
+            101, 32, 76, 105, 116, 116, 108, 101, 87, 111, 114, 108, 100, 32, 67, 104, 97, 109, 112, 105,
+            111, 110, 115, 104, 105, 112, 32, 80, 111, 107, 101, 114, 32, 50, 32, 102, 101, 97, 116, 117,
+            114, 105, 110, 103, 32, 72, 111, 119, 97, 114, 100, 32, 76, 101, 100, 101, 114, 101, 114, 84,
+            104, 101, 32, 66, 105, 98, 108, 101, 32, 71, 97, 109, 101, 66, 114, 117, 110, 115, 119, 105,
+            99, 107, 32, 80, 114, 111, 32, 66, 111, 119, 108, 105, 110, 103, 67, 97, 114, 116, 111, 111,
+            110, 32, 78, 101, 116, 119, 111, 114, 107, 32, 80, 84, 69, 32, 45, 32, 88, 76, 83, 110,
+            105, 112, 101, 114, 32, 45, 32, 71, 104, 111, 115, 116, 32, 87, 97, 114, 114, 105, 111, 114,
+            67, 111, 109, 98, 97, 116, 32, 87, 105, 110, 103, 115, 32, 45, 32, 71, 98, 119, 119, 105,
+            105, 83, 110, 105, 112, 101, 114, 32, 45, 32, 71, 104, 111, 115, 116, 32, 87, 97, 114, 114,
+            105, 111, 114, 32, 50, 69, 110, 101, 109, 121, 32, 70, 114, 111, 110, 116, 68, 101, 97, 116,
+            104, 83, 109, 105, 108, 101, 115, 32, 50, 88, 74, 117, 114, 97, 115, 115, 105, 99, 32, 80,
+            97, 114, 107, 32, 45, 32, 84, 104, 101, 32, 71, 97, 109, 101, 84, 104, 101, 32, 87, 97,
+            108, 107, 105, 110, 103, 32, 68, 101, 97, 100, 32, 45, 32, 83, 101, 97, 115, 111, 110, 32,
+            84, 119, 111, 66, 97, 99, 107, 32, 116, 111, 32, 116, 104, 101, 32, 70, 117, 116, 117, 114,
+            101, 32, 45, 32, 84, 104, 101, 32, 71, 97, 109, 101, 84, 104, 101, 32, 74, 97, 99, 107,
+            98, 111, 120, 32, 80, 97, 114, 116, 121, 32, 80, 97, 99, 107, 65, 114, 120, 32, 70, 97,
+            116, 97, 108, 105, 115, 80, 97, 105, 110, 107, 105, 108, 108, 101, 114, 58, 32, 72, 101, 108,
+            108, 32, 87, 97, 114, 115, 67, 111, 108, 100, 32, 87, 97, 114, 83, 116, 111, 107, 101, 100,
+            83, 116, 111, 107, 101, 100, 32, 45, 32, 66, 105, 103, 32, 65, 105, 114, 32, 69, 100, 46,
+            65, 118, 97, 116, 97, 114, 32, 84, 111, 121, 32, 65, 114, 109, 111, 114, 121, 69, 97, 114,
+            116, 104, 32, 68, 101, 102, 101, 110, 115, 101, 32, 70, 111, 114, 99, 101, 32, 50, 48, 49,
+            55, 68, 97, 114, 107, 32, 83, 101, 99, 116, 111, 114, 79, 110, 101, 99, 104, 97, 110, 98,
+            97, 114, 97, 69, 97, 116, 32, 76, 101, 97, 100, 66, 101, 110, 32, 49, 48, 32, 45, 32,
+            86, 105, 108, 103, 97, 120, 32, 65, 116, 116, 97, 99, 107, 115, 66, 101, 110, 32, 49, 48,
+            32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 65, 108, 105, 101, 110, 69, 97, 114, 116, 104,
+            32, 68, 101, 102, 101, 110, 115, 101, 32, 70, 111, 114, 99, 101, 32, 45, 32, 73, 65, 86,
+            105, 99, 116, 111, 114, 105, 111, 117, 115, 32, 45, 32, 84, 105, 109, 101, 32, 116, 111, 32,
+            83, 104, 105, 110, 101, 66, 101, 110, 32, 49, 48, 32, 71, 97, 108, 97, 99, 116, 105, 99,
+            32, 82, 97, 99, 105, 110, 103, 77, 97, 100, 97, 103, 97, 115, 99, 97, 114, 32, 51, 32,
+            45, 32, 84, 104, 101, 32, 86, 105, 100, 101, 111, 32, 71, 97, 109, 101, 66, 101, 110, 32,
+            49, 48, 32, 79, 109, 110, 105, 118, 101, 114, 115, 101, 82, 105, 115, 101, 32, 111, 102, 32,
+            116, 104, 101, 32, 71, 117, 97, 114, 100, 105, 97, 110, 115, 84, 111, 112, 32, 72, 97, 110,
+            100, 32, 82, 111, 100, 101, 111, 32, 84, 111, 117, 114, 69, 97, 114, 116, 104, 32, 68, 101,
+            102, 101, 110, 115, 101, 32, 70, 111, 114, 99, 101, 32, 50, 48, 50, 53, 84, 117, 114, 98,
+            111, 32, 45, 32, 83, 117, 112, 101, 114, 32, 83, 116, 117, 110, 116, 32, 83, 113, 117, 97,
+            100, 65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 84, 105, 109, 101, 32, 45, 32, 69, 120,
+            112, 108, 111, 114, 101, 66, 101, 110, 32, 49, 48, 32, 79, 109, 110, 105, 118, 101, 114, 115,
+            101, 32, 50, 86, 101, 110, 101, 116, 105, 99, 97, 68, 105, 118, 105, 110, 105, 116, 121, 32,
+            73, 105, 71, 114, 97, 121, 32, 77, 97, 116, 116, 101, 114, 67, 114, 97, 115, 104, 32, 84,
+            105, 109, 101, 32, 52, 32, 45, 32, 84, 104, 101, 32, 83, 121, 110, 100, 105, 99, 97, 116,
+            101, 87, 105, 110, 116, 101, 114, 32, 83, 112, 111, 114, 116, 115, 32, 50, 48, 49, 49, 77,
+            105, 97, 109, 105, 32, 86, 105, 99, 101, 80, 101, 114, 115, 111, 110, 97, 32, 52, 32, 65,
+            114, 101, 110, 97, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 50, 48, 48, 50, 78,
+            65, 83, 67, 65, 82, 32, 84, 104, 117, 110, 100, 101, 114, 32, 50, 48, 48, 50, 78, 66,
+            65, 32, 76, 105, 118, 101, 32, 50, 48, 48, 50, 83, 83, 88, 32, 84, 114, 105, 99, 107,
+            121, 78, 72, 76, 32, 50, 48, 48, 50, 70, 49, 32, 50, 48, 48, 49, 84, 114, 105, 112,
+            108, 101, 32, 80, 108, 97, 121, 32, 50, 48, 48, 50, 75, 110, 111, 99, 107, 111, 117, 116,
+            32, 75, 105, 110, 103, 115, 32, 50, 48, 48, 50, 50, 48, 48, 50, 32, 70, 73, 70, 65,
+            32, 87, 111, 114, 108, 100, 32, 67, 117, 112, 48, 48, 55, 58, 32, 65, 103, 101, 110, 116,
+            32, 85, 110, 100, 101, 114, 32, 70, 105, 114, 101, 72, 97, 114, 114, 121, 32, 80, 111, 116,
+            116, 101, 114, 32, 97, 110, 100, 32, 116, 104, 101, 32, 67, 104, 97, 109, 98, 101, 114, 32,
+            111, 102, 32, 83, 101, 99, 114, 101, 116, 115, 84, 104, 101, 32, 76, 111, 114, 100, 32, 111,
+            102, 32, 116, 104, 101, 32, 82, 105, 110, 103, 115, 58, 32, 84, 104, 101, 32, 84, 119, 111,
+            32, 84, 111, 119, 101, 114, 115, 67, 101, 108, 32, 68, 97, 109, 97, 103, 101, 66, 117, 102,
+            102, 121, 32, 116, 104, 101, 32, 86, 97, 109, 112, 105, 114, 101, 32, 83, 108, 97, 121, 101,
+            114, 84, 104, 101, 32, 83, 105, 109, 112, 115, 111, 110, 115, 58, 32, 82, 111, 97, 100, 32,
+            82, 97, 103, 101, 70, 49, 32, 50, 48, 48, 50, 80, 105, 114, 97, 116, 101, 115, 58, 32,
+            84, 104, 101, 32, 76, 101, 103, 101, 110, 100, 32, 111, 102, 32, 66, 108, 97, 99, 107, 32,
+            75, 97, 116, 70, 73, 70, 65, 32, 83, 111, 99, 99, 101, 114, 32, 50, 48, 48, 51, 77,
+            97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 50, 48, 48, 51, 77, 101, 100, 97, 108, 32,
+            111, 102, 32, 72, 111, 110, 111, 114, 58, 32, 70, 114, 111, 110, 116, 108, 105, 110, 101, 78,
+            65, 83, 67, 65, 82, 32, 84, 104, 117, 110, 100, 101, 114, 32, 50, 48, 48, 51, 78, 66,
+            65, 32, 76, 105, 118, 101, 32, 50, 48, 48, 51, 78, 67, 65, 65, 32, 70, 111, 111, 116,
+            98, 97, 108, 108, 32, 50, 48, 48, 51, 78, 72, 76, 32, 50, 48, 48, 51, 84, 105, 103,
+            101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 111, 117, 114, 32, 50, 48,
+            48, 51, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 79, 98, 105, 45, 87, 97, 110,
+            48, 48, 55, 58, 32, 78, 105, 103, 104, 116, 102, 105, 114, 101, 78, 66, 65, 32, 83, 116,
+            114, 101, 101, 116, 32, 86, 111, 108, 46, 32, 50, 78, 101, 101, 100, 32, 102, 111, 114, 32,
+            83, 112, 101, 101, 100, 58, 32, 72, 111, 116, 32, 80, 117, 114, 115, 117, 105, 116, 32, 50,
+            84, 89, 32, 116, 104, 101, 32, 84, 97, 115, 109, 97, 110, 105, 97, 110, 32, 84, 105, 103,
+            101, 114, 70, 114, 101, 101, 100, 111, 109, 32, 70, 105, 103, 104, 116, 101, 114, 115, 68, 101,
+            97, 100, 32, 116, 111, 32, 82, 105, 103, 104, 116, 115, 77, 86, 80, 32, 66, 97, 115, 101,
+            98, 97, 108, 108, 32, 50, 48, 48, 51, 70, 114, 101, 101, 100, 111, 109, 32, 70, 105, 103,
+            104, 116, 101, 114, 115, 84, 104, 101, 32, 83, 105, 109, 115, 78, 72, 76, 32, 50, 48, 48,
+            52, 78, 65, 83, 67, 65, 82, 32, 84, 104, 117, 110, 100, 101, 114, 32, 50, 48, 48, 52,
+            70, 49, 32, 67, 97, 114, 101, 101, 114, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 78,
+            67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 52, 77, 97, 100,
+            100, 101, 110, 32, 78, 70, 76, 32, 50, 48, 48, 52, 72, 97, 114, 114, 121, 32, 80, 111,
+            116, 116, 101, 114, 32, 97, 110, 100, 32, 116, 104, 101, 32, 83, 111, 114, 99, 101, 114, 101,
+            114, 39, 115, 32, 83, 116, 111, 110, 101, 78, 66, 65, 32, 76, 105, 118, 101, 32, 50, 48,
+            48, 52, 66, 105, 111, 110, 105, 99, 108, 101, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100,
+            115, 32, 80, 71, 65, 32, 84, 111, 117, 114, 32, 50, 48, 48, 52, 70, 73, 70, 65, 32,
+            83, 111, 99, 99, 101, 114, 32, 50, 48, 48, 52, 83, 83, 88, 32, 51, 72, 97, 114, 114,
+            121, 32, 80, 111, 116, 116, 101, 114, 58, 32, 81, 117, 105, 100, 100, 105, 116, 99, 104, 32,
+            87, 111, 114, 108, 100, 32, 67, 117, 112, 69, 108, 32, 83, 101, 241, 111, 114, 32, 100, 101,
+            32, 108, 111, 115, 32, 65, 110, 105, 108, 108, 111, 115, 58, 32, 69, 108, 32, 82, 101, 116,
+            111, 114, 110, 111, 32, 100, 101, 108, 32, 82, 101, 121, 77, 101, 100, 97, 108, 32, 111, 102,
+            32, 72, 111, 110, 111, 114, 58, 32, 82, 105, 115, 105, 110, 103, 32, 83, 117, 110, 84, 111,
+            116, 97, 108, 32, 67, 108, 117, 98, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48,
+            52, 48, 48, 55, 58, 32, 69, 118, 101, 114, 121, 116, 104, 105, 110, 103, 32, 111, 114, 32,
+            78, 111, 116, 104, 105, 110, 103, 84, 104, 101, 32, 83, 105, 109, 115, 58, 32, 66, 117, 115,
+            116, 105, 110, 39, 32, 79, 117, 116, 78, 67, 65, 65, 32, 77, 97, 114, 99, 104, 32, 77,
+            97, 100, 110, 101, 115, 115, 32, 50, 48, 48, 52, 77, 86, 80, 32, 66, 97, 115, 101, 98,
+            97, 108, 108, 32, 50, 48, 48, 52, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101,
+            101, 100, 58, 32, 85, 110, 100, 101, 114, 103, 114, 111, 117, 110, 100, 78, 70, 76, 32, 83,
+            116, 114, 101, 101, 116, 68, 101, 102, 32, 74, 97, 109, 58, 32, 70, 105, 103, 104, 116, 32,
+            102, 111, 114, 32, 78, 89, 85, 69, 70, 65, 32, 69, 117, 114, 111, 32, 50, 48, 48, 52,
+            58, 32, 80, 111, 114, 116, 117, 103, 97, 108, 70, 105, 103, 104, 116, 32, 78, 105, 103, 104,
+            116, 32, 50, 48, 48, 52, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97,
+            110, 100, 32, 116, 104, 101, 32, 80, 114, 105, 115, 111, 110, 101, 114, 32, 111, 102, 32, 65,
+            122, 107, 97, 98, 97, 110, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 50, 48, 48,
+            53, 70, 73, 70, 65, 32, 83, 111, 99, 99, 101, 114, 32, 50, 48, 48, 53, 78, 72, 76,
+            32, 50, 48, 48, 53, 78, 66, 65, 32, 76, 105, 118, 101, 32, 50, 48, 48, 53, 78, 67,
+            65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 78, 67, 65, 65,
+            32, 77, 97, 114, 99, 104, 32, 77, 97, 100, 110, 101, 115, 115, 32, 50, 48, 48, 53, 78,
+            65, 83, 67, 65, 82, 32, 50, 48, 48, 53, 58, 32, 67, 104, 97, 115, 101, 32, 102, 111,
+            114, 32, 116, 104, 101, 32, 67, 117, 112, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115,
+            32, 80, 71, 65, 32, 84, 111, 117, 114, 32, 50, 48, 48, 53, 70, 105, 103, 104, 116, 32,
+            78, 105, 103, 104, 116, 32, 82, 111, 117, 110, 100, 32, 50, 77, 86, 80, 32, 66, 97, 115,
+            101, 98, 97, 108, 108, 32, 50, 48, 48, 53, 78, 70, 76, 32, 83, 116, 114, 101, 101, 116,
+            32, 50, 78, 66, 65, 32, 83, 116, 114, 101, 101, 116, 32, 86, 51, 78, 101, 101, 100, 32,
+            102, 111, 114, 32, 83, 112, 101, 101, 100, 58, 32, 85, 110, 100, 101, 114, 103, 114, 111, 117,
+            110, 100, 32, 50, 66, 117, 114, 110, 111, 117, 116, 32, 51, 58, 32, 84, 97, 107, 101, 100,
+            111, 119, 110, 67, 97, 116, 119, 111, 109, 97, 110, 71, 111, 108, 100, 101, 110, 69, 121, 101,
+            58, 32, 65, 103, 101, 110, 116, 101, 32, 67, 111, 114, 114, 117, 112, 116, 111, 77, 101, 100,
+            97, 108, 32, 111, 102, 32, 72, 111, 110, 111, 114, 58, 32, 76, 101, 115, 32, 70, 97, 117,
+            99, 111, 110, 115, 32, 100, 101, 32, 71, 117, 101, 114, 114, 101, 73, 108, 32, 83, 105, 103,
+            110, 111, 114, 101, 32, 100, 101, 103, 108, 105, 32, 65, 110, 101, 108, 108, 105, 58, 32, 76,
+            97, 32, 84, 101, 114, 122, 97, 32, 69, 114, 97, 84, 104, 101, 32, 85, 114, 98, 122, 58,
+            32, 83, 105, 109, 115, 32, 105, 110, 32, 116, 104, 101, 32, 67, 105, 116, 121, 82, 117, 103,
+            98, 121, 32, 50, 48, 48, 53, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 50,
+            58, 32, 77, 111, 100, 101, 114, 110, 32, 67, 111, 109, 98, 97, 116, 84, 89, 32, 116, 104,
+            101, 32, 84, 97, 115, 109, 97, 110, 105, 97, 110, 32, 84, 105, 103, 101, 114, 32, 50, 58,
+            32, 66, 117, 115, 104, 32, 82, 101, 115, 99, 117, 101, 84, 111, 116, 97, 108, 32, 67, 108,
+            117, 98, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48, 53, 84, 105, 109, 101, 83,
+            112, 108, 105, 116, 116, 101, 114, 115, 58, 32, 70, 117, 116, 117, 114, 101, 32, 80, 101, 114,
+            102, 101, 99, 116, 79, 100, 100, 119, 111, 114, 108, 100, 58, 32, 76, 97, 32, 70, 117, 114,
+            101, 117, 114, 32, 100, 101, 32, 108, 39, 69, 116, 114, 97, 110, 103, 101, 114, 78, 101, 101,
+            100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 58, 32, 85, 110, 100, 101, 114, 103, 114,
+            111, 117, 110, 100, 32, 50, 85, 69, 70, 65, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115,
+            32, 76, 101, 97, 103, 117, 101, 32, 50, 48, 48, 52, 45, 50, 48, 48, 53, 78, 101, 101,
+            100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 58, 32, 85, 110, 100, 101, 114, 103, 114,
+            111, 117, 110, 100, 32, 50, 70, 73, 70, 65, 32, 83, 116, 114, 101, 101, 116, 67, 114, 105,
+            99, 107, 101, 116, 32, 50, 48, 48, 53, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32,
+            48, 54, 66, 117, 114, 110, 111, 117, 116, 32, 82, 101, 118, 101, 110, 103, 101, 72, 97, 114,
+            114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97, 110, 100, 32, 116, 104, 101, 32, 71, 111,
+            98, 108, 101, 116, 32, 111, 102, 32, 70, 105, 114, 101, 70, 73, 70, 65, 32, 83, 111, 99,
+            99, 101, 114, 32, 48, 54, 48, 48, 55, 58, 32, 70, 114, 111, 109, 32, 82, 117, 115, 115,
+            105, 97, 32, 119, 105, 116, 104, 32, 76, 111, 118, 101, 78, 66, 65, 32, 76, 105, 118, 101,
+            32, 48, 54, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 58, 32, 77,
+            111, 115, 116, 32, 87, 97, 110, 116, 101, 100, 78, 72, 76, 32, 48, 54, 68, 101, 114, 32,
+            80, 97, 116, 101, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32,
+            84, 111, 117, 114, 32, 48, 54, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            32, 48, 54, 83, 83, 88, 32, 111, 110, 32, 84, 111, 117, 114, 66, 108, 97, 99, 107, 70,
+            73, 70, 65, 32, 83, 116, 114, 101, 101, 116, 32, 50, 70, 105, 103, 104, 116, 32, 78, 105,
+            103, 104, 116, 32, 82, 111, 117, 110, 100, 32, 51, 82, 117, 103, 98, 121, 32, 48, 54, 78,
+            65, 83, 67, 65, 82, 32, 48, 54, 58, 32, 84, 111, 116, 97, 108, 32, 84, 101, 97, 109,
+            32, 67, 111, 110, 116, 114, 111, 108, 77, 86, 80, 32, 48, 54, 32, 78, 67, 65, 65, 32,
+            66, 97, 115, 101, 98, 97, 108, 108, 78, 70, 76, 32, 72, 101, 97, 100, 32, 67, 111, 97,
+            99, 104, 78, 67, 65, 65, 32, 77, 97, 114, 99, 104, 32, 77, 97, 100, 110, 101, 115, 115,
+            32, 48, 54, 72, 97, 108, 102, 45, 76, 105, 102, 101, 32, 50, 78, 65, 83, 67, 65, 82,
+            32, 48, 54, 58, 32, 84, 111, 116, 97, 108, 32, 84, 101, 97, 109, 32, 67, 111, 110, 116,
+            114, 111, 108, 65, 114, 101, 110, 97, 32, 70, 111, 111, 116, 98, 97, 108, 108, 77, 97, 114,
+            118, 101, 108, 32, 78, 101, 109, 101, 115, 105, 115, 58, 32, 82, 105, 115, 101, 32, 111, 102,
+            32, 116, 104, 101, 32, 73, 109, 112, 101, 114, 102, 101, 99, 116, 115, 70, 73, 70, 65, 32,
+            87, 111, 114, 108, 100, 32, 67, 117, 112, 32, 71, 101, 114, 109, 97, 110, 121, 32, 50, 48,
+            48, 54, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 58, 32, 67, 97,
+            114, 98, 111, 110, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 48, 55, 83, 117, 112,
+            101, 114, 109, 97, 110, 32, 82, 101, 116, 117, 114, 110, 115, 78, 66, 65, 32, 76, 105, 118,
+            101, 32, 48, 55, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 48, 55,
+            78, 65, 83, 67, 65, 82, 32, 48, 55, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115,
+            32, 80, 71, 65, 32, 84, 111, 117, 114, 32, 48, 55, 78, 72, 76, 32, 48, 55, 70, 73,
+            70, 65, 32, 83, 111, 99, 99, 101, 114, 32, 48, 55, 77, 97, 100, 100, 101, 110, 32, 78,
+            70, 76, 32, 48, 55, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 48,
+            56, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 48, 56, 77, 97, 100, 100, 101, 110,
+            32, 78, 70, 76, 32, 48, 57, 66, 97, 116, 109, 97, 110, 32, 66, 101, 103, 105, 110, 115,
+            77, 97, 114, 118, 101, 108, 32, 78, 101, 109, 101, 115, 105, 115, 58, 32, 82, 105, 115, 101,
+            32, 111, 102, 32, 116, 104, 101, 32, 73, 109, 112, 101, 114, 102, 101, 99, 116, 115, 84, 104,
+            101, 32, 83, 105, 109, 115, 32, 50, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 48,
+            54, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 79, 85,
+            82, 32, 48, 54, 70, 73, 70, 65, 32, 48, 54, 32, 82, 84, 70, 87, 67, 78, 66, 65,
+            32, 76, 73, 86, 69, 32, 48, 54, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32,
+            50, 32, 45, 32, 77, 111, 100, 101, 114, 110, 32, 67, 111, 109, 98, 97, 116, 66, 117, 114,
+            110, 111, 117, 116, 32, 82, 101, 118, 101, 110, 103, 101, 70, 105, 103, 104, 116, 32, 78, 105,
+            103, 104, 116, 32, 82, 111, 117, 110, 100, 32, 51, 76, 79, 84, 82, 32, 125, 44, 32, 66,
+            70, 77, 69, 32, 73, 73, 50, 48, 48, 54, 32, 70, 73, 70, 65, 32, 87, 111, 114, 108,
+            100, 32, 67, 117, 112, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 48,
+            55, 84, 104, 101, 32, 71, 111, 100, 102, 97, 116, 104, 101, 114, 77, 97, 100, 100, 101, 110,
+            32, 78, 70, 76, 32, 48, 55, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101,
+            100, 32, 67, 97, 114, 98, 111, 110, 83, 117, 112, 101, 114, 109, 97, 110, 32, 82, 101, 116,
+            117, 114, 110, 115, 68, 101, 102, 32, 74, 97, 109, 32, 73, 99, 111, 110, 70, 73, 70, 65,
+            32, 48, 55, 78, 66, 65, 32, 76, 73, 86, 69, 32, 48, 55, 78, 67, 65, 65, 32, 77,
+            97, 114, 99, 104, 32, 77, 97, 100, 110, 101, 115, 115, 48, 55, 78, 72, 76, 32, 48, 55,
+            84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 79, 85, 82,
+            32, 48, 55, 77, 101, 100, 97, 108, 32, 79, 102, 32, 72, 111, 110, 111, 114, 32, 45, 32,
+            65, 105, 114, 98, 111, 114, 110, 101, 78, 98, 97, 32, 83, 116, 114, 101, 101, 116, 32, 72,
+            111, 109, 101, 99, 111, 117, 114, 116, 65, 114, 109, 121, 32, 111, 102, 32, 84, 119, 111, 66,
+            97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 45, 32, 66, 97, 100, 32, 67, 111, 109,
+            112, 97, 110, 121, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97, 110, 100,
+            32, 116, 104, 101, 32, 72, 97, 108, 102, 32, 66, 108, 111, 111, 100, 32, 80, 114, 105, 110,
+            99, 101, 66, 117, 114, 110, 111, 117, 116, 32, 80, 97, 114, 97, 100, 105, 115, 101, 67, 111,
+            109, 109, 97, 110, 100, 32, 97, 110, 100, 32, 67, 111, 110, 113, 117, 101, 114, 32, 51, 84,
+            104, 101, 32, 79, 114, 97, 110, 103, 101, 32, 66, 111, 120, 85, 69, 70, 65, 32, 67, 76,
+            32, 50, 48, 48, 54, 45, 50, 48, 48, 55, 115, 107, 97, 116, 101, 46, 78, 65, 83, 67,
+            65, 82, 32, 48, 56, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97, 110,
+            100, 32, 116, 104, 101, 32, 79, 114, 100, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32, 80,
+            104, 111, 101, 110, 105, 120, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32,
+            48, 56, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 48, 56, 70, 105, 102, 97, 32,
+            48, 56, 78, 72, 76, 32, 48, 56, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32,
+            80, 71, 65, 32, 84, 79, 85, 82, 32, 48, 56, 78, 101, 101, 100, 32, 102, 111, 114, 32,
+            83, 112, 101, 101, 100, 32, 45, 32, 80, 114, 111, 83, 116, 114, 101, 101, 116, 77, 101, 114,
+            99, 101, 110, 97, 114, 105, 101, 115, 32, 50, 82, 111, 99, 107, 32, 66, 97, 110, 100, 78,
+            98, 97, 32, 76, 105, 118, 101, 32, 48, 56, 76, 101, 102, 116, 32, 52, 32, 68, 101, 97,
+            100, 78, 70, 76, 32, 84, 111, 117, 114, 78, 67, 65, 65, 32, 77, 97, 114, 99, 104, 32,
+            77, 97, 100, 110, 101, 115, 115, 48, 56, 67, 111, 109, 109, 97, 110, 100, 32, 38, 32, 67,
+            111, 110, 113, 117, 101, 114, 32, 51, 32, 45, 32, 75, 97, 110, 101, 39, 115, 32, 87, 114,
+            97, 116, 104, 70, 73, 70, 65, 32, 83, 116, 114, 101, 101, 116, 32, 51, 85, 69, 70, 65,
+            32, 69, 85, 82, 79, 32, 50, 48, 48, 56, 78, 70, 76, 32, 72, 101, 97, 100, 32, 67,
+            111, 97, 99, 104, 32, 48, 57, 78, 65, 83, 67, 65, 82, 32, 48, 57, 65, 114, 109, 121,
+            32, 79, 102, 32, 84, 119, 111, 32, 40, 69, 117, 41, 77, 105, 114, 114, 111, 114, 39, 115,
+            32, 69, 100, 103, 101, 76, 79, 84, 82, 32, 45, 32, 67, 111, 110, 113, 117, 101, 115, 116,
+            68, 101, 97, 100, 32, 83, 112, 97, 99, 101, 70, 105, 102, 97, 32, 48, 57, 78, 67, 65,
+            65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 48, 57, 67, 111, 109, 109, 97, 110, 100,
+            32, 38, 32, 67, 111, 110, 113, 117, 101, 114, 32, 45, 32, 82, 101, 100, 32, 65, 108, 101,
+            114, 116, 32, 51, 70, 97, 99, 101, 66, 114, 101, 97, 107, 101, 114, 77, 97, 100, 100, 101,
+            110, 32, 78, 70, 76, 32, 48, 57, 84, 104, 101, 32, 71, 111, 100, 102, 97, 116, 104, 101,
+            114, 32, 73, 105, 82, 111, 99, 107, 32, 66, 97, 110, 100, 32, 50, 77, 79, 78, 79, 80,
+            79, 76, 89, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84,
+            79, 85, 82, 32, 48, 57, 78, 72, 76, 32, 48, 57, 78, 101, 101, 100, 32, 102, 111, 114,
+            32, 83, 112, 101, 101, 100, 32, 45, 32, 85, 110, 100, 101, 114, 99, 111, 118, 101, 114, 78,
+            66, 65, 32, 76, 73, 86, 69, 32, 48, 57, 83, 107, 97, 116, 101, 32, 50, 65, 67, 47,
+            68, 67, 32, 76, 73, 86, 69, 32, 45, 32, 82, 111, 99, 107, 32, 66, 97, 110, 100, 78,
+            67, 65, 65, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108, 32, 48, 57, 84, 104, 101,
+            32, 83, 97, 98, 111, 116, 101, 117, 114, 69, 65, 32, 83, 80, 79, 82, 84, 83, 32, 71,
+            114, 97, 110, 100, 32, 83, 108, 97, 109, 32, 84, 101, 110, 110, 105, 115, 32, 50, 70, 105,
+            103, 104, 116, 32, 78, 105, 103, 104, 116, 32, 82, 111, 117, 110, 100, 32, 52, 84, 114, 105,
+            118, 105, 97, 108, 32, 80, 117, 114, 115, 117, 105, 116, 71, 46, 73, 46, 32, 74, 79, 69,
+            66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 45, 32, 66, 97, 100, 32, 67, 111,
+            109, 112, 97, 110, 121, 32, 50, 84, 105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80,
+            71, 65, 32, 84, 79, 85, 82, 32, 49, 48, 82, 111, 99, 107, 32, 66, 97, 110, 100, 32,
+            67, 108, 97, 115, 115, 105, 99, 32, 82, 111, 99, 107, 84, 104, 101, 32, 66, 101, 97, 116,
+            108, 101, 115, 32, 45, 32, 82, 111, 99, 107, 32, 66, 97, 110, 100, 78, 101, 101, 100, 32,
+            102, 111, 114, 32, 83, 112, 101, 101, 100, 32, 83, 72, 73, 70, 84, 78, 72, 76, 32, 49,
+            48, 70, 73, 70, 65, 32, 49, 48, 68, 114, 97, 103, 111, 110, 32, 65, 103, 101, 32, 45,
+            32, 79, 114, 105, 103, 105, 110, 115, 78, 66, 65, 32, 76, 73, 86, 69, 32, 49, 48, 78,
+            67, 65, 65, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108, 32, 49, 48, 66, 114, 117,
+            116, 97, 108, 32, 76, 101, 103, 101, 110, 100, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76,
+            32, 49, 48, 82, 111, 99, 107, 32, 66, 97, 110, 100, 32, 67, 111, 117, 110, 116, 114, 121,
+            32, 80, 97, 99, 107, 82, 111, 99, 107, 32, 66, 97, 110, 100, 32, 77, 101, 116, 97, 108,
+            32, 80, 97, 99, 107, 77, 97, 115, 115, 32, 69, 102, 102, 101, 99, 116, 32, 50, 68, 97,
+            110, 116, 101, 39, 115, 32, 73, 110, 102, 101, 114, 110, 111, 76, 101, 102, 116, 32, 52, 32,
+            68, 101, 97, 100, 32, 50, 65, 114, 109, 121, 32, 111, 102, 32, 84, 119, 111, 32, 45, 32,
+            84, 104, 101, 32, 52, 48, 116, 104, 32, 68, 97, 121, 71, 46, 73, 46, 32, 74, 111, 101,
+            32, 40, 80, 97, 108, 41, 68, 101, 97, 100, 32, 83, 112, 97, 99, 101, 32, 50, 84, 104,
+            101, 32, 83, 105, 109, 115, 32, 51, 67, 114, 121, 115, 105, 115, 32, 50, 50, 48, 49, 48,
+            32, 70, 73, 70, 65, 32, 87, 111, 114, 108, 100, 32, 67, 117, 112, 77, 121, 83, 105, 109,
+            115, 32, 83, 107, 121, 72, 101, 114, 111, 101, 115, 83, 107, 97, 116, 101, 32, 51, 71, 114,
+            101, 101, 110, 32, 68, 97, 121, 32, 45, 32, 82, 111, 99, 107, 32, 66, 97, 110, 100, 84,
+            105, 103, 101, 114, 32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 79, 85, 82, 32,
+            49, 49, 66, 117, 108, 108, 101, 116, 115, 116, 111, 114, 109, 70, 73, 70, 65, 32, 83, 111,
+            99, 99, 101, 114, 32, 49, 49, 77, 79, 78, 79, 80, 79, 76, 89, 32, 83, 116, 114, 101,
+            101, 116, 115, 77, 101, 100, 97, 108, 32, 111, 102, 32, 72, 111, 110, 111, 114, 72, 97, 114,
+            114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97, 110, 100, 32, 116, 104, 101, 32, 68, 101,
+            97, 116, 104, 108, 121, 32, 72, 97, 108, 108, 111, 119, 115, 32, 45, 32, 80, 97, 114, 116,
+            32, 49, 69, 65, 32, 83, 80, 79, 82, 84, 83, 32, 77, 77, 65, 78, 72, 76, 32, 49,
+            49, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 49, 49, 78, 67, 65, 65, 32, 70,
+            111, 111, 116, 98, 97, 108, 108, 32, 49, 49, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83,
+            112, 101, 101, 100, 32, 72, 111, 116, 32, 80, 117, 114, 115, 117, 105, 116, 68, 114, 97, 103,
+            111, 110, 32, 65, 103, 101, 32, 50, 72, 97, 115, 98, 114, 111, 32, 70, 97, 109, 105, 108,
+            121, 32, 71, 97, 109, 101, 32, 78, 105, 103, 104, 116, 32, 51, 69, 65, 32, 83, 80, 79,
+            82, 84, 83, 32, 65, 99, 116, 105, 118, 101, 32, 50, 80, 111, 114, 116, 97, 108, 32, 50,
+            82, 111, 99, 107, 32, 66, 97, 110, 100, 32, 51, 70, 105, 103, 104, 116, 32, 78, 105, 103,
+            104, 116, 32, 67, 104, 97, 109, 112, 105, 111, 110, 65, 108, 105, 99, 101, 32, 45, 32, 77,
+            97, 100, 110, 101, 115, 115, 32, 82, 101, 116, 117, 114, 110, 115, 78, 98, 97, 32, 69, 108,
+            105, 116, 101, 32, 49, 49, 83, 121, 110, 100, 105, 99, 97, 116, 101, 67, 114, 101, 97, 116,
+            101, 83, 104, 97, 100, 111, 119, 115, 32, 111, 102, 32, 116, 104, 101, 32, 68, 97, 109, 110,
+            101, 100, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 32, 83, 72, 73,
+            70, 84, 32, 50, 32, 45, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 77, 97, 100, 100,
+            101, 110, 32, 78, 70, 76, 32, 49, 50, 82, 97, 110, 103, 111, 75, 105, 110, 103, 100, 111,
+            109, 115, 32, 79, 102, 32, 65, 109, 97, 108, 117, 114, 32, 45, 32, 82, 101, 99, 107, 111,
+            110, 105, 110, 103, 78, 101, 101, 100, 32, 70, 111, 114, 32, 83, 112, 101, 101, 100, 32, 45,
+            32, 84, 104, 101, 32, 82, 117, 110, 78, 66, 65, 32, 74, 65, 77, 84, 105, 103, 101, 114,
+            32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 79, 85, 82, 32, 49, 50, 32, 45,
+            32, 84, 104, 101, 32, 77, 97, 115, 116, 101, 114, 115, 78, 67, 65, 65, 32, 70, 111, 111,
+            116, 98, 97, 108, 108, 32, 49, 50, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32,
+            51, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 97, 110, 100, 32, 116, 104,
+            101, 32, 68, 101, 97, 116, 104, 108, 121, 32, 72, 97, 108, 108, 111, 119, 115, 32, 45, 32,
+            80, 97, 114, 116, 32, 50, 77, 97, 115, 115, 32, 69, 102, 102, 101, 99, 116, 32, 51, 78,
+            101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 32, 45, 32, 77, 111, 115, 116,
+            32, 87, 97, 110, 116, 101, 100, 32, 40, 50, 48, 49, 50, 41, 84, 104, 101, 32, 83, 105,
+            109, 115, 32, 51, 32, 80, 101, 116, 115, 78, 72, 76, 49, 50, 70, 97, 109, 105, 108, 121,
+            32, 71, 97, 109, 101, 32, 78, 105, 103, 104, 116, 32, 52, 32, 45, 32, 84, 104, 101, 32,
+            71, 97, 109, 101, 32, 83, 104, 111, 119, 70, 73, 70, 65, 32, 49, 50, 67, 114, 121, 115,
+            105, 115, 77, 97, 100, 100, 101, 110, 32, 78, 102, 108, 32, 49, 50, 69, 97, 32, 83, 112,
+            111, 114, 116, 115, 83, 83, 88, 70, 117, 115, 101, 84, 105, 103, 101, 114, 32, 87, 111, 111,
+            100, 115, 32, 80, 71, 65, 32, 84, 79, 85, 82, 32, 49, 51, 70, 73, 70, 65, 32, 83,
+            116, 114, 101, 101, 116, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 49,
+            51, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 49, 51, 67, 114, 121, 115, 105, 115,
+            32, 51, 77, 101, 100, 97, 108, 32, 111, 102, 32, 72, 111, 110, 111, 114, 32, 87, 97, 114,
+            102, 105, 103, 104, 116, 101, 114, 68, 114, 97, 103, 111, 110, 32, 65, 103, 101, 32, 45, 32,
+            73, 110, 113, 117, 105, 115, 105, 116, 105, 111, 110, 70, 73, 70, 65, 32, 83, 111, 99, 99,
+            101, 114, 32, 49, 51, 70, 105, 102, 97, 32, 83, 111, 99, 99, 101, 114, 32, 49, 51, 32,
+            69, 97, 114, 108, 121, 32, 65, 99, 99, 101, 115, 115, 78, 72, 76, 49, 51, 78, 104, 108,
+            32, 49, 51, 32, 69, 97, 114, 108, 121, 32, 82, 101, 108, 101, 97, 115, 101, 68, 101, 97,
+            100, 32, 83, 112, 97, 99, 101, 32, 51, 90, 117, 109, 97, 39, 115, 32, 82, 101, 118, 101,
+            110, 103, 101, 33, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 84, 105, 103, 101, 114,
+            32, 87, 111, 111, 100, 115, 32, 80, 71, 65, 32, 84, 79, 85, 82, 32, 49, 52, 65, 114,
+            109, 121, 32, 111, 102, 32, 84, 119, 111, 32, 45, 32, 84, 104, 101, 32, 68, 101, 118, 105,
+            108, 39, 115, 32, 67, 97, 114, 116, 101, 108, 78, 67, 65, 65, 32, 70, 111, 111, 116, 98,
+            97, 108, 108, 32, 49, 52, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 52, 78,
+            72, 76, 49, 52, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 50, 53, 70, 73, 70,
+            65, 32, 49, 52, 78, 101, 101, 100, 32, 102, 111, 114, 32, 83, 112, 101, 101, 100, 32, 82,
+            105, 118, 97, 108, 115, 80, 108, 97, 110, 116, 115, 32, 118, 115, 46, 32, 90, 111, 109, 98,
+            105, 101, 115, 32, 71, 97, 114, 100, 101, 110, 32, 87, 97, 114, 102, 97, 114, 101, 84, 105,
+            116, 97, 110, 102, 97, 108, 108, 32, 68, 101, 108, 117, 120, 101, 32, 69, 100, 105, 116, 105,
+            111, 110, 69, 65, 32, 83, 80, 79, 82, 84, 83, 32, 50, 48, 49, 52, 32, 70, 73, 70,
+            65, 32, 87, 111, 114, 108, 100, 32, 67, 117, 112, 32, 66, 114, 97, 122, 105, 108, 77, 97,
+            100, 100, 101, 110, 32, 78, 70, 76, 32, 49, 53, 70, 73, 70, 65, 32, 49, 53, 78, 72,
+            76, 49, 53, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 72, 97, 114, 100, 108,
+            105, 110, 101, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 49, 54, 69, 65, 32, 83,
+            80, 79, 82, 84, 83, 32, 78, 72, 76, 32, 76, 101, 103, 97, 99, 121, 32, 69, 100, 105,
+            116, 105, 111, 110, 70, 73, 70, 65, 32, 49, 54, 70, 73, 70, 65, 32, 49, 55, 67, 105,
+            114, 99, 117, 115, 32, 77, 97, 120, 105, 109, 117, 115, 58, 32, 67, 104, 97, 114, 105, 111,
+            116, 32, 87, 97, 114, 115, 71, 114, 111, 111, 118, 101, 114, 105, 100, 101, 114, 58, 32, 83,
+            108, 111, 116, 32, 67, 97, 114, 32, 84, 104, 117, 110, 100, 101, 114, 72, 101, 114, 111, 101,
+            115, 32, 111, 102, 32, 116, 104, 101, 32, 80, 97, 99, 105, 102, 105, 99, 83, 104, 105, 110,
+            99, 104, 111, 117, 32, 77, 97, 104, 106, 111, 110, 103, 65, 109, 101, 114, 105, 99, 97, 110,
+            32, 77, 99, 71, 101, 101, 32, 80, 114, 101, 115, 101, 110, 116, 115, 32, 83, 99, 114, 97,
+            112, 108, 97, 110, 100, 65, 110, 116, 122, 32, 69, 120, 116, 114, 101, 109, 101, 32, 82, 97,
+            99, 105, 110, 103, 66, 105, 103, 32, 77, 117, 116, 104, 97, 32, 84, 114, 117, 99, 107, 101,
+            114, 115, 84, 111, 116, 97, 108, 32, 73, 109, 109, 101, 114, 115, 105, 111, 110, 32, 82, 97,
+            99, 105, 110, 103, 71, 104, 111, 115, 116, 32, 77, 97, 115, 116, 101, 114, 58, 32, 84, 104,
+            101, 32, 71, 114, 97, 118, 101, 110, 118, 105, 108, 108, 101, 32, 67, 104, 114, 111, 110, 105,
+            99, 108, 101, 115, 83, 116, 97, 114, 115, 107, 121, 32, 38, 32, 72, 117, 116, 99, 104, 70,
+            111, 114, 100, 32, 82, 97, 99, 105, 110, 103, 32, 50, 66, 97, 100, 32, 66, 111, 121, 115,
+            32, 73, 73, 70, 108, 97, 116, 79, 117, 116, 77, 97, 115, 104, 101, 100, 58, 32, 68, 114,
+            105, 118, 101, 32, 116, 111, 32, 83, 117, 114, 118, 105, 118, 101, 70, 111, 114, 100, 32, 82,
+            97, 99, 105, 110, 103, 32, 51, 66, 97, 100, 32, 66, 111, 121, 115, 58, 32, 77, 105, 97,
+            109, 105, 32, 84, 97, 107, 101, 100, 111, 119, 110, 66, 105, 103, 32, 77, 117, 116, 104, 97,
+            32, 84, 114, 117, 99, 107, 101, 114, 115, 32, 50, 58, 32, 84, 114, 117, 99, 107, 32, 77,
+            101, 32, 72, 97, 114, 100, 101, 114, 77, 97, 115, 104, 101, 100, 58, 32, 70, 117, 108, 108,
+            121, 32, 76, 111, 97, 100, 101, 100, 84, 97, 105, 116, 111, 32, 76, 101, 103, 101, 110, 100,
+            115, 85, 108, 116, 105, 109, 97, 116, 101, 32, 80, 114, 111, 32, 80, 105, 110, 98, 97, 108,
+            108, 74, 97, 99, 107, 101, 100, 70, 111, 114, 100, 32, 83, 116, 114, 101, 101, 116, 32, 82,
+            97, 99, 105, 110, 103, 70, 108, 97, 116, 79, 117, 116, 32, 50, 84, 97, 105, 116, 111, 32,
+            76, 101, 103, 101, 110, 100, 115, 32, 50, 70, 108, 97, 116, 111, 117, 116, 32, 85, 99, 77,
+            97, 100, 32, 68, 97, 115, 104, 32, 82, 97, 99, 105, 110, 103, 67, 104, 97, 109, 112, 105,
+            111, 110, 115, 104, 105, 112, 32, 77, 97, 110, 97, 103, 101, 114, 58, 32, 83, 101, 97, 115,
+            111, 110, 32, 48, 49, 47, 48, 50, 84, 104, 105, 101, 102, 58, 32, 68, 101, 97, 100, 108,
+            121, 32, 83, 104, 97, 100, 111, 119, 115, 68, 101, 117, 115, 32, 69, 120, 58, 32, 73, 110,
+            118, 105, 115, 105, 98, 108, 101, 32, 87, 97, 114, 66, 108, 111, 111, 100, 32, 79, 109, 101,
+            110, 32, 50, 58, 32, 84, 104, 101, 32, 76, 101, 103, 97, 99, 121, 32, 111, 102, 32, 75,
+            97, 105, 110, 32, 83, 101, 114, 105, 101, 115, 67, 111, 109, 109, 97, 110, 100, 111, 115, 32,
+            50, 58, 32, 77, 101, 110, 32, 111, 102, 32, 67, 111, 117, 114, 97, 103, 101, 72, 105, 116,
+            109, 97, 110, 58, 32, 83, 105, 108, 101, 110, 116, 32, 65, 115, 115, 97, 115, 115, 105, 110,
+            84, 105, 109, 101, 83, 112, 108, 105, 116, 116, 101, 114, 115, 32, 50, 67, 104, 97, 109, 112,
+            105, 111, 110, 115, 104, 105, 112, 32, 77, 97, 110, 97, 103, 101, 114, 58, 32, 83, 101, 97,
+            115, 111, 110, 32, 48, 50, 47, 48, 51, 66, 97, 99, 107, 121, 97, 114, 100, 32, 87, 114,
+            101, 115, 116, 108, 105, 110, 103, 58, 32, 68, 111, 110, 39, 116, 32, 84, 114, 121, 32, 84,
+            104, 105, 115, 32, 97, 116, 32, 72, 111, 109, 101, 84, 104, 101, 32, 73, 116, 97, 108, 105,
+            97, 110, 32, 74, 111, 98, 76, 101, 103, 97, 99, 121, 32, 111, 102, 32, 75, 97, 105, 110,
+            58, 32, 68, 101, 102, 105, 97, 110, 99, 101, 87, 104, 105, 112, 108, 97, 115, 104, 72, 105,
+            116, 109, 97, 110, 58, 32, 67, 111, 110, 116, 114, 97, 99, 116, 115, 83, 104, 101, 108, 108,
+            83, 104, 111, 99, 107, 58, 32, 78, 97, 109, 32, 39, 54, 55, 67, 114, 97, 115, 104, 32,
+            39, 110, 39, 32, 66, 117, 114, 110, 66, 97, 99, 107, 121, 97, 114, 100, 32, 87, 114, 101,
+            115, 116, 108, 105, 110, 103, 32, 50, 58, 32, 84, 104, 101, 114, 101, 32, 71, 111, 101, 115,
+            32, 116, 104, 101, 32, 78, 101, 105, 103, 104, 98, 111, 114, 104, 111, 111, 100, 50, 53, 32,
+            116, 111, 32, 76, 105, 102, 101, 80, 114, 111, 106, 101, 99, 116, 58, 32, 83, 110, 111, 119,
+            98, 108, 105, 110, 100, 83, 99, 117, 100, 101, 116, 116, 111, 32, 53, 76, 69, 71, 79, 32,
+            83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 84, 104, 101, 32, 86, 105, 100, 101, 111,
+            32, 71, 97, 109, 101, 66, 114, 97, 118, 101, 45, 32, 87, 97, 114, 114, 105, 111, 114, 39,
+            115, 32, 84, 97, 108, 101, 82, 97, 118, 101, 110, 32, 83, 113, 117, 97, 100, 84, 101, 114,
+            109, 105, 110, 97, 116, 111, 114, 32, 83, 97, 108, 118, 97, 116, 105, 111, 110, 74, 65, 83,
+            70, 86, 101, 110, 101, 116, 105, 99, 97, 77, 97, 121, 104, 101, 109, 84, 101, 115, 116, 32,
+            68, 114, 105, 118, 101, 32, 45, 32, 70, 101, 114, 114, 97, 114, 105, 66, 108, 111, 111, 100,
+            32, 66, 111, 119, 108, 83, 104, 101, 114, 108, 111, 99, 107, 32, 72, 111, 108, 109, 101, 115,
+            68, 105, 118, 105, 110, 105, 116, 121, 32, 73, 105, 32, 45, 32, 68, 107, 115, 84, 111, 117,
+            114, 32, 68, 101, 32, 70, 114, 97, 110, 99, 101, 70, 97, 114, 109, 105, 110, 103, 32, 83,
+            105, 109, 117, 108, 97, 116, 111, 114, 66, 111, 117, 110, 100, 32, 98, 121, 32, 70, 108, 97,
+            109, 101, 84, 111, 117, 114, 32, 100, 101, 32, 70, 114, 97, 110, 99, 101, 32, 50, 48, 49,
+            51, 70, 97, 114, 109, 105, 110, 103, 32, 83, 105, 109, 117, 108, 97, 116, 111, 114, 32, 49,
+            53, 70, 117, 116, 117, 114, 97, 109, 97, 84, 104, 101, 32, 69, 115, 99, 97, 112, 105, 115,
+            116, 115, 67, 114, 117, 115, 116, 121, 32, 68, 101, 109, 111, 110, 115, 73, 76, 45, 50, 32,
+            45, 32, 66, 105, 114, 100, 115, 32, 111, 102, 32, 80, 114, 101, 121, 77, 111, 114, 112, 104,
+            88, 78, 97, 117, 103, 104, 116, 121, 32, 66, 101, 97, 114, 78, 97, 118, 97, 108, 32, 65,
+            115, 115, 97, 117, 108, 116, 66, 97, 99, 107, 98, 114, 101, 97, 107, 101, 114, 70, 105, 101,
+            108, 100, 32, 38, 32, 83, 116, 114, 101, 97, 109, 32, 84, 79, 67, 77, 105, 99, 104, 97,
+            101, 108, 32, 80, 104, 101, 108, 112, 115, 32, 45, 32, 80, 117, 115, 104, 32, 116, 104, 101,
+            32, 76, 105, 109, 105, 116, 83, 117, 112, 114, 101, 109, 97, 99, 121, 32, 77, 77, 65, 71,
+            114, 101, 97, 115, 101, 32, 68, 97, 110, 99, 101, 83, 110, 105, 112, 101, 114, 32, 69, 108,
+            105, 116, 101, 32, 86, 50, 84, 111, 112, 32, 71, 117, 110, 32, 45, 32, 72, 97, 114, 100,
+            32, 76, 111, 99, 107, 82, 117, 103, 98, 121, 32, 87, 111, 114, 108, 100, 32, 67, 117, 112,
+            32, 50, 48, 49, 49, 66, 108, 97, 99, 107, 119, 97, 116, 101, 114, 32, 75, 105, 110, 101,
+            99, 116, 74, 105, 108, 108, 105, 97, 110, 32, 77, 105, 99, 104, 97, 101, 108, 39, 115, 32,
+            70, 105, 116, 110, 101, 115, 115, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 109, 105, 67,
+            111, 97, 99, 104, 80, 65, 89, 68, 65, 89, 32, 50, 84, 101, 114, 114, 97, 114, 105, 97,
+            32, 45, 32, 88, 98, 111, 120, 32, 51, 54, 48, 32, 69, 100, 105, 116, 105, 111, 110, 83,
+            110, 105, 112, 101, 114, 32, 69, 108, 105, 116, 101, 32, 51, 77, 117, 114, 97, 107, 117, 109,
+            111, 79, 116, 111, 103, 105, 58, 32, 77, 121, 116, 104, 32, 111, 102, 32, 68, 101, 109, 111,
+            110, 115, 84, 104, 111, 117, 115, 97, 110, 100, 32, 76, 97, 110, 100, 79, 116, 111, 103, 105,
+            58, 32, 72, 121, 97, 107, 107, 105, 32, 84, 111, 117, 98, 97, 116, 115, 117, 32, 69, 109,
+            97, 107, 105, 84, 101, 110, 99, 104, 117, 32, 51, 58, 32, 75, 97, 105, 107, 105, 32, 110,
+            111, 32, 83, 104, 111, 117, 77, 101, 116, 97, 108, 32, 87, 111, 108, 102, 32, 67, 104, 97,
+            111, 115, 65, 114, 109, 111, 114, 101, 100, 32, 67, 111, 114, 101, 32, 52, 84, 101, 110, 99,
+            104, 117, 32, 90, 78, 105, 110, 106, 97, 32, 66, 108, 97, 100, 101, 65, 114, 109, 111, 114,
+            101, 100, 32, 67, 111, 114, 101, 32, 45, 32, 70, 111, 114, 32, 65, 110, 115, 119, 101, 114,
+            68, 97, 114, 107, 32, 83, 111, 117, 108, 115, 32, 73, 73, 80, 104, 97, 110, 116, 111, 109,
+            32, 66, 114, 101, 97, 107, 101, 114, 90, 97, 110, 32, 75, 97, 98, 117, 107, 105, 80, 104,
+            97, 110, 116, 111, 109, 32, 67, 114, 97, 115, 104, 75, 101, 110, 103, 111, 32, 76, 101, 103,
+            101, 110, 100, 32, 111, 102, 32, 116, 104, 101, 32, 57, 84, 104, 101, 32, 83, 116, 114, 105,
+            107, 101, 72, 97, 105, 108, 32, 116, 111, 32, 116, 104, 101, 32, 67, 104, 105, 109, 112, 76,
+            101, 103, 101, 110, 100, 97, 114, 121, 83, 101, 99, 116, 105, 111, 110, 32, 56, 86, 101, 108,
+            118, 101, 116, 32, 65, 115, 115, 97, 115, 115, 105, 110, 88, 98, 111, 120, 32, 76, 105, 118,
+            101, 32, 69, 118, 101, 110, 116, 32, 82, 101, 103, 105, 115, 116, 114, 97, 116, 105, 111, 110,
+            115, 80, 97, 114, 105, 97, 104, 67, 111, 109, 98, 97, 116, 58, 32, 84, 97, 115, 107, 32,
+            70, 111, 114, 99, 101, 32, 49, 50, 49, 76, 97, 110, 100, 32, 111, 102, 32, 116, 104, 101,
+            32, 68, 101, 97, 100, 58, 32, 82, 111, 97, 100, 32, 116, 111, 32, 70, 105, 100, 100, 108,
+            101, 114, 39, 115, 32, 71, 114, 101, 101, 110, 87, 111, 114, 108, 100, 32, 87, 97, 114, 32,
+            73, 73, 32, 67, 111, 109, 98, 97, 116, 58, 32, 82, 111, 97, 100, 32, 116, 111, 32, 66,
+            101, 114, 108, 105, 110, 87, 97, 114, 80, 97, 116, 104, 87, 111, 114, 108, 100, 32, 87, 97,
+            114, 32, 73, 73, 32, 67, 111, 109, 98, 97, 116, 58, 32, 73, 119, 111, 32, 74, 105, 109,
+            97, 65, 108, 97, 115, 107, 97, 110, 32, 83, 116, 111, 114, 109, 76, 117, 99, 104, 97, 32,
+            76, 105, 98, 114, 101, 32, 65, 65, 65, 82, 117, 103, 98, 121, 32, 76, 101, 97, 103, 117,
+            101, 70, 114, 97, 110, 107, 105, 101, 32, 68, 101, 116, 116, 111, 114, 105, 32, 82, 97, 99,
+            105, 110, 103, 82, 117, 103, 98, 121, 32, 76, 101, 97, 103, 117, 101, 32, 50, 82, 117, 103,
+            98, 121, 32, 76, 101, 97, 103, 117, 101, 32, 76, 105, 118, 101, 65, 102, 108, 32, 76, 105,
+            118, 101, 74, 111, 110, 97, 104, 32, 76, 111, 109, 117, 32, 82, 117, 103, 98, 121, 32, 67,
+            104, 97, 108, 108, 101, 110, 103, 101, 82, 117, 103, 98, 121, 32, 67, 104, 97, 108, 108, 101,
+            110, 103, 101, 32, 50, 32, 45, 32, 84, 104, 101, 32, 76, 105, 111, 110, 115, 32, 84, 111,
+            117, 114, 32, 69, 100, 105, 116, 105, 111, 110, 82, 117, 103, 98, 121, 32, 76, 101, 97, 103,
+            117, 101, 32, 76, 105, 118, 101, 32, 51, 82, 117, 103, 98, 121, 32, 67, 104, 97, 108, 108,
+            101, 110, 103, 101, 32, 51, 83, 116, 111, 108, 101, 110, 67, 111, 117, 110, 116, 101, 114, 32,
+            84, 101, 114, 114, 111, 114, 105, 115, 116, 32, 83, 112, 101, 99, 105, 97, 108, 32, 70, 111,
+            114, 99, 101, 115, 58, 32, 70, 105, 114, 101, 32, 102, 111, 114, 32, 69, 102, 102, 101, 99,
+            116, 82, 117, 103, 98, 121, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 32, 50, 48, 48,
+            54, 66, 108, 111, 111, 100, 121, 32, 82, 111, 97, 114, 58, 32, 69, 120, 116, 114, 101, 109,
+            101, 66, 79, 77, 66, 69, 82, 77, 65, 78, 32, 65, 99, 116, 32, 45, 90, 101, 114, 111,
+            70, 117, 122, 105, 111, 110, 32, 70, 114, 101, 110, 122, 121, 32, 50, 68, 101, 99, 97, 32,
+            83, 112, 111, 114, 116, 115, 32, 70, 114, 101, 101, 100, 111, 109, 68, 114, 105, 104, 111, 111,
+            82, 101, 97, 108, 32, 87, 111, 114, 108, 100, 32, 71, 111, 108, 102, 69, 120, 45, 67, 104,
+            97, 115, 101, 114, 83, 112, 101, 99, 116, 114, 97, 108, 32, 70, 111, 114, 99, 101, 32, 51,
+            84, 101, 115, 116, 32, 68, 114, 105, 118, 101, 32, 79, 102, 102, 45, 82, 111, 97, 100, 58,
+            32, 87, 105, 100, 101, 32, 79, 112, 101, 110, 84, 114, 97, 110, 115, 87, 111, 114, 108, 100,
+            32, 83, 110, 111, 119, 98, 111, 97, 114, 100, 105, 110, 103, 84, 114, 97, 110, 115, 87, 111,
+            114, 108, 100, 32, 83, 117, 114, 102, 76, 111, 111, 110, 115, 58, 32, 84, 104, 101, 32, 70,
+            105, 103, 104, 116, 32, 102, 111, 114, 32, 70, 97, 109, 101, 84, 101, 115, 116, 32, 68, 114,
+            105, 118, 101, 78, 65, 83, 67, 65, 82, 32, 72, 101, 97, 116, 32, 50, 48, 48, 50, 70,
+            117, 114, 105, 111, 117, 115, 32, 75, 97, 114, 116, 105, 110, 103, 84, 97, 122, 58, 32, 87,
+            97, 110, 116, 101, 100, 77, 97, 103, 105, 99, 58, 32, 84, 104, 101, 32, 71, 97, 116, 104,
+            101, 114, 105, 110, 103, 58, 32, 66, 97, 116, 116, 108, 101, 103, 114, 111, 117, 110, 100, 115,
+            77, 111, 110, 111, 112, 111, 108, 121, 32, 80, 97, 114, 116, 121, 66, 97, 116, 116, 108, 101,
+            32, 69, 110, 103, 105, 110, 101, 32, 65, 113, 117, 105, 108, 97, 83, 108, 97, 109, 32, 84,
+            101, 110, 110, 105, 115, 90, 97, 112, 112, 101, 114, 68, 117, 110, 103, 101, 111, 110, 115, 32,
+            38, 32, 68, 114, 97, 103, 111, 110, 115, 58, 32, 72, 101, 114, 111, 101, 115, 65, 112, 101,
+            120, 83, 117, 112, 101, 114, 109, 97, 110, 58, 32, 84, 104, 101, 32, 77, 97, 110, 32, 111,
+            102, 32, 83, 116, 101, 101, 108, 71, 117, 110, 32, 86, 97, 108, 107, 121, 114, 105, 101, 74,
+            83, 82, 70, 58, 32, 74, 101, 116, 32, 83, 101, 116, 32, 82, 97, 100, 105, 111, 32, 70,
+            117, 116, 117, 114, 101, 83, 112, 108, 97, 115, 104, 100, 111, 119, 110, 77, 105, 99, 114, 111,
+            32, 77, 97, 99, 104, 105, 110, 101, 115, 77, 105, 115, 115, 105, 111, 110, 58, 32, 73, 109,
+            112, 111, 115, 115, 105, 98, 108, 101, 58, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32,
+            83, 117, 114, 109, 97, 69, 110, 116, 101, 114, 32, 116, 104, 101, 32, 77, 97, 116, 114, 105,
+            120, 67, 114, 97, 122, 121, 32, 84, 97, 120, 105, 32, 51, 85, 110, 114, 101, 97, 108, 32,
+            67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 83, 104, 97, 100, 111, 119, 32, 79,
+            112, 115, 58, 32, 82, 101, 100, 32, 77, 101, 114, 99, 117, 114, 121, 84, 104, 101, 32, 84,
+            101, 114, 109, 105, 110, 97, 116, 111, 114, 58, 32, 68, 97, 119, 110, 32, 111, 102, 32, 70,
+            97, 116, 101, 68, 101, 97, 100, 32, 77, 97, 110, 39, 115, 32, 72, 97, 110, 100, 78, 105,
+            99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 80, 97, 114, 116, 121, 32, 66, 108, 97, 115,
+            116, 83, 101, 103, 97, 32, 83, 111, 99, 99, 101, 114, 32, 83, 108, 97, 109, 80, 97, 110,
+            122, 101, 114, 32, 68, 114, 97, 103, 111, 111, 110, 32, 79, 114, 116, 97, 83, 101, 103, 97,
+            32, 71, 84, 32, 50, 48, 48, 50, 82, 111, 108, 108, 101, 114, 67, 111, 97, 115, 116, 101,
+            114, 32, 84, 121, 99, 111, 111, 110, 86, 45, 82, 97, 108, 108, 121, 32, 51, 68, 114, 105,
+            118, 51, 114, 71, 111, 100, 122, 105, 108, 108, 97, 58, 32, 68, 101, 115, 116, 114, 111, 121,
+            32, 65, 108, 108, 32, 77, 111, 110, 115, 116, 101, 114, 115, 32, 77, 101, 108, 101, 101, 84,
+            101, 114, 109, 105, 110, 97, 116, 111, 114, 32, 51, 58, 32, 82, 105, 115, 101, 32, 111, 102,
+            32, 116, 104, 101, 32, 77, 97, 99, 104, 105, 110, 101, 115, 85, 110, 114, 101, 97, 108, 32,
+            73, 73, 58, 32, 84, 104, 101, 32, 65, 119, 97, 107, 101, 110, 105, 110, 103, 84, 114, 105,
+            118, 105, 97, 108, 32, 80, 117, 114, 115, 117, 105, 116, 58, 32, 85, 110, 104, 105, 110, 103,
+            101, 100, 84, 101, 114, 109, 105, 110, 97, 116, 111, 114, 32, 51, 58, 32, 84, 104, 101, 32,
+            82, 101, 100, 101, 109, 112, 116, 105, 111, 110, 68, 101, 97, 100, 32, 77, 97, 110, 39, 115,
+            32, 72, 97, 110, 100, 83, 104, 97, 100, 111, 119, 32, 79, 112, 115, 58, 32, 82, 101, 100,
+            32, 77, 101, 114, 99, 117, 114, 121, 77, 97, 103, 105, 99, 58, 32, 84, 104, 101, 32, 71,
+            97, 116, 104, 101, 114, 105, 110, 103, 58, 32, 66, 97, 116, 116, 108, 101, 103, 114, 111, 117,
+            110, 100, 115, 71, 111, 100, 122, 105, 108, 108, 97, 58, 32, 83, 97, 118, 101, 32, 116, 104,
+            101, 32, 69, 97, 114, 116, 104, 70, 111, 114, 103, 111, 116, 116, 101, 110, 32, 82, 101, 97,
+            108, 109, 115, 58, 32, 68, 101, 109, 111, 110, 32, 83, 116, 111, 110, 101, 84, 101, 115, 116,
+            32, 68, 114, 105, 118, 101, 58, 32, 69, 118, 101, 32, 111, 102, 32, 68, 101, 115, 116, 114,
+            117, 99, 116, 105, 111, 110, 65, 116, 97, 114, 105, 32, 65, 110, 116, 104, 111, 108, 111, 103,
+            121, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32, 90, 58, 32, 83, 97, 103, 97,
+            115, 73, 110, 100, 105, 103, 111, 32, 80, 114, 111, 112, 104, 101, 99, 121, 84, 104, 101, 32,
+            77, 97, 116, 114, 105, 120, 58, 32, 80, 97, 116, 104, 32, 111, 102, 32, 78, 101, 111, 77,
+            97, 114, 99, 32, 69, 99, 107, 111, 39, 115, 32, 71, 101, 116, 116, 105, 110, 103, 32, 85,
+            112, 58, 32, 67, 111, 110, 116, 101, 110, 116, 115, 32, 85, 110, 100, 101, 114, 32, 80, 114,
+            101, 115, 115, 117, 114, 101, 68, 114, 105, 118, 101, 114, 58, 32, 80, 97, 114, 97, 108, 108,
+            101, 108, 32, 76, 105, 110, 101, 115, 65, 108, 111, 110, 101, 32, 73, 110, 32, 84, 104, 101,
+            32, 68, 97, 114, 107, 84, 101, 115, 116, 32, 68, 114, 105, 118, 101, 32, 85, 110, 108, 105,
+            109, 105, 116, 101, 100, 66, 117, 108, 108, 101, 116, 87, 105, 116, 99, 104, 82, 97, 99, 101,
+            32, 80, 114, 111, 65, 115, 115, 97, 117, 108, 116, 32, 111, 110, 32, 68, 97, 114, 107, 32,
+            65, 116, 104, 101, 110, 97, 71, 104, 111, 115, 116, 98, 117, 115, 116, 101, 114, 115, 66, 97,
+            99, 107, 121, 97, 114, 100, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 49, 48, 84, 101,
+            115, 116, 32, 68, 114, 105, 118, 101, 32, 85, 110, 108, 105, 109, 105, 116, 101, 100, 32, 50,
+            83, 97, 110, 100, 108, 111, 116, 32, 83, 108, 117, 103, 103, 101, 114, 115, 66, 97, 99, 107,
+            121, 97, 114, 100, 32, 83, 112, 111, 114, 116, 115, 32, 45, 32, 82, 111, 111, 107, 105, 101,
+            32, 82, 117, 115, 104, 77, 105, 103, 111, 110, 103, 32, 90, 104, 101, 110, 103, 102, 117, 122,
+            104, 101, 66, 114, 97, 118, 101, 107, 110, 105, 103, 104, 116, 58, 32, 76, 101, 118, 101, 114,
+            97, 110, 116, 32, 89, 101, 111, 110, 103, 117, 110, 103, 106, 101, 111, 110, 65, 111, 105, 32,
+            78, 97, 109, 105, 100, 97, 65, 110, 105, 109, 97, 110, 105, 97, 99, 115, 58, 32, 84, 104,
+            101, 32, 71, 114, 101, 97, 116, 32, 69, 100, 103, 97, 114, 32, 72, 117, 110, 116, 77, 101,
+            116, 97, 108, 32, 83, 108, 117, 103, 32, 51, 69, 108, 32, 83, 104, 97, 100, 100, 97, 105,
+            68, 101, 97, 100, 108, 121, 32, 80, 114, 101, 109, 111, 110, 105, 116, 105, 111, 110, 78, 97,
+            116, 105, 111, 110, 97, 108, 32, 71, 101, 111, 103, 114, 97, 112, 104, 105, 99, 32, 67, 104,
+            97, 108, 108, 101, 110, 103, 101, 33, 82, 76, 72, 58, 32, 82, 117, 110, 32, 76, 105, 107,
+            101, 32, 72, 101, 108, 108, 70, 97, 108, 108, 111, 117, 116, 58, 32, 66, 114, 111, 116, 104,
+            101, 114, 104, 111, 111, 100, 32, 111, 102, 32, 83, 116, 101, 101, 108, 66, 97, 108, 100, 117,
+            114, 39, 115, 32, 71, 97, 116, 101, 58, 32, 68, 97, 114, 107, 32, 65, 108, 108, 105, 97,
+            110, 99, 101, 32, 73, 73, 84, 104, 101, 32, 66, 97, 114, 100, 39, 115, 32, 84, 97, 108,
+            101, 80, 117, 108, 115, 101, 32, 82, 97, 99, 101, 114, 78, 105, 103, 104, 116, 32, 67, 97,
+            115, 116, 101, 114, 32, 73, 73, 58, 32, 69, 113, 117, 105, 110, 111, 120, 83, 117, 112, 101,
+            114, 32, 66, 117, 98, 98, 108, 101, 32, 80, 111, 112, 71, 111, 98, 108, 105, 110, 32, 67,
+            111, 109, 109, 97, 110, 100, 101, 114, 58, 32, 85, 110, 108, 101, 97, 115, 104, 32, 116, 104,
+            101, 32, 72, 111, 114, 100, 101, 82, 111, 111, 109, 32, 90, 111, 111, 109, 58, 32, 82, 97,
+            99, 101, 32, 102, 111, 114, 32, 73, 109, 112, 97, 99, 116, 87, 111, 114, 108, 100, 32, 67,
+            104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 80, 111, 111, 108, 32, 50, 48, 48,
+            52, 78, 101, 105, 103, 104, 98, 111, 117, 114, 115, 32, 102, 114, 111, 109, 32, 72, 101, 108,
+            108, 75, 97, 111, 32, 116, 104, 101, 32, 75, 97, 110, 103, 97, 114, 111, 111, 58, 32, 82,
+            111, 117, 110, 100, 32, 50, 89, 101, 116, 105, 115, 112, 111, 114, 116, 115, 32, 65, 114, 99,
+            116, 105, 99, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 83, 107, 105, 32, 82, 97,
+            99, 105, 110, 103, 32, 50, 48, 48, 53, 80, 97, 110, 122, 101, 114, 32, 69, 108, 105, 116,
+            101, 32, 65, 99, 116, 105, 111, 110, 58, 32, 70, 105, 101, 108, 100, 115, 32, 111, 102, 32,
+            71, 108, 111, 114, 121, 83, 107, 105, 32, 82, 97, 99, 105, 110, 103, 32, 50, 48, 48, 54,
+            65, 114, 99, 97, 110, 105, 65, 74, 105, 107, 107, 121, 111, 117, 32, 87, 111, 114, 108, 100,
+            32, 83, 111, 99, 99, 101, 114, 32, 50, 48, 48, 50, 84, 104, 101, 32, 66, 97, 115, 101,
+            98, 97, 108, 108, 32, 50, 48, 48, 50, 58, 32, 66, 97, 116, 116, 108, 101, 32, 66, 97,
+            108, 108, 32, 80, 97, 114, 107, 32, 83, 101, 110, 103, 101, 110, 66, 97, 116, 109, 97, 110,
+            58, 32, 68, 97, 114, 107, 32, 84, 111, 109, 111, 114, 114, 111, 119, 69, 103, 103, 32, 77,
+            97, 110, 105, 97, 58, 32, 84, 115, 117, 107, 97, 110, 100, 101, 33, 32, 77, 97, 119, 97,
+            115, 104, 105, 116, 101, 33, 32, 68, 111, 115, 115, 117, 110, 32, 80, 117, 122, 122, 108, 101,
+            33, 33, 82, 111, 103, 117, 101, 32, 79, 112, 115, 82, 111, 103, 117, 101, 32, 79, 112, 115,
+            67, 104, 105, 99, 97, 103, 111, 32, 69, 110, 102, 111, 114, 99, 101, 114, 89, 97, 103, 101,
+            114, 84, 111, 112, 32, 71, 101, 97, 114, 58, 32, 82, 80, 77, 32, 84, 117, 110, 105, 110,
+            103, 87, 87, 69, 32, 82, 97, 119, 83, 104, 105, 107, 105, 103, 97, 109, 105, 32, 110, 111,
+            32, 83, 104, 105, 114, 111, 32, 69, 118, 111, 108, 117, 116, 105, 111, 110, 83, 104, 105, 107,
+            105, 103, 97, 109, 105, 32, 110, 111, 32, 83, 104, 105, 114, 111, 32, 73, 73, 84, 114, 105,
+            97, 110, 103, 108, 101, 32, 65, 103, 97, 105, 110, 84, 114, 105, 97, 110, 103, 108, 101, 32,
+            65, 103, 97, 105, 110, 32, 50, 69, 120, 97, 115, 107, 101, 108, 101, 116, 111, 110, 83, 97,
+            99, 114, 101, 100, 32, 50, 32, 70, 97, 108, 108, 101, 110, 32, 65, 110, 103, 101, 108, 82,
+            105, 115, 101, 110, 80, 114, 105, 115, 111, 110, 32, 66, 114, 101, 97, 107, 68, 101, 97, 100,
+            32, 73, 115, 108, 97, 110, 100, 110, 97, 105, 108, 39, 100, 87, 105, 110, 116, 101, 114, 32,
+            83, 116, 97, 114, 115, 82, 105, 115, 101, 110, 32, 50, 32, 45, 32, 68, 97, 114, 107, 32,
+            87, 97, 116, 101, 114, 115, 83, 97, 99, 114, 101, 100, 32, 51, 82, 105, 100, 101, 32, 116,
+            111, 32, 72, 101, 108, 108, 32, 45, 32, 82, 101, 116, 114, 105, 98, 117, 116, 105, 111, 110,
+            83, 117, 109, 109, 101, 114, 32, 83, 116, 97, 114, 115, 32, 50, 48, 49, 50, 68, 101, 97,
+            100, 32, 73, 115, 108, 97, 110, 100, 32, 82, 105, 112, 116, 105, 100, 101, 77, 101, 116, 114,
+            111, 32, 45, 32, 76, 97, 115, 116, 32, 76, 105, 103, 104, 116, 83, 97, 105, 110, 116, 115,
+            32, 82, 111, 119, 32, 73, 86, 82, 105, 115, 101, 110, 32, 51, 32, 84, 105, 116, 97, 110,
+            32, 76, 111, 114, 100, 115, 69, 115, 99, 97, 112, 101, 32, 68, 101, 97, 100, 32, 73, 115,
+            108, 97, 110, 100, 83, 97, 105, 110, 116, 115, 32, 82, 111, 119, 32, 45, 32, 71, 97, 116,
+            32, 79, 117, 116, 32, 111, 102, 32, 72, 101, 108, 108, 87, 104, 105, 116, 101, 111, 117, 116,
+            65, 105, 114, 70, 111, 114, 99, 101, 32, 68, 101, 108, 116, 97, 32, 83, 116, 111, 114, 109,
+            69, 83, 80, 78, 32, 78, 70, 76, 32, 80, 114, 105, 109, 101, 84, 105, 109, 101, 32, 50,
+            48, 48, 50, 83, 105, 108, 101, 110, 116, 32, 72, 105, 108, 108, 32, 50, 58, 32, 73, 110,
+            110, 101, 114, 32, 70, 101, 97, 114, 115, 69, 83, 80, 78, 32, 77, 76, 83, 32, 69, 120,
+            116, 114, 97, 84, 105, 109, 101, 32, 50, 48, 48, 50, 69, 83, 80, 78, 32, 78, 66, 65,
+            32, 50, 78, 105, 103, 104, 116, 32, 50, 48, 48, 50, 77, 101, 116, 97, 108, 32, 71, 101,
+            97, 114, 32, 83, 111, 108, 105, 100, 32, 50, 58, 32, 83, 117, 98, 115, 116, 97, 110, 99,
+            101, 73, 110, 116, 101, 114, 110, 97, 116, 105, 111, 110, 97, 108, 32, 83, 117, 112, 101, 114,
+            115, 116, 97, 114, 32, 83, 111, 99, 99, 101, 114, 32, 50, 87, 105, 110, 116, 101, 114, 32,
+            88, 32, 71, 97, 109, 101, 115, 32, 83, 110, 111, 119, 98, 111, 97, 114, 100, 105, 110, 103,
+            32, 50, 72, 121, 112, 101, 114, 32, 83, 112, 111, 114, 116, 115, 32, 50, 48, 48, 50, 32,
+            87, 105, 110, 116, 101, 114, 69, 83, 80, 78, 32, 73, 110, 116, 101, 114, 110, 97, 116, 105,
+            111, 110, 97, 108, 32, 87, 105, 110, 116, 101, 114, 32, 83, 112, 111, 114, 116, 115, 83, 104,
+            97, 100, 111, 119, 32, 111, 102, 32, 77, 101, 109, 111, 114, 105, 101, 115, 76, 101, 32, 84,
+            111, 117, 114, 32, 100, 101, 32, 70, 114, 97, 110, 99, 101, 87, 84, 65, 32, 84, 111, 117,
+            114, 32, 84, 101, 110, 110, 105, 115, 32, 80, 114, 111, 32, 69, 118, 111, 108, 117, 116, 105,
+            111, 110, 67, 114, 97, 115, 104, 32, 66, 97, 110, 100, 105, 99, 111, 111, 116, 32, 52, 58,
+            32, 83, 97, 107, 117, 114, 101, 116, 115, 117, 33, 32, 77, 97, 106, 105, 110, 32, 80, 111,
+            119, 101, 114, 78, 66, 65, 32, 83, 116, 97, 114, 116, 105, 110, 103, 32, 70, 105, 118, 101,
+            70, 114, 111, 103, 103, 101, 114, 32, 66, 101, 121, 111, 110, 100, 68, 97, 110, 99, 101, 32,
+            68, 97, 110, 99, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 85, 108, 116,
+            114, 97, 109, 105, 120, 83, 105, 108, 101, 110, 116, 32, 83, 99, 111, 112, 101, 32, 67, 111,
+            109, 112, 108, 101, 116, 101, 84, 101, 101, 110, 97, 103, 101, 32, 77, 117, 116, 97, 110, 116,
+            32, 78, 105, 110, 106, 97, 32, 84, 117, 114, 116, 108, 101, 115, 67, 114, 105, 109, 101, 32,
+            76, 105, 102, 101, 58, 32, 71, 97, 110, 103, 32, 87, 97, 114, 115, 68, 97, 110, 99, 105,
+            110, 103, 32, 83, 116, 97, 103, 101, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 89, 117,
+            45, 71, 105, 45, 79, 104, 33, 32, 84, 104, 101, 32, 68, 97, 119, 110, 32, 111, 102, 32,
+            68, 101, 115, 116, 105, 110, 121, 83, 105, 108, 101, 110, 116, 32, 72, 105, 108, 108, 32, 52,
+            58, 32, 84, 104, 101, 32, 82, 111, 111, 109, 84, 77, 78, 84, 58, 32, 77, 117, 116, 97,
+            110, 116, 32, 77, 101, 108, 101, 101, 68, 97, 110, 99, 105, 110, 103, 32, 83, 116, 97, 103,
+            101, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 32, 50, 80, 114, 111, 32, 69, 118, 111,
+            108, 117, 116, 105, 111, 110, 32, 83, 111, 99, 99, 101, 114, 32, 52, 84, 101, 101, 110, 97,
+            103, 101, 32, 77, 117, 116, 97, 110, 116, 32, 78, 105, 110, 106, 97, 32, 84, 117, 114, 116,
+            108, 101, 115, 32, 50, 58, 32, 66, 97, 116, 116, 108, 101, 32, 78, 101, 120, 117, 115, 75,
+            105, 110, 103, 32, 65, 114, 116, 104, 117, 114, 75, 97, 114, 97, 111, 107, 101, 32, 82, 101,
+            118, 111, 108, 117, 116, 105, 111, 110, 87, 111, 114, 108, 100, 32, 83, 111, 99, 99, 101, 114,
+            32, 87, 105, 110, 110, 105, 110, 103, 32, 69, 108, 101, 118, 101, 110, 32, 56, 58, 32, 73,
+            110, 116, 101, 114, 110, 97, 116, 105, 111, 110, 97, 108, 68, 97, 110, 99, 105, 110, 103, 32,
+            83, 116, 97, 103, 101, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 32, 51, 84, 101, 101,
+            110, 97, 103, 101, 32, 77, 117, 116, 97, 110, 116, 32, 78, 105, 110, 106, 97, 32, 84, 117,
+            114, 116, 108, 101, 115, 32, 51, 58, 32, 77, 117, 116, 97, 110, 116, 32, 78, 105, 103, 104,
+            116, 109, 97, 114, 101, 70, 114, 111, 103, 103, 101, 114, 58, 32, 65, 110, 99, 105, 101, 110,
+            116, 32, 83, 104, 97, 100, 111, 119, 67, 97, 115, 116, 108, 101, 118, 97, 110, 105, 97, 58,
+            32, 67, 117, 114, 115, 101, 32, 111, 102, 32, 68, 97, 114, 107, 110, 101, 115, 115, 75, 97,
+            114, 97, 111, 107, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 80, 97, 114,
+            116, 121, 87, 111, 114, 108, 100, 32, 83, 111, 99, 99, 101, 114, 32, 87, 105, 110, 110, 105,
+            110, 103, 32, 69, 108, 101, 118, 101, 110, 32, 57, 80, 114, 111, 32, 69, 118, 111, 108, 117,
+            116, 105, 111, 110, 32, 83, 111, 99, 99, 101, 114, 32, 53, 87, 97, 108, 108, 97, 99, 101,
+            32, 38, 32, 71, 114, 111, 109, 105, 116, 58, 32, 84, 104, 101, 32, 67, 117, 114, 115, 101,
+            32, 111, 102, 32, 116, 104, 101, 32, 87, 101, 114, 101, 45, 82, 97, 98, 98, 105, 116, 68,
+            97, 110, 99, 101, 32, 68, 97, 110, 99, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111,
+            110, 32, 85, 108, 116, 114, 97, 109, 105, 120, 32, 52, 88, 105, 97, 111, 108, 105, 110, 32,
+            83, 104, 111, 119, 100, 111, 119, 110, 82, 117, 109, 98, 108, 101, 32, 82, 111, 115, 101, 115,
+            32, 88, 88, 72, 101, 108, 108, 98, 111, 121, 32, 45, 32, 84, 104, 101, 32, 83, 99, 105,
+            101, 110, 99, 101, 32, 79, 102, 32, 69, 118, 105, 108, 80, 114, 111, 32, 69, 118, 111, 108,
+            117, 116, 105, 111, 110, 32, 83, 111, 99, 99, 101, 114, 32, 54, 68, 97, 110, 99, 101, 32,
+            68, 97, 110, 99, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 85, 110, 105,
+            118, 101, 114, 115, 101, 87, 105, 110, 110, 105, 110, 103, 32, 69, 108, 101, 118, 101, 110, 32,
+            50, 48, 48, 55, 82, 111, 99, 107, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 75,
+            97, 114, 97, 111, 107, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 45, 32,
+            65, 109, 101, 114, 105, 99, 97, 110, 32, 73, 100, 111, 108, 32, 69, 110, 99, 111, 114, 101,
+            83, 105, 108, 101, 110, 116, 32, 72, 105, 108, 108, 32, 72, 111, 109, 101, 99, 111, 109, 105,
+            110, 103, 80, 69, 83, 32, 50, 48, 48, 56, 68, 97, 110, 99, 101, 32, 68, 97, 110, 99,
+            101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 85, 110, 105, 118, 101, 114, 115,
+            101, 32, 50, 68, 97, 110, 99, 101, 32, 68, 97, 110, 99, 101, 32, 82, 101, 118, 111, 108,
+            117, 116, 105, 111, 110, 32, 85, 110, 105, 118, 101, 114, 115, 101, 32, 51, 80, 101, 115, 32,
+            50, 48, 48, 57, 75, 97, 114, 97, 111, 107, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105,
+            111, 110, 32, 45, 32, 65, 109, 101, 114, 105, 99, 97, 110, 32, 73, 100, 111, 108, 32, 69,
+            110, 99, 111, 114, 101, 32, 50, 80, 69, 83, 32, 50, 48, 48, 57, 80, 101, 115, 32, 50,
+            48, 49, 48, 83, 97, 119, 75, 97, 114, 97, 111, 107, 101, 32, 82, 101, 118, 111, 108, 117,
+            116, 105, 111, 110, 80, 69, 83, 32, 50, 48, 49, 48, 84, 111, 114, 110, 97, 100, 111, 32,
+            79, 117, 116, 98, 114, 101, 97, 107, 68, 97, 110, 99, 101, 32, 68, 97, 110, 99, 101, 32,
+            82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 67, 97, 115, 116, 108, 101, 118, 97, 110, 105,
+            97, 32, 45, 32, 76, 111, 114, 100, 32, 111, 102, 32, 83, 104, 97, 100, 111, 119, 77, 101,
+            116, 97, 108, 32, 71, 101, 97, 114, 32, 82, 105, 115, 105, 110, 103, 32, 45, 32, 82, 101,
+            118, 101, 110, 103, 101, 97, 110, 99, 101, 78, 105, 110, 101, 116, 121, 45, 78, 105, 110, 101,
+            32, 78, 105, 103, 104, 116, 115, 8545, 47, 78, 65, 78, 105, 110, 101, 116, 121, 45, 78, 105,
+            110, 101, 32, 78, 105, 103, 104, 116, 115, 47, 69, 117, 78, 105, 110, 101, 116, 121, 45, 78,
+            105, 110, 101, 32, 78, 105, 103, 104, 116, 115, 47, 74, 112, 65, 100, 114, 101, 110, 97, 108,
+            105, 110, 32, 77, 105, 115, 102, 105, 116, 115, 80, 69, 83, 32, 50, 48, 49, 49, 68, 97,
+            110, 99, 101, 32, 77, 97, 115, 116, 101, 114, 115, 78, 101, 118, 101, 114, 68, 101, 97, 100,
+            68, 101, 102, 32, 74, 97, 109, 32, 82, 97, 112, 115, 116, 97, 114, 83, 97, 119, 32, 73,
+            73, 83, 105, 108, 101, 110, 116, 32, 72, 105, 108, 108, 32, 45, 32, 68, 111, 119, 110, 112,
+            111, 117, 114, 67, 114, 111, 115, 115, 98, 111, 97, 114, 100, 32, 55, 80, 69, 83, 32, 50,
+            48, 49, 50, 66, 108, 97, 100, 101, 115, 32, 111, 102, 32, 84, 105, 109, 101, 66, 105, 114,
+            100, 115, 32, 111, 102, 32, 83, 116, 101, 101, 108, 79, 116, 111, 109, 101, 100, 105, 117, 115,
+            32, 69, 120, 99, 101, 108, 108, 101, 110, 116, 77, 101, 116, 97, 108, 32, 71, 101, 97, 114,
+            32, 83, 111, 108, 105, 100, 32, 45, 32, 80, 101, 97, 99, 101, 32, 87, 97, 108, 107, 101,
+            114, 75, 97, 114, 97, 111, 107, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32,
+            71, 108, 101, 101, 32, 45, 32, 86, 111, 108, 117, 109, 101, 32, 51, 77, 103, 115, 32, 50,
+            38, 51, 74, 105, 109, 109, 105, 101, 32, 74, 111, 104, 110, 115, 111, 110, 39, 115, 32, 65,
+            110, 121, 116, 104, 105, 110, 103, 32, 87, 105, 116, 104, 32, 65, 110, 32, 69, 110, 103, 105,
+            110, 101, 90, 111, 110, 101, 32, 111, 102, 32, 84, 104, 101, 32, 69, 110, 100, 101, 114, 115,
+            32, 45, 32, 72, 68, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 83, 105, 108, 101,
+            110, 116, 32, 72, 105, 108, 108, 32, 45, 32, 72, 68, 32, 67, 111, 108, 108, 101, 99, 116,
+            105, 111, 110, 80, 69, 83, 32, 50, 48, 49, 51, 67, 97, 115, 116, 108, 101, 118, 97, 110,
+            105, 97, 32, 45, 32, 76, 111, 114, 100, 32, 111, 102, 32, 83, 104, 97, 100, 111, 119, 32,
+            50, 80, 69, 83, 32, 50, 48, 49, 52, 77, 101, 116, 97, 108, 32, 71, 101, 97, 114, 32,
+            83, 111, 108, 105, 100, 32, 86, 32, 45, 32, 71, 114, 111, 117, 110, 100, 32, 90, 101, 114,
+            111, 101, 115, 77, 101, 116, 97, 108, 32, 71, 101, 97, 114, 32, 83, 111, 108, 105, 100, 32,
+            86, 32, 45, 32, 84, 104, 101, 32, 80, 104, 97, 110, 116, 111, 109, 32, 80, 97, 105, 110,
+            80, 69, 83, 32, 50, 48, 49, 53, 80, 69, 83, 32, 50, 48, 49, 54, 78, 111, 98, 117,
+            110, 97, 103, 97, 32, 110, 111, 32, 89, 97, 98, 111, 117, 58, 32, 82, 97, 110, 115, 101,
+            105, 107, 105, 75, 117, 114, 101, 110, 97, 105, 32, 110, 111, 32, 85, 109, 105, 58, 32, 67,
+            114, 105, 109, 115, 111, 110, 32, 83, 101, 97, 83, 104, 105, 110, 32, 83, 97, 110, 103, 111,
+            107, 117, 32, 77, 117, 115, 111, 117, 32, 50, 83, 104, 105, 110, 32, 83, 97, 110, 103, 111,
+            107, 117, 32, 77, 117, 115, 111, 117, 32, 51, 83, 101, 110, 103, 111, 107, 117, 32, 77, 117,
+            115, 111, 117, 83, 97, 109, 117, 114, 97, 105, 32, 87, 97, 114, 114, 105, 111, 114, 115, 83,
+            104, 105, 110, 32, 83, 97, 110, 103, 111, 107, 117, 32, 77, 117, 115, 111, 117, 32, 52, 87,
+            105, 110, 66, 97, 99, 107, 32, 50, 58, 32, 80, 114, 111, 106, 101, 99, 116, 32, 80, 111,
+            115, 101, 105, 100, 111, 110, 68, 121, 110, 97, 115, 116, 121, 32, 87, 97, 114, 114, 105, 111,
+            114, 115, 32, 53, 32, 45, 32, 69, 109, 112, 105, 114, 101, 115, 83, 97, 109, 117, 114, 97,
+            105, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 50, 83, 97, 109, 117, 114, 97, 105, 32,
+            87, 97, 114, 114, 105, 111, 114, 115, 32, 50, 32, 69, 109, 112, 105, 114, 101, 115, 70, 97,
+            116, 97, 108, 32, 73, 110, 101, 114, 116, 105, 97, 66, 108, 97, 100, 101, 115, 116, 111, 114,
+            109, 87, 97, 114, 114, 105, 111, 114, 115, 32, 79, 114, 111, 99, 104, 105, 68, 121, 110, 97,
+            115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 54, 68, 121, 110, 97, 115, 116,
+            121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 54, 87, 97, 114, 114, 105, 111, 114, 115,
+            32, 79, 114, 111, 99, 104, 105, 32, 50, 68, 121, 110, 97, 115, 116, 121, 32, 87, 97, 114,
+            114, 105, 111, 114, 115, 32, 54, 32, 45, 32, 69, 109, 112, 105, 114, 101, 115, 87, 97, 114,
+            114, 105, 111, 114, 115, 32, 45, 32, 76, 101, 103, 101, 110, 100, 115, 32, 111, 102, 32, 84,
+            114, 111, 121, 68, 121, 110, 97, 115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32,
+            45, 32, 83, 116, 114, 105, 107, 101, 102, 111, 114, 99, 101, 70, 105, 115, 116, 32, 111, 102,
+            32, 116, 104, 101, 32, 78, 111, 114, 116, 104, 32, 83, 116, 97, 114, 83, 105, 108, 101, 110,
+            116, 32, 72, 105, 108, 108, 32, 50, 58, 32, 83, 97, 105, 103, 111, 32, 110, 111, 32, 85,
+            116, 97, 73, 110, 110, 111, 99, 101, 110, 116, 32, 84, 101, 97, 114, 115, 68, 121, 110, 97,
+            115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 55, 78, 105, 110, 106, 97, 32,
+            71, 97, 105, 100, 101, 110, 32, 51, 67, 104, 97, 109, 112, 105, 111, 110, 32, 74, 111, 99,
+            107, 101, 121, 87, 97, 114, 114, 105, 111, 114, 115, 32, 79, 114, 111, 99, 104, 105, 32, 51,
+            68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 53, 87, 97, 114, 114, 105,
+            111, 114, 115, 32, 79, 114, 111, 99, 104, 105, 32, 51, 89, 97, 105, 98, 97, 32, 45, 32,
+            78, 105, 110, 106, 97, 32, 71, 97, 105, 100, 101, 110, 32, 90, 70, 105, 115, 116, 32, 111,
+            102, 32, 116, 104, 101, 32, 78, 111, 114, 116, 104, 32, 83, 116, 97, 114, 32, 45, 32, 75,
+            101, 110, 39, 115, 32, 114, 97, 103, 101, 32, 50, 78, 105, 110, 106, 97, 32, 71, 97, 105,
+            100, 101, 110, 32, 51, 32, 45, 32, 82, 97, 122, 111, 114, 39, 115, 32, 69, 100, 103, 101,
+            68, 121, 110, 97, 115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 56, 68, 101,
+            97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 53, 32, 45, 32, 76, 97, 115, 116,
+            32, 82, 111, 117, 110, 100, 84, 114, 111, 112, 105, 99, 111, 32, 51, 84, 104, 101, 32, 70,
+            105, 114, 115, 116, 32, 84, 101, 109, 112, 108, 97, 114, 68, 97, 114, 107, 83, 116, 97, 114,
+            32, 79, 110, 101, 84, 114, 111, 112, 105, 99, 111, 32, 52, 80, 111, 114, 116, 32, 82, 111,
+            121, 97, 108, 101, 32, 51, 65, 105, 114, 32, 67, 111, 110, 102, 108, 105, 99, 116, 115, 32,
+            45, 32, 83, 101, 99, 114, 101, 116, 32, 87, 97, 114, 115, 79, 109, 101, 114, 116, 97, 32,
+            45, 32, 67, 105, 116, 121, 32, 111, 102, 32, 71, 97, 110, 103, 115, 116, 101, 114, 115, 68,
+            97, 114, 107, 84, 114, 111, 112, 105, 99, 111, 32, 53, 83, 116, 97, 114, 32, 87, 97, 114,
+            115, 58, 32, 79, 98, 105, 45, 87, 97, 110, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58,
+            32, 83, 116, 97, 114, 102, 105, 103, 104, 116, 101, 114, 32, 83, 112, 101, 99, 105, 97, 108,
+            32, 69, 100, 105, 116, 105, 111, 110, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 67,
+            97, 98, 97, 108, 108, 101, 114, 111, 115, 32, 100, 101, 32, 108, 97, 32, 65, 110, 116, 105,
+            103, 117, 97, 32, 82, 101, 112, 250, 98, 108, 105, 99, 97, 83, 116, 97, 114, 32, 87, 97,
+            114, 115, 58, 32, 76, 97, 115, 32, 71, 117, 101, 114, 114, 97, 115, 32, 67, 108, 111, 110,
+            83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 74, 101, 100, 105, 32, 83, 116, 97, 114,
+            102, 105, 103, 104, 116, 101, 114, 83, 101, 99, 114, 101, 116, 32, 87, 101, 97, 112, 111, 110,
+            115, 32, 111, 118, 101, 114, 32, 78, 111, 114, 109, 97, 110, 100, 121, 73, 110, 100, 105, 97,
+            110, 97, 32, 74, 111, 110, 101, 115, 32, 97, 110, 100, 32, 116, 104, 101, 32, 69, 109, 112,
+            101, 114, 111, 114, 39, 115, 32, 84, 111, 109, 98, 71, 108, 97, 100, 105, 117, 115, 83, 116,
+            97, 114, 32, 87, 97, 114, 115, 58, 32, 74, 101, 100, 105, 32, 75, 110, 105, 103, 104, 116,
+            32, 73, 73, 58, 32, 74, 101, 100, 105, 32, 79, 117, 116, 99, 97, 115, 116, 83, 116, 97,
+            114, 32, 87, 97, 114, 115, 58, 32, 74, 101, 100, 105, 32, 75, 110, 105, 103, 104, 116, 58,
+            32, 74, 101, 100, 105, 32, 65, 99, 97, 100, 101, 109, 121, 65, 114, 109, 101, 100, 32, 97,
+            110, 100, 32, 68, 97, 110, 103, 101, 114, 111, 117, 115, 87, 114, 97, 116, 104, 32, 85, 110,
+            108, 101, 97, 115, 104, 101, 100, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 66, 97,
+            116, 116, 108, 101, 102, 114, 111, 110, 116, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32,
+            82, 101, 112, 117, 98, 108, 105, 99, 32, 67, 111, 109, 109, 97, 110, 100, 111, 83, 116, 97,
+            114, 32, 87, 97, 114, 115, 58, 32, 75, 110, 105, 103, 104, 116, 115, 32, 111, 102, 32, 116,
+            104, 101, 32, 79, 108, 100, 32, 82, 101, 112, 117, 98, 108, 105, 99, 32, 73, 73, 58, 32,
+            84, 104, 101, 32, 83, 105, 116, 104, 32, 76, 111, 114, 100, 115, 77, 101, 114, 99, 101, 110,
+            97, 114, 105, 101, 115, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 69, 112, 105, 115,
+            111, 100, 101, 32, 73, 73, 73, 58, 32, 68, 105, 101, 32, 82, 97, 99, 104, 101, 32, 100,
+            101, 114, 32, 83, 105, 116, 104, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 82, 101,
+            112, 117, 98, 108, 105, 99, 32, 67, 111, 109, 109, 97, 110, 100, 111, 83, 116, 97, 114, 32,
+            87, 97, 114, 115, 58, 32, 66, 97, 116, 116, 108, 101, 102, 114, 111, 110, 116, 32, 73, 73,
+            76, 69, 71, 79, 32, 83, 116, 97, 114, 32, 87, 97, 114, 115, 32, 73, 73, 58, 32, 84,
+            104, 101, 32, 79, 114, 105, 103, 105, 110, 97, 108, 32, 84, 114, 105, 108, 111, 103, 121, 84,
+            104, 114, 105, 108, 108, 118, 105, 108, 108, 101, 76, 101, 103, 111, 32, 83, 116, 97, 114, 32,
+            87, 97, 114, 115, 32, 73, 105, 83, 116, 97, 114, 32, 87, 97, 114, 115, 32, 45, 32, 84,
+            104, 101, 32, 70, 111, 114, 99, 101, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 70, 114,
+            97, 99, 116, 117, 114, 101, 84, 104, 114, 105, 108, 108, 118, 105, 108, 108, 101, 32, 45, 32,
+            79, 102, 102, 32, 116, 104, 101, 32, 82, 97, 105, 108, 115, 76, 69, 71, 79, 32, 83, 116,
+            97, 114, 32, 87, 97, 114, 115, 32, 45, 32, 84, 67, 83, 76, 69, 71, 79, 32, 73, 110,
+            100, 105, 97, 110, 97, 32, 74, 111, 110, 101, 115, 83, 116, 97, 114, 32, 87, 97, 114, 115,
+            32, 84, 104, 101, 32, 67, 108, 111, 110, 101, 32, 87, 97, 114, 115, 32, 45, 32, 82, 101,
+            112, 117, 98, 108, 105, 99, 32, 72, 101, 114, 111, 101, 115, 76, 69, 71, 79, 32, 73, 110,
+            100, 105, 97, 110, 97, 32, 74, 111, 110, 101, 115, 32, 50, 83, 116, 97, 114, 32, 87, 97,
+            114, 115, 32, 45, 32, 84, 104, 101, 32, 70, 111, 114, 99, 101, 32, 85, 110, 108, 101, 97,
+            115, 104, 101, 100, 32, 73, 73, 76, 69, 71, 79, 32, 83, 116, 97, 114, 32, 87, 97, 114,
+            115, 32, 73, 73, 73, 83, 67, 65, 82, 58, 32, 83, 113, 117, 97, 100, 114, 97, 32, 67,
+            111, 114, 115, 101, 32, 65, 108, 102, 97, 32, 82, 111, 109, 101, 111, 83, 66, 75, 48, 56,
+            83, 66, 75, 48, 57, 83, 66, 75, 88, 83, 117, 112, 101, 114, 115, 116, 97, 114, 115, 32,
+            86, 56, 32, 45, 32, 78, 101, 120, 116, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 78,
+            103, 113, 33, 32, 87, 105, 108, 100, 32, 76, 105, 102, 101, 87, 114, 99, 32, 50, 48, 49,
+            48, 71, 101, 116, 32, 70, 105, 116, 32, 87, 105, 116, 104, 32, 77, 101, 108, 32, 66, 83,
+            66, 75, 87, 114, 99, 32, 50, 77, 85, 68, 75, 117, 110, 103, 45, 70, 117, 84, 101, 97,
+            109, 32, 68, 90, 78, 32, 83, 99, 105, 45, 70, 105, 68, 101, 110, 110, 111, 117, 32, 84,
+            97, 105, 115, 101, 110, 58, 32, 68, 114, 111, 110, 101, 90, 83, 116, 97, 107, 101, 58, 32,
+            70, 111, 114, 116, 117, 110, 101, 32, 70, 105, 103, 104, 116, 101, 114, 115, 67, 46, 65, 46,
+            84, 58, 32, 67, 121, 98, 101, 114, 32, 65, 116, 116, 97, 99, 107, 32, 84, 101, 97, 109,
+            66, 97, 110, 100, 70, 117, 115, 101, 32, 45, 32, 82, 111, 99, 107, 32, 76, 101, 103, 101,
+            110, 100, 115, 72, 101, 97, 118, 121, 32, 70, 105, 114, 101, 32, 45, 32, 83, 104, 97, 116,
+            116, 101, 114, 101, 100, 32, 83, 112, 101, 97, 114, 84, 101, 110, 110, 105, 115, 32, 77, 97,
+            115, 116, 101, 114, 115, 32, 83, 101, 114, 105, 101, 115, 32, 50, 48, 48, 51, 75, 110, 105,
+            103, 104, 116, 39, 115, 32, 65, 112, 112, 114, 101, 110, 116, 105, 99, 101, 58, 32, 77, 101,
+            109, 111, 114, 105, 99, 107, 39, 115, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 32,
+            126, 32, 77, 101, 109, 111, 114, 105, 99, 107, 58, 32, 84, 104, 101, 32, 65, 112, 112, 114,
+            101, 110, 116, 105, 99, 101, 32, 75, 110, 105, 103, 104, 116, 83, 121, 98, 101, 114, 105, 97,
+            83, 121, 98, 101, 114, 105, 97, 32, 73, 73, 79, 98, 115, 67, 117, 114, 101, 83, 116, 105,
+            108, 108, 32, 76, 105, 102, 101, 82, 80, 77, 32, 84, 117, 110, 105, 110, 103, 83, 110, 105,
+            112, 101, 114, 32, 69, 108, 105, 116, 101, 66, 108, 111, 111, 100, 82, 97, 121, 110, 101, 84,
+            111, 116, 97, 108, 101, 100, 33, 71, 117, 110, 109, 101, 116, 97, 108, 66, 108, 111, 119, 111,
+            117, 116, 65, 100, 118, 101, 110, 116, 32, 82, 105, 115, 105, 110, 103, 68, 114, 97, 107, 101,
+            32, 111, 102, 32, 116, 104, 101, 32, 57, 57, 32, 68, 114, 97, 103, 111, 110, 115, 85, 108,
+            116, 114, 97, 32, 66, 117, 115, 116, 45, 65, 45, 77, 111, 118, 101, 66, 108, 111, 111, 100,
+            82, 97, 121, 110, 101, 32, 50, 74, 97, 119, 115, 32, 85, 110, 108, 101, 97, 115, 104, 101,
+            100, 82, 97, 122, 101, 39, 115, 32, 72, 101, 108, 108, 80, 115, 121, 99, 104, 111, 110, 97,
+            117, 116, 115, 84, 101, 101, 110, 32, 84, 105, 116, 97, 110, 115, 65, 101, 111, 110, 32, 70,
+            108, 117, 120, 87, 111, 114, 109, 115, 32, 52, 58, 32, 77, 97, 121, 104, 101, 109, 78, 105,
+            103, 104, 116, 32, 97, 116, 32, 116, 104, 101, 32, 77, 117, 115, 101, 117, 109, 32, 50, 80,
+            97, 105, 110, 116, 98, 97, 108, 108, 32, 50, 65, 116, 116, 97, 99, 107, 32, 79, 102, 32,
+            84, 104, 101, 32, 77, 111, 118, 105, 101, 115, 32, 51, 68, 90, 117, 109, 98, 97, 32, 70,
+            105, 116, 110, 101, 115, 115, 72, 117, 108, 107, 32, 72, 111, 103, 97, 110, 39, 115, 32, 77,
+            97, 105, 110, 32, 69, 118, 101, 110, 116, 84, 119, 105, 115, 116, 101, 114, 32, 77, 97, 110,
+            105, 97, 72, 97, 114, 108, 101, 121, 32, 80, 97, 115, 116, 101, 114, 110, 97, 107, 39, 115,
+            32, 72, 111, 108, 108, 121, 119, 111, 111, 100, 32, 87, 111, 114, 107, 111, 117, 116, 65, 108,
+            118, 105, 110, 32, 97, 110, 100, 32, 84, 104, 101, 32, 67, 104, 105, 112, 109, 117, 110, 107,
+            115, 32, 45, 32, 67, 104, 105, 112, 119, 114, 101, 99, 107, 101, 100, 74, 105, 108, 108, 105,
+            97, 110, 32, 77, 105, 99, 104, 97, 101, 108, 115, 32, 70, 105, 116, 110, 101, 115, 115, 32,
+            65, 100, 118, 101, 110, 116, 117, 114, 101, 77, 111, 116, 105, 111, 110, 32, 69, 120, 112, 108,
+            111, 115, 105, 111, 110, 90, 117, 109, 98, 97, 32, 70, 105, 116, 110, 101, 115, 115, 32, 45,
+            32, 82, 117, 115, 104, 78, 66, 65, 32, 66, 97, 108, 108, 101, 114, 32, 66, 101, 97, 116,
+            115, 90, 117, 109, 98, 97, 32, 70, 105, 116, 110, 101, 115, 115, 32, 67, 111, 114, 101, 90,
+            117, 109, 98, 97, 32, 70, 105, 116, 110, 101, 115, 115, 32, 87, 111, 114, 108, 100, 32, 80,
+            97, 114, 116, 121, 90, 117, 109, 98, 97, 32, 75, 105, 100, 115, 80, 111, 112, 67, 97, 112,
+            32, 72, 105, 116, 115, 65, 108, 105, 101, 110, 32, 66, 114, 101, 101, 100, 32, 84, 114, 105,
+            108, 111, 103, 121, 80, 111, 112, 67, 97, 112, 32, 72, 105, 116, 115, 32, 86, 111, 108, 46,
+            32, 50, 83, 101, 114, 105, 111, 117, 115, 32, 83, 97, 109, 32, 72, 68, 32, 45, 32, 84,
+            104, 101, 32, 70, 105, 114, 115, 116, 32, 97, 110, 100, 32, 83, 101, 99, 111, 110, 100, 32,
+            69, 110, 99, 111, 117, 110, 116, 101, 114, 115, 83, 116, 97, 99, 107, 101, 100, 32, 119, 105,
+            116, 104, 32, 68, 97, 110, 105, 101, 108, 32, 78, 101, 103, 114, 101, 97, 110, 117, 82, 97,
+            105, 100, 101, 110, 32, 73, 86, 77, 121, 115, 116, 32, 73, 73, 73, 58, 32, 69, 120, 105,
+            108, 101, 83, 104, 105, 107, 105, 103, 97, 109, 105, 32, 110, 111, 32, 83, 104, 105, 114, 111,
+            79, 100, 100, 119, 111, 114, 108, 100, 58, 32, 77, 117, 110, 99, 104, 39, 115, 32, 79, 100,
+            100, 121, 115, 101, 101, 70, 117, 122, 105, 111, 110, 32, 70, 114, 101, 110, 122, 121, 80, 114,
+            111, 106, 101, 99, 116, 32, 71, 111, 116, 104, 97, 109, 32, 82, 97, 99, 105, 110, 103, 72,
+            97, 108, 111, 65, 109, 112, 101, 100, 58, 32, 70, 114, 101, 101, 115, 116, 121, 108, 101, 32,
+            83, 110, 111, 119, 98, 111, 97, 114, 100, 105, 110, 103, 78, 70, 76, 32, 70, 101, 118, 101,
+            114, 32, 50, 48, 48, 50, 65, 122, 117, 114, 105, 107, 58, 32, 82, 105, 115, 101, 32, 111,
+            102, 32, 80, 101, 114, 97, 116, 104, 105, 97, 78, 105, 103, 104, 116, 32, 67, 97, 115, 116,
+            101, 114, 58, 32, 68, 101, 102, 101, 97, 116, 32, 116, 104, 101, 32, 68, 97, 114, 107, 110,
+            101, 115, 115, 83, 117, 100, 101, 107, 105, 58, 32, 83, 101, 110, 110, 101, 110, 32, 110, 111,
+            32, 65, 107, 97, 116, 115, 117, 107, 105, 32, 110, 111, 32, 77, 111, 110, 111, 103, 97, 116,
+            97, 114, 105, 78, 66, 65, 32, 73, 110, 115, 105, 100, 101, 32, 68, 114, 105, 118, 101, 32,
+            50, 48, 48, 52, 75, 97, 107, 117, 116, 111, 32, 67, 104, 111, 106, 105, 110, 70, 97, 98,
+            108, 101, 82, 97, 108, 108, 105, 83, 112, 111, 114, 116, 32, 67, 104, 97, 108, 108, 101, 110,
+            103, 101, 66, 108, 111, 111, 100, 32, 87, 97, 107, 101, 78, 66, 65, 32, 73, 110, 115, 105,
+            100, 101, 32, 68, 114, 105, 118, 101, 32, 50, 48, 48, 50, 66, 108, 105, 110, 120, 58, 32,
+            84, 104, 101, 32, 84, 105, 109, 101, 32, 83, 119, 101, 101, 112, 101, 114, 84, 97, 111, 32,
+            70, 101, 110, 103, 58, 32, 70, 105, 115, 116, 32, 111, 102, 32, 116, 104, 101, 32, 76, 111,
+            116, 117, 115, 81, 117, 97, 110, 116, 117, 109, 32, 82, 101, 100, 115, 104, 105, 102, 116, 58,
+            32, 107, 119, 111, 110, 116, 101, 111, 109, 32, 108, 101, 100, 101, 117, 115, 105, 112, 101, 117,
+            116, 101, 117, 77, 101, 99, 104, 65, 115, 115, 97, 117, 108, 116, 66, 114, 117, 116, 101, 32,
+            70, 111, 114, 99, 101, 67, 114, 105, 109, 115, 111, 110, 32, 83, 107, 105, 101, 115, 58, 32,
+            72, 105, 103, 104, 32, 82, 111, 97, 100, 32, 116, 111, 32, 82, 101, 118, 101, 110, 103, 101,
+            78, 101, 122, 109, 105, 120, 87, 104, 97, 99, 107, 101, 100, 33, 78, 70, 76, 32, 70, 101,
+            118, 101, 114, 32, 50, 48, 48, 51, 77, 105, 100, 116, 111, 119, 110, 32, 77, 97, 100, 110,
+            101, 115, 115, 32, 51, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 51,
+            77, 97, 120, 105, 109, 117, 109, 32, 67, 104, 97, 115, 101, 84, 101, 110, 107, 117, 58, 32,
+            70, 114, 101, 101, 115, 116, 121, 108, 101, 32, 83, 110, 111, 119, 98, 111, 97, 114, 100, 105,
+            110, 103, 74, 111, 99, 107, 101, 121, 39, 115, 32, 82, 111, 97, 100, 75, 117, 110, 103, 32,
+            70, 117, 32, 67, 104, 97, 111, 115, 83, 104, 101, 110, 109, 117, 101, 32, 73, 73, 73, 110,
+            115, 105, 100, 101, 32, 80, 105, 116, 99, 104, 32, 50, 48, 48, 51, 84, 111, 112, 32, 83,
+            112, 105, 110, 67, 111, 117, 110, 116, 101, 114, 45, 83, 116, 114, 105, 107, 101, 82, 97, 108,
+            108, 105, 83, 112, 111, 114, 116, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 32, 50, 78,
+            46, 85, 46, 68, 46, 69, 46, 64, 58, 32, 78, 97, 116, 117, 114, 97, 108, 32, 85, 108,
+            116, 105, 109, 97, 116, 101, 32, 68, 105, 103, 105, 116, 97, 108, 32, 69, 120, 112, 101, 114,
+            105, 109, 101, 110, 116, 83, 101, 103, 97, 32, 71, 84, 32, 50, 48, 48, 50, 32, 43, 32,
+            74, 83, 82, 70, 58, 32, 74, 101, 116, 32, 83, 101, 116, 32, 82, 97, 100, 105, 111, 32,
+            70, 117, 116, 117, 114, 101, 65, 109, 112, 101, 100, 32, 50, 78, 66, 65, 32, 73, 110, 115,
+            105, 100, 101, 32, 68, 114, 105, 118, 101, 32, 50, 48, 48, 51, 80, 104, 97, 110, 116, 111,
+            109, 32, 68, 117, 115, 116, 84, 104, 101, 32, 87, 105, 108, 100, 32, 82, 105, 110, 103, 115,
+            80, 104, 97, 110, 116, 97, 115, 121, 32, 83, 116, 97, 114, 32, 79, 110, 108, 105, 110, 101,
+            32, 69, 112, 105, 115, 111, 100, 101, 32, 73, 32, 38, 32, 73, 73, 80, 114, 111, 106, 101,
+            99, 116, 32, 71, 111, 116, 104, 97, 109, 32, 82, 97, 99, 105, 110, 103, 32, 50, 78, 70,
+            76, 32, 70, 101, 118, 101, 114, 32, 50, 48, 48, 52, 78, 72, 76, 32, 82, 105, 118, 97,
+            108, 115, 32, 50, 48, 48, 52, 67, 111, 110, 107, 101, 114, 58, 32, 76, 105, 118, 101, 32,
+            38, 32, 82, 101, 108, 111, 97, 100, 101, 100, 71, 114, 97, 98, 98, 101, 100, 32, 98, 121,
+            32, 116, 104, 101, 32, 71, 104, 111, 117, 108, 105, 101, 115, 72, 97, 108, 111, 58, 32, 67,
+            111, 109, 98, 97, 116, 32, 69, 118, 111, 108, 118, 101, 100, 72, 97, 108, 111, 58, 32, 74,
+            101, 111, 110, 106, 97, 101, 110, 103, 117, 105, 32, 83, 101, 111, 109, 97, 107, 80, 114, 111,
+            106, 101, 99, 116, 32, 90, 101, 114, 111, 88, 98, 111, 120, 32, 77, 117, 115, 105, 99, 32,
+            77, 105, 120, 101, 114, 76, 105, 110, 107, 115, 32, 50, 48, 48, 52, 86, 111, 111, 100, 111,
+            111, 32, 86, 105, 110, 99, 101, 72, 97, 108, 111, 32, 50, 66, 108, 105, 110, 120, 32, 50,
+            58, 32, 77, 97, 115, 116, 101, 114, 115, 32, 111, 102, 32, 84, 105, 109, 101, 32, 38, 32,
+            83, 112, 97, 99, 101, 32, 126, 32, 66, 108, 105, 110, 120, 32, 50, 58, 32, 66, 97, 116,
+            116, 108, 101, 32, 111, 102, 32, 84, 105, 109, 101, 32, 38, 32, 83, 112, 97, 99, 101, 77,
+            97, 103, 97, 116, 97, 109, 97, 68, 105, 110, 111, 115, 97, 117, 114, 32, 72, 117, 110, 116,
+            105, 110, 103, 58, 32, 85, 115, 104, 105, 110, 97, 119, 97, 114, 101, 116, 97, 32, 68, 97,
+            105, 99, 104, 105, 77, 101, 99, 104, 65, 115, 115, 97, 117, 108, 116, 32, 50, 58, 32, 76,
+            111, 110, 101, 32, 87, 111, 108, 102, 74, 97, 100, 101, 32, 69, 109, 112, 105, 114, 101, 70,
+            111, 114, 122, 97, 32, 77, 111, 116, 111, 114, 115, 112, 111, 114, 116, 88, 98, 111, 120, 32,
+            86, 105, 100, 101, 111, 32, 67, 104, 97, 116, 86, 111, 108, 118, 111, 58, 32, 68, 114, 105,
+            118, 101, 32, 102, 111, 114, 32, 76, 105, 102, 101, 88, 98, 111, 120, 32, 76, 105, 118, 101,
+            32, 65, 114, 99, 97, 100, 101, 70, 97, 98, 108, 101, 58, 32, 84, 104, 101, 32, 76, 111,
+            115, 116, 32, 67, 104, 97, 112, 116, 101, 114, 115, 66, 105, 103, 32, 66, 117, 109, 112, 105,
+            110, 39, 83, 110, 101, 97, 107, 32, 75, 105, 110, 103, 80, 111, 99, 107, 101, 116, 66, 105,
+            107, 101, 32, 82, 97, 99, 101, 114, 80, 103, 114, 32, 51, 75, 97, 109, 101, 111, 80, 101,
+            114, 102, 101, 99, 116, 32, 68, 97, 114, 107, 32, 90, 101, 114, 111, 71, 101, 97, 114, 115,
+            32, 111, 102, 32, 87, 97, 114, 83, 104, 97, 100, 111, 119, 114, 117, 110, 78, 105, 110, 101,
+            116, 121, 45, 78, 105, 110, 101, 32, 78, 105, 103, 104, 116, 115, 67, 114, 97, 99, 107, 100,
+            111, 119, 110, 84, 111, 111, 32, 72, 117, 109, 97, 110, 66, 108, 117, 101, 32, 68, 114, 97,
+            103, 111, 110, 72, 97, 108, 111, 32, 51, 77, 97, 115, 115, 32, 69, 102, 102, 101, 99, 116,
+            70, 111, 114, 122, 97, 32, 77, 111, 116, 111, 114, 115, 112, 111, 114, 116, 32, 50, 66, 97,
+            110, 106, 111, 32, 75, 97, 122, 111, 111, 105, 101, 32, 45, 32, 78, 32, 110, 32, 66, 70,
+            97, 98, 108, 101, 32, 73, 73, 86, 105, 118, 97, 32, 80, 105, 110, 97, 116, 97, 80, 114,
+            111, 106, 101, 99, 116, 32, 71, 111, 116, 104, 97, 109, 32, 82, 97, 99, 105, 110, 103, 32,
+            52, 76, 111, 115, 116, 32, 79, 100, 121, 115, 115, 101, 121, 65, 108, 97, 110, 32, 87, 97,
+            107, 101, 72, 97, 108, 111, 32, 87, 97, 114, 115, 80, 97, 114, 116, 121, 32, 65, 110, 105,
+            109, 97, 108, 115, 71, 101, 97, 114, 115, 32, 111, 102, 32, 87, 97, 114, 32, 50, 83, 99,
+            101, 110, 101, 32, 105, 116, 63, 32, 76, 105, 103, 104, 116, 115, 32, 67, 97, 109, 101, 114,
+            97, 32, 65, 99, 116, 105, 111, 110, 70, 111, 114, 122, 97, 32, 77, 111, 116, 111, 114, 115,
+            112, 111, 114, 116, 32, 51, 72, 97, 108, 111, 32, 45, 32, 82, 101, 97, 99, 104, 86, 105,
+            118, 97, 32, 80, 105, 110, 97, 116, 97, 32, 45, 32, 84, 114, 111, 117, 98, 108, 101, 32,
+            105, 110, 32, 80, 97, 114, 97, 100, 105, 115, 101, 83, 99, 101, 110, 101, 32, 105, 116, 63,
+            32, 66, 111, 120, 32, 79, 102, 102, 105, 99, 101, 32, 83, 109, 97, 115, 104, 72, 97, 108,
+            111, 32, 51, 32, 45, 32, 79, 68, 83, 84, 76, 105, 112, 115, 71, 101, 97, 114, 115, 32,
+            111, 102, 32, 87, 97, 114, 32, 51, 76, 105, 112, 115, 32, 45, 32, 78, 117, 109, 98, 101,
+            114, 32, 79, 110, 101, 32, 72, 105, 116, 115, 75, 105, 110, 101, 99, 116, 105, 109, 97, 108,
+            115, 67, 114, 97, 99, 107, 100, 111, 119, 110, 32, 50, 75, 105, 110, 101, 99, 116, 32, 83,
+            112, 111, 114, 116, 115, 72, 97, 108, 111, 32, 87, 97, 121, 112, 111, 105, 110, 116, 70, 97,
+            98, 108, 101, 32, 73, 73, 73, 75, 105, 110, 101, 99, 116, 32, 65, 100, 118, 101, 110, 116,
+            117, 114, 101, 115, 33, 71, 97, 109, 101, 32, 82, 111, 111, 109, 75, 105, 110, 101, 99, 116,
+            32, 83, 116, 97, 114, 32, 87, 97, 114, 115, 78, 105, 107, 101, 43, 32, 75, 105, 110, 101,
+            99, 116, 32, 84, 114, 97, 105, 110, 105, 110, 103, 70, 111, 114, 122, 97, 32, 77, 111, 116,
+            111, 114, 115, 112, 111, 114, 116, 32, 52, 72, 97, 108, 111, 32, 52, 75, 105, 110, 101, 99,
+            116, 32, 74, 111, 121, 32, 82, 105, 100, 101, 72, 97, 108, 111, 32, 45, 32, 67, 111, 109,
+            98, 97, 116, 32, 69, 118, 111, 108, 118, 101, 100, 32, 65, 110, 110, 105, 118, 101, 114, 115,
+            97, 114, 121, 75, 105, 110, 101, 99, 116, 32, 82, 117, 115, 104, 32, 45, 32, 65, 32, 68,
+            105, 115, 110, 101, 121, 32, 80, 105, 120, 97, 114, 32, 65, 100, 118, 101, 110, 116, 117, 114,
+            101, 68, 105, 115, 110, 101, 121, 108, 97, 110, 100, 32, 65, 100, 118, 101, 110, 116, 117, 114,
+            101, 115, 84, 114, 105, 112, 108, 101, 32, 80, 97, 99, 107, 70, 111, 114, 122, 97, 32, 72,
+            111, 114, 105, 122, 111, 110, 75, 105, 110, 101, 99, 116, 32, 78, 97, 116, 32, 71, 101, 111,
+            32, 84, 86, 32, 68, 86, 68, 75, 105, 110, 101, 99, 116, 32, 83, 112, 111, 114, 116, 115,
+            32, 45, 32, 83, 101, 97, 115, 111, 110, 32, 84, 119, 111, 75, 105, 110, 101, 99, 116, 32,
+            83, 101, 115, 97, 109, 101, 32, 83, 116, 114, 101, 101, 116, 32, 84, 86, 84, 104, 101, 32,
+            71, 117, 110, 115, 116, 114, 105, 110, 103, 101, 114, 80, 114, 101, 45, 82, 101, 108, 101, 97,
+            115, 101, 32, 67, 111, 110, 115, 111, 108, 101, 32, 82, 101, 103, 105, 115, 116, 114, 97, 116,
+            105, 111, 110, 32, 65, 112, 112, 108, 105, 99, 97, 105, 116, 111, 110, 70, 97, 98, 108, 101,
+            32, 45, 32, 84, 104, 101, 32, 74, 111, 117, 114, 110, 101, 121, 71, 101, 97, 114, 115, 32,
+            111, 102, 32, 87, 97, 114, 32, 45, 32, 74, 117, 100, 103, 109, 101, 110, 116, 75, 105, 110,
+            101, 99, 116, 32, 83, 112, 111, 114, 116, 115, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116,
+            101, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 75, 97, 114, 97, 111, 107, 101, 70,
+            97, 98, 108, 101, 32, 65, 110, 110, 105, 118, 101, 114, 115, 97, 114, 121, 87, 111, 114, 108,
+            100, 32, 111, 102, 32, 84, 97, 110, 107, 115, 32, 80, 117, 98, 108, 105, 99, 32, 84, 101,
+            115, 116, 87, 111, 114, 108, 100, 32, 111, 102, 32, 84, 97, 110, 107, 115, 90, 111, 111, 32,
+            84, 121, 99, 111, 111, 110, 70, 97, 98, 108, 101, 32, 84, 114, 105, 108, 111, 103, 121, 70,
+            111, 114, 122, 97, 32, 72, 111, 114, 105, 122, 111, 110, 32, 50, 87, 97, 114, 102, 97, 99,
+            101, 83, 99, 114, 101, 97, 109, 82, 105, 100, 101, 70, 111, 114, 122, 97, 32, 72, 111, 114,
+            105, 122, 111, 110, 32, 50, 32, 80, 114, 101, 115, 101, 110, 116, 115, 32, 70, 97, 115, 116,
+            32, 38, 32, 70, 117, 114, 105, 111, 117, 115, 72, 97, 108, 111, 32, 50, 32, 77, 117, 108,
+            116, 105, 112, 108, 97, 121, 101, 114, 32, 77, 97, 112, 32, 80, 97, 99, 107, 68, 101, 97,
+            100, 108, 121, 32, 80, 114, 101, 109, 111, 110, 105, 116, 105, 111, 110, 78, 70, 76, 32, 66,
+            108, 105, 116, 122, 32, 50, 48, 48, 50, 65, 114, 99, 116, 105, 99, 32, 84, 104, 117, 110,
+            100, 101, 114, 78, 72, 76, 32, 72, 105, 116, 122, 32, 50, 48, 48, 50, 83, 112, 121, 32,
+            72, 117, 110, 116, 101, 114, 65, 114, 101, 97, 32, 53, 49, 68, 101, 102, 101, 110, 100, 101,
+            114, 70, 114, 101, 97, 107, 121, 32, 70, 108, 121, 101, 114, 115, 77, 76, 66, 32, 83, 108,
+            117, 103, 70, 101, 115, 116, 32, 50, 48, 48, 51, 77, 76, 66, 32, 83, 108, 117, 103, 70,
+            101, 115, 116, 32, 50, 48, 48, 52, 78, 70, 76, 32, 66, 108, 105, 116, 122, 32, 50, 48,
+            48, 51, 78, 72, 76, 32, 72, 105, 116, 122, 32, 50, 48, 48, 51, 77, 111, 114, 116, 97,
+            108, 32, 75, 111, 109, 98, 97, 116, 58, 32, 68, 101, 97, 100, 108, 121, 32, 65, 108, 108,
+            105, 97, 110, 99, 101, 71, 114, 97, 118, 105, 116, 121, 32, 71, 97, 109, 101, 115, 32, 66,
+            105, 107, 101, 58, 32, 83, 116, 114, 101, 101, 116, 46, 32, 86, 101, 114, 116, 46, 32, 68,
+            105, 114, 116, 46, 71, 97, 117, 110, 116, 108, 101, 116, 58, 32, 68, 97, 114, 107, 32, 76,
+            101, 103, 97, 99, 121, 82, 101, 100, 67, 97, 114, 100, 78, 66, 65, 32, 66, 97, 108, 108,
+            101, 114, 115, 68, 114, 46, 32, 77, 117, 116, 111, 70, 105, 114, 101, 66, 108, 97, 100, 101,
+            78, 70, 76, 32, 66, 108, 105, 116, 122, 32, 80, 114, 111, 84, 104, 101, 32, 83, 117, 102,
+            102, 101, 114, 105, 110, 103, 80, 115, 105, 45, 79, 112, 115, 58, 32, 84, 104, 101, 32, 77,
+            105, 110, 100, 103, 97, 116, 101, 32, 67, 111, 110, 115, 112, 105, 114, 97, 99, 121, 70, 114,
+            101, 101, 115, 116, 121, 108, 101, 32, 77, 101, 116, 97, 108, 32, 88, 82, 111, 97, 100, 75,
+            105, 108, 108, 77, 111, 114, 116, 97, 108, 32, 75, 111, 109, 98, 97, 116, 58, 32, 68, 101,
+            99, 101, 112, 116, 105, 111, 110, 78, 72, 76, 32, 72, 105, 116, 122, 32, 80, 114, 111, 83,
+            112, 121, 32, 72, 117, 110, 116, 101, 114, 32, 50, 77, 105, 100, 119, 97, 121, 32, 65, 114,
+            99, 97, 100, 101, 32, 84, 114, 101, 97, 115, 117, 114, 101, 115, 77, 76, 66, 32, 83, 108,
+            117, 103, 70, 101, 115, 116, 58, 32, 76, 111, 97, 100, 101, 100, 77, 105, 100, 119, 97, 121,
+            32, 65, 114, 99, 97, 100, 101, 32, 84, 114, 101, 97, 115, 117, 114, 101, 115, 32, 50, 85,
+            110, 114, 101, 97, 108, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 50,
+            58, 32, 84, 104, 101, 32, 76, 105, 97, 110, 100, 114, 105, 32, 67, 111, 110, 102, 108, 105,
+            99, 116, 71, 97, 117, 110, 116, 108, 101, 116, 58, 32, 83, 101, 118, 101, 110, 32, 83, 111,
+            114, 114, 111, 119, 115, 77, 111, 114, 116, 97, 108, 32, 75, 111, 109, 98, 97, 116, 58, 32,
+            68, 101, 99, 101, 112, 116, 105, 111, 110, 78, 97, 114, 99, 76, 46, 65, 46, 32, 82, 117,
+            115, 104, 66, 108, 105, 116, 122, 58, 32, 84, 104, 101, 32, 76, 101, 97, 103, 117, 101, 77,
+            111, 114, 116, 97, 108, 32, 75, 111, 109, 98, 97, 116, 58, 32, 83, 104, 97, 111, 108, 105,
+            110, 32, 77, 111, 110, 107, 115, 84, 104, 101, 32, 83, 117, 102, 102, 101, 114, 105, 110, 103,
+            58, 32, 84, 105, 101, 115, 32, 84, 104, 97, 116, 32, 66, 105, 110, 100, 77, 105, 100, 119,
+            97, 121, 32, 65, 114, 99, 97, 100, 101, 32, 84, 114, 101, 97, 115, 117, 114, 101, 115, 32,
+            51, 78, 66, 65, 32, 66, 97, 108, 108, 101, 114, 115, 58, 32, 80, 104, 101, 110, 111, 109,
+            69, 100, 44, 32, 69, 100, 100, 32, 110, 32, 69, 100, 100, 121, 58, 32, 84, 104, 101, 32,
+            77, 105, 115, 45, 69, 100, 118, 101, 110, 116, 117, 114, 101, 115, 71, 97, 117, 110, 116, 108,
+            101, 116, 58, 32, 83, 101, 118, 101, 110, 32, 83, 111, 114, 114, 111, 119, 115, 77, 111, 114,
+            116, 97, 108, 32, 75, 111, 109, 98, 97, 116, 58, 32, 65, 114, 109, 97, 103, 101, 100, 100,
+            111, 110, 83, 112, 121, 32, 72, 117, 110, 116, 101, 114, 58, 32, 78, 111, 119, 104, 101, 114,
+            101, 32, 116, 111, 32, 82, 117, 110, 77, 76, 66, 32, 83, 108, 117, 103, 70, 101, 115, 116,
+            32, 50, 48, 48, 54, 84, 104, 105, 115, 32, 73, 115, 32, 86, 101, 103, 97, 115, 66, 108,
+            105, 116, 122, 32, 45, 32, 84, 104, 101, 32, 76, 101, 97, 103, 117, 101, 87, 104, 101, 101,
+            108, 109, 97, 110, 66, 108, 97, 99, 107, 115, 105, 116, 101, 72, 111, 117, 114, 32, 111, 102,
+            32, 86, 105, 99, 116, 111, 114, 121, 78, 66, 65, 32, 66, 97, 108, 108, 101, 114, 115, 32,
+            45, 67, 104, 111, 115, 101, 110, 32, 79, 110, 101, 85, 110, 114, 101, 97, 108, 32, 84, 111,
+            117, 114, 110, 97, 109, 101, 110, 116, 32, 51, 84, 78, 65, 32, 105, 77, 80, 65, 67, 84,
+            33, 72, 111, 117, 114, 32, 79, 102, 32, 86, 105, 99, 116, 111, 114, 121, 32, 40, 80, 99,
+            41, 66, 108, 105, 116, 122, 32, 45, 32, 84, 104, 101, 32, 76, 101, 97, 103, 117, 101, 32,
+            73, 73, 77, 111, 114, 116, 97, 108, 32, 75, 111, 109, 98, 97, 116, 32, 118, 115, 46, 32,
+            68, 67, 85, 68, 114, 101, 97, 109, 102, 97, 108, 108, 58, 32, 84, 104, 101, 32, 76, 111,
+            110, 103, 101, 115, 116, 32, 74, 111, 117, 114, 110, 101, 121, 68, 97, 109, 97, 103, 101, 32,
+            73, 110, 99, 46, 32, 45, 32, 80, 97, 99, 105, 102, 105, 99, 32, 83, 113, 117, 97, 100,
+            114, 111, 110, 32, 87, 87, 73, 73, 84, 111, 109, 32, 97, 110, 100, 32, 74, 101, 114, 114,
+            121, 32, 105, 110, 32, 87, 97, 114, 32, 111, 102, 32, 116, 104, 101, 32, 87, 104, 105, 115,
+            107, 101, 114, 115, 68, 101, 108, 116, 97, 32, 70, 111, 114, 99, 101, 58, 32, 66, 108, 97,
+            99, 107, 32, 72, 97, 119, 107, 32, 68, 111, 119, 110, 83, 109, 97, 115, 104, 105, 110, 103,
+            32, 68, 114, 105, 118, 101, 83, 111, 117, 108, 99, 97, 108, 105, 98, 117, 114, 32, 73, 73,
+            68, 101, 97, 100, 32, 116, 111, 32, 82, 105, 103, 104, 116, 115, 80, 97, 99, 45, 77, 97,
+            110, 32, 87, 111, 114, 108, 100, 32, 50, 78, 97, 109, 99, 111, 32, 77, 117, 115, 101, 117,
+            109, 82, 58, 82, 97, 99, 105, 110, 103, 32, 69, 118, 111, 108, 117, 116, 105, 111, 110, 58,
+            32, 76, 105, 102, 101, 32, 105, 110, 32, 116, 104, 101, 32, 70, 97, 115, 116, 32, 76, 97,
+            110, 101, 66, 114, 101, 97, 107, 100, 111, 119, 110, 75, 105, 108, 108, 32, 83, 119, 105, 116,
+            99, 104, 83, 112, 97, 119, 110, 58, 32, 65, 114, 109, 97, 103, 101, 100, 100, 111, 110, 73,
+            45, 78, 105, 110, 106, 97, 83, 82, 83, 58, 32, 83, 116, 114, 101, 101, 116, 32, 82, 97,
+            99, 105, 110, 103, 32, 83, 121, 110, 100, 105, 99, 97, 116, 101, 68, 101, 97, 100, 32, 116,
+            111, 32, 82, 105, 103, 104, 116, 115, 32, 73, 73, 78, 97, 109, 99, 111, 32, 77, 117, 115,
+            101, 117, 109, 32, 53, 48, 116, 104, 32, 65, 110, 110, 105, 118, 101, 114, 115, 97, 114, 121,
+            80, 97, 99, 45, 77, 97, 110, 32, 87, 111, 114, 108, 100, 32, 51, 67, 117, 114, 105, 111,
+            117, 115, 32, 71, 101, 111, 114, 103, 101, 65, 99, 101, 32, 67, 111, 109, 98, 97, 116, 32,
+            54, 82, 105, 100, 103, 101, 32, 82, 97, 99, 101, 114, 32, 54, 65, 102, 114, 111, 32, 83,
+            97, 109, 117, 114, 97, 105, 66, 101, 97, 117, 116, 105, 102, 117, 108, 32, 75, 97, 116, 97,
+            109, 97, 114, 105, 87, 97, 114, 104, 97, 109, 109, 101, 114, 32, 45, 32, 66, 97, 116, 116,
+            108, 101, 32, 77, 97, 114, 99, 104, 83, 111, 117, 108, 99, 97, 108, 105, 98, 117, 114, 32,
+            73, 86, 69, 116, 101, 114, 110, 97, 108, 32, 83, 111, 110, 97, 116, 97, 69, 116, 101, 114,
+            110, 97, 108, 32, 83, 111, 110, 97, 116, 97, 68, 121, 110, 97, 115, 116, 121, 32, 87, 97,
+            114, 114, 105, 111, 114, 115, 32, 45, 32, 71, 117, 110, 100, 97, 109, 84, 97, 108, 101, 115,
+            32, 111, 102, 32, 86, 101, 115, 112, 101, 114, 105, 97, 83, 109, 97, 115, 104, 32, 67, 111,
+            117, 114, 116, 32, 84, 101, 110, 110, 105, 115, 32, 51, 83, 112, 108, 97, 116, 116, 101, 114,
+            104, 111, 117, 115, 101, 69, 110, 115, 108, 97, 118, 101, 100, 68, 116, 114, 32, 45, 32, 82,
+            101, 116, 114, 105, 98, 117, 116, 105, 111, 110, 84, 69, 75, 75, 69, 78, 32, 54, 68, 121,
+            110, 97, 115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 45, 32, 71, 117, 110,
+            100, 97, 109, 32, 50, 73, 110, 118, 101, 114, 115, 105, 111, 110, 68, 114, 97, 103, 111, 110,
+            32, 66, 97, 108, 108, 32, 45, 32, 82, 97, 103, 105, 110, 103, 32, 66, 108, 97, 115, 116,
+            84, 97, 108, 101, 115, 32, 79, 102, 32, 86, 101, 115, 112, 101, 114, 105, 97, 77, 97, 103,
+            110, 97, 99, 97, 114, 116, 97, 50, 77, 97, 103, 110, 97, 99, 97, 114, 116, 97, 50, 77,
+            97, 106, 105, 110, 32, 97, 110, 100, 32, 116, 104, 101, 32, 70, 111, 114, 115, 97, 107, 101,
+            110, 32, 75, 105, 110, 103, 100, 111, 109, 78, 97, 114, 117, 116, 111, 32, 83, 104, 105, 112,
+            112, 117, 100, 101, 110, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 78, 105, 110,
+            106, 97, 32, 83, 116, 111, 114, 109, 32, 50, 67, 108, 97, 115, 104, 32, 111, 102, 32, 116,
+            104, 101, 32, 84, 105, 116, 97, 110, 115, 65, 99, 101, 32, 67, 111, 109, 98, 97, 116, 32,
+            45, 32, 65, 115, 115, 97, 117, 108, 116, 32, 72, 111, 114, 105, 122, 111, 110, 65, 115, 115,
+            97, 117, 108, 116, 104, 111, 114, 105, 122, 111, 110, 75, 110, 105, 103, 104, 116, 115, 32, 67,
+            111, 110, 116, 114, 97, 99, 116, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32, 45,
+            32, 82, 97, 103, 105, 110, 103, 32, 66, 108, 97, 115, 116, 32, 50, 66, 111, 100, 121, 32,
+            97, 110, 100, 32, 66, 114, 97, 105, 110, 32, 67, 111, 110, 110, 101, 99, 116, 105, 111, 110,
+            68, 121, 110, 97, 115, 116, 121, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 45, 32, 71,
+            117, 110, 100, 97, 109, 32, 51, 68, 97, 114, 107, 32, 83, 111, 117, 108, 115, 83, 111, 117,
+            108, 99, 97, 108, 105, 98, 117, 114, 32, 86, 82, 105, 100, 103, 101, 32, 82, 97, 99, 101,
+            114, 32, 85, 110, 98, 111, 117, 110, 100, 101, 100, 83, 84, 79, 82, 77, 32, 71, 101, 110,
+            101, 114, 97, 116, 105, 111, 110, 115, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32,
+            90, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 84, 101, 110, 107, 97, 105, 99,
+            104, 105, 80, 111, 119, 101, 114, 32, 82, 97, 110, 103, 101, 114, 115, 32, 83, 117, 112, 101,
+            114, 32, 83, 97, 109, 117, 114, 97, 105, 65, 99, 101, 32, 67, 111, 109, 98, 97, 116, 32,
+            45, 32, 65, 104, 32, 68, 101, 109, 111, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108,
+            32, 90, 32, 102, 111, 114, 32, 75, 105, 110, 101, 99, 116, 65, 114, 109, 111, 114, 101, 100,
+            32, 67, 111, 114, 101, 32, 86, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32, 90,
+            32, 66, 117, 100, 111, 107, 97, 105, 32, 72, 68, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            111, 110, 84, 69, 75, 75, 69, 78, 32, 84, 65, 71, 32, 84, 79, 85, 82, 78, 65, 77,
+            69, 78, 84, 32, 50, 83, 116, 97, 114, 32, 84, 114, 101, 107, 78, 97, 114, 117, 116, 111,
+            32, 83, 104, 105, 112, 112, 117, 100, 101, 110, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116,
+            101, 32, 78, 105, 110, 106, 97, 32, 83, 116, 111, 114, 109, 32, 51, 68, 114, 97, 103, 111,
+            110, 32, 66, 97, 108, 108, 32, 90, 32, 45, 32, 66, 97, 116, 116, 108, 101, 32, 111, 102,
+            32, 90, 68, 114, 97, 103, 111, 110, 32, 66, 97, 108, 108, 32, 88, 101, 110, 111, 118, 101,
+            114, 115, 101, 65, 114, 109, 111, 114, 101, 100, 32, 67, 111, 114, 101, 32, 45, 32, 86, 101,
+            114, 100, 105, 99, 116, 32, 68, 97, 121, 80, 65, 67, 45, 77, 65, 78, 32, 97, 110, 100,
+            32, 116, 104, 101, 32, 71, 104, 111, 115, 116, 108, 121, 32, 65, 100, 118, 101, 110, 116, 117,
+            114, 101, 115, 78, 97, 114, 117, 116, 111, 32, 83, 104, 105, 112, 112, 117, 100, 101, 110, 32,
+            45, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 78, 105, 110, 106, 97, 32, 83, 116, 111,
+            114, 109, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 68, 105, 103, 105, 109, 111, 110,
+            32, 45, 32, 65, 108, 108, 45, 83, 116, 97, 114, 32, 82, 117, 109, 98, 108, 101, 80, 65,
+            67, 45, 77, 65, 78, 32, 97, 110, 100, 32, 116, 104, 101, 32, 71, 104, 111, 115, 116, 108,
+            121, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 32, 50, 80, 100, 99, 32, 87, 111,
+            114, 108, 100, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 68, 97, 114,
+            116, 115, 32, 45, 32, 80, 114, 111, 32, 84, 111, 117, 114, 69, 118, 101, 114, 121, 111, 110,
+            101, 32, 83, 105, 110, 103, 67, 110, 32, 45, 32, 80, 116, 101, 120, 108, 78, 65, 83, 67,
+            65, 82, 32, 39, 49, 53, 32, 86, 105, 99, 116, 111, 114, 121, 32, 69, 100, 105, 116, 105,
+            111, 110, 67, 111, 110, 115, 112, 105, 114, 97, 99, 121, 58, 32, 87, 101, 97, 112, 111, 110,
+            115, 32, 111, 102, 32, 77, 97, 115, 115, 32, 68, 101, 115, 116, 114, 117, 99, 116, 105, 111,
+            110, 80, 105, 108, 111, 116, 32, 68, 111, 119, 110, 58, 32, 66, 101, 104, 105, 110, 100, 32,
+            69, 110, 101, 109, 121, 32, 76, 105, 110, 101, 115, 80, 114, 111, 83, 116, 114, 111, 107, 101,
+            32, 71, 111, 108, 102, 58, 32, 87, 111, 114, 108, 100, 32, 84, 111, 117, 114, 32, 50, 48,
+            48, 55, 88, 121, 97, 110, 105, 100, 101, 73, 110, 102, 101, 114, 110, 97, 108, 80, 111, 112,
+            67, 97, 112, 32, 65, 114, 99, 97, 100, 101, 80, 104, 97, 110, 116, 111, 109, 32, 67, 114,
+            97, 115, 104, 75, 105, 110, 103, 100, 111, 109, 32, 85, 110, 100, 101, 114, 32, 70, 105, 114,
+            101, 58, 32, 84, 104, 101, 32, 67, 114, 117, 115, 97, 100, 101, 114, 115, 75, 105, 110, 103,
+            100, 111, 109, 32, 85, 110, 100, 101, 114, 32, 70, 105, 114, 101, 58, 32, 84, 104, 101, 32,
+            67, 114, 117, 115, 97, 100, 101, 114, 115, 75, 105, 110, 103, 100, 111, 109, 32, 85, 110, 100,
+            101, 114, 32, 70, 105, 114, 101, 58, 32, 84, 104, 101, 32, 67, 114, 117, 115, 97, 100, 101,
+            114, 115, 75, 105, 110, 103, 100, 111, 109, 32, 85, 110, 100, 101, 114, 32, 70, 105, 114, 101,
+            58, 32, 72, 101, 114, 111, 101, 115, 77, 88, 71, 80, 77, 111, 116, 111, 71, 80, 32, 49,
+            52, 82, 105, 100, 101, 68, 101, 97, 100, 108, 105, 101, 115, 116, 32, 87, 97, 114, 114, 105,
+            111, 114, 32, 45, 32, 65, 110, 99, 105, 101, 110, 116, 32, 67, 111, 109, 98, 97, 116, 68,
+            97, 118, 105, 100, 32, 66, 101, 99, 107, 104, 97, 109, 32, 83, 111, 99, 99, 101, 114, 67,
+            114, 97, 115, 104, 82, 111, 99, 107, 121, 71, 117, 110, 109, 101, 116, 97, 108, 89, 111, 117,
+            114, 115, 101, 108, 102, 33, 70, 105, 116, 110, 101, 115, 115, 79, 122, 32, 84, 104, 101, 32,
+            71, 114, 101, 97, 116, 32, 97, 110, 100, 32, 80, 111, 119, 101, 114, 102, 117, 108, 67, 114,
+            97, 115, 104, 32, 84, 105, 109, 101, 67, 114, 97, 115, 104, 32, 84, 105, 109, 101, 32, 73,
+            105, 87, 105, 110, 116, 101, 114, 32, 83, 112, 111, 114, 116, 115, 32, 50, 48, 49, 48, 67,
+            114, 97, 115, 104, 32, 84, 105, 109, 101, 32, 51, 83, 117, 109, 109, 101, 114, 32, 67, 104,
+            97, 108, 108, 101, 110, 103, 101, 67, 97, 108, 97, 100, 114, 105, 117, 115, 71, 117, 105, 108,
+            116, 121, 32, 71, 101, 97, 114, 32, 88, 88, 32, 35, 82, 101, 108, 111, 97, 100, 58, 32,
+            84, 104, 101, 32, 77, 105, 100, 110, 105, 103, 104, 116, 32, 67, 97, 114, 110, 105, 118, 97,
+            108, 73, 114, 111, 110, 32, 80, 104, 111, 101, 110, 105, 120, 71, 117, 105, 108, 116, 121, 32,
+            71, 101, 97, 114, 32, 88, 50, 32, 35, 82, 101, 108, 111, 97, 100, 58, 32, 84, 104, 101,
+            32, 77, 105, 100, 110, 105, 103, 104, 116, 32, 67, 97, 114, 110, 105, 118, 97, 108, 67, 111,
+            110, 102, 108, 105, 99, 116, 58, 32, 68, 101, 115, 101, 114, 116, 32, 83, 116, 111, 114, 109,
+            84, 104, 101, 32, 71, 114, 101, 97, 116, 32, 69, 115, 99, 97, 112, 101, 82, 105, 99, 104,
+            97, 114, 100, 32, 66, 117, 114, 110, 115, 32, 82, 97, 108, 108, 121, 67, 111, 110, 102, 108,
+            105, 99, 116, 58, 32, 68, 101, 115, 101, 114, 116, 32, 83, 116, 111, 114, 109, 32, 73, 73,
+            58, 32, 66, 97, 99, 107, 32, 116, 111, 32, 66, 97, 103, 104, 100, 97, 100, 82, 111, 108,
+            108, 105, 110, 103, 67, 111, 110, 102, 108, 105, 99, 116, 58, 32, 86, 105, 101, 116, 110, 97,
+            109, 71, 97, 108, 108, 101, 111, 110, 67, 111, 110, 102, 108, 105, 99, 116, 58, 32, 71, 108,
+            111, 98, 97, 108, 32, 84, 101, 114, 114, 111, 114, 82, 111, 103, 117, 101, 32, 84, 114, 111,
+            111, 112, 101, 114, 67, 111, 110, 115, 116, 97, 110, 116, 105, 110, 101, 84, 111, 116, 97, 108,
+            32, 79, 118, 101, 114, 100, 111, 115, 101, 85, 114, 98, 97, 110, 32, 67, 104, 97, 111, 115,
+            58, 32, 82, 105, 111, 116, 32, 82, 101, 115, 112, 111, 110, 115, 101, 67, 111, 109, 109, 97,
+            110, 100, 111, 115, 58, 32, 83, 116, 114, 105, 107, 101, 32, 70, 111, 114, 99, 101, 72, 105,
+            116, 109, 97, 110, 58, 32, 66, 108, 111, 111, 100, 32, 77, 111, 110, 101, 121, 74, 117, 115,
+            116, 32, 67, 97, 117, 115, 101, 76, 97, 114, 97, 32, 67, 114, 111, 102, 116, 32, 84, 111,
+            109, 98, 32, 82, 97, 105, 100, 101, 114, 58, 32, 76, 101, 103, 101, 110, 100, 82, 101, 115,
+            101, 114, 118, 111, 105, 114, 32, 68, 111, 103, 115, 67, 104, 97, 109, 112, 105, 111, 110, 115,
+            104, 105, 112, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48, 54, 67, 111, 110, 102,
+            108, 105, 99, 116, 32, 45, 32, 68, 101, 110, 105, 101, 100, 32, 79, 112, 115, 84, 111, 109,
+            98, 32, 82, 97, 105, 100, 101, 114, 32, 45, 32, 76, 101, 103, 101, 110, 100, 74, 117, 115,
+            116, 32, 67, 97, 117, 115, 101, 66, 97, 116, 116, 108, 101, 115, 116, 97, 116, 105, 111, 110,
+            115, 32, 45, 32, 77, 105, 100, 119, 97, 121, 72, 105, 116, 109, 97, 110, 32, 45, 32, 66,
+            108, 111, 111, 100, 32, 77, 111, 110, 101, 121, 75, 97, 110, 101, 32, 97, 110, 100, 32, 76,
+            121, 110, 99, 104, 32, 45, 68, 101, 97, 100, 77, 101, 110, 66, 105, 111, 110, 105, 99, 108,
+            101, 32, 72, 101, 114, 111, 101, 115, 109, 105, 110, 105, 32, 110, 105, 110, 106, 97, 115, 83,
+            104, 101, 108, 108, 115, 104, 111, 99, 107, 32, 50, 74, 117, 115, 116, 32, 67, 97, 117, 115,
+            101, 32, 50, 66, 97, 116, 116, 108, 101, 115, 116, 97, 116, 105, 111, 110, 115, 32, 80, 97,
+            99, 105, 102, 105, 99, 84, 111, 109, 98, 32, 82, 97, 105, 100, 101, 114, 32, 45, 32, 65,
+            110, 110, 105, 118, 101, 114, 115, 97, 114, 121, 84, 111, 109, 98, 32, 82, 97, 105, 100, 101,
+            114, 32, 85, 110, 100, 101, 114, 119, 111, 114, 108, 100, 66, 97, 116, 109, 97, 110, 32, 45,
+            32, 65, 114, 107, 104, 97, 109, 32, 65, 115, 121, 108, 117, 109, 75, 97, 110, 101, 32, 38,
+            32, 76, 121, 110, 99, 104, 32, 50, 66, 97, 116, 109, 97, 110, 32, 45, 32, 65, 97, 32,
+            71, 111, 116, 121, 87, 97, 121, 32, 79, 102, 32, 84, 104, 101, 32, 83, 97, 109, 117, 114,
+            97, 105, 32, 51, 78, 66, 65, 32, 50, 75, 50, 83, 101, 103, 97, 32, 71, 84, 32, 50,
+            48, 48, 50, 67, 114, 97, 122, 121, 32, 84, 97, 120, 105, 32, 51, 58, 32, 72, 105, 103,
+            104, 32, 82, 111, 108, 108, 101, 114, 78, 70, 76, 32, 50, 75, 50, 80, 97, 110, 122, 101,
+            114, 32, 68, 114, 97, 103, 111, 111, 110, 32, 79, 114, 116, 97, 84, 104, 101, 32, 72, 111,
+            117, 115, 101, 32, 111, 102, 32, 116, 104, 101, 32, 68, 101, 97, 100, 32, 73, 73, 73, 74,
+            83, 82, 70, 58, 32, 74, 101, 116, 32, 83, 101, 116, 32, 82, 97, 100, 105, 111, 32, 70,
+            117, 116, 117, 114, 101, 71, 117, 110, 32, 86, 97, 108, 107, 121, 114, 105, 101, 87, 111, 114,
+            108, 100, 32, 83, 101, 114, 105, 101, 115, 32, 66, 97, 115, 101, 98, 97, 108, 108, 84, 111,
+            101, 74, 97, 109, 32, 38, 32, 69, 97, 114, 108, 32, 73, 73, 73, 58, 32, 77, 105, 115,
+            115, 105, 111, 110, 32, 116, 111, 32, 69, 97, 114, 116, 104, 78, 67, 65, 65, 32, 67, 111,
+            108, 108, 101, 103, 101, 32, 70, 111, 111, 116, 98, 97, 108, 108, 32, 50, 75, 51, 78, 70,
+            76, 32, 50, 75, 51, 78, 66, 65, 32, 50, 75, 51, 83, 101, 103, 97, 32, 83, 111, 99,
+            99, 101, 114, 32, 83, 108, 97, 109, 78, 72, 76, 32, 50, 75, 51, 78, 67, 65, 65, 32,
+            67, 111, 108, 108, 101, 103, 101, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108, 32, 50,
+            75, 51, 87, 111, 114, 108, 100, 32, 83, 101, 114, 105, 101, 115, 32, 66, 97, 115, 101, 98,
+            97, 108, 108, 32, 50, 75, 51, 82, 101, 110, 116, 32, 97, 32, 72, 101, 114, 111, 32, 78,
+            111, 46, 32, 49, 78, 66, 65, 32, 50, 75, 51, 78, 70, 76, 32, 50, 75, 51, 78, 72,
+            76, 32, 50, 75, 51, 83, 101, 103, 97, 32, 71, 84, 32, 79, 110, 108, 105, 110, 101, 69,
+            83, 80, 78, 32, 78, 70, 76, 32, 70, 111, 111, 116, 98, 97, 108, 108, 69, 83, 80, 78,
+            32, 78, 66, 65, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108, 69, 83, 80, 78, 32,
+            67, 111, 108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 72, 101, 97, 100, 104, 117, 110,
+            116, 101, 114, 58, 32, 82, 101, 100, 101, 109, 112, 116, 105, 111, 110, 69, 83, 80, 78, 32,
+            78, 72, 76, 32, 72, 111, 99, 107, 101, 121, 80, 117, 121, 111, 32, 80, 111, 112, 32, 70,
+            101, 118, 101, 114, 69, 83, 80, 78, 32, 77, 97, 106, 111, 114, 32, 76, 101, 97, 103, 117,
+            101, 32, 66, 97, 115, 101, 98, 97, 108, 108, 83, 112, 105, 107, 101, 111, 117, 116, 58, 32,
+            66, 97, 116, 116, 108, 101, 32, 83, 116, 114, 101, 101, 116, 87, 111, 114, 109, 115, 32, 51,
+            68, 83, 111, 110, 105, 99, 32, 72, 101, 114, 111, 101, 115, 69, 83, 80, 78, 32, 78, 70,
+            76, 32, 70, 111, 111, 116, 98, 97, 108, 108, 69, 83, 80, 78, 32, 78, 72, 76, 32, 72,
+            111, 99, 107, 101, 121, 69, 83, 80, 78, 32, 78, 66, 65, 32, 66, 97, 115, 107, 101, 116,
+            98, 97, 108, 108, 69, 83, 80, 78, 32, 78, 70, 76, 32, 50, 75, 53, 69, 83, 80, 78,
+            32, 78, 66, 65, 32, 50, 75, 53, 69, 83, 80, 78, 32, 78, 72, 76, 32, 50, 75, 53,
+            69, 83, 80, 78, 32, 67, 111, 108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 32, 50,
+            75, 53, 87, 111, 114, 109, 115, 32, 70, 111, 114, 116, 115, 58, 32, 85, 110, 100, 101, 114,
+            32, 83, 105, 101, 103, 101, 79, 117, 116, 82, 117, 110, 32, 50, 77, 97, 106, 111, 114, 32,
+            76, 101, 97, 103, 117, 101, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 75, 53, 83,
+            117, 112, 101, 114, 32, 77, 111, 110, 107, 101, 121, 32, 66, 97, 108, 108, 32, 68, 101, 108,
+            117, 120, 101, 83, 111, 110, 105, 99, 32, 77, 101, 103, 97, 32, 67, 111, 108, 108, 101, 99,
+            116, 105, 111, 110, 32, 80, 108, 117, 115, 69, 83, 80, 78, 32, 78, 66, 65, 32, 50, 75,
+            53, 87, 111, 114, 108, 100, 32, 83, 110, 111, 111, 107, 101, 114, 32, 67, 104, 97, 109, 112,
+            105, 111, 110, 115, 104, 105, 112, 32, 50, 48, 48, 53, 83, 112, 97, 114, 116, 97, 110, 58,
+            32, 84, 111, 116, 97, 108, 32, 87, 97, 114, 114, 105, 111, 114, 83, 104, 97, 100, 111, 119,
+            32, 116, 104, 101, 32, 72, 101, 100, 103, 101, 104, 111, 103, 83, 111, 110, 105, 99, 32, 82,
+            105, 100, 101, 114, 115, 79, 117, 116, 82, 117, 110, 32, 50, 48, 48, 54, 58, 32, 67, 111,
+            97, 115, 116, 32, 50, 32, 67, 111, 97, 115, 116, 83, 112, 97, 114, 116, 97, 110, 58, 32,
+            84, 111, 116, 97, 108, 32, 87, 97, 114, 114, 105, 111, 114, 70, 111, 111, 116, 98, 97, 108,
+            108, 32, 77, 97, 110, 97, 103, 101, 114, 32, 50, 48, 48, 54, 67, 111, 110, 100, 101, 109,
+            110, 101, 100, 67, 104, 114, 111, 109, 101, 104, 111, 117, 110, 100, 115, 70, 117, 108, 108, 32,
+            65, 117, 116, 111, 83, 111, 110, 105, 99, 32, 84, 104, 101, 32, 72, 101, 100, 103, 101, 104,
+            111, 103, 84, 104, 101, 32, 67, 108, 117, 98, 86, 105, 107, 105, 110, 103, 86, 105, 114, 116,
+            117, 97, 32, 84, 101, 110, 110, 105, 115, 32, 51, 80, 104, 97, 110, 116, 97, 115, 121, 32,
+            83, 116, 97, 114, 32, 85, 110, 105, 118, 101, 114, 115, 101, 71, 111, 108, 100, 101, 110, 32,
+            65, 120, 101, 32, 45, 66, 101, 97, 115, 116, 32, 82, 105, 100, 101, 114, 83, 69, 71, 65,
+            32, 82, 97, 108, 108, 121, 84, 104, 101, 32, 71, 111, 108, 100, 101, 110, 32, 67, 111, 109,
+            112, 97, 115, 115, 86, 105, 114, 116, 117, 97, 32, 70, 105, 103, 104, 116, 101, 114, 32, 53,
+            67, 111, 110, 100, 101, 109, 110, 101, 100, 32, 50, 32, 45, 32, 66, 108, 111, 111, 100, 115,
+            104, 111, 116, 85, 110, 105, 118, 101, 114, 115, 101, 32, 65, 116, 32, 87, 97, 114, 84, 104,
+            101, 32, 73, 110, 99, 114, 101, 100, 105, 98, 108, 101, 32, 72, 117, 108, 107, 73, 114, 111,
+            110, 32, 77, 97, 110, 66, 101, 105, 106, 105, 110, 103, 32, 50, 48, 48, 56, 83, 101, 103,
+            97, 32, 83, 117, 112, 101, 114, 115, 116, 97, 114, 115, 32, 84, 101, 110, 110, 105, 115, 83,
+            116, 111, 114, 109, 114, 105, 115, 101, 65, 108, 105, 101, 110, 115, 32, 45, 32, 67, 111, 108,
+            111, 110, 105, 97, 108, 32, 77, 97, 114, 105, 110, 101, 115, 65, 108, 112, 104, 97, 32, 80,
+            114, 111, 116, 111, 99, 111, 108, 83, 111, 110, 105, 99, 39, 115, 32, 85, 108, 116, 105, 109,
+            97, 116, 101, 32, 71, 101, 110, 101, 115, 105, 115, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            111, 110, 83, 111, 110, 105, 99, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 66, 97, 121,
+            111, 110, 101, 116, 116, 97, 86, 105, 114, 116, 117, 97, 32, 84, 101, 110, 110, 105, 115, 32,
+            50, 48, 48, 57, 83, 111, 110, 105, 99, 32, 38, 32, 83, 69, 71, 65, 32, 82, 97, 99,
+            105, 110, 103, 86, 97, 110, 99, 111, 117, 118, 101, 114, 32, 50, 48, 49, 48, 83, 101, 103,
+            97, 32, 77, 101, 103, 97, 32, 68, 114, 105, 118, 101, 32, 85, 99, 65, 108, 105, 101, 110,
+            115, 32, 118, 115, 32, 80, 114, 101, 100, 97, 116, 111, 114, 69, 110, 100, 32, 79, 102, 32,
+            69, 116, 101, 114, 110, 105, 116, 121, 73, 114, 111, 110, 32, 77, 97, 110, 32, 50, 82, 101,
+            115, 111, 110, 97, 110, 99, 101, 32, 111, 102, 32, 70, 97, 116, 101, 65, 110, 97, 114, 99,
+            104, 121, 32, 82, 101, 105, 103, 110, 115, 86, 97, 110, 113, 117, 105, 115, 104, 76, 111, 110,
+            100, 111, 110, 32, 50, 48, 49, 50, 84, 104, 111, 114, 32, 45, 32, 71, 111, 100, 32, 111,
+            102, 32, 84, 104, 117, 110, 100, 101, 114, 82, 105, 115, 101, 32, 111, 102, 32, 78, 105, 103,
+            104, 116, 109, 97, 114, 101, 115, 83, 111, 110, 105, 99, 32, 71, 101, 110, 101, 114, 97, 116,
+            105, 111, 110, 115, 83, 111, 110, 105, 99, 32, 70, 114, 101, 101, 32, 82, 105, 100, 101, 114,
+            115, 86, 105, 114, 116, 117, 97, 32, 84, 101, 110, 110, 105, 115, 32, 52, 67, 97, 112, 116,
+            97, 105, 110, 32, 65, 109, 101, 114, 105, 99, 97, 32, 45, 32, 83, 117, 112, 101, 114, 32,
+            83, 111, 108, 100, 105, 101, 114, 68, 114, 101, 97, 109, 99, 97, 115, 116, 32, 67, 111, 108,
+            108, 101, 99, 116, 105, 111, 110, 66, 105, 110, 97, 114, 121, 32, 68, 111, 109, 97, 105, 110,
+            83, 111, 110, 105, 99, 32, 38, 32, 65, 108, 108, 45, 83, 116, 97, 114, 115, 32, 82, 97,
+            99, 105, 110, 103, 32, 84, 114, 97, 110, 115, 102, 111, 114, 109, 101, 100, 65, 108, 105, 101,
+            110, 32, 45, 32, 73, 115, 111, 108, 97, 116, 105, 111, 110, 87, 105, 108, 108, 105, 97, 109,
+            115, 32, 80, 105, 110, 98, 97, 108, 108, 32, 67, 108, 97, 115, 115, 105, 99, 115, 83, 78,
+            75, 32, 118, 115, 46, 32, 67, 97, 112, 99, 111, 109, 58, 32, 83, 86, 67, 32, 67, 104,
+            97, 111, 115, 77, 101, 116, 97, 108, 32, 83, 108, 117, 103, 32, 51, 84, 104, 101, 32, 75,
+            105, 110, 103, 32, 111, 102, 32, 70, 105, 103, 104, 116, 101, 114, 115, 32, 50, 48, 48, 51,
+            83, 97, 109, 117, 114, 97, 105, 32, 83, 104, 111, 100, 111, 119, 110, 32, 86, 77, 101, 116,
+            97, 108, 32, 83, 108, 117, 103, 32, 52, 84, 104, 101, 32, 75, 105, 110, 103, 32, 111, 102,
+            32, 70, 105, 103, 104, 116, 101, 114, 115, 32, 50, 48, 48, 50, 75, 79, 70, 58, 32, 77,
+            97, 120, 105, 109, 117, 109, 32, 73, 109, 112, 97, 99, 116, 58, 32, 77, 97, 110, 105, 97,
+            120, 77, 101, 116, 97, 108, 32, 83, 108, 117, 103, 32, 53, 84, 104, 101, 32, 75, 105, 110,
+            103, 32, 111, 102, 32, 70, 105, 103, 104, 116, 101, 114, 115, 58, 32, 78, 101, 111, 119, 97,
+            118, 101, 75, 79, 70, 32, 88, 73, 73, 83, 97, 109, 117, 114, 97, 105, 32, 83, 104, 111,
+            100, 111, 119, 110, 32, 83, 101, 110, 84, 104, 101, 32, 75, 105, 110, 103, 32, 111, 102, 32,
+            70, 105, 103, 104, 116, 101, 114, 115, 32, 88, 73, 73, 73, 67, 111, 109, 98, 97, 116, 32,
+            69, 108, 105, 116, 101, 58, 32, 87, 87, 73, 73, 32, 80, 97, 114, 97, 116, 114, 111, 111,
+            112, 101, 114, 115, 84, 119, 111, 32, 87, 111, 114, 108, 100, 115, 88, 45, 66, 108, 97, 100,
+            101, 115, 80, 104, 97, 110, 116, 111, 109, 32, 66, 114, 101, 97, 107, 101, 114, 80, 108, 97,
+            121, 111, 110, 108, 105, 110, 101, 32, 86, 105, 101, 119, 101, 114, 80, 114, 111, 106, 101, 99,
+            116, 32, 83, 121, 108, 112, 104, 101, 101, 100, 83, 101, 101, 107, 101, 114, 115, 32, 111, 102,
+            32, 65, 100, 111, 117, 108, 105, 110, 84, 104, 101, 32, 76, 97, 115, 116, 32, 82, 101, 109,
+            110, 97, 110, 116, 73, 110, 102, 105, 110, 105, 116, 101, 32, 85, 110, 100, 105, 115, 99, 111,
+            118, 101, 114, 121, 83, 116, 97, 114, 32, 79, 99, 101, 97, 110, 32, 45, 32, 84, 104, 101,
+            32, 76, 97, 115, 116, 32, 72, 111, 112, 101, 83, 117, 112, 114, 101, 109, 101, 32, 67, 111,
+            109, 109, 97, 110, 100, 101, 114, 32, 50, 70, 105, 110, 97, 108, 32, 70, 97, 110, 116, 97,
+            115, 121, 32, 88, 73, 73, 73, 78, 73, 69, 82, 70, 114, 111, 110, 116, 32, 77, 105, 115,
+            115, 105, 111, 110, 32, 69, 118, 111, 108, 118, 101, 100, 77, 105, 110, 100, 106, 97, 99, 107,
+            68, 117, 110, 103, 101, 111, 110, 32, 83, 105, 101, 103, 101, 32, 73, 73, 73, 68, 101, 117,
+            115, 32, 69, 120, 32, 45, 32, 72, 117, 109, 97, 110, 32, 82, 101, 118, 111, 108, 117, 116,
+            105, 111, 110, 84, 111, 109, 98, 32, 82, 97, 105, 100, 101, 114, 84, 104, 105, 101, 102, 72,
+            105, 116, 109, 97, 110, 32, 45, 32, 65, 98, 115, 111, 108, 117, 116, 105, 111, 110, 70, 105,
+            110, 97, 108, 32, 70, 97, 110, 116, 97, 115, 121, 32, 88, 73, 73, 73, 45, 50, 83, 108,
+            101, 101, 112, 105, 110, 103, 32, 68, 111, 103, 115, 76, 105, 103, 104, 116, 110, 105, 110, 103,
+            32, 82, 101, 116, 117, 114, 110, 115, 32, 45, 32, 70, 105, 110, 97, 108, 32, 70, 97, 110,
+            116, 97, 115, 121, 32, 88, 73, 73, 73, 72, 105, 116, 109, 97, 110, 32, 72, 68, 32, 80,
+            97, 99, 107, 77, 117, 114, 100, 101, 114, 101, 100, 32, 45, 32, 83, 111, 117, 108, 32, 83,
+            117, 115, 112, 101, 99, 116, 82, 105, 115, 101, 32, 111, 102, 32, 116, 104, 101, 32, 84, 111,
+            109, 98, 32, 82, 97, 105, 100, 101, 114, 79, 117, 116, 108, 97, 119, 32, 86, 111, 108, 108,
+            101, 121, 98, 97, 108, 108, 79, 117, 116, 108, 97, 119, 32, 71, 111, 108, 102, 58, 32, 57,
+            32, 77, 111, 114, 101, 32, 72, 111, 108, 101, 115, 32, 111, 102, 32, 88, 45, 77, 97, 115,
+            79, 117, 116, 108, 97, 119, 32, 86, 111, 108, 108, 101, 121, 98, 97, 108, 108, 79, 117, 116,
+            108, 97, 119, 32, 86, 111, 108, 108, 101, 121, 98, 97, 108, 108, 58, 32, 82, 101, 100, 32,
+            72, 111, 116, 79, 117, 116, 108, 97, 119, 32, 71, 111, 108, 102, 58, 32, 72, 111, 108, 105,
+            100, 97, 121, 32, 71, 111, 108, 102, 90, 105, 108, 108, 101, 114, 110, 101, 116, 66, 105, 115,
+            116, 114, 111, 32, 67, 117, 112, 105, 100, 78, 97, 107, 97, 106, 105, 109, 97, 32, 84, 101,
+            116, 115, 117, 121, 97, 32, 110, 111, 32, 79, 116, 104, 101, 108, 108, 111, 32, 83, 101, 109,
+            105, 110, 97, 114, 85, 109, 101, 122, 97, 119, 97, 32, 89, 117, 107, 97, 114, 105, 32, 110,
+            111, 32, 73, 103, 111, 32, 83, 101, 109, 105, 110, 97, 114, 89, 111, 110, 101, 110, 97, 103,
+            97, 32, 75, 117, 110, 105, 111, 32, 110, 111, 32, 83, 104, 111, 117, 103, 105, 32, 83, 101,
+            109, 105, 110, 97, 114, 84, 97, 107, 97, 104, 97, 115, 104, 105, 32, 74, 117, 110, 107, 111,
+            32, 110, 111, 32, 77, 97, 104, 106, 111, 110, 103, 32, 83, 101, 109, 105, 110, 97, 114, 84,
+            101, 116, 114, 105, 115, 32, 87, 111, 114, 108, 100, 115, 65, 110, 103, 101, 108, 105, 99, 32,
+            67, 111, 110, 99, 101, 114, 116, 66, 105, 115, 116, 114, 111, 32, 67, 117, 112, 105, 100, 32,
+            50, 80, 115, 121, 118, 97, 114, 105, 97, 114, 32, 50, 58, 32, 69, 120, 116, 101, 110, 100,
+            32, 69, 100, 105, 116, 105, 111, 110, 71, 114, 101, 97, 116, 32, 66, 97, 116, 116, 108, 101,
+            115, 32, 77, 101, 100, 105, 101, 118, 97, 108, 72, 105, 115, 116, 111, 114, 121, 32, 45, 32,
+            76, 101, 103, 101, 110, 100, 115, 32, 111, 102, 32, 87, 97, 114, 69, 110, 99, 108, 97, 118,
+            101, 75, 105, 107, 111, 117, 32, 72, 101, 105, 100, 97, 110, 32, 74, 45, 80, 104, 111, 101,
+            110, 105, 120, 32, 43, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 51,
+            78, 105, 110, 106, 97, 32, 71, 97, 105, 100, 101, 110, 70, 97, 116, 97, 108, 32, 70, 114,
+            97, 109, 101, 58, 32, 90, 101, 114, 111, 32, 83, 112, 101, 99, 105, 97, 108, 32, 69, 100,
+            105, 116, 105, 111, 110, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 50,
+            32, 85, 108, 116, 105, 109, 97, 116, 101, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105,
+            118, 101, 32, 88, 116, 114, 101, 109, 101, 32, 66, 101, 97, 99, 104, 32, 86, 111, 108, 108,
+            101, 121, 98, 97, 108, 108, 71, 117, 110, 103, 114, 105, 102, 102, 111, 110, 58, 32, 65, 108,
+            108, 105, 101, 100, 32, 83, 116, 114, 105, 107, 101, 70, 97, 116, 97, 108, 32, 70, 114, 97,
+            109, 101, 32, 73, 73, 58, 32, 67, 114, 105, 109, 115, 111, 110, 32, 66, 117, 116, 116, 101,
+            114, 102, 108, 121, 71, 117, 110, 103, 114, 105, 102, 102, 111, 110, 58, 32, 65, 108, 108, 105,
+            101, 100, 32, 83, 116, 114, 105, 107, 101, 78, 105, 110, 106, 97, 32, 71, 97, 105, 100, 101,
+            110, 32, 66, 108, 97, 99, 107, 84, 101, 99, 109, 111, 32, 67, 108, 97, 115, 115, 105, 99,
+            32, 65, 114, 99, 97, 100, 101, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101,
+            32, 52, 68, 101, 97, 100, 32, 111, 114, 32, 65, 108, 105, 118, 101, 32, 88, 116, 114, 101,
+            109, 101, 32, 50, 78, 105, 110, 106, 97, 32, 71, 97, 105, 100, 101, 110, 32, 50, 81, 117,
+            97, 110, 116, 117, 109, 32, 84, 104, 101, 111, 114, 121, 81, 117, 97, 110, 116, 117, 109, 32,
+            84, 104, 101, 111, 114, 121, 72, 105, 103, 104, 32, 72, 101, 97, 116, 32, 77, 97, 106, 111,
+            114, 32, 76, 101, 97, 103, 117, 101, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 48,
+            48, 52, 77, 97, 103, 105, 32, 68, 101, 97, 116, 104, 32, 70, 105, 103, 104, 116, 33, 80,
+            108, 117, 115, 32, 80, 108, 117, 109, 98, 32, 50, 83, 104, 114, 101, 107, 82, 111, 98, 111,
+            116, 101, 99, 104, 58, 32, 66, 97, 116, 116, 108, 101, 99, 114, 121, 65, 113, 117, 97, 109,
+            97, 110, 58, 32, 66, 97, 116, 116, 108, 101, 32, 102, 111, 114, 32, 65, 116, 108, 97, 110,
+            116, 105, 115, 83, 104, 114, 101, 107, 32, 83, 117, 112, 101, 114, 32, 80, 97, 114, 116, 121,
+            87, 111, 114, 108, 100, 32, 82, 97, 99, 105, 110, 103, 79, 117, 116, 108, 97, 119, 32, 71,
+            111, 108, 102, 75, 110, 105, 103, 104, 116, 115, 32, 111, 102, 32, 116, 104, 101, 32, 84, 101,
+            109, 112, 108, 101, 58, 32, 73, 110, 102, 101, 114, 110, 97, 108, 32, 67, 114, 117, 115, 97,
+            100, 101, 67, 111, 110, 97, 110, 83, 101, 97, 66, 108, 97, 100, 101, 85, 70, 67, 58, 32,
+            85, 108, 116, 105, 109, 97, 116, 101, 32, 70, 105, 103, 104, 116, 105, 110, 103, 32, 67, 104,
+            97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 58, 32, 84, 97, 112, 111, 117, 116, 32, 50,
+            67, 111, 114, 118, 101, 116, 116, 101, 68, 105, 115, 110, 101, 121, 39, 115, 32, 84, 104, 101,
+            32, 72, 97, 117, 110, 116, 101, 100, 32, 77, 97, 110, 115, 105, 111, 110, 68, 105, 110, 111,
+            116, 111, 112, 105, 97, 58, 32, 84, 104, 101, 32, 83, 117, 110, 115, 116, 111, 110, 101, 32,
+            79, 100, 121, 115, 115, 101, 121, 83, 116, 97, 114, 32, 84, 114, 101, 107, 58, 32, 83, 104,
+            97, 116, 116, 101, 114, 101, 100, 32, 85, 110, 105, 118, 101, 114, 115, 101, 71, 101, 110, 101,
+            32, 84, 114, 111, 111, 112, 101, 114, 115, 87, 111, 114, 108, 100, 32, 82, 97, 99, 105, 110,
+            103, 32, 50, 75, 110, 105, 103, 104, 116, 115, 32, 111, 102, 32, 116, 104, 101, 32, 84, 101,
+            109, 112, 108, 101, 32, 73, 73, 78, 101, 119, 32, 76, 101, 103, 101, 110, 100, 115, 87, 87,
+            69, 32, 82, 97, 119, 77, 88, 32, 50, 48, 48, 50, 32, 102, 101, 97, 116, 117, 114, 105,
+            110, 103, 32, 82, 105, 99, 107, 121, 32, 67, 97, 114, 109, 105, 99, 104, 97, 101, 108, 68,
+            97, 114, 107, 32, 83, 117, 109, 109, 105, 116, 82, 101, 100, 32, 70, 97, 99, 116, 105, 111,
+            110, 32, 73, 73, 89, 97, 103, 101, 114, 84, 111, 120, 105, 99, 32, 71, 114, 105, 110, 100,
+            77, 111, 116, 111, 71, 80, 70, 73, 76, 65, 32, 87, 111, 114, 108, 100, 32, 84, 111, 117,
+            114, 32, 84, 101, 110, 110, 105, 115, 84, 101, 116, 114, 105, 115, 32, 87, 111, 114, 108, 100,
+            115, 69, 118, 105, 108, 32, 68, 101, 97, 100, 58, 32, 65, 32, 70, 105, 115, 116, 102, 117,
+            108, 32, 111, 102, 32, 66, 111, 111, 109, 115, 116, 105, 99, 107, 67, 105, 114, 99, 117, 115,
+            32, 77, 97, 120, 105, 109, 117, 115, 58, 32, 67, 104, 97, 114, 105, 111, 116, 32, 87, 97,
+            114, 115, 87, 87, 69, 32, 82, 97, 119, 32, 50, 83, 99, 111, 111, 98, 121, 45, 68, 111,
+            111, 33, 32, 77, 121, 115, 116, 101, 114, 121, 32, 77, 97, 121, 104, 101, 109, 65, 108, 116,
+            101, 114, 32, 69, 99, 104, 111, 77, 88, 32, 83, 117, 112, 101, 114, 70, 108, 121, 77, 101,
+            116, 97, 108, 32, 68, 117, 110, 103, 101, 111, 110, 77, 111, 116, 111, 71, 80, 32, 50, 84,
+            104, 101, 32, 80, 117, 110, 105, 115, 104, 101, 114, 78, 105, 99, 107, 101, 108, 111, 100, 101,
+            111, 110, 32, 83, 112, 111, 110, 103, 101, 66, 111, 98, 32, 83, 113, 117, 97, 114, 101, 80,
+            97, 110, 116, 115, 58, 32, 66, 97, 116, 116, 108, 101, 32, 102, 111, 114, 32, 66, 105, 107,
+            105, 110, 105, 32, 66, 111, 116, 116, 111, 109, 84, 101, 116, 114, 105, 115, 32, 87, 111, 114,
+            108, 100, 115, 66, 114, 111, 107, 101, 110, 32, 83, 119, 111, 114, 100, 58, 32, 84, 104, 101,
+            32, 83, 108, 101, 101, 112, 105, 110, 103, 32, 68, 114, 97, 103, 111, 110, 68, 105, 115, 110,
+            101, 121, 47, 80, 105, 120, 97, 114, 32, 78, 101, 109, 111, 45, 114, 101, 117, 108, 32, 67,
+            104, 97, 106, 97, 115, 101, 111, 83, 99, 111, 111, 98, 121, 45, 68, 111, 111, 33, 32, 78,
+            105, 103, 104, 116, 32, 111, 102, 32, 49, 48, 48, 32, 70, 114, 105, 103, 104, 116, 115, 84,
+            104, 101, 32, 70, 97, 105, 114, 108, 121, 32, 79, 100, 100, 80, 97, 114, 101, 110, 116, 115,
+            58, 32, 66, 114, 101, 97, 107, 105, 110, 39, 32, 100, 97, 32, 82, 117, 108, 101, 115, 77,
+            88, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 70, 117, 108, 108, 32, 83, 112, 101, 99,
+            116, 114, 117, 109, 32, 87, 97, 114, 114, 105, 111, 114, 83, 112, 104, 105, 110, 120, 32, 97,
+            110, 100, 32, 116, 104, 101, 32, 67, 117, 114, 115, 101, 100, 32, 77, 117, 109, 109, 121, 87,
+            87, 69, 32, 87, 114, 101, 115, 116, 108, 101, 77, 97, 110, 105, 97, 32, 50, 49, 69, 118,
+            105, 108, 32, 68, 101, 97, 100, 58, 32, 82, 101, 103, 101, 110, 101, 114, 97, 116, 105, 111,
+            110, 68, 101, 115, 116, 114, 111, 121, 32, 65, 108, 108, 32, 72, 117, 109, 97, 110, 115, 33,
+            78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 83, 112, 111, 110, 103, 101, 66, 111,
+            98, 32, 83, 99, 104, 119, 97, 109, 109, 107, 111, 112, 102, 58, 32, 68, 101, 114, 32, 70,
+            105, 108, 109, 68, 105, 115, 110, 101, 121, 47, 80, 105, 120, 97, 114, 32, 84, 104, 101, 32,
+            73, 110, 99, 114, 101, 100, 105, 98, 108, 101, 115, 77, 111, 116, 111, 71, 80, 58, 32, 85,
+            108, 116, 105, 109, 97, 116, 101, 32, 82, 97, 99, 105, 110, 103, 32, 84, 101, 99, 104, 110,
+            111, 108, 111, 103, 121, 32, 51, 72, 111, 116, 32, 87, 104, 101, 101, 108, 115, 58, 32, 83,
+            116, 117, 110, 116, 32, 84, 114, 97, 99, 107, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101,
+            78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 84, 97, 107, 32, 50, 58, 32, 84,
+            104, 101, 32, 83, 116, 97, 102, 102, 32, 111, 102, 32, 68, 114, 101, 97, 109, 115, 77, 88,
+            32, 118, 115, 46, 32, 65, 84, 86, 32, 85, 110, 108, 101, 97, 115, 104, 101, 100, 74, 117,
+            105, 99, 101, 100, 68, 105, 115, 110, 101, 121, 47, 80, 105, 120, 97, 114, 32, 67, 97, 114,
+            115, 78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 84, 97, 107, 58, 32, 68, 105,
+            101, 32, 103, 114, 111, 223, 101, 32, 74, 117, 106, 117, 45, 74, 97, 103, 100, 65, 70, 76,
+            32, 76, 105, 118, 101, 32, 80, 114, 101, 109, 105, 101, 114, 115, 104, 105, 112, 32, 69, 100,
+            105, 116, 105, 111, 110, 68, 105, 115, 110, 101, 121, 47, 80, 105, 120, 97, 114, 32, 84, 104,
+            101, 32, 73, 110, 99, 114, 101, 100, 105, 98, 108, 101, 115, 58, 32, 82, 105, 115, 101, 32,
+            111, 102, 32, 116, 104, 101, 32, 85, 110, 100, 101, 114, 109, 105, 110, 101, 114, 83, 99, 111,
+            111, 98, 121, 45, 68, 111, 111, 33, 32, 85, 110, 109, 97, 115, 107, 101, 100, 70, 117, 108,
+            108, 32, 83, 112, 101, 99, 116, 114, 117, 109, 32, 87, 97, 114, 114, 105, 111, 114, 58, 32,
+            84, 101, 110, 32, 72, 97, 109, 109, 101, 114, 115, 87, 87, 69, 32, 87, 114, 101, 115, 116,
+            108, 101, 77, 97, 110, 105, 97, 32, 50, 49, 78, 105, 99, 107, 101, 108, 111, 100, 101, 111,
+            110, 32, 83, 112, 111, 110, 103, 101, 66, 111, 98, 32, 83, 113, 117, 97, 114, 101, 80, 97,
+            110, 116, 115, 58, 32, 76, 105, 103, 104, 116, 115, 44, 32, 67, 97, 109, 101, 114, 97, 44,
+            32, 80, 97, 110, 116, 115, 33, 65, 70, 76, 32, 80, 114, 101, 109, 105, 101, 114, 115, 104,
+            105, 112, 78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 65, 118, 97, 116, 97, 114,
+            58, 32, 84, 104, 101, 32, 76, 97, 115, 116, 32, 65, 105, 114, 98, 101, 110, 100, 101, 114,
+            68, 101, 115, 116, 114, 111, 121, 32, 65, 108, 108, 32, 72, 117, 109, 97, 110, 115, 33, 32,
+            50, 68, 105, 115, 110, 101, 121, 47, 80, 105, 120, 97, 114, 32, 82, 97, 116, 97, 116, 111,
+            117, 105, 108, 108, 101, 83, 97, 105, 110, 116, 115, 32, 82, 111, 119, 84, 104, 101, 32, 79,
+            117, 116, 102, 105, 116, 77, 111, 116, 111, 71, 80, 32, 48, 54, 70, 114, 111, 110, 116, 108,
+            105, 110, 101, 115, 32, 45, 70, 117, 101, 108, 32, 111, 102, 32, 87, 97, 114, 67, 111, 110,
+            97, 110, 77, 120, 32, 86, 115, 46, 32, 65, 116, 118, 32, 45, 32, 85, 110, 116, 97, 109,
+            101, 100, 83, 109, 97, 99, 107, 68, 111, 119, 110, 32, 118, 115, 46, 32, 82, 65, 87, 32,
+            50, 48, 48, 55, 65, 118, 97, 116, 97, 114, 32, 84, 76, 65, 32, 45, 32, 84, 104, 101,
+            32, 66, 117, 114, 110, 105, 110, 103, 32, 69, 97, 114, 116, 104, 68, 97, 114, 107, 115, 105,
+            100, 101, 114, 115, 67, 97, 114, 115, 66, 97, 106, 97, 32, 45, 32, 69, 100, 103, 101, 32,
+            111, 102, 32, 67, 111, 110, 116, 114, 111, 108, 82, 97, 116, 97, 116, 111, 117, 105, 108, 108,
+            101, 83, 116, 117, 110, 116, 109, 97, 110, 32, 45, 32, 73, 103, 110, 105, 116, 105, 111, 110,
+            77, 111, 116, 111, 71, 80, 32, 48, 55, 83, 97, 105, 110, 116, 115, 32, 82, 111, 119, 32,
+            50, 68, 101, 115, 116, 114, 111, 121, 32, 65, 108, 108, 32, 72, 117, 109, 97, 110, 115, 33,
+            32, 80, 97, 116, 104, 32, 111, 102, 32, 116, 104, 101, 32, 70, 117, 114, 111, 110, 67, 97,
+            114, 115, 32, 45, 32, 77, 97, 116, 101, 114, 45, 78, 97, 116, 105, 111, 110, 97, 108, 83,
+            109, 97, 99, 107, 100, 111, 119, 110, 32, 86, 115, 32, 82, 97, 119, 32, 50, 48, 48, 56,
+            82, 101, 100, 32, 70, 97, 99, 116, 105, 111, 110, 32, 45, 32, 71, 117, 101, 114, 114, 105,
+            108, 108, 97, 87, 65, 76, 76, 45, 69, 83, 109, 97, 99, 107, 68, 111, 119, 110, 32, 118,
+            115, 46, 32, 82, 65, 87, 32, 50, 48, 48, 57, 77, 88, 32, 118, 115, 32, 65, 84, 86,
+            32, 82, 101, 102, 108, 101, 120, 85, 70, 67, 32, 50, 48, 48, 57, 32, 85, 110, 100, 105,
+            115, 112, 117, 116, 101, 100, 87, 97, 114, 104, 97, 109, 109, 101, 114, 32, 52, 48, 32, 125,
+            44, 48, 48, 48, 32, 45, 32, 83, 112, 97, 99, 101, 32, 77, 97, 114, 105, 110, 101, 87,
+            111, 111, 32, 45, 32, 83, 112, 114, 105, 110, 116, 32, 67, 97, 114, 115, 87, 87, 69, 32,
+            76, 101, 103, 101, 110, 100, 115, 68, 105, 115, 110, 101, 121, 32, 80, 105, 120, 97, 114, 32,
+            85, 80, 53, 48, 32, 67, 101, 110, 116, 32, 45, 32, 66, 111, 116, 83, 53, 116, 104, 32,
+            71, 114, 97, 100, 101, 114, 32, 45, 32, 71, 97, 109, 101, 32, 84, 105, 109, 101, 77, 101,
+            116, 114, 111, 32, 50, 48, 51, 51, 83, 109, 97, 99, 107, 68, 111, 119, 110, 32, 118, 115,
+            46, 32, 82, 65, 87, 32, 50, 48, 49, 48, 72, 111, 109, 101, 102, 114, 111, 110, 116, 67,
+            97, 114, 115, 32, 45, 32, 82, 97, 99, 101, 45, 79, 45, 82, 97, 109, 97, 83, 112, 111,
+            110, 103, 101, 66, 111, 98, 32, 45, 32, 84, 114, 117, 116, 104, 45, 83, 113, 46, 85, 70,
+            67, 32, 85, 110, 100, 105, 115, 112, 117, 116, 101, 100, 32, 50, 48, 49, 48, 84, 104, 101,
+            32, 66, 105, 103, 103, 101, 115, 116, 32, 76, 111, 115, 101, 114, 32, 45, 32, 85, 108, 116,
+            105, 109, 97, 116, 101, 32, 87, 111, 114, 107, 111, 117, 116, 85, 70, 67, 32, 80, 101, 114,
+            115, 111, 110, 97, 108, 32, 84, 114, 97, 105, 110, 101, 114, 77, 101, 103, 97, 77, 105, 110,
+            100, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 83, 104, 111, 119, 100, 111, 119,
+            110, 87, 87, 69, 32, 83, 109, 97, 99, 107, 100, 111, 119, 110, 32, 118, 115, 46, 32, 82,
+            97, 119, 32, 50, 48, 49, 49, 70, 97, 110, 116, 97, 115, 116, 105, 99, 32, 80, 101, 116,
+            115, 82, 101, 100, 32, 70, 97, 99, 116, 105, 111, 110, 32, 45, 32, 65, 114, 109, 97, 103,
+            101, 100, 100, 111, 110, 83, 117, 112, 101, 114, 32, 72, 101, 114, 111, 32, 83, 113, 117, 97,
+            100, 32, 45, 32, 84, 104, 101, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 71, 97, 117,
+            110, 116, 108, 101, 116, 100, 101, 32, 66, 108, 111, 98, 32, 50, 87, 87, 69, 32, 65, 108,
+            108, 32, 83, 116, 97, 114, 115, 89, 111, 117, 32, 68, 111, 110, 39, 116, 32, 75, 110, 111,
+            119, 32, 74, 97, 99, 107, 68, 101, 101, 112, 97, 107, 32, 67, 104, 111, 112, 114, 97, 39,
+            115, 32, 76, 101, 101, 108, 97, 83, 97, 105, 110, 116, 115, 32, 82, 111, 119, 32, 45, 32,
+            84, 104, 101, 32, 84, 104, 105, 114, 100, 84, 104, 101, 32, 80, 101, 110, 103, 117, 105, 110,
+            115, 32, 111, 102, 32, 77, 97, 100, 97, 103, 97, 115, 99, 97, 114, 75, 117, 110, 103, 32,
+            70, 117, 32, 80, 97, 110, 100, 97, 32, 50, 82, 105, 111, 77, 88, 32, 118, 115, 32, 65,
+            84, 86, 32, 65, 108, 105, 118, 101, 85, 70, 67, 32, 85, 110, 100, 105, 115, 112, 117, 116,
+            101, 100, 32, 51, 80, 117, 115, 115, 32, 105, 110, 32, 66, 111, 111, 116, 115, 68, 97, 110,
+            99, 101, 32, 80, 97, 114, 97, 100, 105, 115, 101, 87, 87, 69, 32, 39, 49, 50, 68, 97,
+            114, 107, 115, 105, 100, 101, 114, 115, 32, 73, 73, 117, 68, 114, 97, 119, 32, 83, 116, 117,
+            100, 105, 111, 32, 45, 32, 73, 110, 115, 116, 97, 110, 116, 32, 65, 114, 116, 105, 115, 116,
+            77, 97, 114, 118, 101, 108, 32, 83, 117, 112, 101, 114, 32, 72, 101, 114, 111, 32, 83, 113,
+            117, 97, 100, 32, 45, 32, 67, 111, 109, 105, 99, 32, 67, 111, 109, 98, 97, 116, 80, 105,
+            99, 116, 105, 111, 110, 97, 114, 121, 32, 45, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32,
+            69, 100, 105, 116, 105, 111, 110, 83, 112, 111, 110, 103, 101, 66, 111, 98, 39, 115, 32, 83,
+            117, 114, 102, 32, 38, 32, 83, 107, 97, 116, 101, 32, 82, 111, 97, 100, 116, 114, 105, 112,
+            77, 101, 116, 114, 111, 32, 45, 32, 76, 97, 115, 116, 32, 76, 105, 103, 104, 116, 74, 101,
+            111, 112, 97, 114, 100, 121, 33, 87, 104, 101, 101, 108, 32, 111, 102, 32, 70, 111, 114, 116,
+            117, 110, 101, 83, 111, 117, 116, 104, 32, 80, 97, 114, 107, 32, 45, 32, 84, 104, 101, 32,
+            83, 116, 105, 99, 107, 32, 79, 102, 32, 84, 114, 117, 116, 104, 87, 87, 69, 32, 39, 49,
+            51, 66, 97, 114, 98, 97, 114, 105, 97, 110, 82, 111, 98, 111, 67, 111, 112, 52, 120, 52,
+            32, 69, 118, 111, 32, 50, 77, 97, 120, 32, 80, 97, 121, 110, 101, 83, 101, 114, 105, 111,
+            117, 115, 32, 83, 97, 109, 67, 111, 110, 102, 108, 105, 99, 116, 58, 32, 68, 101, 115, 101,
+            114, 116, 32, 83, 116, 111, 114, 109, 83, 116, 97, 116, 101, 32, 111, 102, 32, 69, 109, 101,
+            114, 103, 101, 110, 99, 121, 77, 105, 100, 110, 105, 103, 104, 116, 32, 67, 108, 117, 98, 32,
+            73, 73, 77, 97, 102, 105, 97, 86, 105, 101, 116, 99, 111, 110, 103, 58, 32, 80, 117, 114,
+            112, 108, 101, 32, 72, 97, 122, 101, 77, 84, 86, 32, 67, 101, 108, 101, 98, 114, 105, 116,
+            121, 32, 68, 101, 97, 116, 104, 109, 97, 116, 99, 104, 77, 97, 120, 32, 80, 97, 121, 110,
+            101, 32, 50, 58, 32, 84, 104, 101, 32, 70, 97, 108, 108, 32, 111, 102, 32, 77, 97, 120,
+            32, 80, 97, 121, 110, 101, 83, 101, 114, 105, 111, 117, 115, 32, 83, 97, 109, 32, 73, 73,
+            71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 32, 73, 73, 73,
+            71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 58, 32, 86, 105,
+            99, 101, 32, 67, 105, 116, 121, 67, 97, 114, 118, 101, 80, 117, 114, 101, 32, 80, 105, 110,
+            98, 97, 108, 108, 67, 108, 111, 115, 101, 32, 67, 111, 109, 98, 97, 116, 58, 32, 70, 105,
+            114, 115, 116, 32, 116, 111, 32, 70, 105, 103, 104, 116, 58, 32, 85, 110, 105, 116, 101, 100,
+            32, 83, 116, 97, 116, 101, 115, 32, 77, 97, 114, 105, 110, 101, 115, 65, 114, 109, 121, 32,
+            77, 101, 110, 58, 32, 83, 97, 114, 103, 101, 39, 115, 32, 87, 97, 114, 77, 111, 116, 111,
+            99, 114, 111, 115, 115, 32, 77, 97, 110, 105, 97, 32, 51, 86, 105, 114, 116, 117, 97, 108,
+            32, 80, 111, 111, 108, 58, 32, 84, 111, 117, 114, 110, 97, 109, 101, 110, 116, 32, 69, 100,
+            105, 116, 105, 111, 110, 79, 117, 116, 108, 97, 119, 32, 71, 111, 108, 102, 32, 50, 87, 105,
+            110, 103, 115, 32, 111, 102, 32, 87, 97, 114, 77, 97, 110, 104, 117, 110, 116, 82, 101, 100,
+            32, 68, 101, 97, 100, 32, 82, 101, 118, 111, 108, 118, 101, 114, 82, 111, 98, 111, 116, 101,
+            99, 104, 58, 32, 73, 110, 118, 97, 115, 105, 111, 110, 71, 114, 97, 110, 100, 32, 84, 104,
+            101, 102, 116, 32, 65, 117, 116, 111, 58, 32, 86, 105, 99, 101, 32, 67, 105, 116, 121, 79,
+            117, 116, 108, 97, 119, 32, 84, 101, 110, 110, 105, 115, 70, 111, 114, 100, 32, 77, 117, 115,
+            116, 97, 110, 103, 58, 32, 84, 104, 101, 32, 76, 101, 103, 101, 110, 100, 32, 76, 105, 118,
+            101, 115, 77, 105, 100, 110, 105, 103, 104, 116, 32, 67, 108, 117, 98, 32, 51, 58, 32, 68,
+            85, 66, 32, 69, 100, 105, 116, 105, 111, 110, 83, 99, 97, 108, 101, 114, 84, 104, 101, 32,
+            71, 117, 121, 32, 71, 97, 109, 101, 83, 112, 121, 32, 118, 115, 46, 32, 83, 112, 121, 67,
+            108, 97, 115, 115, 105, 102, 105, 101, 100, 58, 32, 84, 104, 101, 32, 83, 101, 110, 116, 105,
+            110, 101, 108, 32, 67, 114, 105, 115, 105, 115, 71, 111, 116, 99, 104, 97, 33, 82, 111, 98,
+            111, 116, 101, 99, 104, 58, 32, 73, 110, 118, 97, 115, 105, 111, 110, 67, 104, 97, 114, 108,
+            105, 101, 32, 97, 110, 100, 32, 116, 104, 101, 32, 67, 104, 111, 99, 111, 108, 97, 116, 101,
+            32, 70, 97, 99, 116, 111, 114, 121, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32,
+            65, 117, 116, 111, 58, 32, 83, 97, 110, 32, 65, 110, 100, 114, 101, 97, 115, 83, 104, 97,
+            116, 116, 101, 114, 101, 100, 32, 85, 110, 105, 111, 110, 83, 112, 121, 32, 118, 115, 46, 32,
+            83, 112, 121, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 58,
+            32, 83, 97, 110, 32, 65, 110, 100, 114, 101, 97, 115, 87, 111, 114, 108, 100, 32, 80, 111,
+            107, 101, 114, 32, 84, 111, 117, 114, 65, 114, 109, 121, 32, 77, 101, 110, 58, 32, 77, 97,
+            106, 111, 114, 32, 77, 97, 108, 102, 117, 110, 99, 116, 105, 111, 110, 70, 111, 114, 100, 32,
+            118, 115, 46, 32, 67, 104, 101, 118, 121, 67, 111, 100, 101, 110, 97, 109, 101, 58, 32, 75,
+            105, 100, 115, 32, 78, 101, 120, 116, 32, 68, 111, 111, 114, 58, 32, 79, 112, 101, 114, 97,
+            116, 105, 111, 110, 58, 32, 86, 46, 73, 46, 68, 46, 69, 46, 79, 46, 71, 46, 65, 46,
+            77, 46, 69, 46, 90, 97, 116, 104, 117, 114, 97, 78, 72, 76, 32, 50, 75, 54, 83, 105,
+            100, 32, 77, 101, 105, 101, 114, 39, 115, 32, 80, 105, 114, 97, 116, 101, 115, 33, 78, 66,
+            65, 32, 50, 75, 54, 67, 111, 108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 32, 50,
+            75, 54, 77, 97, 106, 111, 114, 32, 76, 101, 97, 103, 117, 101, 32, 66, 97, 115, 101, 98,
+            97, 108, 108, 32, 50, 75, 54, 83, 112, 108, 97, 116, 32, 77, 97, 103, 97, 122, 105, 110,
+            101, 32, 82, 101, 110, 101, 103, 97, 100, 101, 32, 80, 97, 105, 110, 116, 98, 97, 108, 108,
+            71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 58, 32, 83, 97,
+            110, 32, 65, 110, 100, 114, 101, 97, 115, 77, 97, 106, 111, 114, 32, 76, 101, 97, 103, 117,
+            101, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 75, 53, 58, 32, 87, 111, 114, 108,
+            100, 32, 83, 101, 114, 105, 101, 115, 32, 69, 100, 105, 116, 105, 111, 110, 84, 104, 101, 32,
+            87, 97, 114, 114, 105, 111, 114, 115, 72, 117, 109, 109, 101, 114, 32, 66, 97, 100, 108, 97,
+            110, 100, 115, 78, 66, 65, 32, 50, 75, 54, 78, 72, 76, 32, 50, 75, 54, 71, 114, 97,
+            110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 58, 32, 83, 97, 110, 32, 65,
+            110, 100, 114, 101, 97, 115, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117,
+            116, 111, 58, 32, 83, 97, 110, 32, 65, 110, 100, 114, 101, 97, 115, 71, 114, 97, 110, 100,
+            32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 58, 32, 83, 97, 110, 32, 65, 110, 100,
+            114, 101, 97, 115, 90, 97, 116, 104, 117, 114, 97, 84, 111, 114, 105, 110, 111, 32, 50, 48,
+            48, 54, 84, 104, 101, 32, 68, 97, 32, 86, 105, 110, 99, 105, 32, 67, 111, 100, 101, 78,
+            72, 76, 32, 50, 75, 55, 78, 66, 65, 32, 50, 75, 55, 67, 111, 108, 108, 101, 103, 101,
+            32, 72, 111, 111, 112, 115, 32, 50, 75, 55, 70, 97, 109, 105, 108, 121, 32, 71, 117, 121,
+            58, 32, 86, 105, 100, 101, 111, 32, 71, 97, 109, 101, 33, 77, 97, 106, 111, 114, 32, 76,
+            101, 97, 103, 117, 101, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 50, 75, 55, 67, 111,
+            108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 32, 50, 75, 54, 77, 108, 98, 32, 50,
+            75, 54, 65, 109, 112, 101, 100, 32, 51, 84, 111, 112, 32, 83, 112, 105, 110, 32, 50, 66,
+            105, 111, 83, 104, 111, 99, 107, 80, 114, 105, 122, 101, 102, 105, 103, 104, 116, 101, 114, 84,
+            104, 101, 32, 66, 117, 114, 101, 97, 117, 32, 45, 32, 88, 67, 79, 77, 32, 68, 101, 99,
+            108, 97, 115, 115, 105, 102, 105, 101, 100, 82, 111, 99, 107, 115, 116, 97, 114, 32, 84, 97,
+            98, 108, 101, 32, 84, 101, 110, 110, 105, 115, 80, 114, 101, 121, 78, 66, 65, 32, 50, 75,
+            54, 78, 72, 76, 32, 50, 75, 54, 84, 104, 101, 32, 66, 73, 71, 83, 67, 105, 118, 105,
+            108, 105, 122, 97, 116, 105, 111, 110, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 77,
+            97, 102, 105, 97, 32, 73, 73, 66, 111, 114, 100, 101, 114, 108, 97, 110, 100, 115, 78, 72,
+            76, 32, 50, 75, 55, 84, 104, 101, 32, 68, 97, 114, 107, 110, 101, 115, 115, 78, 66, 65,
+            32, 50, 75, 55, 67, 111, 108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 32, 50, 75,
+            55, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116, 111, 32, 73, 86,
+            77, 105, 100, 110, 105, 103, 104, 116, 32, 67, 108, 117, 98, 32, 45, 32, 76, 111, 115, 32,
+            65, 110, 103, 101, 108, 101, 115, 77, 108, 98, 32, 50, 75, 55, 84, 111, 112, 32, 83, 112,
+            105, 110, 32, 51, 65, 108, 108, 32, 80, 114, 111, 32, 70, 111, 111, 116, 98, 97, 108, 108,
+            32, 50, 75, 56, 78, 72, 76, 32, 50, 75, 56, 78, 66, 65, 32, 50, 75, 56, 77, 108,
+            98, 32, 50, 75, 56, 67, 111, 108, 108, 101, 103, 101, 32, 72, 111, 111, 112, 115, 32, 50,
+            75, 56, 66, 117, 108, 108, 121, 32, 83, 99, 104, 111, 108, 97, 114, 115, 104, 105, 112, 32,
+            69, 100, 46, 78, 66, 65, 32, 50, 75, 57, 82, 101, 100, 32, 68, 101, 97, 100, 32, 82,
+            101, 100, 101, 109, 112, 116, 105, 111, 110, 66, 105, 111, 115, 104, 111, 99, 107, 32, 50, 78,
+            72, 76, 32, 50, 75, 57, 77, 108, 98, 32, 70, 114, 111, 110, 116, 32, 79, 102, 102, 105,
+            99, 101, 32, 77, 103, 114, 84, 104, 101, 32, 66, 73, 71, 83, 32, 50, 77, 108, 98, 32,
+            50, 75, 57, 83, 112, 101, 99, 32, 79, 112, 115, 32, 45, 32, 84, 104, 101, 32, 76, 105,
+            110, 101, 68, 117, 107, 101, 32, 78, 117, 107, 101, 109, 32, 70, 111, 114, 101, 118, 101, 114,
+            78, 98, 97, 32, 50, 75, 49, 48, 78, 72, 76, 32, 50, 75, 49, 48, 77, 108, 98, 32,
+            50, 75, 49, 48, 84, 111, 112, 32, 83, 112, 105, 110, 32, 52, 66, 105, 111, 83, 104, 111,
+            99, 107, 32, 73, 110, 102, 105, 110, 105, 116, 101, 66, 105, 111, 83, 104, 111, 99, 107, 32,
+            50, 77, 97, 120, 32, 80, 97, 121, 110, 101, 32, 51, 76, 46, 65, 46, 32, 78, 111, 105,
+            114, 101, 78, 98, 97, 32, 50, 75, 49, 49, 66, 111, 114, 100, 101, 114, 108, 97, 110, 100,
+            115, 32, 50, 88, 67, 79, 77, 32, 45, 32, 69, 110, 101, 109, 121, 32, 85, 110, 107, 110,
+            111, 119, 110, 78, 105, 99, 107, 116, 111, 111, 110, 115, 32, 77, 108, 98, 84, 104, 101, 32,
+            68, 97, 114, 107, 110, 101, 115, 115, 32, 73, 73, 77, 108, 98, 32, 50, 75, 49, 49, 67,
+            97, 114, 110, 105, 118, 97, 108, 32, 71, 97, 109, 101, 115, 32, 45, 32, 77, 111, 110, 107,
+            101, 121, 32, 83, 101, 101, 32, 77, 111, 110, 107, 101, 121, 32, 68, 111, 78, 66, 65, 32,
+            50, 75, 49, 50, 78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110, 32, 68, 97, 110, 99,
+            101, 76, 101, 116, 39, 115, 32, 67, 104, 101, 101, 114, 33, 77, 108, 98, 32, 50, 75, 49,
+            50, 78, 66, 65, 32, 50, 75, 49, 51, 78, 105, 99, 107, 101, 108, 111, 100, 101, 111, 110,
+            32, 68, 97, 110, 99, 101, 32, 50, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32,
+            65, 117, 116, 111, 32, 86, 88, 67, 79, 77, 32, 45, 32, 69, 110, 101, 109, 121, 32, 87,
+            105, 116, 104, 105, 110, 78, 66, 65, 32, 50, 75, 49, 52, 87, 87, 69, 32, 50, 75, 49,
+            52, 66, 111, 114, 100, 101, 114, 108, 97, 110, 100, 115, 32, 45, 32, 84, 104, 101, 32, 80,
+            114, 101, 45, 83, 101, 113, 117, 101, 108, 78, 66, 65, 32, 50, 75, 49, 53, 87, 87, 69,
+            32, 50, 75, 49, 53, 71, 114, 97, 110, 100, 32, 84, 104, 101, 102, 116, 32, 65, 117, 116,
+            111, 32, 45, 32, 83, 97, 110, 32, 65, 110, 100, 114, 101, 97, 115, 87, 87, 69, 32, 50,
+            75, 49, 55, 68, 97, 110, 99, 101, 32, 67, 101, 110, 116, 114, 97, 108, 82, 111, 99, 107,
+            32, 66, 97, 110, 100, 32, 77, 117, 115, 105, 99, 32, 83, 116, 111, 114, 101, 68, 101, 102,
+            105, 97, 110, 99, 101, 68, 101, 97, 116, 104, 115, 109, 105, 108, 101, 115, 65, 107, 97, 105,
+            32, 75, 97, 116, 97, 110, 97, 85, 110, 100, 101, 114, 32, 68, 101, 102, 101, 97, 116, 32,
+            72, 68, 32, 45, 32, 68, 101, 108, 117, 120, 101, 32, 69, 100, 105, 116, 105, 111, 110, 67,
+            97, 114, 114, 105, 101, 114, 32, 67, 111, 109, 109, 97, 110, 100, 32, 45, 32, 71, 97, 101,
+            97, 32, 77, 105, 115, 115, 105, 111, 110, 87, 97, 121, 32, 111, 102, 32, 116, 104, 101, 32,
+            83, 97, 109, 117, 114, 97, 105, 32, 51, 82, 111, 99, 107, 32, 111, 102, 32, 116, 104, 101,
+            32, 68, 101, 97, 100, 66, 97, 116, 109, 97, 110, 58, 32, 86, 101, 110, 103, 101, 97, 110,
+            99, 101, 82, 97, 121, 109, 97, 110, 32, 51, 58, 32, 72, 111, 111, 100, 108, 117, 109, 32,
+            72, 97, 118, 111, 99, 82, 97, 121, 109, 97, 110, 32, 65, 114, 101, 110, 97, 68, 101, 97,
+            116, 104, 114, 111, 119, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 71, 104,
+            111, 115, 116, 32, 82, 101, 99, 111, 110, 32, 50, 84, 111, 109, 32, 67, 108, 97, 110, 99,
+            121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110, 84, 111, 109, 32, 67,
+            108, 97, 110, 99, 121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110, 58,
+            32, 73, 115, 108, 97, 110, 100, 32, 84, 104, 117, 110, 100, 101, 114, 70, 97, 114, 32, 67,
+            114, 121, 32, 73, 110, 115, 116, 105, 110, 99, 116, 115, 88, 73, 73, 73, 84, 111, 109, 32,
+            67, 108, 97, 110, 99, 121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110,
+            76, 97, 114, 103, 111, 32, 87, 105, 110, 99, 104, 58, 32, 69, 109, 112, 105, 114, 101, 32,
+            85, 110, 100, 101, 114, 32, 84, 104, 114, 101, 97, 116, 84, 111, 109, 32, 67, 108, 97, 110,
+            99, 121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108, 108, 85, 70,
+            67, 58, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 70, 105, 103, 104, 116, 105, 110, 103,
+            32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 58, 32, 84, 97, 112, 111, 117,
+            116, 83, 116, 97, 114, 32, 87, 97, 114, 115, 58, 32, 79, 98, 105, 45, 87, 97, 110, 77,
+            121, 115, 116, 32, 73, 73, 73, 58, 32, 69, 120, 105, 108, 101, 68, 114, 97, 103, 111, 110,
+            39, 115, 32, 76, 97, 105, 114, 32, 51, 68, 58, 32, 82, 101, 116, 117, 114, 110, 32, 116,
+            111, 32, 116, 104, 101, 32, 76, 97, 105, 114, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121,
+            39, 115, 32, 82, 97, 105, 110, 98, 111, 119, 32, 83, 105, 120, 32, 51, 82, 111, 99, 107,
+            121, 84, 104, 101, 32, 69, 108, 100, 101, 114, 32, 83, 99, 114, 111, 108, 108, 115, 32, 73,
+            73, 73, 58, 32, 77, 111, 114, 114, 111, 119, 105, 110, 100, 77, 117, 114, 97, 107, 117, 109,
+            111, 58, 32, 82, 101, 110, 101, 103, 97, 100, 101, 32, 77, 101, 99, 104, 32, 80, 117, 114,
+            115, 117, 105, 116, 66, 101, 121, 111, 110, 100, 32, 71, 111, 111, 100, 32, 38, 32, 69, 118,
+            105, 108, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 83, 112, 108, 105, 110,
+            116, 101, 114, 32, 67, 101, 108, 108, 58, 32, 80, 97, 110, 100, 111, 114, 97, 32, 84, 111,
+            109, 111, 114, 114, 111, 119, 66, 97, 116, 109, 97, 110, 58, 32, 82, 105, 115, 101, 32, 111,
+            102, 32, 83, 105, 110, 32, 84, 122, 117, 80, 114, 105, 110, 99, 101, 32, 111, 102, 32, 80,
+            101, 114, 115, 105, 97, 58, 32, 84, 104, 101, 32, 83, 97, 110, 100, 115, 32, 111, 102, 32,
+            84, 105, 109, 101, 67, 114, 111, 117, 99, 104, 105, 110, 103, 32, 84, 105, 103, 101, 114, 44,
+            32, 72, 105, 100, 100, 101, 110, 32, 68, 114, 97, 103, 111, 110, 82, 111, 99, 107, 121, 32,
+            76, 101, 103, 101, 110, 100, 115, 49, 56, 55, 58, 32, 82, 105, 100, 101, 32, 111, 114, 32,
+            68, 105, 101, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 82, 97, 105, 110,
+            98, 111, 119, 32, 83, 105, 120, 32, 51, 58, 32, 66, 108, 97, 99, 107, 32, 65, 114, 114,
+            111, 119, 67, 104, 101, 115, 115, 109, 97, 115, 116, 101, 114, 84, 104, 101, 32, 68, 117, 107,
+            101, 115, 32, 111, 102, 32, 72, 97, 122, 122, 97, 114, 100, 58, 32, 82, 101, 116, 117, 114,
+            110, 32, 111, 102, 32, 116, 104, 101, 32, 71, 101, 110, 101, 114, 97, 108, 32, 76, 101, 101,
+            80, 114, 105, 110, 99, 101, 32, 111, 102, 32, 80, 101, 114, 115, 105, 97, 58, 32, 75, 101,
+            110, 115, 104, 105, 32, 110, 111, 32, 75, 111, 107, 111, 114, 111, 66, 114, 111, 116, 104, 101,
+            114, 115, 32, 105, 110, 32, 65, 114, 109, 115, 58, 32, 82, 111, 97, 100, 32, 116, 111, 32,
+            72, 105, 108, 108, 32, 51, 48, 88, 73, 73, 73, 58, 32, 68, 97, 105, 116, 111, 117, 114,
+            121, 111, 117, 32, 111, 32, 75, 111, 114, 111, 115, 104, 105, 116, 97, 32, 79, 116, 111, 107,
+            111, 67, 83, 73, 58, 32, 67, 114, 105, 109, 101, 32, 83, 99, 101, 110, 101, 32, 73, 110,
+            118, 101, 115, 116, 105, 103, 97, 116, 105, 111, 110, 84, 111, 114, 107, 58, 32, 80, 114, 101,
+            104, 105, 115, 116, 111, 114, 105, 99, 32, 80, 117, 110, 107, 84, 111, 109, 32, 67, 108, 97,
+            110, 99, 121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108, 108, 58,
+            32, 67, 104, 97, 111, 115, 32, 84, 104, 101, 111, 114, 121, 65, 109, 101, 114, 105, 99, 97,
+            39, 115, 32, 65, 114, 109, 121, 58, 32, 82, 105, 115, 101, 32, 111, 102, 32, 97, 32, 83,
+            111, 108, 100, 105, 101, 114, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 82,
+            97, 105, 110, 98, 111, 119, 32, 83, 105, 120, 58, 32, 76, 111, 99, 107, 100, 111, 119, 110,
+            77, 111, 110, 115, 116, 101, 114, 32, 52, 120, 52, 58, 32, 87, 111, 114, 108, 100, 32, 67,
+            105, 114, 99, 117, 105, 116, 77, 121, 115, 116, 32, 73, 86, 58, 32, 82, 101, 118, 101, 108,
+            97, 116, 105, 111, 110, 67, 111, 108, 100, 32, 70, 101, 97, 114, 80, 101, 116, 101, 114, 32,
+            74, 97, 99, 107, 115, 111, 110, 39, 115, 32, 75, 105, 110, 103, 32, 75, 111, 110, 103, 58,
+            32, 84, 104, 101, 32, 79, 102, 102, 105, 99, 105, 97, 108, 32, 71, 97, 109, 101, 32, 111,
+            102, 32, 116, 104, 101, 32, 77, 111, 118, 105, 101, 84, 111, 109, 32, 67, 108, 97, 110, 99,
+            121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110, 32, 50, 58, 32, 83,
+            117, 109, 109, 105, 116, 32, 83, 116, 114, 105, 107, 101, 84, 111, 109, 32, 67, 108, 97, 110,
+            99, 121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110, 58, 32, 65, 100,
+            118, 97, 110, 99, 101, 100, 32, 87, 97, 114, 102, 105, 103, 104, 116, 101, 114, 65, 78, 68,
+            32, 49, 32, 83, 116, 114, 101, 101, 116, 98, 97, 108, 108, 66, 108, 97, 122, 105, 110, 103,
+            32, 65, 110, 103, 101, 108, 115, 58, 32, 83, 113, 117, 97, 100, 114, 111, 110, 115, 32, 111,
+            102, 32, 87, 87, 73, 73, 80, 114, 105, 110, 99, 101, 32, 111, 102, 32, 80, 101, 114, 115,
+            105, 97, 58, 32, 84, 104, 101, 32, 84, 119, 111, 32, 84, 104, 114, 111, 110, 101, 115, 66,
+            114, 111, 116, 104, 101, 114, 115, 32, 105, 110, 32, 65, 114, 109, 115, 58, 32, 69, 97, 114,
+            110, 101, 100, 32, 105, 110, 32, 66, 108, 111, 111, 100, 66, 114, 111, 116, 104, 101, 114, 115,
+            32, 105, 110, 32, 65, 114, 109, 115, 58, 32, 82, 111, 97, 100, 32, 116, 111, 32, 72, 105,
+            108, 108, 32, 51, 48, 68, 97, 114, 107, 119, 97, 116, 99, 104, 84, 111, 109, 32, 67, 108,
+            97, 110, 99, 121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108, 108,
+            58, 32, 68, 111, 117, 98, 108, 101, 32, 65, 103, 101, 110, 116, 84, 111, 109, 32, 67, 108,
+            97, 110, 99, 121, 39, 115, 32, 82, 97, 105, 110, 98, 111, 119, 32, 83, 105, 120, 58, 32,
+            67, 114, 105, 116, 105, 99, 97, 108, 32, 72, 111, 117, 114, 70, 97, 114, 32, 67, 114, 121,
+            32, 73, 110, 115, 116, 105, 110, 99, 116, 115, 58, 32, 69, 118, 111, 108, 117, 116, 105, 111,
+            110, 79, 112, 101, 110, 32, 83, 101, 97, 115, 111, 110, 75, 105, 110, 103, 32, 75, 111, 110,
+            103, 65, 115, 115, 97, 115, 115, 105, 110, 39, 115, 32, 67, 114, 101, 101, 100, 84, 111, 109,
+            32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111,
+            110, 32, 65, 100, 118, 97, 110, 99, 101, 100, 32, 87, 97, 114, 102, 105, 103, 104, 116, 101,
+            114, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 82, 97, 105, 110, 98, 111,
+            119, 32, 83, 105, 120, 32, 86, 101, 103, 97, 115, 84, 111, 109, 32, 67, 108, 97, 110, 99,
+            121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108, 108, 32, 45, 32,
+            68, 111, 117, 98, 108, 101, 32, 65, 103, 101, 110, 116, 66, 108, 97, 122, 105, 110, 103, 32,
+            65, 110, 103, 101, 108, 115, 70, 97, 114, 32, 67, 114, 121, 32, 73, 110, 115, 116, 105, 110,
+            99, 116, 115, 32, 80, 114, 101, 100, 97, 116, 111, 114, 84, 111, 109, 32, 67, 108, 97, 110,
+            99, 121, 39, 115, 32, 69, 110, 100, 87, 97, 114, 78, 97, 114, 117, 116, 111, 32, 82, 105,
+            115, 101, 32, 79, 102, 32, 65, 32, 78, 105, 110, 106, 97, 69, 110, 99, 104, 97, 110, 116,
+            101, 100, 32, 65, 114, 109, 115, 79, 112, 101, 110, 32, 83, 101, 97, 115, 111, 110, 66, 114,
+            111, 116, 104, 101, 114, 115, 32, 73, 110, 32, 65, 114, 109, 115, 32, 72, 101, 108, 108, 39,
+            115, 32, 72, 105, 103, 104, 119, 97, 121, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39,
+            115, 32, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110, 32, 65, 100, 118, 97, 110, 99,
+            101, 100, 32, 87, 97, 114, 102, 105, 103, 104, 116, 101, 114, 32, 50, 82, 97, 121, 109, 97,
+            110, 32, 82, 97, 118, 105, 110, 103, 32, 82, 97, 98, 98, 105, 100, 115, 82, 46, 85, 46,
+            83, 46, 69, 46, 84, 77, 78, 84, 67, 97, 108, 108, 32, 111, 102, 32, 74, 117, 97, 114,
+            101, 122, 80, 117, 114, 101, 32, 70, 117, 116, 98, 111, 108, 66, 108, 97, 122, 105, 110, 103,
+            32, 65, 110, 103, 101, 108, 115, 32, 50, 66, 101, 111, 119, 117, 108, 102, 68, 97, 114, 107,
+            32, 77, 101, 115, 115, 105, 97, 104, 32, 111, 102, 32, 77, 105, 103, 104, 116, 32, 38, 32,
+            77, 97, 103, 105, 99, 32, 45, 32, 69, 108, 101, 109, 101, 110, 116, 115, 84, 111, 109, 32,
+            67, 108, 97, 110, 99, 121, 39, 115, 32, 82, 97, 105, 110, 98, 111, 119, 32, 83, 105, 120,
+            32, 86, 101, 103, 97, 115, 32, 50, 65, 109, 101, 114, 105, 99, 97, 39, 115, 32, 65, 114,
+            109, 121, 32, 45, 32, 84, 114, 117, 101, 32, 83, 111, 108, 100, 105, 101, 114, 115, 67, 83,
+            73, 45, 72, 97, 114, 100, 32, 69, 118, 105, 100, 101, 110, 99, 101, 84, 111, 109, 32, 67,
+            108, 97, 110, 99, 121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108,
+            108, 32, 67, 111, 110, 118, 105, 99, 116, 105, 111, 110, 80, 114, 105, 110, 99, 101, 32, 111,
+            102, 32, 80, 101, 114, 115, 105, 97, 76, 111, 115, 116, 32, 86, 105, 97, 32, 68, 111, 109,
+            117, 115, 70, 97, 114, 32, 67, 114, 121, 32, 50, 84, 99, 115, 32, 72, 46, 65, 46, 87,
+            46, 88, 67, 97, 108, 108, 32, 111, 102, 32, 74, 117, 97, 114, 101, 122, 32, 50, 83, 104,
+            97, 117, 110, 32, 87, 104, 105, 116, 101, 32, 83, 110, 111, 119, 98, 111, 97, 114, 100, 105,
+            110, 103, 78, 97, 114, 117, 116, 111, 32, 84, 104, 101, 32, 66, 114, 111, 107, 101, 110, 32,
+            66, 111, 110, 100, 83, 104, 97, 117, 110, 32, 87, 104, 105, 116, 101, 32, 83, 107, 97, 116,
+            101, 98, 111, 97, 114, 100, 105, 110, 103, 71, 104, 111, 115, 116, 32, 82, 101, 99, 111, 110,
+            32, 45, 32, 70, 117, 116, 117, 114, 101, 32, 83, 111, 108, 100, 105, 101, 114, 67, 108, 111,
+            117, 100, 121, 32, 87, 105, 116, 104, 32, 65, 46, 46, 46, 65, 115, 115, 97, 115, 115, 105,
+            110, 39, 115, 32, 67, 114, 101, 101, 100, 32, 73, 73, 67, 97, 109, 101, 114, 111, 110, 39,
+            115, 32, 65, 118, 97, 116, 97, 114, 80, 114, 105, 110, 99, 101, 32, 111, 102, 32, 80, 101,
+            114, 115, 105, 97, 32, 84, 104, 101, 32, 70, 111, 114, 103, 111, 116, 116, 101, 110, 32, 83,
+            97, 110, 100, 115, 67, 115, 105, 32, 45, 32, 68, 101, 97, 100, 108, 121, 32, 73, 110, 116,
+            101, 110, 116, 72, 101, 114, 111, 101, 115, 32, 79, 118, 101, 114, 32, 69, 117, 114, 111, 112,
+            101, 84, 111, 109, 32, 67, 108, 97, 110, 99, 121, 39, 115, 32, 72, 46, 65, 46, 87, 46,
+            88, 46, 32, 50, 67, 83, 73, 32, 45, 32, 70, 97, 116, 97, 108, 32, 67, 111, 110, 115,
+            112, 105, 114, 97, 99, 121, 67, 104, 105, 108, 100, 32, 111, 102, 32, 69, 100, 101, 110, 70,
+            105, 103, 104, 116, 101, 114, 115, 32, 85, 110, 99, 97, 103, 101, 100, 89, 111, 117, 114, 32,
+            83, 104, 97, 112, 101, 32, 45, 32, 70, 105, 116, 110, 101, 115, 115, 32, 69, 118, 111, 108,
+            118, 101, 100, 77, 111, 116, 105, 111, 110, 115, 112, 111, 114, 116, 115, 77, 105, 99, 104, 97,
+            101, 108, 32, 74, 97, 99, 107, 115, 111, 110, 32, 84, 104, 101, 32, 69, 120, 112, 101, 114,
+            105, 101, 110, 99, 101, 65, 115, 115, 97, 115, 115, 105, 110, 39, 115, 32, 67, 114, 101, 101,
+            100, 32, 66, 114, 111, 116, 104, 101, 114, 104, 111, 111, 100, 80, 111, 119, 101, 114, 85, 112,
+            32, 72, 101, 114, 111, 101, 115, 84, 104, 101, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101,
+            115, 32, 111, 102, 32, 84, 105, 110, 116, 105, 110, 82, 111, 99, 107, 115, 109, 105, 116, 104,
+            67, 97, 108, 108, 32, 111, 102, 32, 74, 117, 97, 114, 101, 122, 32, 45, 32, 84, 104, 101,
+            32, 67, 97, 114, 116, 101, 108, 74, 117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 75, 105,
+            100, 115, 32, 50, 65, 115, 115, 97, 115, 115, 105, 110, 39, 115, 32, 67, 114, 101, 101, 100,
+            32, 82, 101, 118, 101, 108, 97, 116, 105, 111, 110, 115, 68, 114, 105, 118, 101, 114, 32, 83,
+            97, 110, 32, 70, 114, 97, 110, 99, 105, 115, 99, 111, 70, 97, 109, 105, 108, 121, 32, 70,
+            101, 117, 100, 84, 104, 101, 32, 80, 114, 105, 99, 101, 32, 73, 115, 32, 82, 105, 103, 104,
+            116, 78, 67, 73, 83, 32, 71, 97, 109, 101, 82, 97, 118, 105, 110, 103, 32, 82, 97, 98,
+            98, 105, 100, 115, 32, 45, 32, 65, 108, 105, 118, 101, 32, 38, 32, 75, 105, 99, 107, 105,
+            110, 103, 87, 104, 111, 32, 87, 97, 110, 116, 115, 32, 84, 111, 32, 66, 101, 32, 65, 32,
+            77, 105, 108, 108, 105, 111, 110, 97, 105, 114, 101, 82, 97, 121, 109, 97, 110, 32, 79, 114,
+            105, 103, 105, 110, 115, 89, 111, 117, 114, 32, 83, 104, 97, 112, 101, 32, 45, 32, 70, 105,
+            116, 110, 101, 115, 115, 32, 69, 118, 111, 108, 118, 101, 100, 32, 50, 48, 49, 50, 77, 111,
+            116, 105, 111, 110, 83, 112, 111, 114, 116, 115, 32, 45, 32, 65, 100, 114, 101, 110, 97, 108,
+            105, 110, 101, 74, 117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 51, 83, 101, 108, 102, 45,
+            68, 101, 102, 101, 110, 115, 101, 32, 84, 114, 97, 105, 110, 105, 110, 103, 32, 67, 97, 109,
+            112, 70, 97, 114, 32, 67, 114, 121, 32, 51, 66, 108, 97, 99, 107, 32, 69, 121, 101, 100,
+            32, 80, 101, 97, 115, 32, 69, 120, 112, 101, 114, 105, 101, 110, 99, 101, 77, 97, 114, 118,
+            101, 108, 32, 65, 118, 101, 110, 103, 101, 114, 115, 32, 45, 32, 66, 97, 116, 116, 108, 101,
+            32, 102, 111, 114, 32, 69, 97, 114, 116, 104, 65, 115, 115, 97, 115, 115, 105, 110, 39, 115,
+            32, 67, 114, 101, 101, 100, 32, 73, 73, 73, 74, 117, 115, 116, 32, 68, 97, 110, 99, 101,
+            32, 71, 114, 101, 97, 116, 101, 115, 116, 32, 72, 105, 116, 115, 74, 117, 115, 116, 32, 68,
+            97, 110, 99, 101, 32, 68, 105, 115, 110, 101, 121, 32, 80, 97, 114, 116, 121, 72, 105, 112,
+            45, 72, 111, 112, 32, 68, 97, 110, 99, 101, 32, 69, 120, 112, 101, 114, 105, 101, 110, 99,
+            101, 74, 117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 52, 84, 111, 109, 32, 67, 108, 97,
+            110, 99, 121, 39, 115, 32, 83, 112, 108, 105, 110, 116, 101, 114, 32, 67, 101, 108, 108, 32,
+            66, 108, 97, 99, 107, 108, 105, 115, 116, 87, 97, 116, 99, 104, 32, 68, 111, 103, 115, 84,
+            104, 101, 32, 83, 109, 117, 114, 102, 115, 32, 50, 82, 111, 99, 107, 115, 109, 105, 116, 104,
+            32, 50, 48, 49, 52, 32, 69, 100, 105, 116, 105, 111, 110, 74, 117, 115, 116, 32, 68, 97,
+            110, 99, 101, 32, 50, 48, 49, 52, 65, 115, 115, 97, 115, 115, 105, 110, 39, 115, 32, 67,
+            114, 101, 101, 100, 32, 73, 86, 82, 97, 121, 109, 97, 110, 32, 76, 101, 103, 101, 110, 100,
+            115, 84, 104, 101, 32, 83, 116, 105, 99, 107, 32, 111, 102, 32, 84, 114, 117, 116, 104, 74,
+            117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 75, 105, 100, 115, 32, 50, 48, 49, 52, 70,
+            97, 114, 32, 67, 114, 121, 32, 52, 84, 104, 101, 32, 67, 114, 101, 119, 74, 117, 115, 116,
+            32, 68, 97, 110, 99, 101, 32, 68, 105, 115, 110, 101, 121, 32, 80, 97, 114, 116, 121, 32,
+            50, 74, 117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 50, 48, 49, 53, 65, 115, 115, 97,
+            115, 115, 105, 110, 39, 115, 32, 67, 114, 101, 101, 100, 32, 82, 111, 103, 117, 101, 82, 97,
+            98, 98, 105, 100, 115, 32, 73, 110, 118, 97, 115, 105, 111, 110, 32, 45, 32, 84, 104, 101,
+            32, 73, 110, 116, 101, 114, 97, 99, 116, 105, 118, 101, 32, 84, 86, 32, 83, 104, 111, 119,
+            74, 117, 115, 116, 32, 68, 97, 110, 99, 101, 32, 50, 48, 49, 54, 67, 111, 117, 110, 116,
+            114, 121, 32, 68, 97, 110, 99, 101, 32, 65, 108, 108, 32, 83, 116, 97, 114, 115, 77, 117,
+            122, 122, 108, 101, 32, 70, 108, 97, 115, 104, 83, 107, 105, 45, 68, 111, 111, 32, 67, 104,
+            97, 108, 108, 101, 110, 103, 101, 82, 97, 105, 100, 101, 110, 32, 70, 105, 103, 104, 116, 101,
+            114, 115, 32, 65, 99, 101, 115, 68, 97, 114, 107, 101, 115, 116, 32, 79, 102, 32, 68, 97,
+            121, 115, 72, 117, 110, 116, 101, 114, 58, 32, 84, 104, 101, 32, 82, 101, 99, 107, 111, 110,
+            105, 110, 103, 66, 97, 108, 100, 117, 114, 39, 115, 32, 71, 97, 116, 101, 58, 32, 68, 97,
+            114, 107, 32, 65, 108, 108, 105, 97, 110, 99, 101, 76, 101, 116, 39, 115, 32, 68, 97, 110,
+            99, 101, 76, 101, 103, 101, 110, 100, 115, 32, 111, 102, 32, 87, 97, 114, 87, 111, 114, 109,
+            115, 32, 84, 104, 101, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 32, 67, 111, 108,
+            108, 101, 99, 116, 105, 111, 110, 67, 114, 97, 115, 104, 32, 66, 97, 110, 100, 105, 99, 111,
+            111, 116, 58, 32, 84, 104, 101, 32, 87, 114, 97, 116, 104, 32, 111, 102, 32, 67, 111, 114,
+            116, 101, 120, 84, 104, 101, 32, 76, 111, 114, 100, 32, 111, 102, 32, 116, 104, 101, 32, 82,
+            105, 110, 103, 115, 58, 32, 84, 104, 101, 32, 70, 101, 108, 108, 111, 119, 115, 104, 105, 112,
+            32, 111, 102, 32, 116, 104, 101, 32, 82, 105, 110, 103, 66, 117, 102, 102, 121, 32, 116, 104,
+            101, 32, 86, 97, 109, 112, 105, 114, 101, 32, 83, 108, 97, 121, 101, 114, 58, 32, 67, 104,
+            97, 111, 115, 32, 66, 108, 101, 101, 100, 115, 72, 117, 110, 116, 101, 114, 58, 32, 84, 104,
+            101, 32, 82, 101, 99, 107, 111, 110, 105, 110, 103, 70, 117, 116, 117, 114, 97, 109, 97, 65,
+            110, 116, 122, 32, 69, 120, 116, 114, 101, 109, 101, 32, 82, 97, 99, 105, 110, 103, 77, 101,
+            116, 97, 108, 32, 65, 114, 109, 115, 58, 32, 71, 108, 105, 116, 99, 104, 32, 105, 110, 32,
+            116, 104, 101, 32, 83, 121, 115, 116, 101, 109, 84, 104, 101, 32, 84, 104, 105, 110, 103, 69,
+            110, 99, 108, 97, 118, 101, 66, 97, 116, 116, 108, 101, 115, 116, 97, 114, 32, 71, 97, 108,
+            97, 99, 116, 105, 99, 97, 79, 117, 116, 108, 97, 119, 32, 71, 111, 108, 102, 72, 117, 108,
+            107, 84, 111, 116, 97, 108, 32, 73, 109, 109, 101, 114, 115, 105, 111, 110, 32, 82, 97, 99,
+            105, 110, 103, 74, 97, 109, 101, 115, 32, 67, 97, 109, 101, 114, 111, 110, 39, 115, 32, 68,
+            97, 114, 107, 32, 65, 110, 103, 101, 108, 84, 104, 101, 32, 83, 105, 109, 112, 115, 111, 110,
+            115, 58, 32, 72, 105, 116, 32, 38, 32, 82, 117, 110, 66, 114, 117, 99, 101, 32, 76, 101,
+            101, 58, 32, 81, 117, 101, 115, 116, 32, 111, 102, 32, 116, 104, 101, 32, 68, 114, 97, 103,
+            111, 110, 83, 101, 97, 66, 108, 97, 100, 101, 77, 97, 99, 101, 32, 71, 114, 105, 102, 102,
+            105, 110, 58, 32, 66, 111, 117, 110, 116, 121, 32, 72, 117, 110, 116, 101, 114, 77, 101, 110,
+            32, 111, 102, 32, 86, 97, 108, 111, 114, 66, 97, 108, 100, 117, 114, 39, 115, 32, 71, 97,
+            116, 101, 58, 32, 68, 97, 114, 107, 32, 65, 108, 108, 105, 97, 110, 99, 101, 67, 114, 97,
+            115, 104, 32, 78, 105, 116, 114, 111, 32, 75, 97, 114, 116, 74, 117, 114, 97, 115, 115, 105,
+            99, 32, 80, 97, 114, 107, 58, 32, 79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 71, 101,
+            110, 101, 115, 105, 115, 65, 108, 105, 101, 110, 115, 32, 86, 101, 114, 115, 117, 115, 32, 80,
+            114, 101, 100, 97, 116, 111, 114, 58, 32, 69, 120, 116, 105, 110, 99, 116, 105, 111, 110, 84,
+            104, 101, 32, 72, 111, 98, 98, 105, 116, 58, 32, 84, 104, 101, 32, 80, 114, 101, 108, 117,
+            100, 101, 32, 116, 111, 32, 116, 104, 101, 32, 76, 111, 114, 100, 32, 111, 102, 32, 116, 104,
+            101, 32, 82, 105, 110, 103, 115, 84, 104, 101, 32, 67, 104, 114, 111, 110, 105, 99, 108, 101,
+            115, 32, 111, 102, 32, 82, 105, 100, 100, 105, 99, 107, 58, 32, 69, 115, 99, 97, 112, 101,
+            32, 102, 114, 111, 109, 32, 66, 117, 116, 99, 104, 101, 114, 32, 66, 97, 121, 82, 101, 100,
+            32, 78, 105, 110, 106, 97, 58, 32, 69, 110, 100, 32, 111, 102, 32, 72, 111, 110, 111, 114,
+            84, 104, 101, 32, 67, 97, 116, 32, 105, 110, 32, 116, 104, 101, 32, 72, 97, 116, 86, 97,
+            110, 32, 72, 101, 108, 115, 105, 110, 103, 66, 97, 114, 98, 105, 101, 32, 72, 111, 114, 115,
+            101, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 115, 58, 32, 87, 105, 108, 100, 32, 72,
+            111, 114, 115, 101, 32, 82, 101, 115, 99, 117, 101, 72, 117, 110, 116, 101, 114, 58, 32, 84,
+            104, 101, 32, 82, 101, 99, 107, 111, 110, 105, 110, 103, 58, 32, 82, 101, 100, 101, 101, 109,
+            101, 114, 70, 105, 103, 104, 116, 32, 67, 108, 117, 98, 80, 114, 101, 100, 97, 116, 111, 114,
+            58, 32, 67, 111, 110, 99, 114, 101, 116, 101, 32, 74, 117, 110, 103, 108, 101, 76, 101, 105,
+            115, 117, 114, 101, 32, 83, 117, 105, 116, 32, 76, 97, 114, 114, 121, 58, 32, 77, 97, 103,
+            110, 97, 32, 67, 117, 109, 32, 76, 97, 117, 100, 101, 83, 112, 121, 114, 111, 58, 32, 65,
+            32, 72, 101, 114, 111, 39, 115, 32, 84, 97, 105, 108, 67, 114, 97, 115, 104, 32, 84, 119,
+            105, 110, 115, 97, 110, 105, 116, 121, 82, 111, 98, 111, 116, 115, 84, 104, 101, 32, 73, 110,
+            99, 114, 101, 100, 105, 98, 108, 101, 32, 72, 117, 108, 107, 58, 32, 85, 108, 116, 105, 109,
+            97, 116, 101, 32, 68, 101, 115, 116, 114, 117, 99, 116, 105, 111, 110, 83, 99, 97, 114, 102,
+            97, 99, 101, 58, 32, 84, 104, 101, 32, 87, 111, 114, 108, 100, 32, 73, 115, 32, 89, 111,
+            117, 114, 115, 77, 101, 110, 32, 111, 102, 32, 86, 97, 108, 111, 114, 67, 114, 97, 115, 104,
+            32, 84, 97, 103, 32, 84, 101, 97, 109, 32, 82, 97, 99, 105, 110, 103, 53, 48, 32, 67,
+            101, 110, 116, 58, 32, 66, 117, 108, 108, 101, 116, 112, 114, 111, 111, 102, 69, 114, 97, 103,
+            111, 110, 66, 97, 115, 115, 32, 80, 114, 111, 32, 83, 104, 111, 112, 115, 58, 32, 84, 114,
+            111, 112, 104, 121, 32, 72, 117, 110, 116, 101, 114, 32, 50, 48, 48, 55, 66, 97, 115, 115,
+            32, 80, 114, 111, 32, 83, 104, 111, 112, 115, 58, 32, 84, 114, 111, 112, 104, 121, 32, 66,
+            97, 115, 115, 32, 50, 48, 48, 55, 84, 104, 101, 32, 76, 101, 103, 101, 110, 100, 32, 111,
+            102, 32, 83, 112, 121, 114, 111, 58, 32, 65, 32, 78, 101, 119, 32, 66, 101, 103, 105, 110,
+            110, 105, 110, 103, 73, 99, 101, 32, 65, 103, 101, 32, 50, 58, 32, 84, 104, 101, 32, 77,
+            101, 108, 116, 100, 111, 119, 110, 84, 104, 101, 32, 66, 111, 117, 114, 110, 101, 32, 67, 111,
+            110, 115, 112, 105, 114, 97, 99, 121, 70, 46, 69, 46, 65, 46, 82, 46, 84, 105, 109, 101,
+            83, 104, 105, 102, 116, 69, 114, 97, 103, 111, 110, 67, 114, 97, 115, 104, 32, 79, 102, 32,
+            84, 104, 101, 32, 84, 105, 116, 97, 110, 115, 83, 112, 105, 100, 101, 114, 119, 105, 99, 107,
+            32, 67, 104, 114, 111, 110, 105, 99, 108, 101, 115, 76, 101, 103, 101, 110, 100, 32, 79, 102,
+            32, 83, 112, 121, 114, 111, 67, 114, 97, 115, 104, 32, 77, 105, 110, 100, 32, 79, 118, 101,
+            114, 32, 77, 117, 116, 97, 110, 116, 79, 117, 116, 108, 97, 119, 32, 71, 111, 108, 102, 58,
+            32, 57, 32, 72, 111, 108, 101, 115, 32, 111, 102, 32, 88, 45, 77, 97, 115, 67, 114, 97,
+            115, 104, 32, 66, 97, 110, 100, 105, 99, 111, 111, 116, 58, 32, 84, 104, 101, 32, 87, 114,
+            97, 116, 104, 32, 111, 102, 32, 67, 111, 114, 116, 101, 120, 66, 114, 117, 99, 101, 32, 76,
+            101, 101, 58, 32, 81, 117, 101, 115, 116, 32, 111, 102, 32, 116, 104, 101, 32, 68, 114, 97,
+            103, 111, 110, 84, 104, 101, 32, 84, 104, 105, 110, 103, 84, 104, 101, 32, 76, 111, 114, 100,
+            32, 111, 102, 32, 116, 104, 101, 32, 82, 105, 110, 103, 115, 58, 32, 84, 104, 101, 32, 70,
+            101, 108, 108, 111, 119, 115, 104, 105, 112, 32, 111, 102, 32, 116, 104, 101, 32, 82, 105, 110,
+            103, 72, 117, 108, 107, 74, 117, 114, 97, 115, 115, 105, 99, 32, 80, 97, 114, 107, 58, 32,
+            79, 112, 101, 114, 97, 116, 105, 111, 110, 32, 71, 101, 110, 101, 115, 105, 115, 74, 117, 100,
+            103, 101, 32, 68, 114, 101, 100, 100, 58, 32, 68, 114, 101, 100, 100, 32, 118, 115, 46, 32,
+            68, 101, 97, 116, 104, 74, 97, 109, 101, 115, 32, 67, 97, 109, 101, 114, 111, 110, 39, 115,
+            32, 68, 97, 114, 107, 32, 65, 110, 103, 101, 108, 77, 97, 99, 101, 32, 71, 114, 105, 102,
+            102, 105, 110, 58, 32, 66, 111, 117, 110, 116, 121, 32, 72, 117, 110, 116, 101, 114, 66, 108,
+            111, 111, 100, 82, 97, 121, 110, 101, 83, 87, 65, 84, 58, 32, 71, 108, 111, 98, 97, 108,
+            32, 83, 116, 114, 105, 107, 101, 32, 84, 101, 97, 109, 68, 105, 101, 32, 72, 97, 114, 100,
+            58, 32, 86, 101, 110, 100, 101, 116, 116, 97, 76, 111, 108, 108, 105, 112, 111, 112, 32, 67,
+            104, 97, 105, 110, 115, 97, 119, 75, 105, 108, 108, 101, 114, 32, 105, 115, 32, 68, 101, 97,
+            100, 83, 110, 105, 112, 101, 114, 115, 72, 117, 110, 116, 101, 114, 39, 115, 32, 84, 114, 111,
+            112, 104, 121, 32, 50, 32, 45, 32, 69, 117, 114, 111, 112, 97, 77, 121, 32, 66, 111, 100,
+            121, 32, 67, 111, 97, 99, 104, 32, 51, 79, 98, 117, 116, 32, 80, 101, 116, 97, 110, 113,
+            117, 101, 32, 50, 84, 114, 117, 99, 107, 32, 82, 97, 99, 101, 114, 87, 82, 67, 32, 53,
+            82, 117, 103, 98, 121, 32, 87, 111, 114, 108, 100, 32, 67, 117, 112, 32, 50, 48, 49, 53,
+            72, 97, 110, 100, 98, 97, 108, 108, 32, 49, 54, 72, 97, 114, 114, 121, 32, 80, 111, 116,
+            116, 101, 114, 32, 65, 110, 100, 32, 84, 104, 101, 32, 68, 101, 97, 116, 104, 108, 121, 32,
+            72, 97, 108, 108, 111, 119, 115, 116, 109, 80, 114, 111, 32, 66, 101, 97, 99, 104, 32, 83,
+            111, 99, 99, 101, 114, 67, 117, 114, 115, 101, 58, 32, 84, 104, 101, 32, 69, 121, 101, 32,
+            111, 102, 32, 73, 115, 105, 115, 74, 117, 115, 116, 105, 99, 101, 32, 76, 101, 97, 103, 117,
+            101, 32, 72, 101, 114, 111, 101, 115, 76, 111, 111, 110, 101, 121, 32, 84, 117, 110, 101, 115,
+            32, 45, 32, 65, 67, 77, 69, 32, 65, 114, 115, 101, 110, 97, 108, 70, 46, 69, 46, 65,
+            46, 82, 46, 32, 50, 76, 69, 71, 79, 32, 66, 97, 116, 109, 97, 110, 87, 97, 110, 116,
+            101, 100, 32, 45, 32, 87, 101, 97, 112, 111, 110, 115, 32, 111, 102, 32, 70, 97, 116, 101,
+            76, 69, 71, 79, 32, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 71, 114, 101,
+            101, 110, 32, 76, 97, 110, 116, 101, 114, 110, 84, 104, 101, 32, 76, 111, 114, 100, 32, 111,
+            102, 32, 116, 104, 101, 32, 82, 105, 110, 103, 115, 32, 45, 32, 87, 97, 114, 32, 105, 110,
+            32, 116, 104, 101, 32, 78, 111, 114, 116, 104, 76, 69, 71, 79, 32, 82, 111, 99, 107, 32,
+            66, 97, 110, 100, 76, 79, 84, 71, 87, 104, 101, 114, 101, 32, 116, 104, 101, 32, 87, 105,
+            108, 100, 32, 84, 104, 105, 110, 103, 115, 32, 65, 114, 101, 77, 111, 114, 116, 97, 108, 32,
+            75, 111, 109, 98, 97, 116, 70, 46, 69, 46, 65, 46, 82, 46, 32, 51, 71, 97, 109, 101,
+            32, 80, 97, 114, 116, 121, 32, 73, 110, 32, 77, 111, 116, 105, 111, 110, 66, 97, 116, 109,
+            97, 110, 32, 45, 32, 65, 114, 107, 104, 97, 109, 32, 67, 105, 116, 121, 83, 101, 115, 97,
+            109, 101, 32, 83, 116, 114, 101, 101, 116, 32, 45, 32, 79, 110, 99, 101, 32, 85, 112, 111,
+            110, 32, 97, 32, 77, 111, 110, 115, 116, 101, 114, 72, 97, 112, 112, 121, 32, 70, 101, 101,
+            116, 32, 84, 119, 111, 32, 45, 32, 84, 104, 101, 32, 86, 105, 100, 101, 111, 103, 97, 109,
+            101, 76, 69, 71, 79, 32, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 45,
+            32, 89, 101, 97, 114, 115, 32, 53, 45, 55, 76, 69, 71, 79, 32, 66, 97, 116, 109, 97,
+            110, 32, 50, 76, 69, 71, 79, 32, 76, 111, 114, 100, 32, 111, 102, 32, 116, 104, 101, 32,
+            82, 105, 110, 103, 115, 84, 104, 101, 32, 87, 105, 116, 99, 104, 101, 114, 32, 50, 32, 45,
+            32, 65, 115, 115, 97, 115, 115, 105, 110, 115, 32, 111, 102, 32, 75, 105, 110, 103, 115, 72,
+            97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 102, 111, 114, 32, 75, 105, 110, 101,
+            99, 116, 66, 97, 116, 109, 97, 110, 32, 45, 32, 65, 114, 107, 104, 97, 109, 32, 79, 114,
+            105, 103, 105, 110, 115, 73, 110, 106, 117, 115, 116, 105, 99, 101, 32, 45, 32, 71, 111, 100,
+            115, 32, 65, 109, 111, 110, 103, 32, 85, 115, 83, 104, 97, 100, 111, 119, 32, 111, 102, 32,
+            77, 111, 114, 100, 111, 114, 77, 105, 100, 119, 97, 121, 32, 65, 114, 99, 97, 100, 101, 32,
+            79, 114, 105, 103, 105, 110, 115, 77, 97, 100, 32, 77, 97, 120, 76, 69, 71, 79, 32, 77,
+            97, 114, 118, 101, 108, 87, 111, 114, 108, 100, 39, 115, 32, 66, 101, 115, 116, 32, 68, 114,
+            105, 118, 101, 114, 76, 69, 71, 79, 32, 77, 111, 118, 105, 101, 32, 86, 105, 100, 101, 111,
+            103, 97, 109, 101, 76, 69, 71, 79, 32, 84, 104, 101, 32, 72, 111, 98, 98, 105, 116, 76,
+            69, 71, 79, 32, 66, 97, 116, 109, 97, 110, 32, 51, 32, 45, 32, 66, 101, 121, 111, 110,
+            100, 32, 71, 111, 116, 104, 97, 109, 76, 69, 71, 79, 32, 68, 105, 109, 101, 110, 115, 105,
+            111, 110, 115, 76, 69, 71, 79, 32, 74, 117, 114, 97, 115, 115, 105, 99, 32, 87, 111, 114,
+            108, 100, 76, 69, 71, 79, 32, 77, 97, 114, 118, 101, 108, 39, 115, 32, 65, 118, 101, 110,
+            103, 101, 114, 115, 76, 69, 71, 79, 32, 83, 116, 97, 114, 32, 87, 97, 114, 115, 32, 45,
+            32, 84, 104, 101, 32, 70, 111, 114, 99, 101, 32, 65, 119, 97, 107, 101, 110, 115, 72, 101,
+            120, 105, 99, 32, 72, 68, 66, 101, 106, 101, 119, 101, 108, 101, 100, 32, 50, 72, 97, 114,
+            100, 119, 111, 111, 100, 32, 72, 101, 97, 114, 116, 115, 83, 109, 97, 108, 108, 32, 65, 114,
+            109, 115, 77, 117, 116, 97, 110, 116, 32, 83, 116, 111, 114, 109, 32, 82, 101, 108, 111, 97,
+            100, 101, 100, 79, 117, 116, 112, 111, 115, 116, 32, 75, 97, 108, 111, 107, 105, 32, 88, 87,
+            105, 107, 32, 45, 32, 70, 97, 98, 108, 101, 32, 111, 102, 32, 83, 111, 117, 108, 115, 87,
+            111, 114, 109, 115, 72, 97, 114, 100, 119, 111, 111, 100, 32, 66, 97, 99, 107, 103, 97, 109,
+            109, 111, 110, 72, 97, 114, 100, 119, 111, 111, 100, 32, 83, 112, 97, 100, 101, 115, 82, 111,
+            98, 111, 66, 108, 105, 116, 122, 67, 108, 111, 110, 105, 110, 103, 32, 67, 108, 121, 100, 101,
+            78, 111, 118, 97, 100, 114, 111, 109, 101, 74, 101, 119, 101, 108, 32, 81, 117, 101, 115, 116,
+            66, 97, 110, 107, 115, 104, 111, 116, 32, 66, 105, 108, 108, 105, 97, 114, 100, 115, 32, 50,
+            71, 101, 111, 109, 101, 116, 114, 121, 32, 87, 97, 114, 115, 32, 69, 118, 111, 108, 118, 101,
+            100, 67, 114, 121, 115, 116, 97, 108, 32, 81, 117, 101, 115, 116, 90, 117, 109, 97, 83, 116,
+            114, 101, 101, 116, 32, 84, 114, 97, 99, 101, 32, 45, 78, 89, 67, 70, 101, 101, 100, 105,
+            110, 103, 32, 70, 114, 101, 110, 122, 121, 65, 115, 116, 114, 111, 112, 111, 112, 85, 110, 111,
+            83, 116, 114, 101, 101, 116, 32, 70, 105, 103, 104, 116, 101, 114, 32, 73, 73, 32, 45, 32,
+            72, 121, 112, 101, 114, 32, 70, 105, 103, 104, 116, 105, 110, 103, 83, 112, 121, 103, 108, 97,
+            115, 115, 32, 66, 111, 97, 114, 100, 32, 71, 97, 109, 101, 115, 84, 101, 120, 97, 115, 32,
+            72, 111, 108, 100, 39, 101, 109, 77, 97, 100, 32, 84, 114, 97, 99, 107, 115, 76, 85, 77,
+            73, 78, 69, 83, 32, 76, 73, 86, 69, 33, 74, 101, 116, 112, 97, 99, 32, 82, 101, 102,
+            117, 101, 108, 108, 101, 100, 65, 115, 115, 97, 117, 108, 116, 32, 72, 101, 114, 111, 101, 115,
+            65, 114, 107, 97, 100, 105, 97, 110, 32, 87, 97, 114, 114, 105, 111, 114, 115, 83, 112, 97,
+            99, 101, 32, 71, 105, 114, 97, 102, 102, 101, 76, 117, 120, 111, 114, 32, 50, 72, 101, 97,
+            118, 121, 32, 87, 101, 97, 112, 111, 110, 80, 65, 67, 45, 77, 65, 78, 71, 97, 108, 97,
+            103, 97, 70, 114, 111, 103, 103, 101, 114, 83, 99, 114, 97, 109, 98, 108, 101, 84, 105, 109,
+            101, 32, 80, 105, 108, 111, 116, 89, 105, 101, 32, 65, 114, 32, 75, 117, 110, 103, 45, 70,
+            117, 71, 121, 114, 117, 115, 115, 67, 111, 110, 116, 114, 97, 82, 117, 115, 104, 39, 110, 32,
+            65, 116, 116, 97, 99, 107, 83, 117, 112, 101, 114, 32, 67, 111, 110, 116, 114, 97, 84, 114,
+            97, 99, 107, 32, 97, 110, 100, 32, 70, 105, 101, 108, 100, 77, 117, 116, 97, 110, 116, 32,
+            83, 116, 111, 114, 109, 32, 69, 109, 112, 105, 114, 101, 66, 117, 107, 117, 32, 83, 117, 100,
+            111, 107, 117, 67, 111, 109, 109, 97, 110, 100, 101, 114, 115, 32, 45, 32, 65, 116, 116, 97,
+            99, 107, 68, 97, 114, 119, 105, 110, 105, 97, 43, 68, 79, 79, 77, 69, 101, 116, 115, 32,
+            45, 32, 67, 104, 111, 119, 100, 111, 119, 110, 72, 101, 120, 105, 99, 32, 50, 66, 97, 110,
+            100, 32, 111, 102, 32, 66, 117, 103, 115, 83, 119, 105, 116, 99, 104, 98, 97, 108, 108, 84,
+            111, 116, 101, 109, 66, 97, 108, 108, 80, 105, 110, 98, 97, 108, 108, 32, 70, 88, 78, 69,
+            87, 32, 82, 65, 76, 76, 89, 45, 88, 68, 73, 71, 32, 68, 85, 71, 77, 115, 46, 32,
+            80, 97, 99, 45, 109, 97, 110, 70, 97, 116, 97, 108, 32, 70, 117, 114, 121, 32, 83, 112,
+            101, 99, 105, 97, 108, 84, 101, 116, 114, 105, 115, 32, 83, 112, 108, 97, 115, 104, 83, 111,
+            108, 116, 114, 105, 111, 32, 83, 111, 108, 105, 116, 97, 105, 114, 101, 67, 97, 116, 97, 110,
+            66, 111, 109, 98, 101, 114, 109, 97, 110, 32, 76, 73, 86, 69, 67, 97, 114, 99, 97, 115,
+            115, 111, 110, 110, 101, 51, 68, 32, 85, 108, 116, 114, 97, 32, 77, 105, 110, 105, 103, 111,
+            108, 102, 71, 101, 111, 110, 65, 108, 105, 101, 110, 32, 72, 111, 109, 105, 110, 105, 100, 32,
+            72, 68, 67, 97, 115, 116, 108, 101, 118, 97, 110, 105, 97, 32, 45, 32, 83, 121, 109, 112,
+            104, 111, 110, 121, 32, 111, 102, 32, 116, 104, 101, 32, 78, 105, 103, 104, 116, 67, 101, 110,
+            116, 105, 112, 101, 100, 101, 32, 38, 32, 77, 105, 108, 108, 105, 112, 101, 100, 101, 77, 105,
+            115, 115, 105, 108, 101, 32, 67, 111, 109, 109, 97, 110, 100, 65, 115, 116, 101, 114, 111, 105,
+            100, 115, 32, 38, 32, 68, 101, 108, 117, 120, 101, 84, 101, 109, 112, 101, 115, 116, 66, 97,
+            116, 116, 108, 101, 122, 111, 110, 101, 87, 97, 114, 108, 111, 114, 100, 115, 87, 97, 114, 32,
+            87, 111, 114, 108, 100, 76, 111, 100, 101, 32, 82, 117, 110, 110, 101, 114, 78, 43, 77, 97,
+            114, 97, 116, 104, 111, 110, 32, 45, 32, 68, 117, 114, 97, 110, 100, 97, 108, 77, 97, 103,
+            105, 99, 32, 45, 32, 84, 104, 101, 32, 71, 97, 116, 104, 101, 114, 105, 110, 103, 71, 111,
+            108, 100, 101, 110, 32, 65, 120, 101, 83, 111, 110, 105, 99, 32, 84, 104, 101, 32, 72, 101,
+            100, 103, 101, 104, 111, 103, 32, 50, 83, 111, 110, 105, 99, 32, 84, 104, 101, 32, 72, 101,
+            100, 103, 101, 104, 111, 103, 80, 114, 105, 110, 99, 101, 32, 79, 102, 32, 80, 101, 114, 115,
+            105, 97, 67, 104, 101, 115, 115, 109, 97, 115, 116, 101, 114, 32, 76, 105, 118, 101, 69, 108,
+            101, 109, 101, 110, 116, 115, 79, 102, 68, 101, 115, 116, 114, 117, 99, 116, 105, 111, 110, 87,
+            105, 110, 103, 32, 67, 111, 109, 109, 97, 110, 100, 101, 114, 32, 65, 114, 101, 110, 97, 83,
+            101, 110, 115, 105, 98, 108, 101, 32, 87, 111, 114, 108, 100, 32, 111, 102, 32, 83, 111, 99,
+            99, 101, 114, 66, 111, 111, 109, 32, 66, 111, 111, 109, 32, 82, 111, 99, 107, 101, 116, 66,
+            108, 105, 115, 115, 32, 73, 115, 108, 97, 110, 100, 83, 116, 114, 101, 101, 116, 115, 32, 111,
+            102, 32, 82, 97, 103, 101, 32, 50, 80, 117, 122, 122, 108, 101, 32, 70, 105, 103, 104, 116,
+            101, 114, 32, 72, 68, 82, 111, 99, 107, 101, 116, 109, 101, 110, 32, 45, 65, 120, 105, 115,
+            32, 111, 102, 32, 69, 118, 105, 108, 69, 52, 32, 40, 69, 118, 101, 114, 121, 32, 69, 120,
+            116, 101, 110, 100, 32, 69, 120, 116, 114, 97, 32, 69, 120, 116, 114, 101, 109, 101, 41, 85,
+            110, 100, 101, 114, 116, 111, 119, 87, 111, 114, 100, 32, 80, 117, 122, 122, 108, 101, 82, 111,
+            99, 107, 101, 116, 66, 111, 119, 108, 69, 99, 99, 111, 32, 116, 104, 101, 32, 68, 111, 108,
+            112, 104, 105, 110, 80, 97, 99, 45, 77, 97, 110, 32, 67, 46, 69, 46, 73, 107, 97, 114,
+            117, 103, 97, 83, 104, 114, 101, 100, 32, 78, 101, 98, 117, 108, 97, 83, 104, 111, 116, 101,
+            115, 116, 32, 83, 104, 111, 103, 105, 70, 114, 111, 103, 103, 101, 114, 32, 50, 67, 111, 102,
+            102, 101, 101, 116, 105, 109, 101, 32, 67, 114, 111, 115, 115, 119, 111, 114, 100, 115, 66, 101,
+            97, 116, 39, 110, 32, 71, 114, 111, 111, 118, 121, 65, 99, 101, 115, 32, 111, 102, 32, 116,
+            104, 101, 32, 71, 97, 108, 97, 120, 121, 84, 114, 105, 103, 103, 101, 114, 104, 101, 97, 114,
+            116, 32, 69, 120, 101, 108, 105, 99, 97, 80, 101, 103, 103, 108, 101, 70, 101, 101, 100, 105,
+            110, 103, 32, 70, 114, 101, 110, 122, 121, 32, 50, 84, 82, 79, 78, 68, 105, 115, 99, 115,
+            32, 79, 102, 32, 84, 114, 111, 110, 82, 111, 99, 107, 121, 32, 65, 110, 100, 32, 66, 117,
+            108, 108, 119, 105, 110, 107, 108, 101, 88, 69, 86, 73, 79, 85, 83, 83, 99, 114, 101, 119,
+            32, 74, 117, 109, 112, 101, 114, 33, 80, 117, 122, 122, 108, 101, 32, 81, 117, 101, 115, 116,
+            77, 105, 108, 105, 116, 97, 114, 121, 32, 77, 97, 100, 110, 101, 115, 115, 68, 111, 109, 105,
+            110, 111, 32, 77, 97, 115, 116, 101, 114, 85, 110, 111, 32, 82, 117, 115, 104, 67, 114, 97,
+            122, 121, 77, 111, 117, 115, 101, 80, 111, 107, 101, 114, 32, 83, 109, 97, 115, 104, 71, 114,
+            105, 112, 83, 104, 105, 102, 116, 83, 112, 111, 110, 103, 101, 66, 111, 98, 32, 85, 110, 100,
+            101, 114, 80, 97, 110, 116, 115, 33, 80, 117, 122, 122, 108, 101, 32, 65, 114, 99, 97, 100,
+            101, 71, 111, 108, 102, 32, 45, 32, 84, 101, 101, 32, 73, 116, 32, 85, 112, 33, 83, 117,
+            112, 101, 114, 32, 83, 116, 114, 101, 101, 116, 32, 70, 105, 103, 104, 116, 101, 114, 32, 50,
+            32, 84, 117, 114, 98, 111, 32, 72, 68, 79, 109, 101, 103, 97, 32, 70, 105, 118, 101, 87,
+            105, 116, 115, 32, 38, 32, 87, 97, 103, 101, 114, 115, 69, 88, 73, 84, 86, 105, 103, 105,
+            108, 97, 110, 116, 101, 32, 56, 32, 65, 114, 99, 97, 100, 101, 49, 57, 52, 50, 32, 45,
+            32, 74, 111, 105, 110, 116, 32, 83, 116, 114, 105, 107, 101, 87, 111, 108, 102, 32, 111, 102,
+            32, 116, 104, 101, 32, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 45, 32, 67,
+            111, 109, 109, 97, 110, 100, 111, 32, 51, 72, 97, 112, 112, 121, 32, 84, 114, 101, 101, 32,
+            70, 114, 105, 101, 110, 100, 115, 82, 45, 84, 121, 112, 101, 32, 68, 105, 109, 101, 110, 115,
+            105, 111, 110, 115, 66, 114, 97, 105, 110, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 82,
+            101, 122, 32, 72, 68, 77, 108, 98, 32, 83, 116, 105, 99, 107, 98, 97, 108, 108, 67, 97,
+            115, 116, 108, 101, 32, 67, 114, 97, 115, 104, 101, 114, 115, 71, 111, 33, 32, 71, 111, 33,
+            32, 66, 114, 101, 97, 107, 32, 83, 116, 101, 97, 100, 121, 71, 97, 108, 97, 103, 97, 32,
+            76, 101, 103, 105, 111, 110, 115, 77, 114, 46, 32, 68, 114, 105, 108, 108, 101, 114, 32, 79,
+            110, 108, 105, 110, 101, 83, 99, 104, 105, 122, 111, 105, 100, 84, 104, 101, 32, 77, 97, 119,
+            65, 115, 115, 97, 117, 108, 116, 32, 72, 101, 114, 111, 101, 115, 32, 50, 83, 104, 114, 101,
+            107, 45, 78, 45, 82, 111, 108, 108, 81, 117, 97, 107, 101, 32, 65, 114, 101, 110, 97, 32,
+            65, 114, 99, 97, 100, 101, 68, 101, 102, 101, 110, 115, 101, 32, 71, 114, 105, 100, 82, 111,
+            99, 107, 101, 116, 32, 82, 105, 111, 116, 66, 114, 97, 105, 100, 77, 101, 116, 97, 108, 32,
+            83, 108, 117, 103, 32, 51, 83, 97, 109, 117, 114, 97, 105, 32, 83, 104, 111, 100, 111, 119,
+            110, 32, 73, 73, 75, 79, 70, 57, 56, 85, 77, 66, 111, 111, 103, 105, 101, 32, 66, 117,
+            110, 110, 105, 101, 115, 90, 111, 109, 98, 105, 101, 32, 87, 114, 97, 110, 103, 108, 101, 114,
+            115, 84, 105, 81, 97, 108, 65, 32, 75, 105, 110, 103, 100, 111, 109, 32, 102, 111, 114, 32,
+            75, 101, 102, 108, 105, 110, 103, 115, 77, 105, 110, 101, 115, 119, 101, 101, 112, 101, 114, 32,
+            70, 108, 97, 103, 115, 84, 105, 99, 107, 101, 116, 32, 116, 111, 32, 82, 105, 100, 101, 68,
+            111, 117, 98, 108, 101, 32, 68, 32, 68, 111, 100, 103, 101, 98, 97, 108, 108, 65, 103, 101,
+            32, 111, 102, 32, 66, 111, 111, 116, 121, 66, 105, 111, 110, 105, 99, 67, 111, 109, 109, 97,
+            110, 100, 111, 32, 45, 82, 101, 97, 114, 109, 101, 100, 82, 111, 111, 103, 111, 111, 83, 104,
+            97, 100, 111, 119, 32, 67, 111, 109, 112, 108, 101, 120, 83, 101, 97, 108, 105, 102, 101, 32,
+            83, 97, 102, 97, 114, 105, 71, 101, 111, 109, 101, 116, 114, 121, 32, 87, 97, 114, 115, 32,
+            69, 118, 111, 108, 118, 101, 100, 32, 50, 53, 116, 104, 32, 71, 114, 97, 100, 101, 114, 68,
+            117, 107, 101, 32, 78, 117, 107, 101, 109, 32, 51, 68, 84, 104, 101, 32, 68, 105, 115, 104,
+            119, 97, 115, 104, 101, 114, 83, 111, 117, 108, 99, 97, 108, 105, 98, 117, 114, 69, 110, 99,
+            108, 101, 118, 101, 114, 109, 101, 110, 116, 69, 120, 112, 101, 114, 105, 109, 101, 110, 116, 71,
+            101, 108, 66, 108, 97, 122, 105, 110, 103, 32, 66, 105, 114, 100, 115, 80, 101, 110, 110, 121,
+            32, 65, 114, 99, 97, 100, 101, 32, 69, 112, 105, 115, 111, 100, 101, 32, 49, 71, 105, 110,
+            32, 82, 117, 109, 109, 121, 68, 101, 97, 116, 104, 32, 84, 97, 110, 107, 87, 111, 114, 109,
+            115, 32, 50, 32, 45, 32, 65, 114, 109, 97, 103, 101, 100, 100, 111, 110, 80, 117, 122, 122,
+            108, 101, 32, 81, 117, 101, 115, 116, 32, 71, 97, 108, 97, 99, 116, 114, 105, 120, 77, 101,
+            116, 101, 111, 115, 32, 87, 97, 114, 115, 70, 97, 98, 108, 101, 32, 73, 73, 32, 80, 117,
+            98, 32, 71, 97, 109, 101, 115, 82, 97, 115, 107, 117, 108, 108, 115, 67, 101, 108, 108, 70,
+            97, 99, 116, 111, 114, 32, 45, 32, 80, 115, 121, 99, 104, 111, 107, 105, 110, 101, 116, 105,
+            99, 32, 87, 97, 114, 115, 83, 104, 97, 100, 111, 119, 32, 65, 115, 115, 97, 117, 108, 116,
+            47, 84, 101, 110, 99, 104, 117, 80, 101, 110, 110, 121, 32, 65, 114, 99, 97, 100, 101, 32,
+            69, 112, 105, 115, 111, 100, 101, 32, 50, 77, 69, 71, 65, 32, 77, 65, 78, 32, 57, 77,
+            101, 114, 118, 32, 71, 114, 105, 102, 102, 105, 110, 39, 115, 32, 88, 119, 111, 114, 100, 115,
+            65, 120, 101, 108, 32, 38, 32, 80, 105, 120, 101, 108, 89, 111, 45, 72, 111, 32, 75, 97,
+            98, 108, 97, 109, 109, 111, 84, 111, 117, 114, 32, 100, 101, 32, 70, 114, 97, 110, 99, 101,
+            32, 50, 48, 48, 57, 84, 104, 101, 32, 87, 97, 114, 114, 105, 111, 114, 115, 32, 45, 32,
+            83, 66, 83, 111, 117, 116, 104, 32, 80, 97, 114, 107, 70, 117, 110, 84, 111, 119, 110, 32,
+            77, 97, 104, 106, 111, 110, 103, 80, 111, 119, 101, 114, 85, 112, 32, 70, 111, 114, 101, 118,
+            101, 114, 70, 108, 111, 99, 107, 33, 87, 97, 108, 108, 97, 99, 101, 32, 38, 32, 71, 114,
+            111, 109, 105, 116, 32, 35, 49, 80, 117, 122, 122, 108, 101, 32, 67, 104, 114, 111, 110, 105,
+            99, 108, 101, 115, 66, 97, 110, 106, 111, 45, 75, 97, 122, 111, 111, 105, 101, 66, 97, 110,
+            106, 111, 45, 84, 111, 111, 105, 101, 84, 111, 119, 101, 114, 32, 66, 108, 111, 120, 120, 32,
+            68, 101, 108, 117, 120, 101, 67, 97, 108, 108, 32, 111, 102, 32, 68, 117, 116, 121, 32, 67,
+            108, 97, 115, 115, 105, 99, 84, 114, 105, 97, 108, 115, 32, 72, 68, 65, 110, 99, 105, 101,
+            110, 116, 115, 32, 111, 102, 32, 79, 111, 103, 97, 76, 97, 122, 121, 32, 82, 97, 105, 100,
+            101, 114, 115, 80, 111, 114, 116, 97, 108, 32, 45, 32, 83, 116, 105, 108, 108, 32, 65, 108,
+            105, 118, 101, 90, 111, 109, 98, 105, 101, 32, 65, 112, 111, 99, 97, 108, 121, 112, 115, 101,
+            65, 108, 105, 101, 110, 32, 66, 114, 101, 101, 100, 32, 69, 112, 105, 115, 111, 100, 101, 32,
+            49, 72, 121, 100, 114, 111, 32, 84, 104, 117, 110, 100, 101, 114, 84, 101, 120, 97, 115, 32,
+            67, 104, 101, 97, 116, 39, 101, 109, 87, 97, 116, 99, 104, 109, 101, 110, 32, 45, 32, 84,
+            104, 101, 32, 69, 110, 100, 32, 73, 115, 32, 78, 105, 103, 104, 83, 112, 97, 99, 101, 32,
+            65, 114, 107, 71, 97, 114, 111, 117, 32, 45, 32, 77, 97, 114, 107, 32, 111, 102, 32, 116,
+            104, 101, 32, 87, 111, 108, 118, 101, 115, 77, 101, 116, 97, 108, 32, 83, 108, 117, 103, 32,
+            88, 88, 86, 97, 110, 100, 97, 108, 32, 72, 101, 97, 114, 116, 115, 32, 45, 32, 70, 108,
+            97, 109, 101, 115, 32, 111, 102, 32, 74, 117, 100, 103, 109, 101, 110, 116, 51, 32, 111, 110,
+            32, 51, 32, 78, 72, 76, 32, 65, 114, 99, 97, 100, 101, 77, 97, 114, 118, 101, 108, 32,
+            86, 115, 46, 32, 67, 97, 112, 99, 111, 109, 32, 50, 73, 110, 116, 101, 114, 112, 111, 108,
+            87, 97, 108, 108, 97, 99, 101, 32, 38, 32, 71, 114, 111, 109, 105, 116, 32, 35, 50, 87,
+            97, 108, 108, 97, 99, 101, 32, 38, 32, 71, 114, 111, 109, 105, 116, 32, 35, 51, 87, 97,
+            108, 108, 97, 99, 101, 32, 38, 32, 71, 114, 111, 109, 105, 116, 32, 35, 52, 83, 97, 109,
+            32, 38, 32, 77, 97, 120, 32, 83, 97, 118, 101, 32, 116, 104, 101, 32, 87, 111, 114, 108,
+            100, 66, 97, 116, 116, 108, 101, 102, 105, 101, 108, 100, 32, 49, 57, 52, 51, 70, 97, 109,
+            105, 108, 121, 32, 71, 97, 109, 101, 32, 78, 105, 103, 104, 116, 73, 110, 118, 105, 110, 99,
+            105, 98, 108, 101, 32, 84, 105, 103, 101, 114, 67, 114, 105, 109, 115, 111, 110, 32, 65, 108,
+            108, 105, 97, 110, 99, 101, 86, 105, 114, 116, 117, 97, 108, 45, 79, 110, 32, 79, 84, 83,
+            99, 114, 97, 112, 32, 77, 101, 116, 97, 108, 67, 114, 121, 115, 116, 97, 108, 32, 68, 101,
+            102, 101, 110, 100, 101, 114, 115, 89, 111, 115, 117, 109, 105, 110, 33, 32, 76, 73, 86, 69,
+            70, 117, 108, 108, 32, 72, 111, 117, 115, 101, 32, 80, 111, 107, 101, 114, 83, 116, 97, 114,
+            32, 84, 114, 101, 107, 32, 45, 32, 68, 183, 65, 183, 67, 83, 112, 108, 111, 115, 105, 111,
+            110, 32, 77, 97, 110, 69, 88, 73, 84, 50, 65, 114, 107, 97, 110, 111, 105, 100, 32, 76,
+            105, 118, 101, 33, 75, 114, 105, 115, 115, 120, 77, 111, 110, 107, 101, 121, 32, 73, 115, 108,
+            97, 110, 100, 83, 112, 97, 99, 101, 32, 73, 110, 118, 97, 100, 101, 114, 115, 32, 69, 120,
+            116, 114, 101, 109, 101, 78, 67, 65, 65, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108,
+            32, 77, 77, 69, 83, 97, 109, 32, 38, 32, 77, 97, 120, 32, 66, 101, 121, 111, 110, 100,
+            32, 84, 105, 109, 101, 32, 97, 110, 100, 32, 83, 112, 97, 99, 101, 84, 111, 121, 32, 83,
+            111, 108, 100, 105, 101, 114, 115, 84, 104, 101, 32, 80, 97, 116, 104, 32, 111, 102, 32, 71,
+            111, 87, 97, 116, 99, 104, 109, 101, 110, 32, 45, 32, 84, 104, 101, 32, 69, 110, 100, 32,
+            73, 115, 32, 78, 105, 103, 104, 32, 45, 32, 80, 97, 114, 116, 32, 50, 67, 111, 109, 105,
+            120, 32, 90, 111, 110, 101, 65, 108, 116, 101, 114, 101, 100, 32, 66, 101, 97, 115, 116, 83,
+            111, 110, 105, 99, 32, 84, 104, 101, 32, 72, 101, 100, 103, 101, 104, 111, 103, 32, 51, 83,
+            104, 105, 110, 111, 98, 105, 80, 104, 97, 110, 116, 97, 115, 121, 32, 83, 116, 97, 114, 32,
+            73, 73, 71, 117, 110, 115, 116, 97, 114, 32, 72, 101, 114, 111, 101, 115, 87, 111, 108, 102,
+            101, 110, 115, 116, 101, 105, 110, 32, 51, 68, 48, 68, 32, 66, 101, 97, 116, 32, 68, 114,
+            111, 112, 73, 115, 108, 97, 110, 100, 115, 32, 111, 102, 32, 87, 97, 107, 102, 117, 75, 79,
+            70, 50, 48, 48, 50, 85, 77, 75, 79, 70, 32, 83, 75, 89, 32, 83, 84, 65, 71, 69,
+            66, 117, 98, 98, 108, 101, 32, 66, 111, 98, 98, 108, 101, 32, 78, 101, 111, 33, 66, 111,
+            109, 98, 101, 114, 109, 97, 110, 32, 66, 97, 116, 116, 108, 101, 102, 101, 115, 116, 66, 108,
+            111, 111, 100, 121, 32, 71, 111, 111, 100, 32, 84, 105, 109, 101, 80, 97, 110, 122, 101, 114,
+            32, 71, 101, 110, 101, 114, 97, 108, 83, 110, 111, 111, 112, 121, 32, 70, 108, 121, 105, 110,
+            103, 32, 65, 99, 101, 68, 79, 79, 77, 32, 73, 73, 48, 32, 100, 97, 121, 32, 65, 116,
+            116, 97, 99, 107, 32, 111, 110, 32, 69, 97, 114, 116, 104, 84, 114, 111, 117, 98, 108, 101,
+            32, 87, 105, 116, 99, 104, 101, 115, 32, 78, 101, 111, 68, 114, 111, 112, 108, 105, 116, 122,
+            82, 65, 89, 83, 84, 79, 82, 77, 32, 72, 68, 83, 112, 101, 108, 117, 110, 107, 121, 67,
+            111, 109, 109, 97, 110, 100, 101, 114, 39, 115, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101,
+            70, 101, 122, 80, 117, 122, 122, 108, 101, 32, 66, 111, 98, 98, 108, 101, 32, 76, 105, 118,
+            101, 33, 80, 101, 114, 102, 101, 99, 116, 32, 68, 97, 114, 107, 82, 97, 105, 110, 98, 111,
+            119, 32, 73, 115, 108, 97, 110, 100, 115, 32, 45, 32, 84, 111, 119, 101, 114, 105, 110, 103,
+            32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 83, 111, 110, 105, 99, 32, 38, 32, 75, 110,
+            117, 99, 107, 108, 101, 115, 65, 113, 117, 97, 71, 121, 114, 111, 109, 97, 110, 99, 101, 114,
+            68, 101, 97, 116, 104, 32, 98, 121, 32, 67, 117, 98, 101, 77, 97, 100, 98, 97, 108, 108,
+            115, 32, 66, 97, 98, 111, 32, 45, 73, 110, 118, 97, 115, 105, 111, 110, 77, 97, 116, 116,
+            32, 72, 97, 122, 97, 114, 100, 32, 45, 32, 66, 108, 111, 111, 100, 32, 66, 97, 116, 104,
+            32, 97, 110, 100, 32, 66, 101, 121, 111, 110, 100, 87, 111, 108, 102, 101, 110, 115, 116, 101,
+            105, 110, 32, 51, 68, 73, 110, 102, 101, 114, 110, 111, 32, 80, 111, 111, 108, 76, 73, 77,
+            66, 79, 80, 117, 122, 122, 108, 101, 103, 101, 100, 100, 111, 110, 70, 114, 101, 116, 32, 78,
+            105, 99, 101, 87, 105, 110, 116, 101, 114, 98, 111, 116, 116, 111, 109, 83, 101, 114, 105, 111,
+            117, 115, 32, 83, 97, 109, 32, 72, 68, 32, 45, 32, 84, 70, 69, 65, 32, 87, 111, 114,
+            108, 100, 32, 111, 102, 32, 75, 101, 102, 108, 105, 110, 103, 115, 90, 101, 110, 111, 32, 67,
+            108, 97, 115, 104, 32, 85, 69, 70, 105, 110, 97, 108, 32, 70, 105, 103, 104, 116, 32, 45,
+            32, 68, 98, 108, 73, 109, 112, 97, 99, 116, 66, 105, 111, 110, 105, 99, 32, 67, 111, 109,
+            109, 97, 110, 100, 111, 32, 45, 32, 82, 101, 97, 114, 109, 101, 100, 32, 50, 69, 97, 114,
+            116, 104, 119, 111, 114, 109, 32, 74, 105, 109, 32, 72, 68, 76, 117, 99, 105, 100, 105, 116,
+            121, 81, 73, 88, 43, 43, 72, 121, 98, 114, 105, 100, 66, 101, 110, 32, 49, 48, 32, 84,
+            104, 101, 32, 82, 105, 115, 101, 32, 79, 102, 32, 72, 101, 120, 80, 111, 108, 97, 114, 32,
+            80, 97, 110, 105, 99, 77, 97, 100, 100, 101, 110, 32, 78, 70, 76, 32, 65, 114, 99, 97,
+            100, 101, 77, 69, 71, 65, 32, 77, 65, 78, 32, 49, 48, 72, 121, 100, 114, 111, 112, 104,
+            111, 98, 105, 97, 80, 108, 97, 110, 116, 115, 32, 118, 115, 46, 32, 90, 111, 109, 98, 105,
+            101, 115, 82, 111, 99, 107, 101, 116, 32, 75, 110, 105, 103, 104, 116, 89, 117, 45, 71, 105,
+            45, 79, 104, 33, 32, 53, 68, 39, 115, 32, 68, 101, 99, 97, 100, 101, 32, 68, 117, 101,
+            108, 115, 32, 80, 108, 117, 115, 79, 117, 116, 108, 97, 110, 100, 65, 102, 116, 101, 114, 32,
+            66, 117, 114, 110, 101, 114, 32, 67, 108, 105, 109, 97, 120, 83, 111, 110, 105, 99, 32, 84,
+            104, 101, 32, 72, 101, 100, 103, 101, 104, 111, 103, 32, 52, 68, 97, 121, 115, 32, 79, 102,
+            32, 84, 104, 117, 110, 100, 101, 114, 32, 45, 32, 65, 114, 99, 97, 100, 101, 85, 110, 98,
+            111, 117, 110, 100, 32, 83, 97, 103, 97, 82, 105, 115, 107, 32, 70, 97, 99, 116, 105, 111,
+            110, 115, 67, 104, 105, 109, 101, 82, 117, 115, 104, 39, 78, 32, 65, 116, 116, 97, 99, 107,
+            32, 45, 32, 69, 120, 45, 80, 97, 116, 114, 105, 111, 116, 72, 97, 114, 100, 32, 67, 111,
+            114, 112, 115, 32, 45, 32, 85, 112, 114, 105, 115, 105, 110, 103, 77, 105, 103, 104, 116, 32,
+            38, 32, 77, 97, 103, 105, 99, 32, 67, 108, 97, 115, 104, 32, 111, 102, 32, 72, 101, 114,
+            111, 101, 115, 105, 108, 111, 109, 105, 108, 111, 72, 111, 108, 101, 32, 73, 110, 32, 84, 104,
+            101, 32, 87, 97, 108, 108, 78, 69, 79, 71, 69, 79, 32, 66, 65, 84, 84, 76, 69, 32,
+            67, 79, 76, 73, 83, 69, 85, 77, 67, 111, 109, 105, 99, 32, 74, 117, 109, 112, 101, 114,
+            84, 104, 101, 32, 68, 105, 115, 104, 119, 97, 115, 104, 101, 114, 32, 45, 32, 86, 97, 109,
+            112, 105, 114, 101, 32, 83, 109, 105, 108, 101, 65, 108, 105, 101, 110, 32, 66, 114, 101, 101,
+            100, 32, 50, 32, 45, 32, 65, 115, 115, 97, 117, 108, 116, 80, 105, 110, 98, 97, 108, 108,
+            32, 70, 88, 50, 71, 114, 101, 101, 100, 32, 67, 111, 114, 112, 83, 111, 110, 105, 99, 32,
+            65, 100, 118, 101, 110, 116, 117, 114, 101, 83, 99, 111, 116, 116, 32, 80, 105, 108, 103, 114,
+            105, 109, 32, 118, 115, 32, 84, 104, 101, 32, 87, 111, 114, 108, 100, 32, 45, 32, 84, 104,
+            101, 32, 71, 97, 109, 101, 77, 111, 111, 110, 32, 68, 105, 118, 101, 114, 66, 97, 116, 116,
+            108, 101, 66, 108, 111, 99, 107, 32, 84, 104, 101, 97, 116, 101, 114, 67, 114, 97, 122, 121,
+            32, 84, 97, 120, 105, 84, 104, 105, 110, 103, 115, 32, 111, 110, 32, 87, 104, 101, 101, 108,
+            115, 68, 117, 107, 101, 32, 78, 117, 107, 101, 109, 32, 45, 32, 77, 97, 110, 104, 97, 116,
+            116, 97, 110, 68, 97, 110, 99, 101, 33, 32, 73, 116, 39, 115, 32, 121, 111, 117, 114, 32,
+            83, 116, 97, 103, 101, 83, 112, 97, 99, 101, 32, 67, 104, 97, 110, 110, 101, 108, 32, 53,
+            32, 80, 97, 114, 116, 32, 50, 51, 68, 32, 85, 108, 116, 114, 97, 32, 77, 105, 110, 105,
+            103, 111, 108, 102, 32, 50, 80, 117, 122, 122, 108, 101, 32, 81, 117, 101, 115, 116, 32, 50,
+            77, 111, 110, 100, 97, 121, 32, 78, 105, 103, 104, 116, 32, 67, 111, 109, 98, 97, 116, 83,
+            112, 97, 99, 101, 32, 73, 110, 118, 97, 100, 101, 114, 115, 32, 45, 32, 73, 110, 102, 105,
+            110, 105, 116, 121, 32, 71, 101, 110, 101, 86, 111, 111, 100, 111, 111, 32, 68, 105, 99, 101,
+            77, 111, 110, 107, 101, 121, 32, 73, 115, 108, 97, 110, 100, 32, 50, 82, 97, 100, 105, 97,
+            110, 116, 32, 83, 105, 108, 118, 101, 114, 103, 117, 110, 66, 101, 106, 101, 119, 101, 108, 101,
+            100, 32, 66, 108, 105, 116, 122, 32, 76, 73, 86, 69, 84, 78, 84, 32, 82, 97, 99, 101,
+            114, 115, 76, 97, 114, 97, 32, 67, 114, 111, 102, 116, 32, 97, 110, 100, 32, 116, 104, 101,
+            32, 71, 117, 97, 114, 100, 105, 97, 110, 32, 111, 102, 32, 76, 105, 103, 104, 116, 83, 117,
+            112, 101, 114, 32, 77, 101, 97, 116, 32, 66, 111, 121, 66, 108, 97, 99, 107, 108, 105, 103,
+            104, 116, 32, 45, 32, 84, 97, 110, 103, 111, 32, 68, 111, 119, 110, 65, 100, 118, 101, 110,
+            116, 117, 114, 101, 115, 32, 111, 102, 32, 83, 104, 117, 103, 103, 121, 84, 101, 99, 109, 111,
+            32, 66, 111, 119, 108, 32, 84, 104, 114, 111, 119, 98, 97, 99, 107, 83, 104, 97, 110, 107,
+            71, 111, 116, 104, 97, 109, 32, 67, 105, 116, 121, 32, 73, 109, 112, 111, 115, 116, 111, 114,
+            115, 68, 117, 115, 116, 32, 45, 32, 65, 110, 32, 69, 108, 121, 115, 105, 97, 110, 32, 84,
+            97, 105, 108, 66, 114, 101, 97, 99, 104, 68, 101, 97, 100, 108, 105, 101, 115, 116, 32, 87,
+            97, 114, 114, 105, 111, 114, 70, 117, 115, 105, 111, 110, 32, 45, 32, 71, 101, 110, 101, 115,
+            105, 115, 82, 101, 100, 32, 70, 97, 99, 116, 105, 111, 110, 32, 45, 32, 66, 97, 116, 116,
+            108, 101, 103, 114, 111, 117, 110, 100, 115, 68, 101, 97, 116, 104, 83, 112, 97, 110, 107, 72,
+            97, 114, 109, 115, 32, 87, 97, 121, 68, 111, 114, 105, 116, 111, 115, 32, 67, 114, 97, 115,
+            104, 32, 67, 111, 117, 114, 115, 101, 83, 101, 114, 105, 111, 117, 115, 32, 83, 97, 109, 32,
+            72, 68, 32, 45, 32, 84, 83, 69, 83, 116, 97, 99, 107, 105, 110, 103, 82, 111, 116, 97,
+            115, 116, 105, 99, 70, 97, 101, 114, 121, 32, 45, 32, 76, 101, 103, 101, 110, 100, 115, 32,
+            111, 102, 32, 65, 118, 97, 108, 111, 110, 71, 117, 119, 97, 110, 103, 101, 67, 111, 115, 116,
+            117, 109, 101, 32, 81, 117, 101, 115, 116, 67, 97, 115, 116, 108, 101, 118, 97, 110, 105, 97,
+            32, 72, 68, 68, 101, 97, 100, 32, 83, 112, 97, 99, 101, 32, 73, 103, 110, 105, 116, 105,
+            111, 110, 83, 112, 97, 114, 101, 32, 80, 97, 114, 116, 115, 84, 111, 114, 99, 104, 108, 105,
+            103, 104, 116, 70, 105, 114, 101, 32, 80, 114, 111, 32, 87, 114, 101, 115, 116, 108, 105, 110,
+            103, 83, 69, 71, 65, 32, 66, 97, 115, 115, 32, 70, 105, 115, 104, 105, 110, 103, 66, 108,
+            97, 100, 101, 32, 75, 105, 116, 116, 101, 110, 84, 104, 101, 32, 85, 110, 100, 101, 114, 71,
+            97, 114, 100, 101, 110, 72, 97, 117, 110, 116, 101, 100, 32, 72, 111, 117, 115, 101, 71, 104,
+            111, 115, 116, 98, 117, 115, 116, 101, 114, 115, 32, 45, 32, 83, 97, 110, 99, 116, 117, 109,
+            32, 111, 102, 32, 83, 108, 105, 109, 101, 68, 101, 97, 116, 104, 83, 112, 97, 110, 107, 32,
+            45, 32, 84, 104, 111, 110, 103, 115, 32, 111, 102, 32, 86, 105, 114, 116, 117, 101, 80, 65,
+            67, 45, 77, 65, 78, 32, 67, 104, 97, 109, 112, 105, 111, 110, 115, 104, 105, 112, 32, 69,
+            100, 105, 116, 105, 111, 110, 32, 68, 88, 43, 68, 101, 97, 100, 32, 82, 105, 115, 105, 110,
+            103, 32, 50, 32, 45, 32, 67, 97, 115, 101, 32, 90, 101, 114, 111, 70, 114, 111, 109, 32,
+            68, 117, 115, 116, 73, 114, 111, 110, 32, 66, 114, 105, 103, 97, 100, 101, 82, 111, 99, 107,
+            32, 111, 102, 32, 65, 103, 101, 115, 84, 114, 105, 110, 101, 32, 50, 77, 105, 99, 114, 111,
+            66, 111, 116, 84, 104, 101, 32, 70, 97, 110, 99, 121, 32, 80, 97, 110, 116, 115, 32, 65,
+            100, 118, 101, 110, 116, 117, 114, 101, 115, 89, 97, 114, 39, 115, 32, 82, 101, 118, 101, 110,
+            103, 101, 68, 117, 110, 103, 101, 111, 110, 115, 32, 38, 32, 68, 114, 97, 103, 111, 110, 115,
+            32, 45, 32, 68, 97, 103, 103, 101, 114, 100, 97, 108, 101, 65, 108, 105, 101, 110, 32, 66,
+            114, 101, 101, 100, 32, 51, 32, 45, 32, 68, 101, 115, 99, 101, 110, 116, 83, 116, 114, 97,
+            110, 105, 97, 90, 101, 105, 116, 32, 50, 84, 111, 121, 32, 83, 111, 108, 100, 105, 101, 114,
+            115, 32, 45, 32, 67, 111, 108, 100, 32, 87, 97, 114, 84, 114, 105, 97, 108, 115, 32, 69,
+            118, 111, 108, 117, 116, 105, 111, 110, 82, 101, 110, 101, 103, 97, 100, 101, 32, 79, 112, 115,
+            83, 101, 103, 97, 32, 82, 97, 108, 108, 121, 32, 79, 110, 108, 105, 110, 101, 32, 65, 114,
+            99, 97, 100, 101, 66, 108, 111, 111, 100, 82, 97, 121, 110, 101, 32, 45, 32, 66, 101, 116,
+            114, 97, 121, 97, 108, 72, 97, 112, 112, 121, 32, 87, 97, 114, 115, 66, 111, 117, 108, 100,
+            101, 114, 32, 68, 97, 115, 104, 45, 88, 108, 66, 97, 110, 103, 97, 105, 45, 79, 32, 72,
+            68, 88, 111, 116, 105, 99, 67, 114, 97, 122, 121, 32, 77, 97, 99, 104, 105, 110, 101, 115,
+            32, 69, 108, 101, 109, 101, 110, 116, 115, 71, 97, 108, 97, 103, 97, 32, 76, 101, 103, 105,
+            111, 110, 115, 32, 68, 88, 66, 101, 121, 111, 110, 100, 32, 71, 111, 111, 100, 32, 38, 32,
+            69, 118, 105, 108, 32, 72, 68, 87, 111, 114, 109, 115, 32, 45, 32, 85, 108, 116, 105, 109,
+            97, 116, 101, 32, 77, 97, 121, 104, 101, 109, 68, 101, 97, 100, 32, 82, 105, 115, 105, 110,
+            103, 32, 50, 32, 45, 32, 67, 97, 115, 101, 32, 87, 101, 115, 116, 83, 119, 97, 114, 109,
+            87, 114, 101, 99, 107, 101, 100, 32, 82, 101, 118, 101, 110, 103, 101, 32, 82, 101, 118, 105,
+            115, 105, 116, 101, 100, 77, 111, 116, 111, 99, 114, 111, 115, 115, 32, 77, 97, 100, 110, 101,
+            115, 115, 82, 101, 100, 32, 66, 117, 108, 108, 32, 88, 45, 70, 105, 103, 104, 116, 101, 114,
+            115, 88, 45, 77, 101, 110, 67, 114, 105, 109, 115, 111, 110, 32, 68, 114, 97, 103, 111, 110,
+            83, 116, 114, 101, 101, 116, 32, 70, 105, 103, 104, 116, 101, 114, 32, 73, 73, 73, 32, 45,
+            32, 79, 110, 108, 105, 110, 101, 32, 69, 100, 105, 116, 105, 111, 110, 77, 115, 46, 32, 83,
+            112, 108, 111, 115, 105, 111, 110, 32, 77, 97, 110, 73, 110, 115, 97, 110, 101, 108, 121, 32,
+            84, 119, 105, 115, 116, 101, 100, 32, 83, 104, 97, 100, 111, 119, 32, 80, 108, 97, 110, 101,
+            116, 68, 97, 121, 116, 111, 110, 97, 32, 85, 83, 65, 65, 108, 105, 101, 110, 32, 82, 97,
+            103, 101, 78, 73, 78, 50, 45, 74, 85, 77, 80, 87, 97, 114, 108, 111, 114, 100, 115, 71,
+            117, 97, 114, 100, 105, 97, 110, 32, 72, 101, 114, 111, 101, 115, 71, 97, 116, 108, 105, 110,
+            103, 32, 71, 101, 97, 114, 115, 72, 97, 117, 110, 116, 68, 101, 102, 101, 110, 100, 101, 114,
+            115, 32, 111, 102, 32, 65, 114, 100, 97, 110, 105, 97, 66, 97, 99, 107, 98, 114, 101, 97,
+            107, 101, 114, 32, 86, 101, 110, 103, 101, 97, 110, 99, 101, 73, 32, 65, 109, 32, 65, 108,
+            105, 118, 101, 68, 105, 97, 98, 111, 108, 105, 99, 97, 108, 32, 80, 105, 116, 99, 104, 72,
+            97, 108, 102, 32, 77, 105, 110, 117, 116, 101, 32, 72, 101, 114, 111, 32, 45, 32, 83, 117,
+            112, 101, 114, 32, 77, 101, 103, 97, 32, 78, 101, 111, 32, 67, 108, 105, 109, 97, 120, 83,
+            116, 97, 114, 32, 82, 97, 105, 100, 101, 114, 115, 77, 97, 103, 105, 99, 32, 50, 48, 49,
+            50, 90, 111, 109, 98, 105, 101, 32, 68, 114, 105, 118, 101, 114, 32, 72, 68, 66, 97, 116,
+            116, 108, 101, 32, 45, 32, 76, 111, 115, 32, 65, 110, 103, 101, 108, 101, 115, 83, 101, 99,
+            116, 105, 111, 110, 32, 56, 32, 45, 32, 80, 114, 101, 106, 117, 100, 105, 99, 101, 65, 112,
+            112, 108, 101, 115, 32, 116, 111, 32, 65, 112, 112, 108, 101, 115, 68, 101, 97, 100, 32, 66,
+            108, 111, 99, 107, 83, 107, 121, 68, 114, 105, 102, 116, 66, 97, 110, 103, 32, 66, 97, 110,
+            103, 32, 82, 97, 99, 105, 110, 103, 87, 97, 114, 104, 97, 109, 109, 101, 114, 32, 52, 48,
+            32, 125, 44, 48, 48, 48, 32, 45, 32, 75, 105, 108, 108, 32, 84, 101, 97, 109, 65, 119,
+            101, 115, 111, 109, 101, 110, 97, 117, 116, 115, 68, 101, 97, 100, 108, 105, 101, 115, 116, 32,
+            87, 97, 114, 114, 105, 111, 114, 32, 45, 32, 76, 101, 103, 101, 110, 100, 115, 66, 117, 114,
+            110, 111, 117, 116, 32, 67, 114, 97, 115, 104, 33, 77, 111, 114, 116, 97, 108, 32, 75, 111,
+            109, 98, 97, 116, 32, 65, 114, 99, 97, 100, 101, 85, 103, 108, 121, 32, 65, 109, 101, 114,
+            105, 99, 97, 110, 115, 32, 45, 32, 65, 112, 111, 99, 97, 108, 121, 112, 115, 101, 103, 101,
+            100, 100, 111, 110, 84, 104, 101, 32, 87, 97, 114, 32, 111, 102, 32, 116, 104, 101, 32, 87,
+            111, 114, 108, 100, 115, 66, 97, 115, 116, 105, 111, 110, 75, 117, 110, 103, 32, 70, 117, 32,
+            83, 116, 114, 105, 107, 101, 68, 117, 110, 103, 101, 111, 110, 32, 68, 101, 102, 101, 110, 100,
+            101, 114, 115, 83, 101, 103, 97, 32, 86, 105, 110, 116, 97, 103, 101, 32, 67, 111, 108, 108,
+            101, 99, 116, 105, 111, 110, 32, 45, 32, 71, 111, 108, 100, 101, 110, 32, 65, 120, 101, 83,
+            101, 103, 97, 32, 86, 105, 110, 116, 97, 103, 101, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            111, 110, 32, 45, 32, 65, 108, 101, 120, 32, 75, 105, 100, 100, 32, 38, 32, 67, 111, 46,
+            83, 101, 103, 97, 32, 86, 105, 110, 116, 97, 103, 101, 32, 67, 111, 108, 108, 101, 99, 116,
+            105, 111, 110, 32, 45, 32, 83, 116, 114, 101, 101, 116, 115, 32, 111, 102, 32, 82, 97, 103,
+            101, 83, 101, 103, 97, 32, 86, 105, 110, 116, 97, 103, 101, 32, 67, 111, 108, 108, 101, 99,
+            116, 105, 111, 110, 32, 45, 32, 77, 111, 110, 115, 116, 101, 114, 32, 87, 111, 114, 108, 100,
+            90, 111, 109, 98, 105, 101, 32, 65, 112, 111, 99, 97, 108, 121, 112, 115, 101, 32, 45, 32,
+            78, 101, 118, 101, 114, 32, 68, 105, 101, 32, 65, 108, 111, 110, 101, 70, 114, 117, 105, 116,
+            32, 78, 105, 110, 106, 97, 32, 75, 105, 110, 101, 99, 116, 66, 108, 111, 111, 100, 102, 111,
+            114, 103, 101, 77, 108, 98, 32, 66, 111, 98, 98, 108, 101, 104, 101, 97, 100, 32, 80, 114,
+            111, 115, 77, 108, 98, 32, 66, 111, 98, 98, 108, 101, 104, 101, 97, 100, 32, 66, 97, 116,
+            116, 108, 101, 68, 117, 110, 103, 101, 111, 110, 32, 70, 105, 103, 104, 116, 101, 114, 32, 76,
+            73, 86, 69, 32, 45, 32, 70, 97, 108, 108, 32, 79, 102, 32, 72, 101, 110, 100, 111, 110,
+            32, 77, 121, 114, 101, 83, 111, 117, 116, 104, 32, 80, 97, 114, 107, 32, 45, 32, 84, 101,
+            110, 111, 114, 109, 97, 110, 39, 115, 32, 82, 101, 118, 101, 110, 103, 101, 78, 101, 120, 117,
+            105, 122, 67, 104, 97, 114, 108, 105, 101, 32, 77, 117, 114, 100, 101, 114, 70, 97, 98, 108,
+            101, 32, 72, 101, 114, 111, 101, 115, 83, 99, 101, 110, 101, 32, 73, 116, 63, 32, 77, 111,
+            118, 105, 101, 32, 78, 105, 103, 104, 116, 68, 114, 97, 103, 111, 110, 39, 115, 32, 76, 97,
+            105, 114, 77, 101, 114, 99, 117, 114, 121, 32, 72, 103, 87, 114, 101, 99, 107, 97, 116, 101,
+            101, 114, 68, 101, 97, 100, 108, 105, 103, 104, 116, 86, 111, 108, 116, 114, 111, 110, 66, 117,
+            114, 103, 101, 114, 116, 105, 109, 101, 32, 87, 111, 114, 108, 100, 32, 84, 111, 117, 114, 72,
+            69, 76, 76, 32, 89, 69, 65, 72, 33, 32, 87, 114, 97, 116, 104, 32, 111, 102, 32, 116,
+            104, 101, 32, 68, 101, 97, 100, 32, 82, 97, 98, 98, 105, 116, 66, 97, 98, 101, 108, 32,
+            82, 105, 115, 105, 110, 103, 76, 101, 101, 100, 109, 101, 101, 115, 66, 101, 106, 101, 119, 101,
+            108, 101, 100, 32, 51, 83, 107, 117, 108, 108, 115, 32, 111, 102, 32, 116, 104, 101, 32, 83,
+            104, 111, 103, 117, 110, 80, 117, 100, 100, 108, 101, 74, 101, 114, 101, 109, 121, 32, 77, 99,
+            71, 114, 97, 116, 104, 39, 115, 32, 79, 102, 102, 114, 111, 97, 100, 83, 107, 117, 108, 108,
+            103, 105, 114, 108, 115, 87, 97, 114, 112, 71, 117, 105, 108, 116, 121, 32, 71, 101, 97, 114,
+            32, 88, 88, 32, 65, 99, 99, 101, 110, 116, 32, 67, 111, 114, 101, 32, 80, 108, 117, 115,
+            84, 104, 101, 32, 87, 97, 108, 107, 105, 110, 103, 32, 68, 101, 97, 100, 82, 101, 97, 108,
+            32, 83, 116, 101, 101, 108, 84, 104, 101, 32, 83, 112, 108, 97, 116, 116, 101, 114, 115, 68,
+            101, 101, 112, 32, 66, 108, 97, 99, 107, 32, 45, 32, 69, 112, 105, 115, 111, 100, 101, 32,
+            49, 68, 101, 97, 116, 104, 83, 112, 97, 110, 107, 32, 45, 32, 84, 104, 101, 32, 66, 97,
+            99, 111, 110, 105, 110, 103, 83, 116, 97, 116, 101, 32, 111, 102, 32, 68, 101, 99, 97, 121,
+            90, 117, 109, 97, 39, 115, 32, 82, 101, 118, 101, 110, 103, 101, 33, 81, 117, 97, 114, 114,
+            101, 108, 79, 114, 99, 115, 32, 77, 117, 115, 116, 32, 68, 105, 101, 33, 78, 66, 65, 32,
+            74, 65, 77, 32, 45, 32, 79, 110, 32, 70, 105, 114, 101, 32, 69, 100, 105, 116, 105, 111,
+            110, 82, 65, 87, 83, 111, 110, 105, 99, 32, 67, 68, 83, 79, 78, 73, 67, 32, 52, 32,
+            69, 112, 105, 115, 111, 100, 101, 32, 73, 73, 68, 111, 117, 98, 108, 101, 32, 70, 105, 110,
+            101, 32, 72, 97, 112, 112, 121, 32, 65, 99, 116, 105, 111, 110, 32, 84, 104, 101, 97, 116,
+            101, 114, 74, 111, 101, 32, 68, 97, 110, 103, 101, 114, 32, 83, 112, 101, 99, 105, 97, 108,
+            32, 69, 100, 105, 116, 105, 111, 110, 74, 111, 101, 32, 68, 97, 110, 103, 101, 114, 32, 50,
+            32, 45, 32, 84, 104, 101, 32, 77, 111, 118, 105, 101, 77, 105, 110, 101, 99, 114, 97, 102,
+            116, 32, 45, 32, 88, 98, 111, 120, 32, 51, 54, 48, 32, 69, 100, 105, 116, 105, 111, 110,
+            70, 114, 111, 103, 103, 101, 114, 32, 45, 32, 72, 121, 112, 101, 114, 32, 65, 114, 99, 97,
+            100, 101, 32, 69, 100, 105, 116, 105, 111, 110, 83, 104, 111, 111, 116, 32, 77, 97, 110, 121,
+            32, 82, 111, 98, 111, 116, 115, 86, 105, 114, 116, 117, 97, 32, 70, 105, 103, 104, 116, 101,
+            114, 32, 53, 32, 70, 105, 110, 97, 108, 32, 83, 104, 111, 119, 100, 111, 119, 110, 81, 117,
+            97, 110, 116, 117, 109, 32, 67, 111, 110, 117, 110, 100, 114, 117, 109, 83, 111, 110, 105, 99,
+            32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 50, 66, 101, 108, 108, 97, 116, 111, 114,
+            32, 45, 32, 77, 77, 65, 32, 79, 110, 115, 108, 97, 117, 103, 104, 116, 83, 104, 97, 110,
+            107, 50, 83, 99, 111, 117, 114, 103, 101, 32, 45, 32, 79, 117, 116, 98, 114, 101, 97, 107,
+            77, 97, 103, 105, 99, 32, 50, 48, 49, 51, 84, 104, 101, 32, 87, 111, 108, 102, 32, 65,
+            109, 111, 110, 103, 32, 85, 115, 65, 110, 111, 109, 97, 108, 121, 32, 87, 97, 114, 122, 111,
+            110, 101, 32, 69, 97, 114, 116, 104, 80, 105, 110, 98, 97, 108, 108, 32, 65, 114, 99, 97,
+            100, 101, 65, 77, 89, 82, 117, 110, 110, 101, 114, 50, 65, 108, 105, 101, 110, 32, 83, 112,
+            105, 100, 121, 83, 99, 97, 114, 121, 103, 105, 114, 108, 77, 97, 114, 107, 32, 111, 102, 32,
+            116, 104, 101, 32, 78, 105, 110, 106, 97, 82, 111, 99, 107, 32, 66, 97, 110, 100, 32, 66,
+            108, 105, 116, 122, 68, 97, 114, 107, 115, 116, 97, 108, 107, 101, 114, 115, 32, 82, 101, 115,
+            117, 114, 114, 101, 99, 116, 105, 111, 110, 65, 109, 101, 114, 105, 99, 97, 110, 32, 77, 101,
+            110, 115, 97, 32, 65, 99, 97, 100, 101, 109, 121, 67, 104, 111, 112, 108, 105, 102, 116, 101,
+            114, 32, 72, 68, 65, 108, 97, 110, 32, 87, 97, 107, 101, 39, 115, 32, 65, 109, 101, 114,
+            105, 99, 97, 110, 32, 78, 105, 103, 104, 116, 109, 97, 114, 101, 83, 73, 78, 69, 32, 77,
+            79, 82, 65, 78, 70, 76, 32, 66, 108, 105, 116, 122, 83, 97, 99, 114, 101, 100, 32, 67,
+            105, 116, 97, 100, 101, 108, 84, 104, 101, 32, 67, 97, 118, 101, 71, 105, 114, 108, 32, 70,
+            105, 103, 104, 116, 66, 108, 97, 99, 107, 32, 75, 110, 105, 103, 104, 116, 32, 83, 119, 111,
+            114, 100, 109, 105, 110, 105, 32, 110, 105, 110, 106, 97, 115, 32, 45, 32, 65, 100, 118, 101,
+            110, 116, 117, 114, 101, 115, 70, 97, 114, 32, 67, 114, 121, 32, 67, 108, 97, 115, 115, 105,
+            99, 82, 97, 121, 109, 97, 110, 32, 51, 32, 72, 68, 77, 97, 100, 32, 82, 105, 100, 101,
+            114, 115, 74, 97, 109, 32, 76, 105, 118, 101, 32, 77, 117, 115, 105, 99, 32, 65, 114, 99,
+            97, 100, 101, 74, 101, 116, 32, 83, 101, 116, 32, 82, 97, 100, 105, 111, 83, 101, 114, 105,
+            111, 117, 115, 32, 83, 97, 109, 32, 68, 111, 117, 98, 108, 101, 32, 68, 32, 88, 88, 76,
+            84, 111, 110, 121, 32, 72, 97, 119, 107, 39, 115, 32, 80, 114, 111, 32, 83, 107, 97, 116,
+            101, 114, 32, 72, 68, 84, 104, 101, 32, 69, 120, 112, 101, 110, 100, 97, 98, 108, 101, 115,
+            32, 50, 32, 86, 105, 100, 101, 111, 103, 97, 109, 101, 83, 101, 103, 97, 32, 86, 105, 110,
+            116, 97, 103, 101, 32, 67, 111, 108, 108, 101, 99, 116, 105, 111, 110, 32, 45, 32, 84, 111,
+            101, 74, 97, 109, 32, 38, 32, 69, 97, 114, 108, 80, 108, 97, 110, 101, 116, 115, 32, 85,
+            110, 100, 101, 114, 32, 65, 116, 116, 97, 99, 107, 68, 111, 117, 98, 108, 101, 32, 68, 114,
+            97, 103, 111, 110, 32, 78, 101, 111, 110, 82, 101, 100, 32, 66, 117, 108, 108, 32, 67, 114,
+            97, 115, 104, 101, 100, 32, 73, 99, 101, 32, 75, 105, 110, 101, 99, 116, 83, 112, 97, 114,
+            116, 97, 99, 117, 115, 32, 76, 101, 103, 101, 110, 100, 115, 67, 65, 80, 67, 79, 77, 32,
+            65, 82, 67, 65, 68, 69, 32, 67, 65, 66, 73, 78, 69, 84, 67, 111, 117, 110, 116, 101,
+            114, 45, 83, 116, 114, 105, 107, 101, 32, 45, 32, 71, 79, 75, 105, 110, 101, 99, 116, 32,
+            80, 97, 114, 116, 121, 32, 45, 32, 66, 97, 115, 101, 32, 71, 97, 109, 101, 80, 104, 97,
+            110, 116, 111, 109, 32, 66, 114, 101, 97, 107, 101, 114, 32, 45, 66, 97, 116, 116, 108, 101,
+            32, 71, 114, 111, 117, 110, 100, 115, 74, 111, 121, 32, 82, 105, 100, 101, 32, 84, 117, 114,
+            98, 111, 82, 101, 100, 32, 74, 111, 104, 110, 115, 111, 110, 39, 115, 32, 67, 104, 114, 111,
+            110, 105, 99, 108, 101, 115, 68, 111, 103, 102, 105, 103, 104, 116, 32, 49, 57, 52, 50, 72,
+            111, 109, 101, 32, 82, 117, 110, 32, 83, 116, 97, 114, 115, 78, 105, 71, 72, 84, 83, 32,
+            105, 110, 116, 111, 32, 100, 114, 101, 97, 109, 115, 46, 46, 46, 90, 101, 110, 111, 32, 67,
+            108, 97, 115, 104, 32, 50, 76, 101, 116, 39, 115, 32, 83, 105, 110, 103, 32, 65, 110, 100,
+            32, 68, 97, 110, 99, 101, 68, 101, 102, 101, 110, 115, 101, 32, 84, 101, 99, 104, 110, 105,
+            99, 97, 80, 111, 111, 108, 32, 78, 97, 116, 105, 111, 110, 78, 97, 117, 103, 104, 116, 121,
+            32, 66, 101, 97, 114, 32, 80, 97, 110, 105, 99, 32, 105, 110, 32, 80, 97, 114, 97, 100,
+            105, 115, 101, 83, 101, 114, 105, 111, 117, 115, 32, 83, 97, 109, 32, 51, 32, 45, 32, 66,
+            70, 69, 71, 117, 97, 114, 100, 105, 97, 110, 115, 32, 111, 102, 32, 77, 105, 100, 100, 108,
+            101, 45, 101, 97, 114, 116, 104, 68, 111, 108, 108, 97, 114, 32, 68, 97, 115, 104, 82, 101,
+            116, 114, 111, 32, 67, 105, 116, 121, 32, 82, 97, 109, 112, 97, 103, 101, 32, 45, 32, 68,
+            88, 80, 105, 100, 76, 111, 99, 111, 67, 121, 99, 108, 101, 75, 97, 114, 97, 116, 101, 107,
+            97, 68, 111, 117, 98, 108, 101, 32, 68, 114, 97, 103, 111, 110, 32, 73, 73, 87, 111, 114,
+            109, 115, 32, 82, 101, 118, 111, 108, 117, 116, 105, 111, 110, 87, 97, 121, 32, 111, 102, 32,
+            116, 104, 101, 32, 68, 111, 103, 103, 78, 97, 114, 99, 111, 32, 84, 101, 114, 114, 111, 114,
+            77, 111, 110, 97, 99, 111, 32, 45, 32, 87, 104, 97, 116, 39, 115, 32, 89, 111, 117, 114,
+            115, 32, 105, 115, 32, 77, 105, 110, 101, 67, 97, 115, 116, 108, 101, 83, 116, 111, 114, 109,
+            86, 105, 114, 116, 117, 97, 32, 70, 105, 103, 104, 116, 101, 114, 32, 50, 70, 105, 103, 104,
+            116, 105, 110, 103, 32, 86, 105, 112, 101, 114, 115, 83, 111, 110, 105, 99, 32, 116, 104, 101,
+            32, 70, 105, 103, 104, 116, 101, 114, 115, 83, 107, 105, 32, 82, 97, 99, 101, 66, 114, 111,
+            116, 104, 101, 114, 115, 68, 97, 114, 116, 115, 32, 86, 115, 32, 90, 111, 109, 98, 105, 101,
+            115, 83, 112, 101, 99, 105, 97, 108, 32, 70, 111, 114, 99, 101, 115, 32, 84, 101, 97, 109,
+            32, 88, 80, 114, 105, 122, 101, 32, 68, 114, 105, 118, 101, 114, 49, 48, 32, 70, 114, 97,
+            109, 101, 32, 66, 111, 119, 108, 105, 110, 103, 67, 97, 108, 108, 32, 111, 102, 32, 74, 117,
+            97, 114, 101, 122, 32, 45, 32, 71, 117, 110, 115, 108, 105, 110, 103, 101, 114, 70, 105, 101,
+            108, 100, 32, 71, 111, 97, 108, 32, 67, 111, 110, 116, 101, 115, 116, 80, 101, 110, 97, 108,
+            116, 121, 32, 83, 97, 118, 101, 114, 80, 105, 110, 103, 32, 80, 111, 110, 103, 66, 111, 120,
+            105, 110, 103, 32, 70, 105, 103, 104, 116, 82, 101, 97, 99, 116, 105, 111, 110, 32, 82, 97,
+            108, 108, 121, 51, 32, 80, 111, 105, 110, 116, 32, 67, 111, 110, 116, 101, 115, 116, 80, 97,
+            99, 105, 102, 105, 99, 32, 82, 105, 109, 66, 108, 111, 111, 100, 32, 75, 110, 105, 103, 104,
+            116, 115, 77, 97, 103, 105, 99, 32, 50, 48, 49, 52, 32, 45, 32, 68, 117, 101, 108, 115,
+            32, 111, 102, 32, 116, 104, 101, 32, 80, 108, 97, 110, 101, 115, 119, 97, 108, 107, 101, 114,
+            115, 67, 97, 115, 116, 108, 101, 32, 111, 102, 32, 73, 108, 108, 117, 115, 105, 111, 110, 32,
+            83, 116, 97, 114, 114, 105, 110, 103, 32, 77, 105, 99, 107, 101, 121, 32, 77, 111, 117, 115,
+            101, 83, 107, 121, 100, 105, 118, 101, 83, 117, 112, 101, 114, 32, 84, 105, 109, 101, 32, 70,
+            111, 114, 99, 101, 83, 97, 110, 99, 116, 117, 109, 32, 50, 77, 97, 103, 114, 117, 110, 110,
+            101, 114, 32, 45, 32, 68, 97, 114, 107, 32, 80, 117, 108, 115, 101, 68, 117, 115, 116, 102,
+            111, 114, 99, 101, 70, 97, 114, 32, 67, 114, 121, 32, 51, 32, 66, 108, 111, 111, 100, 32,
+            68, 114, 97, 103, 111, 110, 77, 97, 114, 115, 32, 45, 32, 87, 97, 114, 32, 76, 111, 103,
+            115, 84, 77, 78, 84, 32, 45, 32, 79, 117, 116, 32, 111, 102, 32, 116, 104, 101, 32, 83,
+            104, 97, 100, 111, 119, 115, 68, 117, 110, 103, 101, 111, 110, 115, 32, 38, 32, 68, 114, 97,
+            103, 111, 110, 115, 32, 45, 32, 67, 104, 114, 111, 110, 105, 99, 108, 101, 115, 32, 111, 102,
+            32, 77, 121, 115, 116, 97, 114, 97, 79, 114, 99, 32, 65, 116, 116, 97, 99, 107, 68, 117,
+            99, 107, 84, 97, 108, 101, 115, 32, 45, 32, 82, 101, 109, 97, 115, 116, 101, 114, 101, 100,
+            83, 116, 114, 105, 100, 101, 114, 67, 108, 111, 117, 100, 98, 101, 114, 114, 121, 32, 75, 105,
+            110, 103, 100, 111, 109, 72, 117, 110, 116, 101, 114, 39, 115, 32, 84, 114, 111, 112, 104, 121,
+            32, 50, 32, 45, 32, 65, 109, 101, 114, 105, 99, 97, 72, 117, 110, 116, 101, 114, 39, 115,
+            32, 84, 114, 111, 112, 104, 121, 32, 50, 32, 45, 32, 65, 117, 115, 116, 114, 97, 108, 105,
+            97, 71, 111, 100, 32, 77, 111, 100, 101, 71, 105, 97, 110, 97, 32, 83, 105, 115, 116, 101,
+            114, 115, 32, 45, 32, 84, 119, 105, 115, 116, 101, 100, 32, 68, 114, 101, 97, 109, 115, 77,
+            97, 114, 118, 101, 108, 32, 80, 117, 122, 122, 108, 101, 32, 81, 117, 101, 115, 116, 65, 110,
+            110, 97, 32, 45, 32, 69, 120, 116, 101, 110, 100, 101, 100, 32, 69, 100, 105, 116, 105, 111,
+            110, 80, 111, 107, 101, 114, 32, 78, 105, 103, 104, 116, 32, 50, 87, 104, 111, 32, 87, 97,
+            110, 116, 115, 32, 84, 111, 32, 66, 101, 32, 65, 32, 77, 105, 108, 108, 105, 111, 110, 97,
+            105, 114, 101, 63, 84, 97, 107, 101, 100, 111, 119, 110, 32, 45, 32, 82, 101, 100, 32, 83,
+            97, 98, 114, 101, 72, 111, 119, 32, 116, 111, 32, 83, 117, 114, 118, 105, 118, 101, 65, 46,
+            82, 46, 69, 46, 83, 46, 82, 46, 73, 46, 80, 46, 68, 46, 32, 45, 32, 84, 104, 101,
+            32, 71, 97, 109, 101, 67, 97, 112, 115, 105, 122, 101, 100, 83, 116, 111, 114, 109, 70, 105,
+            110, 97, 108, 32, 69, 120, 97, 109, 84, 104, 117, 110, 100, 101, 114, 32, 87, 111, 108, 118,
+            101, 115, 68, 111, 111, 100, 108, 101, 32, 74, 117, 109, 112, 32, 102, 111, 114, 32, 75, 105,
+            110, 101, 99, 116, 70, 105, 114, 101, 98, 117, 114, 115, 116, 65, 115, 115, 97, 115, 115, 105,
+            110, 39, 115, 32, 67, 114, 101, 101, 100, 32, 76, 105, 98, 101, 114, 97, 116, 105, 111, 110,
+            32, 72, 68, 70, 108, 97, 115, 104, 98, 97, 99, 107, 84, 114, 105, 97, 108, 115, 32, 70,
+            117, 115, 105, 111, 110, 72, 101, 120, 111, 100, 105, 117, 115, 77, 97, 114, 108, 111, 119, 32,
+            66, 114, 105, 103, 103, 115, 83, 121, 98, 101, 114, 105, 97, 83, 121, 98, 101, 114, 105, 97,
+            32, 50, 70, 114, 101, 101, 102, 97, 108, 108, 32, 82, 97, 99, 101, 114, 115, 67, 97, 115,
+            116, 108, 101, 118, 97, 110, 105, 97, 32, 45, 32, 76, 111, 114, 100, 32, 111, 102, 32, 83,
+            104, 97, 100, 111, 119, 32, 45, 32, 77, 105, 114, 114, 111, 114, 32, 111, 102, 32, 70, 97,
+            116, 101, 32, 72, 68, 70, 111, 117, 108, 32, 80, 108, 97, 121, 84, 104, 101, 32, 82, 97,
+            118, 101, 110, 32, 69, 112, 105, 115, 111, 100, 101, 32, 49, 67, 104, 105, 108, 100, 32, 111,
+            102, 32, 76, 105, 103, 104, 116, 80, 65, 67, 45, 77, 65, 78, 32, 77, 117, 115, 101, 117,
+            109, 83, 111, 117, 108, 99, 97, 108, 105, 98, 117, 114, 32, 73, 73, 32, 72, 68, 72, 97,
+            108, 111, 32, 45, 32, 83, 112, 97, 114, 116, 97, 110, 32, 65, 115, 115, 97, 117, 108, 116,
+            84, 104, 101, 32, 87, 97, 108, 107, 105, 110, 103, 32, 68, 101, 97, 100, 32, 45, 32, 83,
+            101, 97, 115, 111, 110, 32, 84, 119, 111, 84, 104, 101, 32, 66, 114, 105, 100, 103, 101, 67,
+            111, 110, 116, 114, 97, 115, 116, 77, 97, 103, 105, 99, 32, 50, 48, 49, 53, 82, 101, 107,
+            111, 105, 108, 32, 45, 32, 76, 105, 98, 101, 114, 97, 116, 111, 114, 67, 111, 110, 115, 116,
+            97, 110, 116, 32, 67, 65, 105, 114, 77, 101, 99, 104, 32, 65, 114, 101, 110, 97, 65, 98,
+            121, 115, 115, 32, 79, 100, 121, 115, 115, 101, 121, 86, 97, 108, 105, 97, 110, 116, 32, 72,
+            101, 97, 114, 116, 115, 66, 108, 111, 111, 100, 32, 111, 102, 32, 116, 104, 101, 32, 87, 101,
+            114, 101, 119, 111, 108, 102, 83, 108, 101, 110, 100, 101, 114, 32, 45, 32, 84, 104, 101, 32,
+            65, 114, 114, 105, 118, 97, 108, 66, 97, 116, 116, 108, 101, 32, 65, 99, 97, 100, 101, 109,
+            121, 80, 117, 116, 116, 121, 32, 83, 113, 117, 97, 100, 80, 101, 103, 103, 108, 101, 32, 50,
+            84, 97, 108, 101, 115, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 66, 111, 114, 100, 101,
+            114, 108, 97, 110, 100, 115, 77, 117, 116, 97, 110, 116, 32, 66, 108, 111, 98, 115, 32, 65,
+            116, 116, 97, 99, 107, 71, 117, 110, 99, 114, 97, 102, 116, 32, 45, 32, 66, 108, 111, 99,
+            107, 101, 100, 32, 97, 110, 100, 32, 76, 111, 97, 100, 101, 100, 66, 108, 97, 99, 107, 103,
+            97, 116, 101, 32, 68, 101, 108, 117, 120, 101, 32, 69, 100, 46, 89, 117, 45, 71, 105, 45,
+            79, 104, 33, 32, 77, 105, 108, 108, 101, 110, 110, 105, 117, 109, 32, 68, 117, 101, 108, 115,
+            70, 111, 114, 103, 111, 116, 116, 101, 110, 32, 87, 97, 114, 115, 71, 117, 97, 99, 97, 109,
+            101, 108, 101, 101, 33, 32, 83, 84, 67, 69, 84, 104, 101, 32, 76, 101, 103, 101, 110, 100,
+            32, 111, 102, 32, 75, 111, 114, 114, 97, 67, 111, 98, 97, 108, 116, 82, 101, 115, 105, 100,
+            101, 110, 116, 32, 69, 118, 105, 108, 32, 82, 101, 118, 101, 108, 97, 116, 105, 111, 110, 115,
+            32, 50, 82, 46, 66, 46, 73, 46, 32, 66, 97, 115, 101, 98, 97, 108, 108, 32, 49, 52,
+            74, 101, 116, 32, 67, 97, 114, 32, 83, 116, 117, 110, 116, 115, 67, 104, 105, 118, 97, 108,
+            114, 121, 67, 111, 115, 116, 117, 109, 101, 32, 81, 117, 101, 115, 116, 32, 50, 71, 101, 111,
+            109, 101, 116, 114, 121, 32, 87, 97, 114, 115, 32, 51, 32, 45, 32, 68, 105, 109, 101, 110,
+            115, 105, 111, 110, 115, 32, 69, 118, 111, 108, 118, 101, 100, 77, 79, 78, 79, 80, 79, 76,
+            89, 32, 80, 76, 85, 83, 77, 79, 78, 79, 80, 79, 76, 89, 32, 68, 69, 65, 76, 84,
+            114, 105, 118, 105, 97, 108, 32, 80, 117, 114, 115, 117, 105, 116, 32, 76, 105, 118, 101, 33,
+            77, 97, 120, 32, 45, 32, 84, 104, 101, 32, 67, 117, 114, 115, 101, 32, 111, 102, 32, 66,
+            114, 111, 116, 104, 101, 114, 104, 111, 111, 100, 82, 105, 115, 107, 84, 111, 121, 98, 111, 120,
+            32, 84, 117, 114, 98, 111, 115, 76, 105, 102, 101, 32, 73, 115, 32, 83, 116, 114, 97, 110,
+            103, 101, 32, 69, 112, 105, 115, 111, 100, 101, 32, 49, 71, 97, 109, 101, 32, 111, 102, 32,
+            84, 104, 114, 111, 110, 101, 115, 74, 85, 74, 85, 77, 111, 110, 115, 116, 101, 114, 32, 74,
+            97, 109, 32, 66, 97, 116, 116, 108, 101, 103, 114, 111, 117, 110, 100, 115, 68, 101, 97, 100,
+            108, 105, 101, 115, 116, 32, 87, 97, 114, 114, 105, 111, 114, 32, 45, 32, 66, 97, 116, 116,
+            108, 101, 103, 114, 111, 117, 110, 100, 115, 71, 111, 97, 116, 32, 83, 105, 109, 117, 108, 97,
+            116, 111, 114, 70, 114, 111, 122, 101, 110, 32, 70, 114, 101, 101, 32, 70, 97, 108, 108, 32,
+            45, 32, 83, 110, 111, 119, 98, 97, 108, 108, 32, 70, 105, 103, 104, 116, 77, 105, 110, 101,
+            99, 114, 97, 102, 116, 32, 45, 32, 83, 116, 111, 114, 121, 32, 77, 111, 100, 101, 71, 111,
+            111, 115, 101, 98, 117, 109, 112, 115, 32, 45, 32, 84, 104, 101, 32, 71, 97, 109, 101, 77,
+            105, 103, 104, 116, 121, 32, 78, 111, 46, 32, 57, 77, 109, 111, 114, 101, 32, 71, 111, 97,
+            116, 122, 32, 69, 100, 105, 116, 105, 111, 110, 84, 104, 101, 32, 87, 97, 108, 107, 105, 110,
+            103, 32, 68, 101, 97, 100, 32, 45, 32, 77, 105, 99, 104, 111, 110, 110, 101, 32, 45, 32,
+            69, 112, 105, 115, 111, 100, 101, 32, 49, 80, 104, 111, 116, 111, 32, 80, 97, 114, 116, 121,
+            70, 97, 99, 101, 98, 111, 111, 107, 76, 97, 115, 116, 46, 70, 109, 86, 105, 100, 101, 111,
+            32, 75, 105, 110, 101, 99, 116, 88, 98, 111, 120, 32, 76, 105, 118, 101, 32, 76, 97, 98,
+            115, 75, 105, 110, 101, 99, 116, 32, 70, 117, 110, 32, 76, 97, 98, 115, 66, 117, 105, 108,
+            100, 32, 65, 32, 66, 117, 100, 100, 121, 66, 111, 98, 98, 108, 101, 32, 72, 101, 97, 100,
+            75, 105, 110, 101, 99, 116, 32, 77, 101, 75, 105, 110, 101, 99, 116, 32, 83, 112, 97, 114,
+            107, 108, 101, 114, 75, 105, 110, 101, 99, 116, 32, 71, 111, 111, 103, 108, 121, 32, 69, 121,
+            101, 115, 66, 97, 116, 116, 108, 101, 32, 83, 116, 117, 102, 102, 65, 118, 97, 116, 97, 114,
+            32, 75, 105, 110, 101, 99, 116, 65, 105, 114, 32, 66, 97, 110, 100, 77, 117, 116, 97, 116,
+            105, 111, 110, 32, 83, 116, 97, 116, 105, 111, 110, 77, 117, 115, 105, 99, 97, 108, 32, 70,
+            101, 101, 116, 74, 117, 110, 107, 32, 70, 117, 73, 32, 65, 109, 32, 83, 117, 112, 101, 114,
+            33, 75, 105, 110, 101, 99, 116, 32, 82, 117, 115, 104, 32, 45, 32, 83, 110, 97, 112, 115,
+            104, 111, 116, 77, 97, 114, 115, 32, 82, 111, 118, 101, 114, 32, 76, 97, 110, 100, 105, 110,
+            103, 77, 101, 116, 97, 108, 32, 68, 117, 110, 103, 101, 111, 110, 66, 108, 97, 99, 107, 32,
+            83, 116, 111, 110, 101, 58, 32, 77, 97, 103, 105, 99, 32, 38, 32, 83, 116, 101, 101, 108,
+            76, 111, 116, 117, 115, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 74, 117, 100, 103, 101,
+            32, 68, 114, 101, 100, 100, 58, 32, 68, 114, 101, 100, 100, 32, 118, 115, 46, 32, 68, 101,
+            97, 116, 104, 84, 104, 101, 32, 85, 108, 116, 105, 109, 97, 116, 101, 32, 83, 101, 108, 101,
+            99, 116, 105, 111, 110, 88, 98, 111, 120, 32, 66, 101, 116, 97, 88, 98, 111, 120, 32, 51,
+            54, 48, 32, 84, 101, 97, 109, 88, 98, 111, 120, 32, 76, 105, 118, 101, 32, 83, 116, 97,
+            114, 116, 101, 114, 32, 75, 105, 116, 32, 68, 105, 115, 99, 32, 47, 32, 90, 117, 110, 111,
+            117, 32, 84, 97, 105, 115, 101, 110, 32, 76, 105, 118, 101, 83, 116, 97, 114, 32, 87, 97,
+            114, 115, 58, 32, 84, 104, 101, 32, 67, 108, 111, 110, 101, 32, 87, 97, 114, 115, 32, 43,
+            32, 84, 101, 116, 114, 105, 115, 32, 87, 111, 114, 108, 100, 115, 78, 67, 65, 65, 32, 70,
+            111, 111, 116, 98, 97, 108, 108, 32, 50, 48, 48, 53, 32, 43, 32, 84, 111, 112, 32, 83,
+            112, 105, 110, 69, 51, 32, 50, 48, 48, 55, 70, 111, 114, 122, 97, 32, 77, 111, 116, 111,
+            114, 115, 112, 111, 114, 116, 32, 43, 32, 88, 98, 111, 120, 32, 76, 105, 118, 101, 32, 65,
+            114, 99, 97, 100, 101, 77, 97, 108, 105, 99, 101, 67, 104, 97, 109, 112, 105, 111, 110, 115,
+            104, 105, 112, 32, 66, 111, 119, 108, 105, 110, 103, 71, 117, 105, 32, 89, 105, 72, 101, 108,
+            108, 111, 32, 75, 105, 116, 116, 121, 58, 32, 82, 111, 108, 108, 101, 114, 32, 82, 101, 115,
+            99, 117, 101, 69, 51, 32, 50, 48, 48, 56, 83, 117, 109, 109, 101, 114, 32, 79, 102, 32,
+            65, 114, 99, 97, 100, 101, 32, 50, 48, 49, 50, 81, 117, 105, 99, 107, 100, 114, 97, 119,
+            65, 99, 101, 32, 79, 102, 32, 68, 121, 110, 97, 109, 105, 116, 101, 115, 84, 104, 101, 32,
+            67, 97, 110, 110, 111, 110, 80, 108, 97, 103, 117, 101, 65, 108, 105, 101, 110, 32, 72, 105,
+            100, 101, 111, 117, 116, 80, 108, 97, 99, 101, 32, 84, 104, 101, 32, 65, 114, 114, 111, 119,
+            115, 32, 79, 110, 32, 84, 104, 101, 32, 70, 108, 111, 111, 114, 70, 97, 119, 110, 105, 120,
+            84, 111, 117, 114, 105, 115, 116, 32, 84, 114, 97, 112, 66, 97, 108, 108, 111, 99, 104, 101,
+            116, 67, 111, 109, 98, 111, 32, 45, 32, 82, 101, 100, 32, 77, 111, 111, 110, 32, 82, 105,
+            115, 105, 110, 103, 83, 116, 97, 114, 32, 78, 105, 110, 106, 97, 83, 107, 121, 32, 67, 97,
+            116, 86, 105, 114, 116, 117, 97, 108, 32, 65, 116, 116, 114, 97, 99, 116, 105, 111, 110, 32,
+            45, 32, 80, 97, 114, 116, 32, 49, 71, 104, 120, 121, 107, 50, 32, 67, 108, 97, 115, 115,
+            105, 99, 115, 32, 86, 111, 108, 46, 32, 49, 65, 115, 115, 101, 109, 98, 108, 121, 32, 76,
+            105, 110, 101, 86, 101, 110, 116, 117, 114, 101, 72, 101, 120, 99, 104, 101, 115, 115, 32, 51,
+            54, 48, 83, 107, 101, 116, 99, 104, 121, 32, 66, 111, 117, 110, 99, 101, 68, 105, 118, 105,
+            110, 101, 32, 74, 117, 115, 116, 105, 99, 101, 32, 90, 101, 114, 111, 80, 105, 120, 101, 108,
+            32, 66, 108, 111, 99, 107, 101, 100, 33, 67, 97, 115, 116, 108, 101, 109, 105, 110, 101, 114,
+            80, 104, 97, 115, 101, 32, 82, 117, 110, 110, 101, 114, 84, 114, 97, 105, 108, 101, 114, 32,
+            80, 97, 114, 107, 32, 75, 105, 110, 103, 73, 110, 118, 97, 105, 100, 101, 114, 115, 77, 105,
+            108, 108, 101, 110, 110, 105, 117, 109, 32, 77, 97, 110, 84, 117, 114, 116, 108, 101, 32, 67,
+            97, 115, 105, 110, 111, 87, 104, 111, 32, 73, 115, 32, 71, 111, 100, 82, 111, 99, 107, 32,
+            39, 78, 39, 32, 77, 111, 108, 101, 32, 69, 120, 116, 114, 101, 109, 101, 88, 101, 110, 111,
+            32, 87, 97, 115, 116, 101, 114, 82, 97, 110, 100, 111, 109, 32, 84, 104, 101, 32, 68, 117,
+            110, 103, 101, 111, 110, 80, 97, 114, 97, 115, 105, 116, 117, 115, 32, 45, 32, 78, 105, 110,
+            106, 97, 32, 90, 101, 114, 111, 50, 55, 32, 66, 97, 108, 108, 32, 70, 117, 110, 107, 121,
+            32, 80, 111, 111, 108, 65, 110, 110, 101, 99, 116, 111, 72, 111, 110, 111, 114, 32, 73, 110,
+            32, 86, 101, 110, 103, 101, 97, 110, 99, 101, 32, 73, 105, 79, 102, 102, 32, 66, 97, 108,
+            97, 110, 99, 101, 78, 111, 32, 76, 117, 99, 97, 32, 78, 111, 82, 101, 112, 105, 120, 108,
+            97, 110, 100, 71, 111, 97, 108, 115, 90, 111, 109, 98, 105, 101, 115, 32, 82, 117, 105, 110,
+            101, 100, 32, 77, 121, 32, 68, 97, 121, 79, 120, 97, 100, 97, 110, 105, 97, 32, 45, 32,
+            65, 110, 32, 69, 45, 66, 111, 111, 107, 67, 114, 97, 122, 121, 32, 66, 97, 108, 108, 111,
+            111, 110, 32, 76, 105, 116, 101, 87, 105, 115, 112, 108, 105, 115, 112, 32, 65, 114, 114, 97,
+            121, 32, 79, 102, 32, 76, 105, 115, 116, 82, 111, 98, 111, 116, 32, 80, 108, 97, 116, 102,
+            111, 114, 109, 101, 114, 67, 121, 99, 108, 111, 105, 100, 77, 111, 111, 110, 32, 67, 104, 101,
+            101, 115, 101, 80, 97, 114, 114, 111, 116, 32, 80, 97, 114, 97, 100, 105, 115, 101, 32, 45,
+            32, 76, 111, 114, 105, 107, 101, 101, 116, 115, 65, 118, 97, 116, 97, 114, 32, 70, 97, 114,
+            109, 33, 66, 101, 119, 97, 114, 101, 32, 79, 102, 32, 84, 104, 101, 32, 80, 101, 110, 103,
+            117, 105, 110, 115, 86, 105, 114, 116, 117, 97, 108, 32, 77, 111, 110, 101, 121, 32, 80, 108,
+            97, 110, 116, 65, 110, 100, 114, 111, 109, 105, 117, 109, 66, 108, 111, 119, 32, 77, 101, 32,
+            85, 112, 75, 105, 99, 107, 39, 110, 32, 73, 116, 83, 119, 97, 115, 104, 98, 117, 99, 107,
+            101, 108, 32, 85, 114, 32, 83, 101, 97, 116, 98, 101, 108, 116, 115, 76, 101, 116, 39, 115,
+            32, 68, 114, 97, 119, 32, 38, 32, 83, 104, 97, 114, 101, 33, 70, 108, 105, 112, 32, 78,
+            32, 83, 104, 105, 102, 116, 73, 110, 102, 101, 114, 110, 111, 33, 80, 97, 106, 97, 109, 111,
+            114, 97, 109, 97, 71, 114, 97, 118, 97, 114, 101, 110, 97, 77, 111, 116, 111, 114, 98, 105,
+            107, 101, 32, 83, 116, 117, 110, 116, 32, 65, 103, 101, 110, 116, 32, 74, 117, 108, 105, 101,
+            78, 111, 118, 97, 32, 82, 101, 109, 110, 97, 110, 116, 52, 51, 68, 78, 101, 110, 101, 32,
+            77, 105, 110, 105, 103, 97, 109, 101, 115, 67, 111, 97, 103, 117, 108, 97, 116, 101, 68, 111,
+            99, 32, 76, 111, 103, 105, 99, 65, 116, 116, 97, 110, 99, 107, 33, 84, 111, 114, 113, 117,
+            101, 32, 81, 117, 101, 115, 116, 82, 97, 118, 101, 110, 116, 104, 111, 114, 110, 101, 65, 116,
+            116, 97, 99, 107, 32, 79, 102, 32, 84, 104, 101, 32, 69, 118, 105, 108, 32, 65, 110, 100,
+            114, 111, 105, 100, 115, 67, 117, 114, 115, 101, 100, 32, 76, 111, 111, 116, 72, 101, 114, 111,
+            101, 115, 32, 86, 115, 46, 32, 90, 111, 109, 98, 105, 101, 115, 77, 101, 101, 112, 32, 50,
+            32, 45, 32, 74, 117, 109, 112, 105, 110, 103, 32, 69, 118, 111, 108, 118, 101, 100, 76, 117,
+            99, 107, 121, 32, 71, 97, 109, 101, 65, 102, 116, 101, 114, 32, 68, 117, 115, 107, 83, 116,
+            101, 101, 108, 32, 65, 118, 101, 110, 103, 101, 114, 67, 117, 116, 101, 32, 84, 104, 105, 110,
+            103, 115, 32, 68, 121, 105, 110, 103, 32, 86, 105, 111, 108, 101, 110, 116, 108, 121, 86, 105,
+            100, 101, 111, 119, 97, 114, 115, 66, 108, 111, 98, 115, 65, 109, 98, 105, 101, 110, 116, 32,
+            84, 114, 97, 118, 101, 108, 115, 84, 46, 69, 46, 67, 46, 32, 51, 48, 48, 49, 67, 117,
+            98, 105, 99, 108, 101, 84, 104, 101, 32, 74, 117, 109, 112, 32, 72, 101, 114, 111, 68, 111,
+            111, 109, 32, 38, 32, 68, 101, 115, 116, 105, 110, 121, 65, 115, 112, 104, 97, 108, 116, 32,
+            74, 117, 110, 103, 108, 101, 32, 50, 82, 111, 99, 107, 115, 46, 32, 73, 110, 46, 32, 83,
+            112, 97, 97, 97, 99, 101, 33, 78, 105, 110, 106, 97, 32, 83, 110, 101, 97, 107, 105, 110,
+            103, 84, 104, 97, 116, 32, 82, 101, 97, 108, 108, 121, 32, 72, 111, 116, 32, 67, 104, 105,
+            99, 107, 71, 117, 97, 114, 100, 105, 110, 103, 66, 101, 97, 99, 104, 32, 66, 117, 98, 98,
+            108, 101, 115, 32, 50, 84, 97, 107, 101, 32, 65, 114, 109, 115, 65, 108, 108, 32, 84, 104,
+            101, 32, 66, 97, 100, 32, 80, 97, 114, 116, 115, 80, 114, 111, 102, 101, 115, 115, 105, 111,
+            110, 97, 108, 32, 36, 84, 101, 97, 108, 101, 114, 90, 111, 109, 98, 105, 101, 32, 82, 97,
+            99, 101, 114, 115, 65, 118, 97, 116, 97, 114, 32, 82, 117, 110, 110, 105, 110, 103, 82, 117,
+            109, 98, 108, 101, 118, 111, 105, 99, 101, 83, 112, 101, 101, 100, 114, 117, 110, 110, 101, 114,
+            32, 72, 100, 75, 111, 98, 111, 108, 100, 39, 115, 32, 81, 117, 101, 115, 116, 84, 114, 97,
+            105, 110, 32, 70, 114, 111, 110, 116, 105, 101, 114, 32, 69, 120, 112, 114, 101, 115, 115, 67,
+            104, 97, 105, 110, 32, 67, 114, 117, 115, 104, 101, 114, 65, 118, 97, 116, 97, 114, 32, 67,
+            111, 110, 110, 101, 99, 116, 105, 111, 110, 67, 104, 101, 115, 116, 101, 114, 74, 101, 116, 32,
+            83, 116, 97, 114, 32, 85, 110, 105, 118, 101, 114, 115, 101, 65, 105, 114, 32, 67, 111, 109,
+            98, 97, 116, 32, 45, 32, 68, 101, 115, 101, 114, 116, 32, 65, 99, 101, 115, 74, 101, 108,
+            108, 121, 102, 105, 115, 104, 32, 77, 100, 66, 108, 111, 99, 107, 116, 72, 101, 97, 100, 32,
+            83, 104, 111, 116, 32, 71, 111, 100, 78, 105, 110, 106, 97, 104, 69, 108, 101, 109, 101, 110,
+            116, 97, 108, 32, 87, 105, 122, 97, 114, 100, 82, 101, 100, 100, 32, 45, 32, 84, 104, 101,
+            32, 76, 111, 115, 116, 32, 84, 101, 109, 112, 108, 101, 77, 111, 110, 107, 101, 121, 32, 77,
+            97, 100, 110, 101, 115, 115, 80, 114, 105, 109, 97, 114, 121, 32, 80, 111, 116, 105, 111, 110,
+            115, 75, 105, 110, 103, 39, 115, 32, 67, 117, 112, 65, 112, 101, 120, 80, 108, 97, 121, 32,
+            65, 115, 32, 89, 111, 117, 32, 71, 111, 72, 97, 99, 111, 116, 97, 109, 97, 72, 97, 112,
+            112, 121, 50, 68, 32, 77, 97, 116, 104, 32, 80, 97, 110, 105, 99, 65, 114, 111, 110, 39,
+            115, 32, 74, 111, 117, 114, 110, 101, 121, 32, 73, 110, 32, 68, 114, 101, 97, 109, 108, 97,
+            110, 100, 65, 118, 97, 116, 97, 114, 32, 83, 116, 114, 101, 101, 116, 32, 66, 97, 115, 107,
+            101, 116, 98, 97, 108, 108, 32, 50, 71, 101, 116, 32, 84, 111, 32, 84, 104, 97, 32, 67,
+            104, 111, 112, 112, 97, 32, 84, 119, 111, 111, 111, 33, 33, 50, 65, 118, 97, 108, 105, 115,
+            32, 68, 117, 110, 103, 101, 111, 110, 32, 50, 83, 116, 114, 97, 116, 101, 103, 105, 99, 32,
+            67, 111, 109, 98, 97, 116, 80, 101, 108, 108, 101, 116, 101, 117, 115, 101, 71, 111, 111, 108,
+            105, 110, 70, 105, 103, 117, 114, 101, 32, 56, 32, 82, 97, 99, 105, 110, 103, 66, 97, 108,
+            108, 115, 32, 78, 32, 87, 97, 108, 108, 115, 80, 114, 101, 115, 105, 100, 101, 110, 116, 32,
+            74, 111, 104, 110, 32, 65, 109, 101, 114, 105, 99, 97, 83, 101, 110, 99, 111, 117, 110, 116,
+            101, 114, 67, 97, 108, 108, 32, 77, 101, 68, 101, 97, 100, 32, 80, 105, 120, 101, 108, 115,
+            65, 32, 80, 105, 109, 112, 32, 82, 112, 103, 65, 110, 103, 114, 121, 32, 70, 105, 115, 104,
+            80, 117, 122, 122, 108, 101, 100, 32, 82, 97, 98, 98, 105, 116, 80, 114, 111, 106, 101, 99,
+            116, 32, 87, 105, 110, 100, 115, 116, 111, 114, 109, 65, 118, 97, 116, 97, 114, 32, 70, 105,
+            103, 104, 116, 101, 114, 32, 79, 110, 108, 105, 110, 101, 80, 105, 103, 115, 32, 67, 97, 110,
+            39, 116, 32, 70, 108, 121, 71, 97, 109, 101, 32, 70, 114, 101, 110, 122, 121, 84, 117, 110,
+            110, 101, 108, 118, 105, 115, 105, 111, 110, 84, 104, 101, 32, 70, 97, 108, 108, 32, 79, 102,
+            32, 71, 111, 100, 115, 68, 111, 110, 39, 116, 32, 70, 101, 101, 100, 32, 84, 104, 101, 32,
+            84, 114, 111, 108, 108, 115, 83, 105, 100, 101, 114, 97, 108, 32, 68, 101, 102, 101, 110, 115,
+            101, 87, 97, 99, 107, 121, 32, 87, 97, 118, 105, 110, 103, 32, 73, 46, 32, 65, 46, 32,
+            70, 46, 32, 65, 118, 97, 116, 97, 114, 115, 68, 101, 118, 105, 108, 32, 66, 108, 111, 111,
+            100, 72, 105, 103, 104, 32, 71, 114, 97, 118, 105, 116, 121, 32, 87, 101, 108, 108, 115, 82,
+            97, 110, 103, 101, 114, 32, 87, 97, 114, 115, 65, 115, 116, 114, 97, 108, 105, 97, 87, 105,
+            122, 111, 114, 98, 77, 97, 116, 104, 32, 70, 105, 103, 104, 116, 101, 114, 90, 111, 109, 98,
+            105, 101, 99, 114, 97, 102, 116, 116, 33, 33, 49, 32, 83, 97, 109, 112, 108, 101, 114, 70,
+            97, 108, 108, 105, 110, 103, 32, 66, 108, 111, 99, 107, 115, 82, 111, 98, 111, 116, 114, 105,
+            111, 116, 70, 97, 115, 116, 98, 97, 108, 108, 32, 50, 67, 111, 110, 118, 105, 99, 116, 32,
+            77, 105, 110, 105, 103, 97, 109, 101, 115, 68, 97, 114, 107, 32, 68, 101, 108, 118, 101, 66,
+            97, 108, 108, 32, 76, 105, 103, 104, 116, 110, 105, 110, 103, 83, 104, 101, 114, 98, 101, 116,
+            32, 84, 104, 105, 101, 118, 101, 115, 80, 105, 120, 101, 108, 111, 115, 105, 116, 121, 83, 116,
+            101, 97, 109, 115, 117, 110, 107, 77, 101, 103, 97, 32, 83, 104, 111, 111, 116, 101, 114, 32,
+            49, 49, 84, 104, 101, 114, 101, 32, 87, 105, 108, 108, 32, 66, 101, 32, 66, 114, 97, 105,
+            110, 115, 70, 105, 116, 115, 45, 70, 105, 115, 104, 105, 110, 103, 32, 73, 110, 32, 84, 104,
+            101, 32, 83, 101, 97, 83, 112, 101, 108, 108, 32, 77, 97, 115, 116, 101, 114, 84, 104, 101,
+            32, 36, 49, 32, 90, 111, 109, 98, 105, 101, 32, 71, 97, 109, 101, 87, 105, 114, 114, 97,
+            108, 32, 82, 97, 105, 108, 119, 97, 121, 32, 38, 32, 71, 97, 114, 100, 101, 110, 32, 80,
+            108, 97, 110, 116, 115, 70, 108, 105, 103, 104, 116, 32, 65, 100, 118, 101, 110, 116, 117, 114,
+            101, 32, 50, 66, 108, 111, 99, 107, 121, 69, 115, 99, 97, 112, 101, 32, 84, 104, 101, 32,
+            67, 97, 114, 78, 105, 110, 106, 97, 32, 87, 97, 114, 32, 83, 116, 111, 108, 101, 110, 32,
+            83, 99, 114, 111, 108, 108, 115, 80, 105, 120, 101, 108, 32, 65, 110, 105, 109, 97, 116, 111,
+            114, 32, 51, 68, 77, 101, 114, 98, 97, 108, 108, 32, 84, 111, 117, 114, 110, 97, 109, 101,
+            110, 116, 83, 104, 111, 99, 107, 32, 65, 110, 100, 32, 65, 119, 101, 71, 108, 111, 119, 32,
+            65, 114, 99, 97, 100, 101, 32, 82, 97, 99, 101, 114, 70, 108, 97, 103, 32, 72, 117, 110,
+            116, 65, 114, 112, 32, 72, 97, 108, 108, 111, 119, 101, 101, 110, 32, 69, 100, 105, 116, 105,
+            111, 110, 83, 109, 97, 114, 116, 98, 111, 109, 98, 65, 118, 97, 116, 97, 114, 32, 80, 117,
+            110, 99, 104, 84, 101, 99, 104, 110, 111, 32, 67, 104, 111, 112, 112, 101, 114, 73, 110, 116,
+            101, 114, 110, 97, 116, 105, 111, 110, 97, 108, 32, 77, 111, 111, 105, 110, 103, 32, 67, 111,
+            110, 116, 101, 115, 116, 65, 118, 97, 116, 97, 114, 32, 80, 97, 110, 105, 99, 80, 108, 97,
+            116, 102, 111, 114, 109, 32, 72, 97, 99, 107, 82, 101, 109, 111, 116, 101, 32, 86, 105, 101,
+            119, 101, 114, 72, 101, 108, 108, 39, 115, 32, 72, 111, 117, 115, 101, 70, 105, 110, 97, 108,
+            32, 70, 97, 105, 108, 117, 114, 101, 71, 114, 97, 110, 100, 32, 67, 108, 97, 115, 115, 32,
+            77, 101, 108, 101, 101, 71, 104, 111, 115, 116, 32, 77, 105, 110, 101, 32, 45, 32, 68, 105,
+            103, 32, 70, 111, 114, 32, 83, 117, 114, 118, 105, 118, 97, 108, 66, 108, 111, 111, 100, 121,
+            32, 77, 97, 114, 121, 71, 108, 111, 119, 98, 122, 77, 105, 108, 105, 101, 32, 38, 32, 84,
+            101, 108, 108, 121, 76, 117, 109, 98, 101, 114, 106, 97, 99, 107, 65, 118, 97, 116, 97, 114,
+            32, 80, 108, 97, 110, 107, 105, 110, 103, 70, 111, 117, 114, 32, 87, 105, 110, 100, 115, 32,
+            70, 97, 110, 116, 97, 115, 121, 78, 111, 32, 80, 97, 105, 110, 32, 78, 111, 32, 66, 114,
+            97, 105, 110, 85, 110, 98, 111, 117, 110, 100, 69, 110, 100, 108, 101, 115, 115, 32, 80, 114,
+            105, 110, 99, 101, 115, 115, 76, 105, 103, 104, 116, 102, 105, 115, 104, 67, 97, 115, 116, 108,
+            101, 32, 79, 102, 32, 80, 105, 120, 101, 108, 32, 83, 107, 117, 108, 108, 115, 79, 116, 111,
+            65, 118, 97, 116, 97, 114, 32, 84, 111, 119, 101, 114, 80, 97, 100, 100, 108, 101, 32, 87,
+            97, 114, 115, 77, 105, 110, 101, 114, 32, 77, 97, 110, 83, 117, 112, 101, 114, 32, 75, 97,
+            98, 108, 97, 109, 111, 83, 101, 110, 115, 111, 114, 121, 32, 79, 118, 101, 114, 108, 111, 97,
+            100, 68, 105, 101, 32, 80, 97, 100, 32, 68, 105, 101, 68, 101, 115, 101, 114, 116, 32, 67,
+            111, 109, 109, 97, 110, 100, 111, 80, 114, 97, 105, 114, 105, 101, 32, 68, 111, 103, 32, 77,
+            97, 115, 115, 97, 99, 114, 101, 52, 45, 84, 101, 116, 32, 77, 117, 115, 105, 99, 32, 77,
+            97, 107, 101, 114, 76, 97, 115, 116, 32, 68, 114, 97, 103, 111, 110, 32, 83, 116, 97, 110,
+            100, 105, 110, 103, 87, 97, 114, 114, 77, 111, 116, 111, 106, 117, 109, 112, 65, 118, 97, 116,
+            97, 114, 32, 67, 104, 101, 115, 115, 83, 105, 110, 115, 32, 79, 102, 32, 84, 104, 101, 32,
+            70, 108, 101, 115, 104, 77, 111, 111, 110, 32, 77, 105, 110, 101, 114, 68, 108, 99, 32, 81,
+            117, 101, 115, 116, 69, 115, 99, 97, 112, 101, 32, 71, 111, 97, 116, 66, 117, 98, 32, 66,
+            108, 111, 99, 107, 67, 97, 116, 115, 97, 98, 101, 114, 83, 116, 97, 114, 98, 101, 97, 109,
+            77, 111, 101, 32, 77, 101, 107, 117, 114, 105, 32, 50, 46, 53, 50, 46, 53, 87, 111, 114,
+            108, 100, 32, 87, 97, 114, 115, 32, 73, 105, 68, 101, 118, 105, 108, 115, 111, 110, 103, 74,
+            97, 119, 115, 111, 109, 101, 83, 116, 97, 114, 99, 97, 116, 99, 104, 101, 114, 67, 108, 97,
+            117, 115, 116, 114, 111, 112, 104, 111, 98, 105, 97, 80, 117, 109, 112, 107, 105, 110, 32, 83,
+            109, 97, 115, 104, 101, 114, 51, 68, 32, 80, 105, 120, 101, 108, 32, 65, 114, 116, 32, 83,
+            116, 117, 100, 105, 111, 82, 101, 32, 45, 32, 71, 101, 116, 32, 84, 111, 32, 83, 99, 104,
+            111, 108, 32, 79, 110, 32, 84, 105, 109, 101, 70, 108, 111, 119, 114, 105, 100, 101, 114, 90,
+            111, 109, 98, 117, 115, 116, 101, 114, 115, 66, 111, 98, 98, 121, 73, 114, 111, 110, 32, 67,
+            111, 114, 101, 82, 111, 98, 111, 116, 32, 80, 108, 97, 116, 102, 111, 114, 109, 101, 114, 32,
+            50, 83, 110, 97, 107, 101, 32, 50, 68, 105, 115, 116, 111, 114, 116, 105, 111, 110, 32, 75,
+            105, 110, 103, 67, 97, 115, 116, 108, 101, 109, 105, 110, 101, 114, 32, 90, 71, 114, 111, 119,
+            105, 110, 103, 32, 80, 97, 105, 110, 115, 77, 97, 115, 116, 101, 114, 115, 32, 79, 102, 32,
+            73, 110, 102, 108, 117, 101, 110, 99, 101, 89, 111, 117, 39, 114, 101, 32, 65, 108, 108, 32,
+            68, 105, 115, 101, 97, 115, 101, 100, 33, 90, 111, 109, 98, 105, 101, 32, 83, 108, 97, 117,
+            103, 104, 116, 101, 114, 32, 73, 115, 32, 70, 117, 110, 70, 105, 114, 105, 110, 103, 32, 82,
+            97, 110, 103, 101, 73, 110, 118, 97, 115, 105, 111, 110, 71, 101, 109, 111, 108, 111, 103, 105,
+            115, 116, 87, 104, 111, 39, 115, 32, 84, 104, 101, 32, 68, 97, 100, 100, 121, 82, 101, 100,
+            32, 84, 105, 101, 32, 77, 105, 110, 101, 114, 51, 68, 45, 83, 116, 114, 117, 99, 116, 105,
+            111, 110, 72, 105, 100, 100, 101, 110, 32, 73, 110, 32, 80, 108, 97, 105, 110, 32, 83, 105,
+            103, 104, 116, 80, 101, 114, 107, 117, 110, 97, 115, 39, 32, 68, 114, 97, 103, 111, 110, 32,
+            45, 32, 69, 112, 105, 115, 111, 100, 101, 32, 79, 110, 101, 67, 97, 110, 121, 111, 110, 32,
+            86, 105, 97, 100, 117, 99, 116, 65, 110, 103, 114, 121, 32, 90, 111, 109, 98, 105, 101, 32,
+            78, 105, 110, 106, 97, 32, 67, 97, 116, 115, 73, 116, 122, 97, 83, 116, 97, 114, 32, 68,
+            101, 102, 101, 110, 100, 101, 114, 79, 111, 122, 105, 32, 45, 32, 69, 97, 114, 116, 104, 32,
+            65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 69, 112, 46, 32, 50, 84, 101, 109, 112, 108,
+            101, 32, 79, 102, 32, 68, 111, 103, 111, 108, 114, 97, 107, 85, 108, 116, 105, 109, 97, 116,
+            101, 32, 80, 111, 108, 121, 103, 111, 110, 82, 105, 115, 101, 32, 79, 102, 32, 84, 104, 101,
+            32, 77, 117, 109, 109, 105, 101, 115, 76, 111, 108, 105, 116, 97, 32, 79, 102, 32, 76, 97,
+            98, 121, 114, 105, 110, 116, 104, 65, 32, 68, 97, 121, 32, 65, 116, 32, 71, 109, 97, 39,
+            115, 32, 72, 111, 117, 115, 101, 32, 73, 110, 32, 87, 105, 110, 116, 101, 114, 85, 107, 32,
+            82, 101, 103, 105, 111, 110, 115, 32, 38, 32, 67, 111, 117, 110, 116, 105, 101, 115, 90, 111,
+            109, 98, 105, 101, 115, 44, 32, 90, 111, 109, 98, 105, 101, 115, 32, 69, 118, 101, 114, 121,
+            119, 104, 101, 114, 101, 33, 78, 97, 110, 111, 115, 113, 117, 97, 100, 84, 117, 114, 98, 111,
+            114, 111, 99, 107, 101, 116, 32, 50, 69, 108, 102, 115, 113, 117, 97, 100, 55, 86, 111, 108,
+            99, 104, 97, 111, 115, 79, 114, 98, 105, 116, 114, 111, 110, 32, 45, 32, 82, 101, 118, 111,
+            108, 117, 116, 105, 111, 110, 69, 115, 99, 97, 112, 101, 32, 70, 114, 111, 109, 32, 82, 111,
+            98, 111, 116, 32, 68, 111, 111, 109, 79, 114, 99, 115, 33, 78, 105, 110, 106, 97, 32, 82,
+            101, 99, 97, 112, 116, 117, 114, 101, 68, 114, 97, 103, 111, 110, 115, 32, 86, 115, 32, 83,
+            112, 97, 99, 101, 115, 104, 105, 112, 115, 65, 118, 97, 116, 97, 114, 32, 84, 114, 105, 118,
+            105, 97, 32, 80, 97, 114, 116, 121, 67, 104, 114, 105, 115, 116, 109, 97, 115, 32, 82, 111,
+            99, 107, 115, 33, 69, 112, 49, 99, 32, 67, 97, 116, 32, 71, 52, 109, 101, 32, 70, 111,
+            114, 101, 118, 51, 114, 32, 33, 33, 80, 105, 110, 103, 118, 105, 110, 97, 115, 50, 49, 32,
+            66, 97, 108, 108, 32, 83, 110, 111, 111, 107, 101, 114, 32, 67, 104, 97, 109, 112, 105, 111,
+            110, 80, 105, 110, 105, 113, 65, 118, 97, 116, 97, 114, 32, 82, 117, 109, 98, 108, 101, 84,
+            104, 101, 121, 32, 66, 114, 101, 97, 116, 104, 101, 65, 98, 122, 111, 108, 105, 117, 109, 83,
+            116, 103, 32, 86, 115, 70, 114, 97, 99, 116, 97, 108, 117, 115, 86, 105, 114, 116, 117, 97,
+            108, 32, 65, 116, 116, 114, 97, 99, 116, 105, 111, 110, 32, 45, 32, 80, 97, 114, 116, 32,
+            50, 83, 97, 110, 116, 97, 39, 115, 32, 88, 109, 97, 115, 32, 68, 97, 115, 104, 71, 97,
+            109, 101, 114, 115, 99, 111, 114, 101, 32, 84, 114, 97, 99, 107, 101, 114, 84, 104, 101, 32,
+            66, 111, 111, 107, 32, 79, 102, 32, 66, 105, 98, 108, 101, 116, 115, 32, 45, 32, 80, 97,
+            114, 116, 32, 49, 87, 97, 98, 98, 105, 116, 115, 33, 32, 74, 117, 109, 112, 105, 110, 103,
+            32, 70, 111, 114, 32, 70, 117, 110, 83, 105, 108, 101, 110, 116, 32, 67, 97, 108, 108, 32,
+            50, 83, 112, 97, 114, 116, 97, 110, 115, 32, 73, 110, 32, 67, 97, 110, 100, 121, 108, 97,
+            110, 100, 67, 97, 115, 115, 105, 101, 39, 115, 32, 67, 104, 114, 105, 115, 116, 109, 97, 115,
+            32, 77, 97, 103, 105, 99, 70, 117, 110, 32, 73, 110, 32, 84, 104, 101, 32, 71, 117, 108,
+            102, 78, 121, 97, 110, 32, 67, 97, 116, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 70,
+            105, 115, 104, 112, 111, 112, 78, 111, 114, 116, 104, 32, 80, 111, 108, 101, 32, 90, 111, 109,
+            98, 105, 101, 32, 77, 97, 115, 115, 97, 99, 114, 101, 77, 97, 103, 105, 99, 32, 82, 97,
+            99, 105, 110, 103, 32, 71, 112, 32, 50, 67, 97, 115, 115, 105, 101, 39, 115, 32, 65, 110,
+            105, 109, 97, 108, 32, 83, 111, 117, 110, 100, 115, 73, 32, 125, 44, 32, 90, 111, 109, 98,
+            105, 101, 69, 120, 116, 114, 101, 109, 101, 32, 74, 111, 103, 103, 105, 110, 103, 76, 101, 116,
+            39, 115, 32, 71, 101, 116, 32, 70, 105, 115, 99, 97, 108, 72, 111, 114, 100, 101, 32, 79,
+            102, 32, 84, 104, 101, 32, 68, 97, 109, 110, 101, 100, 70, 105, 114, 101, 102, 108, 121, 32,
+            86, 101, 103, 97, 115, 67, 114, 97, 122, 121, 32, 80, 97, 114, 116, 105, 99, 108, 101, 115,
+            65, 116, 116, 97, 110, 99, 107, 33, 50, 67, 111, 108, 111, 110, 105, 101, 115, 32, 45, 32,
+            78, 101, 111, 99, 105, 118, 83, 116, 97, 114, 115, 104, 105, 112, 32, 83, 108, 111, 116, 115,
+            80, 108, 97, 121, 105, 110, 103, 32, 73, 110, 32, 84, 114, 97, 102, 102, 105, 99, 72, 111,
+            109, 101, 108, 101, 115, 115, 67, 97, 114, 100, 32, 67, 114, 101, 97, 116, 111, 114, 32, 88,
+            109, 97, 115, 65, 118, 97, 116, 97, 114, 32, 71, 111, 108, 100, 32, 71, 114, 97, 98, 32,
+            88, 45, 77, 97, 115, 32, 86, 101, 114, 115, 105, 111, 110, 65, 116, 116, 97, 99, 107, 32,
+            79, 102, 32, 84, 104, 101, 32, 90, 111, 109, 98, 105, 101, 32, 72, 111, 114, 100, 101, 71,
+            97, 109, 101, 32, 84, 121, 112, 101, 70, 105, 101, 114, 99, 101, 32, 71, 97, 109, 101, 32,
+            72, 117, 110, 116, 105, 110, 103, 65, 108, 105, 101, 110, 32, 74, 101, 108, 108, 121, 83, 116,
+            97, 114, 122, 122, 108, 101, 32, 83, 101, 97, 115, 111, 110, 115, 77, 101, 114, 114, 121, 32,
+            77, 97, 116, 99, 104, 51, 32, 67, 104, 114, 105, 115, 116, 109, 97, 115, 69, 99, 104, 111,
+            115, 112, 97, 99, 101, 78, 111, 109, 110, 111, 109, 115, 76, 101, 120, 105, 118, 65, 98, 115,
+            111, 108, 117, 108, 116, 32, 70, 105, 114, 101, 112, 111, 119, 101, 114, 83, 97, 110, 116, 97,
+            32, 83, 108, 101, 105, 103, 104, 32, 83, 108, 105, 110, 103, 82, 97, 109, 101, 110, 32, 78,
+            105, 110, 106, 97, 66, 105, 108, 108, 121, 32, 84, 104, 101, 32, 75, 105, 100, 110, 101, 121,
+            32, 66, 101, 97, 110, 32, 86, 116, 102, 102, 73, 110, 118, 97, 115, 105, 111, 110, 32, 79,
+            110, 101, 79, 114, 98, 32, 84, 111, 119, 101, 114, 32, 68, 101, 102, 101, 110, 115, 101, 69,
+            110, 100, 32, 79, 102, 32, 68, 97, 121, 115, 32, 45, 32, 73, 110, 102, 101, 99, 116, 101,
+            100, 32, 86, 115, 32, 77, 101, 114, 99, 115, 65, 112, 112, 112, 97, 99, 107, 32, 50, 46,
+            48, 82, 97, 105, 110, 98, 111, 119, 32, 82, 97, 112, 116, 117, 114, 101, 65, 118, 97, 116,
+            97, 114, 98, 97, 108, 108, 65, 118, 97, 116, 97, 114, 32, 67, 108, 105, 109, 98, 105, 110,
+            103, 90, 111, 109, 98, 105, 101, 32, 83, 110, 111, 119, 109, 101, 110, 72, 97, 99, 107, 32,
+            84, 104, 105, 115, 32, 71, 97, 109, 101, 32, 51, 84, 97, 107, 101, 100, 111, 119, 110, 33,
+            65, 115, 99, 101, 110, 115, 105, 111, 110, 82, 111, 111, 109, 114, 101, 110, 116, 97, 108, 66,
+            117, 114, 103, 101, 114, 32, 74, 97, 99, 107, 66, 108, 105, 110, 100, 103, 105, 114, 108, 50,
+            71, 114, 97, 118, 105, 116, 121, 32, 68, 97, 115, 104, 32, 50, 79, 110, 101, 32, 77, 97,
+            110, 32, 65, 114, 109, 121, 66, 97, 108, 108, 111, 99, 104, 101, 116, 32, 51, 69, 121, 101,
+            115, 116, 111, 114, 109, 80, 51, 83, 109, 97, 114, 116, 101, 114, 32, 84, 104, 97, 110, 32,
+            65, 32, 67, 104, 101, 101, 114, 108, 101, 97, 100, 101, 114, 63, 69, 118, 105, 108, 113, 117,
+            101, 115, 116, 76, 111, 116, 115, 32, 79, 102, 32, 71, 117, 110, 115, 84, 114, 97, 105, 108,
+            101, 114, 32, 80, 97, 114, 107, 32, 75, 105, 110, 103, 32, 69, 112, 105, 115, 111, 100, 101,
+            32, 50, 52, 80, 32, 80, 105, 110, 103, 45, 80, 111, 110, 103, 68, 111, 116, 46, 79, 99,
+            116, 111, 112, 101, 100, 101, 80, 108, 117, 103, 101, 109, 111, 110, 115, 32, 45, 32, 80, 97,
+            114, 116, 32, 49, 78, 101, 119, 115, 99, 111, 112, 116, 101, 114, 76, 111, 111, 116, 102, 101,
+            115, 116, 32, 45, 32, 76, 105, 118, 101, 32, 68, 101, 115, 105, 103, 110, 70, 105, 115, 104,
+            32, 71, 97, 109, 101, 83, 105, 101, 103, 101, 32, 75, 105, 110, 103, 32, 45, 32, 84, 104,
+            101, 32, 83, 105, 101, 103, 101, 32, 79, 102, 32, 65, 117, 114, 117, 109, 77, 117, 115, 105,
+            99, 107, 110, 101, 115, 115, 84, 104, 101, 32, 68, 101, 102, 101, 110, 100, 101, 114, 115, 68,
+            111, 110, 39, 116, 32, 68, 105, 101, 32, 68, 97, 116, 101, 108, 101, 115, 115, 32, 125, 44,
+            32, 68, 117, 109, 109, 121, 33, 78, 97, 116, 117, 114, 97, 108, 32, 83, 101, 108, 101, 99,
+            116, 105, 111, 110, 65, 108, 108, 32, 89, 111, 117, 114, 32, 67, 114, 101, 101, 112, 115, 66,
+            108, 111, 99, 107, 32, 90, 111, 109, 98, 105, 101, 115, 33, 67, 111, 119, 98, 111, 116, 115,
+            80, 101, 114, 102, 101, 99, 116, 32, 83, 104, 111, 111, 116, 105, 110, 103, 32, 84, 114, 97,
+            105, 110, 105, 110, 103, 32, 67, 97, 109, 112, 72, 121, 112, 101, 114, 115, 104, 105, 112, 32,
+            83, 116, 105, 108, 108, 32, 79, 117, 116, 32, 79, 102, 32, 67, 111, 110, 116, 114, 111, 108,
+            65, 110, 32, 69, 108, 102, 121, 32, 87, 105, 110, 116, 101, 114, 68, 101, 116, 101, 99, 116,
+            51, 68, 32, 83, 116, 101, 114, 101, 111, 32, 83, 116, 117, 100, 105, 111, 83, 116, 97, 114,
+            100, 117, 115, 116, 104, 117, 110, 116, 101, 114, 112, 111, 112, 111, 121, 79, 99, 101, 97, 110,
+            32, 68, 114, 105, 118, 101, 32, 67, 104, 97, 108, 108, 101, 110, 103, 101, 65, 118, 97, 116,
+            97, 114, 32, 71, 114, 97, 110, 100, 32, 80, 114, 105, 120, 32, 50, 77, 101, 103, 97, 117,
+            112, 32, 45, 32, 85, 112, 108, 111, 97, 100, 32, 73, 102, 32, 89, 111, 117, 32, 67, 97,
+            110, 33, 78, 105, 110, 106, 97, 32, 83, 110, 101, 97, 107, 105, 110, 103, 50, 75, 105, 115,
+            115, 32, 75, 105, 115, 115, 84, 117, 114, 98, 111, 114, 111, 99, 107, 101, 116, 32, 51, 76,
+            105, 116, 116, 108, 101, 32, 82, 97, 99, 101, 114, 115, 32, 83, 116, 114, 101, 101, 116, 68,
+            97, 114, 107, 32, 82, 101, 105, 103, 110, 32, 82, 101, 100, 117, 120, 68, 101, 102, 121, 32,
+            71, 114, 97, 118, 105, 116, 121, 32, 69, 120, 116, 101, 110, 100, 101, 100, 71, 111, 108, 100,
+            32, 68, 105, 103, 103, 101, 114, 32, 84, 104, 101, 32, 67, 111, 109, 105, 99, 32, 49, 32,
+            45, 32, 55, 68, 105, 97, 109, 111, 110, 100, 32, 68, 105, 103, 103, 101, 114, 83, 112, 97,
+            99, 101, 102, 105, 103, 104, 116, 101, 114, 52, 48, 48, 48, 32, 84, 114, 97, 105, 110, 105,
+            110, 103, 87, 111, 114, 108, 100, 115, 32, 66, 101, 115, 116, 32, 70, 114, 101, 97, 107, 105,
+            110, 103, 32, 67, 97, 114, 100, 32, 71, 97, 109, 101, 65, 118, 97, 116, 97, 114, 32, 79,
+            110, 115, 108, 97, 117, 103, 104, 116, 32, 50, 76, 46, 65, 46, 82, 46, 65, 76, 99, 100,
+            32, 68, 117, 110, 103, 101, 111, 110, 32, 83, 121, 115, 116, 101, 109, 66, 114, 97, 110, 100,
+            66, 117, 103, 32, 66, 97, 108, 108, 65, 118, 97, 116, 97, 114, 32, 84, 104, 117, 110, 100,
+            101, 114, 32, 67, 97, 114, 115, 77, 120, 104, 100, 72, 97, 114, 100, 98, 111, 105, 108, 101,
+            100, 32, 80, 105, 110, 98, 97, 108, 108, 75, 97, 116, 97, 110, 97, 32, 76, 97, 110, 100,
+            77, 105, 110, 101, 114, 32, 83, 116, 121, 108, 101, 65, 118, 97, 116, 97, 114, 32, 66, 108,
+            111, 99, 107, 32, 87, 97, 114, 65, 32, 86, 111, 120, 101, 108, 32, 65, 99, 116, 105, 111,
+            110, 83, 112, 97, 99, 101, 32, 80, 105, 114, 97, 116, 101, 115, 32, 65, 100, 118, 101, 110,
+            116, 117, 114, 101, 115, 75, 105, 110, 103, 100, 111, 109, 77, 97, 114, 97, 116, 104, 111, 110,
+            32, 77, 111, 110, 107, 80, 105, 99, 98, 111, 120, 67, 101, 108, 108, 32, 45, 32, 69, 109,
+            101, 114, 103, 101, 110, 99, 101, 71, 114, 101, 121, 32, 73, 110, 102, 101, 99, 116, 105, 111,
+            110, 85, 110, 105, 111, 110, 32, 79, 102, 32, 65, 114, 109, 115, 116, 114, 111, 110, 103, 65,
+            116, 111, 109, 66, 97, 108, 108, 111, 111, 110, 32, 71, 117, 97, 114, 100, 84, 104, 101, 32,
+            78, 101, 118, 101, 114, 32, 69, 110, 100, 105, 110, 103, 32, 71, 97, 109, 101, 32, 50, 80,
+            101, 100, 114, 111, 83, 107, 105, 109, 109, 101, 114, 32, 80, 97, 116, 114, 111, 108, 79, 111,
+            122, 105, 32, 45, 32, 69, 97, 114, 116, 104, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101,
+            32, 69, 112, 46, 32, 51, 70, 97, 116, 115, 104, 101, 101, 112, 65, 108, 101, 120, 97, 110,
+            100, 101, 114, 32, 76, 101, 97, 114, 110, 105, 110, 103, 32, 83, 101, 114, 105, 101, 115, 32,
+            51, 54, 48, 83, 117, 112, 101, 114, 32, 90, 111, 109, 98, 105, 101, 32, 83, 109, 97, 115,
+            104, 87, 105, 110, 101, 104, 101, 97, 100, 78, 117, 97, 103, 101, 70, 112, 115, 32, 84, 114,
+            97, 105, 110, 101, 114, 84, 111, 121, 32, 83, 116, 117, 110, 116, 32, 66, 105, 107, 101, 32,
+            50, 83, 112, 97, 99, 101, 32, 66, 97, 116, 116, 108, 101, 115, 79, 46, 67, 46, 68, 46,
+            65, 110, 103, 114, 121, 32, 70, 105, 115, 104, 32, 45, 32, 68, 101, 101, 112, 32, 83, 101,
+            97, 83, 112, 97, 99, 101, 32, 67, 111, 109, 109, 97, 110, 100, 76, 105, 118, 105, 110, 103,
+            32, 68, 101, 97, 100, 32, 45, 32, 85, 112, 103, 114, 97, 100, 101, 100, 71, 114, 97, 118,
+            105, 116, 97, 115, 69, 118, 97, 110, 32, 81, 117, 101, 115, 116, 80, 101, 114, 116, 117, 114,
+            98, 105, 114, 100, 115, 76, 105, 116, 116, 108, 101, 32, 83, 116, 114, 97, 116, 101, 103, 121,
+            80, 105, 103, 109, 97, 110, 68, 101, 110, 105, 122, 101, 110, 39, 115, 32, 68, 101, 110, 67,
+            114, 111, 45, 77, 97, 103, 32, 82, 97, 108, 108, 121, 32, 69, 120, 116, 114, 101, 109, 101,
+            33, 84, 104, 101, 32, 73, 109, 112, 111, 115, 115, 105, 98, 108, 101, 32, 68, 117, 110, 103,
+            101, 111, 110, 79, 99, 116, 111, 103, 101, 110, 97, 114, 105, 97, 110, 32, 86, 105, 112, 85,
+            98, 101, 114, 122, 111, 109, 98, 105, 101, 32, 85, 115, 97, 66, 111, 120, 101, 100, 32, 73,
+            110, 90, 111, 109, 98, 105, 101, 32, 73, 110, 118, 97, 115, 105, 111, 110, 70, 105, 103, 104,
+            116, 101, 114, 32, 77, 105, 115, 115, 105, 111, 110, 82, 101, 100, 32, 84, 105, 101, 32, 77,
+            105, 110, 101, 114, 32, 90, 111, 109, 98, 105, 101, 90, 111, 109, 98, 105, 101, 32, 67, 114,
+            111, 115, 115, 105, 110, 103, 83, 111, 108, 97, 114, 32, 65, 110, 110, 105, 104, 105, 108, 97,
+            116, 105, 111, 110, 82, 101, 99, 116, 97, 110, 103, 108, 101, 32, 66, 97, 116, 116, 108, 101,
+            74, 105, 103, 115, 97, 119, 32, 74, 117, 109, 98, 108, 101, 84, 114, 97, 110, 115, 103, 114,
+            101, 115, 115, 105, 111, 110, 70, 108, 121, 99, 97, 116, 99, 104, 101, 114, 83, 116, 97, 114,
+            116, 102, 105, 103, 104, 116, 101, 114, 32, 50, 45, 57, 65, 114, 103, 104, 32, 65, 108, 105,
+            101, 110, 115, 65, 115, 116, 114, 97, 108, 66, 114, 105, 116, 116, 108, 101, 67, 114, 97, 102,
+            116, 105, 109, 97, 108, 115, 32, 45, 32, 66, 117, 105, 108, 100, 32, 84, 111, 32, 84, 104,
+            101, 32, 83, 117, 110, 80, 97, 112, 101, 114, 32, 82, 112, 103, 66, 105, 116, 32, 68, 105,
+            103, 103, 101, 114, 65, 116, 116, 97, 110, 99, 107, 33, 51, 82, 101, 100, 115, 104, 105, 102,
+            116, 77, 105, 110, 101, 114, 52, 101, 118, 101, 114, 69, 115, 99, 97, 112, 101, 32, 72, 101,
+            108, 108, 32, 80, 114, 105, 115, 111, 110, 84, 117, 114, 98, 111, 114, 111, 99, 107, 101, 116,
+            32, 52, 67, 97, 114, 32, 87, 97, 115, 104, 101, 114, 32, 83, 117, 109, 109, 101, 114, 32,
+            79, 102, 32, 84, 104, 101, 32, 78, 105, 110, 106, 97, 70, 111, 114, 116, 114, 101, 115, 115,
+            32, 87, 97, 114, 115, 73, 99, 52, 67, 121, 98, 101, 114, 100, 101, 99, 107, 66, 105, 114,
+            116, 104, 32, 79, 114, 100, 101, 114, 67, 97, 116, 97, 98, 111, 111, 109, 65, 118, 97, 116,
+            97, 114, 32, 68, 101, 97, 116, 104, 109, 97, 116, 99, 104, 76, 101, 109, 109, 121, 32, 76,
+            105, 122, 97, 114, 100, 32, 86, 115, 32, 84, 104, 101, 32, 77, 101, 99, 104, 97, 45, 69,
+            103, 103, 115, 68, 97, 114, 107, 32, 70, 111, 114, 101, 115, 116, 77, 97, 116, 99, 104, 32,
+            87, 105, 116, 104, 32, 87, 97, 108, 108, 121, 82, 111, 98, 111, 102, 105, 115, 104, 82, 101,
+            116, 114, 111, 32, 65, 114, 99, 97, 100, 101, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101,
+            79, 105, 108, 32, 77, 97, 103, 110, 97, 116, 101, 68, 114, 101, 97, 109, 32, 68, 105, 118,
+            101, 114, 115, 70, 114, 101, 101, 122, 101, 32, 69, 118, 101, 114, 121, 116, 104, 105, 110, 103,
+            77, 121, 32, 67, 97, 116, 32, 86, 115, 32, 90, 111, 109, 98, 105, 101, 115, 32, 69, 112,
+            32, 73, 90, 111, 109, 98, 105, 101, 114, 117, 110, 83, 117, 112, 101, 114, 32, 78, 105, 110,
+            106, 97, 32, 87, 97, 114, 114, 105, 111, 114, 32, 69, 120, 116, 114, 101, 109, 101, 79, 103,
+            114, 101, 39, 115, 32, 80, 104, 97, 110, 116, 97, 115, 109, 32, 83, 119, 111, 114, 100, 32,
+            81, 117, 101, 115, 116, 82, 101, 100, 32, 72, 111, 116, 32, 80, 111, 107, 101, 114, 80, 105,
+            99, 116, 117, 114, 101, 32, 80, 117, 122, 122, 108, 101, 83, 112, 111, 105, 100, 115, 77, 117,
+            115, 105, 99, 32, 73, 115, 108, 97, 110, 100, 84, 104, 101, 32, 72, 101, 97, 114, 116, 115,
+            32, 79, 102, 32, 77, 101, 110, 32, 45, 32, 84, 111, 100, 50, 48, 32, 71, 97, 109, 101,
+            115, 72, 117, 110, 103, 114, 121, 32, 83, 110, 97, 107, 101, 84, 104, 101, 32, 72, 111, 117,
+            99, 104, 105, 32, 80, 108, 97, 121, 83, 112, 101, 99, 116, 114, 97, 110, 103, 108, 101, 51,
+            54, 48, 82, 97, 112, 116, 111, 114, 32, 82, 101, 115, 111, 114, 116, 82, 97, 99, 105, 110,
+            103, 32, 87, 105, 110, 103, 115, 66, 105, 116, 45, 72, 97, 99, 107, 101, 114, 82, 111, 99,
+            107, 32, 66, 111, 116, 116, 111, 109, 77, 97, 121, 102, 108, 121, 39, 115, 32, 67, 97, 115,
+            116, 108, 101, 87, 97, 110, 100, 101, 114, 101, 114, 82, 97, 99, 101, 100, 114, 111, 109, 101,
+            32, 79, 102, 102, 114, 111, 97, 100, 72, 111, 112, 112, 101, 114, 66, 121, 116, 111, 119, 110,
+            32, 76, 117, 109, 98, 101, 114, 106, 97, 99, 107, 83, 99, 117, 98, 97, 32, 65, 100, 118,
+            101, 110, 116, 117, 114, 101, 72, 111, 112, 32, 65, 110, 100, 32, 80, 111, 112, 87, 97, 114,
+            32, 73, 110, 32, 66, 111, 120, 32, 40, 72, 97, 107, 111, 110, 105, 119, 97, 115, 101, 110,
+            41, 68, 121, 97, 100, 87, 101, 32, 65, 114, 101, 32, 67, 117, 98, 101, 115, 83, 110, 97,
+            107, 101, 122, 32, 71, 117, 110, 122, 32, 38, 32, 76, 97, 100, 100, 101, 114, 122, 82, 101,
+            100, 32, 73, 110, 118, 97, 115, 105, 111, 110, 32, 45, 32, 84, 111, 119, 101, 114, 32, 68,
+            101, 102, 101, 110, 115, 101, 87, 105, 116, 104, 111, 117, 116, 32, 69, 115, 99, 97, 112, 101,
+            68, 117, 110, 106, 97, 120, 87, 111, 111, 111, 112, 117, 112, 33, 83, 112, 97, 99, 101, 32,
+            68, 101, 98, 114, 105, 115, 77, 101, 103, 97, 99, 105, 116, 121, 49, 48, 32, 65, 109, 97,
+            122, 105, 110, 103, 108, 121, 32, 65, 119, 102, 117, 108, 32, 71, 97, 109, 101, 115, 32, 86,
+            111, 108, 32, 50, 86, 105, 100, 105, 111, 116, 32, 71, 97, 109, 101, 65, 117, 120, 105, 108,
+            108, 105, 117, 109, 32, 77, 97, 103, 105, 52, 56, 32, 67, 104, 97, 109, 98, 101, 114, 115,
+            77, 105, 110, 101, 114, 32, 87, 97, 114, 102, 97, 114, 101, 71, 101, 109, 115, 32, 78, 32,
+            82, 111, 99, 107, 115, 84, 101, 100, 100, 121, 32, 68, 101, 102, 101, 110, 100, 101, 114, 83,
+            101, 112, 116, 105, 112, 117, 115, 32, 45, 32, 84, 101, 110, 116, 97, 99, 108, 101, 32, 65,
+            112, 111, 99, 97, 108, 121, 112, 115, 101, 77, 111, 110, 115, 116, 101, 114, 32, 87, 105, 115,
+            112, 81, 117, 105, 101, 116, 44, 32, 80, 108, 101, 97, 115, 101, 33, 65, 118, 97, 116, 97,
+            114, 32, 82, 117, 110, 110, 105, 110, 103, 32, 50, 65, 45, 66, 97, 110, 100, 67, 108, 121,
+            100, 101, 32, 72, 111, 112, 112, 101, 114, 39, 115, 32, 84, 114, 97, 106, 101, 99, 116, 111,
+            114, 121, 70, 105, 115, 104, 32, 66, 97, 105, 116, 66, 114, 105, 99, 107, 115, 65, 99, 101,
+            32, 79, 110, 32, 83, 116, 101, 114, 111, 105, 100, 115, 76, 101, 116, 116, 101, 114, 32, 77,
+            117, 110, 99, 104, 82, 101, 116, 114, 105, 98, 117, 116, 105, 111, 110, 81, 117, 105, 99, 107,
+            32, 80, 105, 114, 97, 116, 101, 85, 110, 110, 101, 99, 101, 115, 115, 97, 114, 121, 32, 86,
+            105, 111, 108, 101, 110, 99, 101, 76, 101, 97, 103, 117, 101, 32, 79, 102, 32, 80, 108, 97,
+            110, 101, 116, 115, 67, 121, 108, 105, 110, 100, 101, 114, 90, 111, 109, 98, 105, 101, 115, 70,
+            105, 114, 105, 110, 103, 32, 82, 97, 110, 103, 101, 32, 50, 73, 110, 115, 97, 110, 101, 32,
+            90, 111, 109, 98, 105, 101, 32, 67, 97, 114, 110, 97, 103, 101, 76, 101, 97, 114, 110, 32,
+            66, 97, 115, 105, 99, 32, 73, 116, 97, 108, 105, 97, 110, 90, 111, 109, 98, 105, 101, 32,
+            77, 111, 110, 107, 101, 121, 115, 32, 84, 100, 68, 114, 105, 118, 101, 32, 70, 97, 115, 116,
+            32, 84, 104, 105, 110, 107, 32, 70, 97, 115, 116, 101, 114, 84, 105, 108, 101, 115, 32, 87,
+            105, 116, 104, 32, 66, 117, 100, 100, 105, 101, 115, 65, 118, 97, 116, 97, 114, 32, 65, 105,
+            114, 32, 87, 97, 114, 115, 80, 108, 97, 115, 109, 97, 32, 83, 112, 104, 101, 114, 101, 115,
+            32, 51, 71, 111, 108, 100, 32, 77, 105, 110, 101, 114, 79, 114, 98, 105, 116, 32, 67, 114,
+            97, 122, 101, 67, 114, 121, 115, 116, 97, 108, 32, 72, 117, 110, 116, 101, 114, 115, 68, 101,
+            110, 105, 122, 101, 110, 39, 115, 32, 68, 101, 110, 45, 84, 104, 101, 32, 66, 108, 97, 99,
+            107, 32, 75, 110, 105, 103, 104, 116, 82, 117, 110, 110, 105, 110, 103, 32, 87, 105, 116, 104,
+            32, 83, 99, 105, 115, 115, 111, 114, 115, 66, 105, 98, 108, 101, 32, 84, 114, 105, 118, 105,
+            97, 32, 65, 118, 97, 116, 97, 114, 32, 69, 100, 105, 116, 105, 111, 110, 67, 117, 114, 115,
+            101, 32, 79, 102, 32, 83, 104, 97, 100, 111, 119, 115, 67, 105, 116, 121, 32, 90, 111, 109,
+            98, 105, 102, 105, 101, 100, 71, 105, 110, 103, 101, 114, 98, 114, 101, 97, 100, 32, 72, 111,
+            108, 105, 100, 97, 121, 72, 111, 110, 101, 121, 32, 66, 97, 100, 103, 101, 114, 32, 45, 32,
+            83, 108, 97, 121, 101, 114, 32, 79, 102, 32, 77, 101, 109, 101, 115, 83, 107, 121, 102, 105,
+            115, 104, 32, 73, 105, 32, 69, 97, 116, 32, 89, 111, 117, 114, 32, 80, 101, 97, 115, 65,
+            114, 101, 110, 97, 32, 79, 102, 32, 70, 105, 114, 101, 67, 104, 97, 105, 110, 115, 68, 105,
+            99, 101, 68, 111, 116, 32, 68, 97, 115, 104, 32, 45, 32, 69, 112, 105, 115, 111, 100, 101,
+            32, 49, 67, 117, 100, 100, 108, 101, 32, 66, 101, 97, 114, 68, 105, 97, 109, 111, 110, 100,
+            32, 67, 97, 118, 101, 115, 76, 105, 116, 116, 108, 101, 32, 77, 111, 110, 115, 116, 101, 114,
+            115, 77, 101, 109, 111, 114, 121, 32, 70, 114, 101, 97, 107, 68, 114, 111, 112, 112, 105, 110,
+            39, 32, 66, 97, 108, 108, 122, 83, 110, 97, 107, 101, 115, 116, 101, 114, 69, 118, 105, 108,
+            32, 83, 104, 97, 112, 101, 115, 32, 65, 110, 100, 32, 83, 112, 97, 99, 101, 115, 104, 105,
+            112, 115, 83, 101, 97, 108, 32, 84, 101, 97, 109, 32, 49, 50, 77, 105, 97, 115, 109, 97,
+            32, 50, 80, 101, 110, 100, 117, 108, 111, 117, 115, 84, 97, 112, 32, 66, 108, 111, 120, 82,
+            111, 99, 107, 101, 116, 32, 78, 97, 114, 119, 104, 97, 108, 65, 114, 111, 110, 32, 50, 32,
+            45, 32, 77, 121, 115, 116, 101, 114, 105, 111, 117, 115, 32, 84, 114, 111, 117, 98, 108, 101,
+            115, 66, 101, 101, 112, 32, 66, 114, 114, 112, 32, 66, 105, 110, 103, 32, 66, 97, 110, 103,
+            32, 66, 111, 115, 104, 83, 112, 105, 116, 102, 105, 114, 101, 71, 104, 111, 115, 116, 115, 32,
+            79, 102, 32, 84, 97, 114, 114, 45, 77, 105, 110, 111, 115, 83, 116, 111, 114, 121, 32, 83,
+            101, 110, 100, 101, 114, 66, 105, 98, 122, 90, 111, 109, 98, 105, 101, 115, 32, 83, 116, 111,
+            108, 101, 32, 77, 121, 32, 76, 105, 113, 117, 111, 114, 33, 53, 77, 105, 110, 114, 112, 103,
+            77, 105, 103, 32, 77, 97, 100, 110, 101, 115, 115, 65, 118, 97, 116, 97, 114, 32, 70, 97,
+            114, 116, 33, 33, 67, 104, 111, 109, 112, 121, 32, 67, 104, 111, 109, 112, 32, 67, 104, 111,
+            109, 112, 72, 101, 114, 111, 101, 115, 32, 79, 102, 32, 72, 97, 116, 67, 111, 109, 112, 114,
+            111, 109, 105, 115, 101, 100, 66, 114, 97, 105, 110, 32, 74, 117, 109, 112, 32, 51, 77, 97,
+            109, 98, 111, 119, 71, 101, 110, 116, 108, 101, 109, 101, 110, 32, 83, 116, 97, 114, 116, 32,
+            89, 111, 117, 114, 32, 69, 110, 103, 105, 105, 105, 110, 101, 115, 82, 101, 118, 101, 110, 103,
+            101, 32, 79, 102, 32, 84, 104, 101, 32, 83, 97, 109, 109, 105, 99, 104, 77, 111, 110, 115,
+            116, 101, 114, 32, 75, 97, 116, 122, 65, 118, 97, 116, 97, 114, 32, 70, 97, 108, 108, 115,
+            32, 68, 111, 119, 110, 32, 83, 116, 97, 105, 114, 115, 67, 111, 108, 108, 101, 103, 101, 32,
+            76, 97, 99, 114, 111, 115, 115, 101, 32, 50, 48, 49, 50, 49, 79, 110, 49, 32, 83, 111,
+            99, 99, 101, 114, 85, 110, 105, 120, 110, 97, 32, 32, 45, 32, 67, 117, 98, 101, 82, 111,
+            108, 108, 105, 110, 103, 32, 72, 111, 116, 32, 66, 97, 108, 108, 115, 80, 108, 97, 115, 109,
+            97, 110, 105, 97, 66, 117, 114, 101, 97, 117, 32, 45, 32, 83, 104, 97, 116, 116, 101, 114,
+            101, 100, 32, 83, 108, 105, 112, 112, 101, 114, 66, 117, 105, 108, 100, 32, 39, 78, 32, 66,
+            117, 109, 112, 74, 101, 119, 101, 108, 32, 70, 101, 118, 101, 114, 70, 108, 121, 105, 110, 103,
+            32, 90, 111, 109, 98, 105, 101, 32, 73, 110, 118, 97, 115, 105, 111, 110, 77, 105, 99, 114,
+            111, 98, 105, 97, 108, 77, 121, 32, 67, 104, 97, 98, 117, 100, 97, 105, 66, 97, 116, 116,
+            108, 101, 112, 97, 116, 104, 115, 76, 105, 107, 101, 44, 32, 70, 97, 118, 111, 114, 105, 116,
+            101, 44, 32, 83, 104, 111, 111, 116, 33, 73, 110, 102, 101, 99, 116, 105, 111, 110, 77, 105,
+            110, 105, 103, 97, 109, 101, 32, 77, 97, 114, 97, 116, 104, 111, 110, 65, 32, 80, 105, 120,
+            101, 108, 32, 69, 115, 99, 97, 112, 101, 77, 111, 114, 116, 97, 108, 32, 76, 101, 103, 97,
+            99, 105, 101, 115, 80, 101, 114, 100, 105, 116, 105, 111, 110, 67, 114, 121, 115, 116, 97, 108,
+            32, 83, 107, 105, 101, 115, 72, 101, 114, 98, 101, 114, 116, 32, 65, 110, 100, 32, 84, 104,
+            101, 32, 83, 107, 121, 115, 104, 105, 112, 74, 101, 116, 112, 97, 99, 107, 32, 82, 97, 112,
+            116, 117, 114, 101, 83, 101, 112, 97, 107, 32, 86, 101, 110, 117, 115, 101, 115, 83, 104, 111,
+            111, 116, 105, 110, 103, 32, 67, 104, 105, 99, 107, 101, 110, 32, 66, 114, 117, 116, 97, 108,
+            115, 117, 99, 107, 101, 114, 115, 51, 55, 32, 68, 97, 121, 115, 32, 84, 111, 32, 68, 105,
+            101, 67, 104, 101, 114, 114, 121, 32, 80, 111, 107, 101, 32, 80, 114, 105, 115, 111, 110, 65,
+            112, 112, 108, 101, 32, 74, 97, 99, 107, 32, 50, 77, 105, 110, 101, 114, 32, 79, 102, 32,
+            68, 117, 116, 121, 83, 117, 112, 101, 114, 100, 105, 109, 101, 110, 115, 105, 111, 110, 32, 73,
+            108, 105, 97, 100, 65, 100, 97, 109, 97, 110, 116, 32, 65, 110, 116, 115, 77, 111, 110, 115,
+            116, 101, 114, 32, 75, 105, 110, 103, 80, 117, 122, 122, 108, 101, 32, 67, 117, 98, 105, 99,
+            108, 101, 76, 101, 97, 114, 110, 32, 66, 97, 115, 105, 99, 32, 70, 114, 101, 110, 99, 104,
+            65, 113, 117, 97, 108, 105, 98, 114, 105, 117, 109, 80, 105, 103, 32, 38, 32, 66, 117, 108,
+            108, 101, 116, 65, 118, 97, 116, 97, 114, 32, 82, 97, 110, 100, 111, 109, 32, 67, 104, 97,
+            116, 77, 97, 110, 105, 99, 32, 77, 105, 110, 101, 114, 32, 51, 54, 48, 79, 118, 101, 114,
+            100, 114, 105, 118, 101, 110, 65, 108, 99, 104, 101, 109, 121, 32, 71, 111, 100, 83, 112, 97,
+            99, 101, 32, 87, 97, 114, 115, 32, 82, 116, 115, 65, 118, 97, 116, 97, 114, 32, 69, 117,
+            114, 111, 32, 80, 101, 110, 97, 108, 116, 121, 32, 83, 104, 111, 111, 116, 111, 117, 116, 77,
+            121, 115, 116, 105, 99, 32, 70, 111, 114, 101, 115, 116, 87, 97, 115, 104, 105, 110, 103, 116,
+            111, 110, 39, 115, 32, 87, 105, 103, 65, 118, 97, 116, 111, 117, 114, 32, 45, 32, 86, 101,
+            103, 97, 115, 80, 117, 108, 115, 101, 32, 45, 32, 70, 105, 103, 104, 116, 32, 84, 104, 101,
+            32, 78, 105, 103, 104, 116, 80, 101, 110, 110, 121, 32, 65, 114, 99, 97, 100, 101, 39, 115,
+            32, 82, 97, 105, 110, 45, 83, 108, 105, 99, 107, 32, 51, 65, 110, 100, 121, 39, 115, 32,
+            78, 111, 116, 101, 112, 97, 100, 32, 91, 83, 97, 117, 99, 101, 114, 115, 93, 71, 111, 32,
+            71, 105, 109, 98, 97, 108, 32, 71, 111, 83, 104, 111, 111, 116, 105, 110, 103, 32, 65, 116,
+            32, 77, 111, 110, 115, 116, 101, 114, 115, 65, 118, 97, 103, 108, 105, 100, 101, 32, 50, 82,
+            111, 116, 111, 115, 99, 104, 117, 116, 122, 101, 110, 84, 104, 101, 32, 82, 105, 115, 101, 32,
+            79, 102, 32, 71, 97, 100, 100, 97, 102, 105, 115, 104, 83, 46, 32, 65, 118, 97, 116, 97,
+            114, 32, 70, 105, 103, 104, 116, 105, 110, 103, 32, 84, 111, 117, 114, 110, 97, 109, 101, 110,
+            116, 65, 98, 115, 111, 108, 117, 116, 101, 32, 87, 97, 114, 83, 117, 112, 101, 114, 32, 65,
+            109, 97, 122, 105, 110, 103, 32, 87, 97, 103, 111, 110, 32, 65, 100, 118, 101, 110, 116, 117,
+            114, 101, 79, 98, 115, 101, 115, 115, 105, 118, 101, 32, 67, 111, 108, 108, 101, 99, 116, 105,
+            110, 103, 32, 68, 105, 115, 111, 114, 100, 101, 114, 83, 116, 101, 108, 108, 97, 114, 32, 70,
+            111, 114, 116, 114, 101, 115, 115, 77, 97, 115, 115, 116, 101, 114, 111, 105, 100, 83, 99, 104,
+            97, 114, 32, 45, 32, 66, 108, 117, 101, 32, 83, 104, 105, 101, 108, 100, 32, 65, 108, 108,
+            105, 97, 110, 99, 101, 76, 105, 116, 116, 108, 101, 32, 78, 105, 110, 106, 97, 115, 90, 97,
+            110, 100, 114, 105, 39, 115, 32, 82, 101, 118, 101, 110, 103, 101, 88, 101, 110, 111, 116, 114,
+            111, 105, 100, 83, 117, 115, 104, 105, 32, 67, 97, 115, 116, 108, 101, 87, 117, 115, 104, 105,
+            80, 101, 103, 32, 83, 111, 108, 105, 116, 97, 105, 114, 101, 65, 98, 111, 117, 116, 32, 84,
+            111, 32, 66, 108, 111, 119, 32, 85, 112, 32, 80, 97, 114, 116, 32, 49, 84, 104, 101, 32,
+            76, 101, 103, 101, 110, 100, 32, 79, 102, 32, 65, 121, 108, 101, 115, 98, 117, 114, 121, 80,
+            114, 111, 32, 66, 97, 115, 107, 101, 116, 98, 97, 108, 108, 32, 83, 104, 111, 111, 116, 101,
+            114, 67, 104, 114, 111, 110, 111, 100, 97, 115, 104, 80, 105, 78, 97, 110, 111, 32, 68, 111,
+            99, 50, 49, 32, 66, 97, 108, 108, 32, 83, 110, 111, 111, 107, 101, 114, 32, 76, 105, 118,
+            101, 84, 104, 97, 116, 32, 87, 97, 99, 107, 121, 32, 70, 105, 115, 104, 32, 71, 97, 109,
+            101, 65, 118, 97, 116, 97, 114, 32, 68, 111, 119, 110, 104, 105, 108, 108, 83, 117, 112, 101,
+            114, 32, 75, 105, 108, 108, 101, 114, 32, 72, 111, 114, 110, 101, 116, 80, 117, 122, 122, 108,
+            101, 100, 80, 114, 105, 110, 99, 101, 115, 115, 32, 80, 111, 110, 121, 39, 115, 32, 72, 97,
+            112, 112, 121, 32, 66, 111, 117, 110, 99, 101, 87, 104, 111, 39, 115, 32, 71, 111, 110, 110,
+            97, 32, 71, 101, 116, 32, 84, 104, 101, 32, 71, 105, 114, 108, 84, 104, 101, 32, 82, 101,
+            108, 105, 99, 32, 79, 102, 32, 72, 111, 114, 117, 115, 83, 116, 97, 114, 119, 105, 110, 103,
+            115, 77, 105, 115, 116, 101, 114, 32, 74, 117, 109, 112, 83, 112, 97, 99, 101, 32, 73, 110,
+            118, 97, 115, 105, 111, 110, 68, 101, 97, 100, 32, 83, 101, 97, 71, 117, 112, 112, 121, 32,
+            45, 32, 67, 111, 108, 108, 101, 99, 116, 115, 33, 32, 50, 67, 97, 116, 104, 117, 110, 116,
+            101, 114, 112, 111, 112, 111, 121, 49, 79, 110, 49, 32, 66, 97, 115, 107, 101, 116, 98, 97,
+            108, 108, 78, 105, 110, 106, 97, 32, 69, 120, 111, 114, 99, 105, 115, 116, 32, 69, 112, 105,
+            115, 111, 100, 101, 32, 49, 83, 108, 105, 99, 107, 82, 101, 100, 32, 84, 105, 101, 32, 77,
+            105, 110, 101, 114, 32, 90, 111, 109, 98, 105, 101, 32, 50, 84, 119, 101, 110, 116, 121, 32,
+            84, 119, 101, 108, 118, 101, 65, 99, 105, 100, 32, 68, 114, 105, 102, 116, 32, 45, 32, 83,
+            111, 108, 97, 114, 77, 117, 114, 100, 101, 114, 32, 70, 111, 114, 32, 68, 105, 110, 110, 101,
+            114, 83, 112, 97, 99, 101, 109, 97, 110, 32, 65, 100, 118, 101, 110, 116, 117, 114, 101, 82,
+            111, 99, 107, 32, 125, 44, 32, 80, 97, 112, 101, 114, 32, 125, 44, 32, 76, 97, 122, 101,
+            114, 115, 65, 118, 97, 116, 97, 114, 32, 84, 114, 105, 118, 105, 97, 32, 80, 97, 114, 116,
+            121, 32, 50, 84, 104, 101, 32, 85, 110, 100, 101, 97, 100, 32, 83, 121, 110, 100, 114, 111,
+            109, 101, 76, 101, 97, 114, 110, 32, 84, 104, 101, 32, 85, 46, 83, 32, 80, 114, 101, 115,
+            105, 100, 101, 110, 116, 115, 80, 105, 110, 103, 50, 48, 49, 50, 32, 65, 116, 104, 108, 101,
+            116, 105, 99, 115, 32, 84, 111, 117, 114, 110, 97, 109, 101, 110, 116, 56, 32, 66, 97, 108,
+            108, 32, 67, 104, 97, 109, 112, 105, 111, 110, 32, 76, 105, 118, 101, 83, 117, 110, 102, 108,
+            111, 119, 101, 114, 32, 70, 97, 114, 109, 70, 97, 108, 108, 101, 110, 32, 65, 110, 103, 101,
+            108, 69, 100, 103, 101, 108, 97, 110, 100, 66, 108, 97, 115, 116, 101, 114, 80, 97, 99, 105,
+            102, 105, 99, 32, 87, 105, 110, 103, 115, 71, 101, 111, 32, 66, 111, 116, 115, 81, 116, 101,
+            32, 67, 104, 97, 109, 112, 68, 105, 114, 116, 32, 84, 114, 97, 99, 107, 32, 82, 97, 99,
+            101, 114, 67, 104, 111, 112, 112, 101, 114, 32, 83, 116, 111, 114, 109, 70, 97, 99, 101, 32,
+            83, 108, 97, 112, 112, 101, 114, 69, 118, 101, 114, 121, 32, 79, 116, 104, 101, 114, 32, 83,
+            104, 111, 111, 116, 101, 114, 69, 109, 112, 105, 114, 101, 32, 79, 102, 32, 84, 111, 119, 101,
+            114, 115, 65, 118, 97, 116, 97, 114, 32, 76, 97, 115, 101, 114, 32, 87, 97, 114, 115, 32,
+            50, 84, 104, 101, 32, 52, 84, 104, 32, 87, 97, 108, 108, 68, 97, 114, 107, 32, 77, 97,
+            116, 116, 101, 114, 65, 110, 116, 32, 71, 101, 110, 101, 114, 97, 108, 73, 110, 115, 97, 110,
+            101, 32, 71, 97, 109, 101, 84, 104, 101, 32, 77, 111, 110, 107, 101, 121, 32, 87, 97, 110,
+            116, 115, 32, 66, 97, 110, 97, 110, 97, 115, 77, 97, 122, 101, 32, 79, 102, 32, 65, 112,
+            101, 115, 67, 111, 109, 101, 100, 121, 32, 78, 105, 103, 104, 116, 83, 116, 105, 99, 107, 121,
+            32, 66, 117, 109, 112, 79, 110, 101, 32, 77, 105, 108, 108, 105, 111, 110, 32, 84, 97, 112,
+            115, 48, 32, 71, 114, 97, 118, 105, 116, 121, 32, 89, 51, 48, 51, 48, 50, 48, 49, 50,
+            66, 108, 111, 99, 107, 32, 87, 111, 114, 108, 100, 83, 112, 121, 108, 101, 97, 107, 115, 72,
+            117, 109, 97, 110, 32, 83, 117, 98, 106, 101, 99, 116, 66, 111, 111, 112, 97, 32, 90, 97,
+            112, 65, 118, 97, 116, 97, 97, 97, 104, 33, 33, 33, 50, 68, 32, 72, 111, 117, 115, 101,
+            32, 79, 102, 32, 84, 101, 114, 114, 111, 114, 78, 105, 110, 106, 97, 115, 32, 65, 110, 100,
+            32, 80, 114, 105, 101, 115, 116, 101, 115, 115, 73, 109, 97, 103, 105, 110, 97, 114, 121, 65,
+            109, 98, 105, 97, 110, 99, 101, 66, 117, 114, 110, 105, 110, 103, 32, 82, 117, 98, 98, 101,
+            114, 68, 114, 105, 110, 107, 97, 114, 100, 115, 32, 66, 101, 101, 114, 32, 80, 111, 110, 103,
+            74, 101, 116, 32, 83, 101, 116, 32, 87, 105, 108, 108, 121, 32, 51, 54, 48, 50, 32, 74,
+            97, 119, 115, 111, 109, 101, 77, 101, 114, 103, 101, 114, 82, 101, 99, 111, 114, 100, 105, 110,
+            103, 32, 83, 116, 117, 100, 105, 111, 82, 111, 103, 117, 101, 32, 65, 105, 68, 114, 105, 110,
+            107, 105, 110, 103, 32, 71, 97, 109, 101, 115, 68, 101, 97, 116, 104, 32, 67, 108, 111, 115,
+            101, 116, 87, 97, 114, 112, 32, 83, 104, 111, 111, 116, 101, 114, 77, 97, 114, 99, 104, 32,
+            84, 111, 32, 84, 104, 101, 32, 77, 111, 111, 110, 77, 121, 115, 116, 105, 99, 32, 77, 97,
+            121, 104, 101, 109, 78, 117, 108, 108, 32, 66, 97, 116, 116, 108, 101, 115, 80, 97, 105, 110,
+            116, 98, 97, 108, 108, 32, 87, 97, 114, 79, 111, 122, 105, 32, 69, 97, 114, 116, 104, 32,
+            65, 100, 118, 101, 110, 116, 117, 114, 101, 32, 69, 112, 46, 32, 52, 86, 111, 108, 108, 101,
+            121, 83, 117, 109, 109, 111, 110, 101, 114, 115, 76, 105, 116, 116, 108, 101, 32, 75, 105, 110,
+            103, 100, 111, 109, 32, 65, 100, 118, 97, 110, 99, 101, 100, 71, 101, 116, 32, 79, 102, 102,
+            32, 77, 121, 32, 73, 115, 108, 97, 110, 100, 77, 97, 103, 101, 32, 67, 97, 103, 101, 82,
+            101, 115, 105, 115, 116, 111, 114, 84, 114, 97, 112, 32, 66, 97, 108, 108, 32, 69, 100, 105,
+            99, 105, 243, 110, 32, 66, 105, 108, 108, 97, 114, 80, 117, 110, 99, 104, 32, 84, 104, 97,
+            116, 32, 70, 97, 99, 101, 70, 97, 99, 101, 45, 80, 108, 97, 110, 116, 32, 65, 100, 118,
+            101, 110, 116, 117, 114, 101, 115, 83, 108, 111, 119, 100, 111, 119, 110, 72, 97, 99, 107, 32,
+            84, 104, 105, 115, 32, 71, 97, 109, 101, 32, 52, 89, 101, 116, 104, 111, 108, 109, 32, 67,
+            97, 115, 116, 108, 101, 32, 65, 114, 105, 101, 115, 32, 65, 116, 116, 97, 99, 107, 66, 97,
+            116, 104, 32, 83, 97, 108, 116, 32, 90, 111, 109, 98, 105, 101, 115, 68, 101, 97, 116, 104,
+            32, 79, 114, 98, 32, 87, 97, 114, 115, 71, 97, 108, 97, 99, 116, 105, 99, 32, 84, 104,
+            117, 110, 100, 101, 114, 69, 122, 109, 117, 122, 101, 43, 32, 50, 77, 117, 114, 100, 101, 114,
+            32, 77, 105, 110, 101, 114, 115, 66, 114, 105, 109, 115, 116, 111, 110, 101, 32, 45, 32, 65,
+            110, 32, 65, 99, 116, 105, 111, 110, 32, 82, 112, 103, 67, 111, 108, 111, 114, 32, 83, 101,
+            110, 115, 101, 71, 108, 97, 114, 101, 72, 101, 121, 32, 65, 108, 105, 101, 110, 115, 32, 45,
+            32, 73, 108, 108, 32, 77, 97, 115, 104, 32, 89, 111, 117, 32, 85, 112, 33, 81, 114, 116,
+            104, 45, 80, 104, 121, 108, 68, 101, 102, 101, 110, 100, 101, 114, 115, 32, 79, 102, 32, 84,
+            104, 101, 32, 76, 97, 115, 116, 32, 67, 111, 108, 111, 110, 121, 70, 117, 110, 107, 121, 32,
+            66, 97, 108, 108, 115, 83, 101, 110, 111, 107, 97, 83, 101, 110, 116, 101, 110, 116, 105, 97,
+            83, 112, 108, 111, 100, 103, 101, 72, 97, 99, 107, 116, 114, 105, 115, 68, 105, 101, 104, 97,
+            114, 100, 32, 68, 117, 110, 103, 101, 111, 110, 83, 110, 111, 112, 115, 32, 65, 116, 116, 97,
+            99, 107, 33, 32, 90, 111, 109, 98, 105, 101, 32, 68, 101, 102, 101, 110, 115, 101, 65, 32,
+            83, 110, 111, 119, 121, 32, 83, 108, 97, 108, 111, 109, 71, 97, 116, 101, 119, 97, 121, 115,
+            33, 83, 109, 111, 111, 116, 104, 32, 79, 112, 101, 114, 97, 116, 111, 114, 115, 76, 105, 102,
+            101, 32, 73, 110, 32, 84, 104, 101, 32, 68, 111, 114, 109, 115, 74, 117, 110, 103, 108, 101,
+            32, 74, 97, 109, 66, 97, 99, 99, 97, 114, 97, 116, 71, 97, 108, 108, 111, 119, 115, 73,
+            110, 116, 101, 114, 103, 97, 108, 97, 120, 105, 97, 68, 105, 97, 109, 111, 110, 100, 32, 67,
+            104, 97, 108, 108, 101, 69, 110, 116, 114, 111, 112, 121, 87, 97, 108, 45, 77, 97, 114, 116,
+            32, 71, 97, 109, 101, 99, 101, 110, 116, 101, 114, 89, 111, 117, 114, 32, 68, 117, 110, 103,
+            101, 111, 110, 32, 77, 121, 32, 68, 114, 97, 103, 111, 110, 84, 117, 114, 116, 108, 101, 32,
+            66, 101, 97, 99, 104, 32, 65, 99, 114, 32, 84, 104, 101, 109, 101, 115, 32, 65, 110, 100,
+            32, 80, 105, 99, 115, 89, 115, 108, 32, 76, 39, 104, 111, 109, 109, 101, 32, 76, 105, 98,
+            114, 101, 32, 84, 104, 101, 109, 101, 115, 32, 65, 110, 100, 32, 80, 105, 99, 115, 67, 104,
+            101, 118, 114, 111, 108, 101, 116, 32, 83, 111, 110, 105, 99, 32, 75, 105, 110, 101, 99, 116,
+            77, 105, 99, 114, 111, 115, 111, 102, 116, 32, 87, 105, 110, 100, 111, 119, 115, 32, 77, 101,
+            100, 105, 97, 32, 67, 101, 110, 116, 101, 114, 32, 69, 120, 116, 101, 110, 100, 101, 114, 32,
+            102, 111, 114, 32, 88, 98, 111, 120, 32, 118, 49, 46, 48, 49, 69, 51, 32, 50, 48, 48,
+            57, 80, 114, 111, 106, 101, 99, 116, 32, 78, 97, 116, 97, 108, 66, 108, 111, 99, 107, 32,
+            80, 97, 114, 116, 121, 86, 101, 114, 105, 122, 111, 110, 32, 65, 108, 97, 110, 32, 87, 97,
+            107, 101, 79, 108, 100, 32, 83, 112, 105, 99, 101, 69, 51, 32, 50, 48, 49, 48, 83, 112,
+            97, 114, 116, 97, 99, 117, 115, 32, 45, 32, 66, 108, 111, 111, 100, 32, 65, 110, 100, 32,
+            83, 97, 110, 100, 72, 97, 114, 114, 121, 32, 80, 111, 116, 116, 101, 114, 32, 65, 110, 100,
+            32, 84, 104, 101, 32, 68, 101, 97, 116, 104, 108, 121, 32, 72, 97, 108, 108, 111, 119, 115,
+            75, 105, 110, 101, 99, 116, 32, 70, 111, 114, 32, 88, 98, 111, 120, 32, 51, 54, 48, 68,
+            105, 115, 110, 101, 121, 32, 67, 108, 97, 115, 115, 105, 99, 115, 69, 51, 32, 50, 48, 49,
+            49, 68, 117, 109, 98, 111, 70, 97, 115, 116, 32, 70, 105, 118, 101, 74, 117, 114, 97, 115,
+            115, 105, 99, 32, 80, 97, 114, 107, 84, 114, 97, 110, 115, 102, 111, 114, 109, 101, 114, 115,
+            32, 68, 97, 114, 107, 32, 79, 102, 32, 84, 104, 101, 32, 77, 111, 111, 110, 73, 110, 115,
+            105, 100, 101, 32, 88, 98, 111, 120, 77, 117, 114, 97, 107, 117, 109, 111, 79, 116, 111, 103,
+            105, 89, 111, 111, 115, 116, 97, 114, 50, 89, 111, 111, 115, 116, 97, 114, 32, 79, 110, 32,
+            77, 116, 118, 80, 111, 111, 108, 32, 83, 104, 97, 114, 107, 32, 50, 65, 108, 105, 101, 110,
+            32, 72, 111, 109, 105, 110, 105, 100, 67, 104, 101, 99, 107, 32, 118, 115, 32, 77, 97, 116,
+            101, 84, 119, 111, 32, 87, 111, 114, 108, 100, 115, 32, 73, 73, 77, 105, 110, 117, 116, 101,
+            32, 84, 111, 32, 87, 105, 110, 32, 73, 116, 88, 98, 111, 120, 32, 51, 54, 48, 32, 68,
+            97, 115, 104, 98, 111, 97, 114, 100,
+        };
+    }
+
+    inline constexpr EmbeddedTable kEmbeddedTitles(embedded_data::kKeys, embedded_data::kOffsets, embedded_data::kPool,
+        3884, 142647, 0x00E963BF5539AABFULL);
+    static_assert(kEmbeddedTitles.IsSorted(), "keys must ascend");
+
+} // namespace titledb
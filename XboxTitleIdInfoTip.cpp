@@ -1,10 +1,15 @@
 // XboxTitleIdInfoTip.cpp – Windows 11 (x64) InfoTip handler for folders named like 8-char uppercase/digit IDs.
-// Shows tooltip from %SystemRoot%\System32\XboxTitleIDs.txt (UTF-8; lines: ID=Name).
+// Shows tooltip from %SystemRoot%\System32\XboxTitleIDs.txt (UTF-8; lines: ID=Name, optionally followed by
+// platform, region, year and publisher columns, see TitleMeta.h), overridden by
+// %APPDATA%\XboxTitleIdInfoTip\XboxTitleIDs.txt and by XboxTitleIDs.txt at the root of a network share.
+// The shipped list is also compiled in (XboxTitleIDsEmbedded.h, generated by build.bat) and answers
+// for IDs none of the files has, and for every ID while the files are still loading in the background.
 // Build (x64 Dev Prompt):
 //   cl /LD /EHsc /permissive- /std:c++17 /DUNICODE /D_UNICODE XboxTitleIdInfoTip.cpp ^
 //      shlwapi.lib ole32.lib uuid.lib advapi32.lib shell32.lib user32.lib propsys.lib
 //
-// Logs to %TEMP%\XboxTip.log for troubleshooting.
+// Logs to %TEMP%\XboxTip.log for troubleshooting (add /DXBOXTIP_LOG_DEBUG=1 for per-hover detail) and
+// writes latency histograms and counters to %TEMP%\XboxTip.stats.<pid>.json.
 
 #if __has_include("pch.h")
 #include "pch.h"
@@ -37,12 +42,32 @@
 #include <propsys.h>   // For property system
 #include <comdef.h>    // For COM definitions
 
-#include <unordered_map>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <mutex>
+#include <atomic>
+#include <memory>
 #include <new>
 
+#include "TitleIndex.h"
+#include "TitleLayers.h"
+#include "TitleReload.h"
+#include "TitleCompact.h"
+#include "TitleFreshness.h"
+#include "LogRing.h"
+#include "Metrics.h"
+#include "HandlerMetrics.h"
+#include "TooltipCache.h"
+#include "TitleWarmup.h"
+#include "TitleScan.h"
+#include "TitleShared.h"
+#include "TitleMeta.h"
+#include "TitleLookup.h"
+#include "XboxTitleIDsEmbedded.h" // generated by build.bat from XboxTitleIDs.txt
+
+static_assert(sizeof(wchar_t) == sizeof(char16_t), "title names are stored as UTF-16");
+
 // --- Fix for DllRegisterServer not found ---
 // These pragmas instruct the linker to export the required functions.
 #pragma comment(linker,"/EXPORT:DllCanUnloadNow,PRIVATE")
@@ -64,24 +89,240 @@ static LONG g_dllRefCount = 0;
 // Global instance handle for DllMain
 HINSTANCE g_hInstance = nullptr;
 
+// ---------------- Metrics ----------------
+// Counters and latency histograms of the hover path, the freshness checks and reloads. Recording
+// is a few relaxed atomic adds into a per-thread shard (see Metrics.h). The log flusher thread
+// writes a snapshot to %TEMP%\XboxTip.stats.<pid>.json every StatsIntervalSec when anything was
+// recorded, when the DumpStats event is signaled (XboxTitleTool stats) and when it exits.
+namespace {
+    using Metric = titledb::HandlerMetrics;
+    using MetricTimer = titledb::Metrics<Metric>::Timer;
+    titledb::Metrics<Metric> g_metrics;
+
+    const wchar_t* const kDumpStatsEvent = L"Local\\XboxTitleIdInfoTip.DumpStats";
+    DWORD g_statsIntervalMs = 60 * 1000; // StatsIntervalSec; 0 = only on demand and at exit
+    HANDLE g_statsDump = nullptr;        // manual-reset, set by XboxTitleTool stats
+    const ULONGLONG g_statsStart = GetTickCount64();
+
+    // Write the current snapshot. Unless forced, nothing is written when no sample was recorded
+    // since the last write, which *lastEvents (owned by the calling flusher) remembers. Only
+    // called from the flusher thread.
+    void StatsWriteNow(const char* reason, bool force, uint64_t* lastEvents) {
+        titledb::MetricsSnapshot<Metric> snap = g_metrics.Snapshot();
+        if (!force && snap.Events() == *lastEvents) return;
+        *lastEvents = snap.Events();
+
+        wchar_t dir[MAX_PATH], path[MAX_PATH], tmp[MAX_PATH], exe[MAX_PATH] = L"";
+        DWORD n = GetTempPathW(MAX_PATH, dir);
+        if (!n || n >= MAX_PATH) return;
+        StringCchPrintfW(path, MAX_PATH, L"%sXboxTip.stats.%lu.json", dir, GetCurrentProcessId());
+        StringCchPrintfW(tmp, MAX_PATH, L"%s.tmp", path);
+        GetModuleFileNameW(nullptr, exe, MAX_PATH);
+        char process[MAX_PATH * 3] = "";
+        WideCharToMultiByte(CP_UTF8, 0, PathFindFileNameW(exe), -1, process, (int)sizeof(process), nullptr, nullptr);
+
+        FILETIME ft; GetSystemTimeAsFileTime(&ft);
+        ULONGLONG unixMs = ((((ULONGLONG)ft.dwHighDateTime << 32) | ft.dwLowDateTime) - 116444736000000000ULL) / 10000;
+        char head[MAX_PATH * 3 + 160];
+        StringCchPrintfA(head, ARRAYSIZE(head),
+                         "{\"pid\": %lu, \"process\": \"%s\", \"reason\": \"%s\", \"time_ms\": %llu, \"uptime_ms\": %llu,\n",
+                         GetCurrentProcessId(), process, reason, unixMs, GetTickCount64() - g_statsStart);
+        std::string json = head;
+        snap.AppendJson(json);
+        json += "}\n";
+
+        HANDLE h = CreateFileW(tmp, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return;
+        DWORD wrote = 0;
+        BOOL ok = WriteFile(h, json.data(), (DWORD)json.size(), &wrote, nullptr);
+        CloseHandle(h);
+        if (ok) MoveFileExW(tmp, path, MOVEFILE_REPLACE_EXISTING); // readers never see half a file
+        else DeleteFileW(tmp);
+    }
+}
+
 // ---------------- Logging ----------------
-// Simple logging to %TEMP%\XboxTip.log for debugging purposes.
-static void LogLine(const wchar_t* fmt, ...) {
-    wchar_t path[MAX_PATH]{}; DWORD n = GetTempPathW(MAX_PATH, path);
-    if (!n || n >= MAX_PATH) return;
-    StringCchCatW(path, MAX_PATH, L"XboxTip.log");
-    HANDLE h = CreateFileW(path, FILE_APPEND_DATA, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
-    if (h == INVALID_HANDLE_VALUE) return;
-    wchar_t buf[1024];
-    va_list ap; va_start(ap, fmt);
-    StringCchVPrintfW(buf, 1024, fmt, ap);
-    va_end(ap);
-    DWORD wrote = 0;
-    WriteFile(h, buf, (DWORD)(lstrlenW(buf) * sizeof(wchar_t)), &wrote, nullptr);
-    WriteFile(h, L"\r\n", 4, &wrote, nullptr);
-    CloseHandle(h);
+// Logging to %TEMP%\XboxTip.log for troubleshooting. Callers only format into a lock-free ring;
+// a background thread appends the records in batches and rotates the file to XboxTip.log.1
+// once it passes LogMaxKB. LOG_DEBUG compiles to nothing unless XBOXTIP_LOG_DEBUG is 1.
+#ifndef XBOXTIP_LOG_DEBUG
+#define XBOXTIP_LOG_DEBUG 0
+#endif
+
+using titledb::LogLevel;
+
+namespace {
+    titledb::LogRing<wchar_t, 512, 512> g_logRing;
+    std::atomic<int> g_logMinLevel{ (int)LogLevel::Info };
+    DWORD g_logMaxBytes = 1024 * 1024;
+    uint64_t g_logReportedDrops = 0;
+    std::atomic<bool> g_logRunning{ false };
+    std::atomic<bool> g_logStop{ false };
+    HANDLE g_logThread = nullptr;   // the flusher, running or stopping; guarded by g_logStateMutex
+    HANDLE g_logWake = nullptr;     // auto-reset: flush now, or stop
+    std::once_flag g_logConfigOnce;
+    std::mutex g_logStateMutex;     // starting/stopping the flusher
+    std::mutex g_logFileMutex;      // draining the ring and writing the file
+
+    // Log and stats settings, read once from HKLM\SOFTWARE\XboxTitleIdInfoTip:
+    //   LogLevel (DWORD)         - minimum level written: 0 debug, 1 info (default), 2 warning, 3 error.
+    //   LogMaxKB (DWORD)         - size at which the log is rotated, default 1024.
+    //   StatsIntervalSec (DWORD) - interval between stats files, default 60; 0 = on demand only.
+    void LogReadConfig() {
+        DWORD value = 0, cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"LogLevel",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            g_logMinLevel.store((int)value, std::memory_order_relaxed);
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"LogMaxKB",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS && value) {
+            g_logMaxBytes = value * 1024;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"StatsIntervalSec",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            g_statsIntervalMs = value * 1000;
+        }
+    }
+
+    bool GetLogPath(wchar_t* path, size_t cch) {
+        DWORD n = GetTempPathW((DWORD)cch, path);
+        if (!n || n >= cch) return false;
+        return SUCCEEDED(StringCchCatW(path, cch, L"XboxTip.log"));
+    }
+
+    // Drain the ring and append everything to the log file in one write. Safe from any thread.
+    void LogFlushNow() {
+        std::lock_guard<std::mutex> lk(g_logFileMutex);
+        static const wchar_t* const kLevel[] = { L"DBG", L"INF", L"WRN", L"ERR" };
+        std::wstring batch;
+        g_logRing.Drain([&](LogLevel level, uint64_t time, const wchar_t* text, size_t len) {
+            FILETIME utc = { (DWORD)time, (DWORD)(time >> 32) }, local; SYSTEMTIME st{};
+            FileTimeToLocalFileTime(&utc, &local);
+            FileTimeToSystemTime(&local, &st);
+            wchar_t prefix[48];
+            StringCchPrintfW(prefix, 48, L"%02u:%02u:%02u.%03u %s ",
+                             st.wHour, st.wMinute, st.wSecond, st.wMilliseconds, kLevel[(int)level & 3]);
+            batch += prefix;
+            batch.append(text, len);
+            batch += L"\r\n";
+        });
+        uint64_t dropped = g_logRing.Dropped();
+        if (dropped != g_logReportedDrops) {
+            wchar_t note[64];
+            StringCchPrintfW(note, 64, L"[Log] %llu records dropped\r\n", dropped - g_logReportedDrops);
+            batch += note;
+            g_logReportedDrops = dropped;
+        }
+        if (batch.empty()) return;
+
+        wchar_t path[MAX_PATH];
+        if (!GetLogPath(path, MAX_PATH)) return;
+        DWORD bytes = (DWORD)(batch.size() * sizeof(wchar_t));
+        HANDLE h = CreateFileW(path, FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER size{};
+        if (GetFileSizeEx(h, &size) && size.QuadPart + bytes > (LONGLONG)g_logMaxBytes) {
+            CloseHandle(h);
+            wchar_t old[MAX_PATH];
+            StringCchPrintfW(old, MAX_PATH, L"%s.1", path);
+            MoveFileExW(path, old, MOVEFILE_REPLACE_EXISTING);
+            h = CreateFileW(path, FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (h == INVALID_HANDLE_VALUE) return;
+        }
+        DWORD wrote = 0;
+        WriteFile(h, batch.data(), bytes, &wrote, nullptr);
+        CloseHandle(h);
+    }
+
+    // Flusher: wakes every 500 ms (or when the ring is half full) and writes a batch, and writes
+    // the stats file when it is due or asked for. It holds a reference on this DLL so the module
+    // cannot be unloaded under it, and drops it on exit. There is never more than one: it is the
+    // ring's only consumer. It must not log (LogEnsureStarted may be waiting for it to exit).
+    DWORD WINAPI LogFlusherThread(LPVOID) {
+        ULONGLONG lastStats = GetTickCount64();
+        uint64_t lastEvents = 0;
+        bool dumpWasSet = false;
+        for (;;) {
+            WaitForSingleObject(g_logWake, 500);
+            LogFlushNow();
+            bool stop = g_logStop.load();
+            bool dump = g_statsDump && WaitForSingleObject(g_statsDump, 0) == WAIT_OBJECT_0;
+            ULONGLONG now = GetTickCount64();
+            if (dump && !dumpWasSet) StatsWriteNow("dump", true, &lastEvents);
+            else if (stop) StatsWriteNow("exit", false, &lastEvents);
+            else if (g_statsIntervalMs && now - lastStats >= g_statsIntervalMs) {
+                StatsWriteNow("interval", false, &lastEvents);
+                lastStats = now;
+            }
+            dumpWasSet = dump;
+            if (stop) break;
+        }
+        FreeLibraryAndExitThread(g_hInstance, 0);
+    }
+
+    // Start the flusher unless it is running. One that was asked to stop (LogStop) is waited for
+    // first: it still drains the ring, and a new one must not start draining beside it.
+    void LogEnsureStarted() {
+        if (g_logRunning.load(std::memory_order_acquire)) return;
+        std::lock_guard<std::mutex> lk(g_logStateMutex);
+        std::call_once(g_logConfigOnce, LogReadConfig);
+        if (g_logRunning.load()) return;
+        if (g_logThread) {
+            WaitForSingleObject(g_logThread, INFINITE);
+            CloseHandle(g_logThread);
+            g_logThread = nullptr;
+        }
+        if (!g_logWake) g_logWake = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!g_statsDump) g_statsDump = CreateEventW(nullptr, TRUE, FALSE, kDumpStatsEvent);
+        if (!g_statsDump) g_statsDump = OpenEventW(SYNCHRONIZE, FALSE, kDumpStatsEvent); // created by an elevated tool
+        HMODULE self = nullptr;
+        if (!g_logWake || !GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+                                              (LPCWSTR)&LogFlusherThread, &self)) return;
+        g_logStop = false;
+        g_logThread = CreateThread(nullptr, 0, LogFlusherThread, nullptr, 0, nullptr);
+        if (!g_logThread) { FreeLibrary(self); return; }
+        g_logRunning.store(true, std::memory_order_release);
+    }
+
+    // Ask the flusher to write what is left and exit. Called when COM may unload the DLL.
+    void LogStop() {
+        std::lock_guard<std::mutex> lk(g_logStateMutex);
+        if (!g_logRunning.load()) return;
+        g_logStop = true;
+        g_logRunning = false;
+        SetEvent(g_logWake);
+    }
+
+    void LogWrite(LogLevel level, const wchar_t* fmt, ...) {
+        LogEnsureStarted();
+        if ((int)level < g_logMinLevel.load(std::memory_order_relaxed)) return;
+        FILETIME ft; GetSystemTimeAsFileTime(&ft);
+        uint64_t time = ((uint64_t)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+        va_list ap; va_start(ap, fmt);
+        bool pushed = g_logRing.Push(level, time, [&](wchar_t* buf, size_t cap) {
+            StringCchVPrintfW(buf, cap, fmt, ap); // truncates long records
+            size_t len = 0;
+            StringCchLengthW(buf, cap, &len);
+            return len;
+        });
+        va_end(ap);
+        if (pushed && g_logRing.Pending() >= g_logRing.capacity() / 2) SetEvent(g_logWake);
+    }
 }
 
+#define LOG_ERROR(...) LogWrite(LogLevel::Error, __VA_ARGS__)
+#define LOG_WARN(...)  LogWrite(LogLevel::Warn, __VA_ARGS__)
+#define LOG_INFO(...)  LogWrite(LogLevel::Info, __VA_ARGS__)
+#if XBOXTIP_LOG_DEBUG
+#define LOG_DEBUG(...) LogWrite(LogLevel::Debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
 // ---------------- DllMain ----------------
 // DllMain is the entry point for a DLL. We use it to save our instance handle.
 BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserved) {
@@ -100,10 +341,161 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
 // -------------- TXT UTF-8: reading and caching --------------
 // This namespace handles reading, parsing, and caching the ID -> Name mapping file.
 namespace {
-    std::unordered_map<std::wstring, std::wstring> g_cache; // ID -> Name
-    FILETIME g_lastWrite = {};
+    // Identity of the mapping file: enough to tell whether it changed without reading it.
+    struct FileStamp {
+        ULONGLONG size = 0;
+        FILETIME writeTime = {};
+        DWORD volume = 0;
+        ULONGLONG fileId = 0;
+    };
+
+    bool SameStamp(const FileStamp& a, const FileStamp& b) {
+        return a.size == b.size && CompareFileTime(&a.writeTime, &b.writeTime) == 0 &&
+               a.volume == b.volume && a.fileId == b.fileId;
+    }
+
+    FileStamp StampFromInfo(const BY_HANDLE_FILE_INFORMATION& info) {
+        FileStamp st;
+        st.size = ((ULONGLONG)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+        st.writeTime = info.ftLastWriteTime;
+        st.volume = info.dwVolumeSerialNumber;
+        st.fileId = ((ULONGLONG)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+        return st;
+    }
+
+    // Revalidation settings, read once from HKLM\SOFTWARE\XboxTitleIdInfoTip:
+    //   RevalidateMs (DWORD) - minimum interval between metadata checks, default 2000.
+    //   WatchMapping (DWORD) - nonzero: only check the system list after a change notification
+    //                          on its folder (the per-user and share lists stay on the interval).
+    //   ShareLayers (DWORD)  - zero: ignore XboxTitleIDs.txt at the root of network shares.
+    //   LoadAsync (DWORD)    - zero: load the mapping files on the first hover, which waits for it.
+    //   LoadWaitMs (DWORD)   - how long a hover may wait for the background load, default 0.
+    //   MatchInName (DWORD)  - where else title IDs are looked for when the item's name is not one:
+    //                          0 nowhere, 1 inside its name (default), 2 anywhere in its path.
+    //   MatchPolicy (DWORD)  - which of several known IDs wins: 0 the last (default), 1 the first,
+    //                          2 none (only a name with a single known ID matches).
+    //   MatchDelimiters (SZ) - ASCII characters that may border an ID inside a longer name.
+    //   SharedTable (DWORD)  - nonzero: keep one compiled system list per session in shared memory
+    //                          for every process that loads the handler, instead of one each.
+    //   TipDetails (DWORD)   - zero: the tooltip is the name alone, without platform, publisher,
+    //                          region and year lines.
+    //   CompactShares (DWORD) - nonzero: keep the share lists in compact form (TitleCompact.h).
+    struct RevalidateConfig {
+        DWORD ttlMs = 2000;
+        bool watch = false;
+        bool shares = true;
+        bool async = true;
+        DWORD waitMs = 0;
+        DWORD matchScope = 1;
+        titledb::TitleScanner scanner;
+        bool shared = false;
+        bool details = true;
+        bool compactShares = false;
+    };
+
+    // Compiled index (XboxTitleIDs.bin) mapped read-only; takes the place of the table when fresh.
+    struct MappedIndex {
+        HANDLE mapping = nullptr;
+        const void* view = nullptr;
+        titledb::IndexView index;
+    };
+
+    void UnmapIndex(MappedIndex& m);
+
+    // One mapping file. Built once and never modified; generations share unchanged layers.
+    struct TitleLayer {
+        FileStamp stamp;                 // text file this layer reflects (zero if none)
+        titledb::IncrementalTable table; // packed ID -> Name, when parsed from text
+        MappedIndex index;               // used instead of table when open (system layer only)
+        std::unique_ptr<const titledb::SharedTable> shared; // owns the view index reads in SharedTable mode
+        std::unique_ptr<const titledb::PublisherTable> compact; // CompactShares: the names, in place of table
+        titledb::TitleMetaTable meta;    // optional columns of the text file, whichever form holds the names
+
+        TitleLayer() = default;
+        TitleLayer(const TitleLayer&) = delete;
+        TitleLayer& operator=(const TitleLayer&) = delete;
+        ~TitleLayer() { UnmapIndex(index); }
+
+        // A compact layer rebuilds the name into a buffer of the calling thread, valid until the
+        // thread's next Find in a compact layer. The buffer keeps its capacity, so only the first
+        // long names allocate.
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            if (compact) {
+                thread_local std::u16string buffer;
+                if (!compact->Find(key, buffer)) return false;
+                *name = buffer.data();
+                *len = buffer.size();
+                return true;
+            }
+            return index.index.IsOpen() ? index.index.Find(key, name, len) : table.Find(key, name, len);
+        }
+        bool Contains(uint64_t key) const {
+            const char16_t* name; size_t len;
+            return compact ? compact->Contains(key) : Find(key, &name, &len);
+        }
+        size_t Size() const { return compact ? compact->Size() : index.index.IsOpen() ? index.index.Size() : table.Size(); }
+
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            if (compact) compact->ForEach(fn);
+            else if (index.index.IsOpen()) index.index.ForEach(fn);
+            else table.ForEach(fn);
+        }
+        // Names at stable offsets, for the merge. Compact layers have none and are never merged.
+        const char16_t* NameData() const { return index.index.IsOpen() ? index.index.NameData() : table.NameData(); }
+    };
+
+    // Base layers, lowest first; a later layer's name wins.
+    enum : size_t { kSystemLayer, kUserLayer, kBaseLayers };
+
+    // System and per-user layers merged into one table, plus a filter over its keys.
+    struct MergedTitles {
+        titledb::LayeredTable<TitleLayer> table;
+        titledb::KeyFilter filter; // every key in table; rejects unknown IDs cheaply
+
+        void BuildFilter() {
+            filter.Reset(table.Size());
+            table.ForEach([&](uint64_t key, const char16_t*, size_t) { filter.Add(key); });
+        }
+    };
+
+    // XboxTitleIDs.txt at the root of a network share. Which share applies depends on the item,
+    // so these are consulted ahead of the merged table rather than merged into it.
+    struct ShareOverlay {
+        std::wstring root;                       // \\server\share or a mapped drive (X:)
+        std::shared_ptr<const TitleLayer> layer; // nullptr: the share has no mapping file
+
+        bool Is(std::wstring_view other) const {
+            return CompareStringOrdinal(root.c_str(), (int)root.size(), other.data(), (int)other.size(), TRUE) == CSTR_EQUAL;
+        }
+    };
+
+    constexpr size_t kMaxShares = 16;
+
+    // One generation of the mapping. Built off to the side, then published whole and never
+    // modified, so lookups need no lock and never see a half-built table. Copying one is cheap:
+    // layers and the merged table are shared, not duplicated.
+    struct TitleSnapshot {
+        std::shared_ptr<const MergedTitles> merged;
+        std::vector<ShareOverlay> shares;
+
+        const TitleLayer* BaseLayer(size_t i) const {
+            return merged && i < merged->table.LayerCount() ? merged->table.GetLayer(i).get() : nullptr;
+        }
+        const ShareOverlay* FindShare(std::wstring_view root) const {
+            for (const ShareOverlay& s : shares) if (s.Is(root)) return &s;
+            return nullptr;
+        }
+    };
+
+    titledb::SnapshotCell<TitleSnapshot> g_snapshot;
+    RevalidateConfig g_config;
+    titledb::RevalidateClock g_revalidate; // RevalidateMs between metadata checks
+    std::atomic<HANDLE> g_watch{nullptr}; // FindFirstChangeNotification handle when WatchMapping is set
     std::once_flag g_once;
-    std::mutex g_mutex;
+    std::mutex g_loadMutex; // serializes loaders; lookups never take it
+    titledb::Warmup g_warmup; // the first load, run in the background unless LoadAsync is 0
+    titledb::SharedTitles g_shared("Local\\XboxTitleIdInfoTip.Titles.v1"); // open in SharedTable mode
 
     // Get the path to System32
     std::wstring GetSystem32Path() {
@@ -121,180 +513,764 @@ namespace {
         return p;
     }
 
-    // Check if a string is a valid 8-character uppercase alphanumeric ID
-    bool Is8UpperAlnum(std::wstring s) {
-        if (s.size() != 8) return false;
-        for (auto& ch : s) {
-            if (ch >= L'a' && ch <= L'z') ch = (wchar_t)(ch - L'a' + L'A');
-            if (!((ch >= L'0' && ch <= L'9') || (ch >= L'A' && ch <= L'Z'))) return false;
+    // Per-user overrides: %APPDATA%\XboxTitleIdInfoTip\XboxTitleIDs.txt (empty if unknown)
+    std::wstring GetUserMappingPath() {
+        wchar_t buf[MAX_PATH];
+        DWORD n = ExpandEnvironmentStringsW(L"%APPDATA%\\XboxTitleIdInfoTip\\XboxTitleIDs.txt", buf, MAX_PATH);
+        if (n == 0 || n > MAX_PATH || buf[0] == L'%') return L"";
+        return std::wstring(buf);
+    }
+
+    std::wstring GetLayerPath(size_t layer) {
+        return layer == kSystemLayer ? GetMappingPath() : GetUserMappingPath();
+    }
+
+    // Root of the network share holding path: \\server\share, or X: for a mapped network
+    // drive. Empty for local paths. A view into path.
+    std::wstring_view GetShareRoot(std::wstring_view path) {
+        if (path.size() > 2 && path[0] == L'\\' && path[1] == L'\\' && path[2] != L'?' && path[2] != L'.') {
+            size_t server = path.find(L'\\', 2);
+            if (server == std::wstring_view::npos) return {};
+            size_t share = path.find(L'\\', server + 1);
+            return path.substr(0, share);
+        }
+        if (path.size() >= 2 && path[1] == L':') {
+            wchar_t drive[4] = { path[0], L':', L'\\', 0 };
+            if (GetDriveTypeW(drive) == DRIVE_REMOTE) return path.substr(0, 2);
+        }
+        return {};
+    }
+
+    // The share root of an item's path, asked for (GetShareRoot, a drive type query for a drive
+    // letter) at most once per hover and only once something needs it: finding the item's ID and
+    // looking up its name share one.
+    class ItemShare {
+    public:
+        explicit ItemShare(std::wstring_view path) : m_path(path) {}
+
+        std::wstring_view Root() {
+            if (!m_resolved) {
+                m_root = GetShareRoot(m_path);
+                m_resolved = true;
+            }
+            return m_root;
+        }
+
+    private:
+        std::wstring_view m_path;
+        std::wstring_view m_root;
+        bool m_resolved = false;
+    };
+
+    std::wstring GetShareMappingPath(const std::wstring& root) {
+        return root + L"\\XboxTitleIDs.txt";
+    }
+
+    // Get the full path to the compiled index (see XboxTitleTool compile)
+    std::wstring GetIndexPath() {
+        std::wstring p = GetSystem32Path();
+        if (!p.empty() && p.back() != L'\\') p.push_back(L'\\');
+        p += L"XboxTitleIDs.bin";
+        return p;
+    }
+
+    // Read the revalidation settings; missing values keep the defaults.
+    RevalidateConfig ReadRevalidateConfig() {
+        RevalidateConfig cfg;
+        DWORD value = 0, cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"RevalidateMs",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.ttlMs = value;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"WatchMapping",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.watch = value != 0;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"ShareLayers",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.shares = value != 0;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"LoadAsync",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.async = value != 0;
         }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"LoadWaitMs",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.waitMs = value;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"MatchInName",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.matchScope = value;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"MatchPolicy",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS && value <= titledb::TitleScanner::OnlyKnown) {
+            cfg.scanner.SetPolicy((titledb::TitleScanner::Policy)value);
+        }
+        wchar_t delims[64];
+        cb = sizeof(delims);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"MatchDelimiters",
+                         RRF_RT_REG_SZ, nullptr, delims, &cb) == ERROR_SUCCESS) {
+            std::string ascii;
+            for (const wchar_t* d = delims; *d; ++d) if (*d < 128) ascii.push_back((char)*d);
+            cfg.scanner.SetDelimiters(ascii);
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"SharedTable",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.shared = value != 0;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"TipDetails",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.details = value != 0;
+        }
+        cb = sizeof(value);
+        if (RegGetValueW(HKEY_LOCAL_MACHINE, L"SOFTWARE\\XboxTitleIdInfoTip", L"CompactShares",
+                         RRF_RT_REG_DWORD, nullptr, &value, &cb) == ERROR_SUCCESS) {
+            cfg.compactShares = value != 0;
+        }
+        return cfg;
+    }
+
+    // Stat a file without reading its contents
+    bool StatFile(const std::wstring& path, FileStamp* out) {
+        HANDLE h = CreateFileW(path.c_str(), FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return false;
+        BY_HANDLE_FILE_INFORMATION info{};
+        BOOL ok = GetFileInformationByHandle(h, &info);
+        CloseHandle(h);
+        if (!ok) return false;
+        *out = StampFromInfo(info);
         return true;
     }
 
-    // Read all bytes from a file
-    std::string ReadAllBytes(const std::wstring& path, FILETIME* outWriteTime) {
-        std::string data;
+    // The bytes of a mapping file, for parsing. Local files are mapped read-only, so the text is
+    // never copied and only the parsed table takes private memory however large the file is.
+    // Files on a network share are read into memory instead: touching a view of a file whose
+    // share has gone away raises an in-page exception rather than failing a read. Files of 4 GB
+    // or more are refused (table offsets are 32-bit).
+    class FileBytes {
+    public:
+        FileBytes() = default;
+        FileBytes(const FileBytes&) = delete;
+        FileBytes& operator=(const FileBytes&) = delete;
+        ~FileBytes() { if (m_view) UnmapViewOfFile(m_view); }
+
+        const char* Data() const { return m_view ? static_cast<const char*>(m_view) : m_heap.data(); }
+        size_t Size() const { return m_size; }
+
+        bool Open(const std::wstring& path, FileStamp* outStamp) {
+            HANDLE h = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                   nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (h == INVALID_HANDLE_VALUE) return false;
+            BY_HANDLE_FILE_INFORMATION info{};
+            if (GetFileInformationByHandle(h, &info) && outStamp) *outStamp = StampFromInfo(info);
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(h, &size) || size.QuadPart <= 0 || size.QuadPart >= 0xFFFFFFFFLL) {
+                if (size.QuadPart > 0) LOG_WARN(L"[Parse] %s is too large (%lld bytes)", path.c_str(), (long long)size.QuadPart);
+                CloseHandle(h);
+                return false;
+            }
+            m_size = static_cast<size_t>(size.QuadPart);
+            bool ok;
+            if (GetShareRoot(path).empty()) {
+                HANDLE mapping = CreateFileMappingW(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping) {
+                    m_view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    CloseHandle(mapping); // the view keeps the mapping
+                }
+                ok = m_view != nullptr;
+            } else {
+                m_heap.resize(m_size);
+                size_t done = 0;
+                DWORD read = 0;
+                while (done < m_size && ReadFile(h, &m_heap[done], (DWORD)(m_size - done), &read, nullptr) && read) done += read;
+                m_heap.resize(done);
+                m_size = done;
+                ok = done > 0;
+            }
+            CloseHandle(h);
+            return ok;
+        }
+
+    private:
+        void* m_view = nullptr;
+        std::string m_heap;
+        size_t m_size = 0;
+    };
+
+    // The first cap bytes of a file, fewer only at its end; 0 if it cannot be read.
+    size_t ReadFileHead(const std::wstring& path, char* buf, size_t cap) {
         HANDLE h = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
-        if (h == INVALID_HANDLE_VALUE) return data;
-        BY_HANDLE_FILE_INFORMATION info{};
-        if (GetFileInformationByHandle(h, &info) && outWriteTime) *outWriteTime = info.ftLastWriteTime;
-        LARGE_INTEGER size{}; if (!GetFileSizeEx(h, &size)) { CloseHandle(h); return data; }
-        if (size.QuadPart <= 0 || size.QuadPart > 10LL * 1024 * 1024) { CloseHandle(h); return data; } // 10MB cap
-        std::vector<char> buf(static_cast<size_t>(size.QuadPart));
-        DWORD read = 0; BOOL ok = ReadFile(h, buf.data(), (DWORD)buf.size(), &read, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return 0;
+        size_t done = 0;
+        DWORD read = 0;
+        while (done < cap && ReadFile(h, buf + done, (DWORD)(cap - done), &read, nullptr) && read) done += read;
         CloseHandle(h);
-        if (!ok) return std::string();
-        return std::string(buf.data(), buf.data() + read);
+        return done;
+    }
+
+    void UnmapIndex(MappedIndex& m) {
+        if (m.view) UnmapViewOfFile(m.view);
+        if (m.mapping) CloseHandle(m.mapping);
+        m = MappedIndex();
+    }
+
+    // Map the compiled index. It is only accepted if it was compiled from the text file as it
+    // is now (same size and write time); with no text file at all, any valid index is used.
+    bool MapIndex(const std::wstring& path, const FileStamp* source, MappedIndex* out) {
+        HANDLE h = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(h, &size) || size.QuadPart < (LONGLONG)sizeof(titledb::IndexHeader)) { CloseHandle(h); return false; }
+        MappedIndex m;
+        m.mapping = CreateFileMappingW(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(h); // the mapping keeps the file open
+        if (!m.mapping) return false;
+        m.view = MapViewOfFile(m.mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!m.view || !m.index.Open(m.view, (size_t)size.QuadPart)) {
+            UnmapIndex(m);
+            return false;
+        }
+        if (source) {
+            ULONGLONG wt = ((ULONGLONG)source->writeTime.dwHighDateTime << 32) | source->writeTime.dwLowDateTime;
+            const titledb::IndexHeader* hdr = m.index.Header();
+            if (hdr->sourceSize != source->size || hdr->sourceWriteTime != wt) {
+                LOG_INFO(L"[Index] %s is stale, using text file", path.c_str());
+                UnmapIndex(m);
+                return false;
+            }
+        }
+        *out = m;
+        return true;
+    }
+
+    // Whether the file holds exactly the list compiled into the handler (see TitleEmbedded.h).
+    // Only a file of the same size is read, and then only hashed.
+    bool IsEmbeddedSource(const std::wstring& path, const FileStamp& stamp) {
+        if (stamp.size != titledb::kEmbeddedTitles.SourceSize()) return false;
+        FileBytes bytes;
+        return bytes.Open(path, nullptr) && titledb::kEmbeddedTitles.IsSource(bytes.Data(), bytes.Size());
+    }
+
+    titledb::SharedTag SharedTagOf(const FileStamp& st) {
+        titledb::SharedTag tag;
+        tag.v[0] = st.size;
+        tag.v[1] = ((ULONGLONG)st.writeTime.dwHighDateTime << 32) | st.writeTime.dwLowDateTime;
+        tag.v[2] = st.volume;
+        tag.v[3] = st.fileId;
+        return tag;
+    }
+
+    // SharedTable mode: map the table another process compiled from the system list as it is now,
+    // or compile it and publish it for the others. False (the caller parses privately) if neither
+    // works.
+    bool AttachShared(const std::wstring& path, TitleLayer* layer) {
+        titledb::SharedTag want = SharedTagOf(layer->stamp);
+        auto table = g_shared.Attach();
+        bool built = false;
+        if (!table || table->Tag() != want) {
+            table = g_shared.Publish(want, [&](std::vector<unsigned char>& image, titledb::SharedTag& tag) {
+                FileBytes bytes;
+                if (!bytes.Open(path, &layer->stamp)) return false;
+                tag = SharedTagOf(layer->stamp);
+                MetricTimer t(g_metrics, Metric::Parse);
+                return titledb::CompileIndex(bytes.Data(), bytes.Size(), tag.v[0], tag.v[1], image);
+            }, &built);
+        }
+        if (!table) {
+            g_metrics.Add(Metric::SharedFallbacks);
+            LOG_WARN(L"[Shared] Cannot attach or publish the shared table (error %lu); loading privately", GetLastError());
+            return false;
+        }
+        g_metrics.Add(built ? Metric::SharedPublishes : Metric::SharedAttaches);
+        LOG_INFO(L"[Shared] %s generation %llu (%u mappings)", built ? L"Published" : L"Attached",
+                 (unsigned long long)table->Generation(), (unsigned)table->Index().Size());
+        layer->index.index = table->Index();
+        layer->shared = std::move(table);
+        return true;
     }
 
-    // Convert a UTF-8 string to a wide character string
-    std::wstring Utf8ToWide(const std::string& s) {
-        if (s.empty()) return L"";
-        int needed = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, s.data(), (int)s.size(), nullptr, 0);
-        if (needed <= 0) return L"";
-        std::wstring w; w.resize(needed);
-        MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, s.data(), (int)s.size(), &w[0], needed);
-        return w;
+    // Decide whether this call should look at the mapping files' metadata. At most one
+    // thread per TTL interval wins.
+    bool ShouldRevalidate() {
+        return g_revalidate.ShouldCheck(GetTickCount64());
     }
 
-    // Parse the mapping file content and populate the cache
-    void ParseMappingLocked(const std::wstring& text) {
-        g_cache.clear();
-        size_t i = 0, n = text.size();
-        while (i < n) {
-            size_t ls = i;
-            while (i < n && text[i] != L'\n' && text[i] != L'\r') ++i;
-            size_t le = i;
-            if (i < n && text[i] == L'\r') ++i;
-            if (i < n && text[i] == L'\n') ++i;
+    // In watch mode the system list is only checked after a change notification on System32.
+    bool SystemFolderChanged() {
+        HANDLE watch = g_watch.load();
+        if (!watch) return true;
+        if (WaitForSingleObject(watch, 0) != WAIT_OBJECT_0) return false;
+        FindNextChangeNotification(watch);
+        return true;
+    }
 
-            if (le <= ls) continue;
-            std::wstring line = text.substr(ls, le - ls);
+    // Close the change notification when COM may unload the DLL. Should the handler be used
+    // again after all, the system list is checked every RevalidateMs like the others.
+    void WatchStop() {
+        if (HANDLE watch = g_watch.exchange(nullptr)) FindCloseChangeNotification(watch);
+    }
 
-            if (ls == 0 && !line.empty() && line[0] == 0xFEFF) line.erase(0, 1);
+    // How LoadLayer built a layer from the one it replaces. When patched, every name outside
+    // `keys` sits where it did in the previous layer, so the merge only revisits `keys`.
+    struct LayerDelta {
+        bool patched = false;
+        std::vector<uint64_t> keys;
+    };
 
-            auto lpos = line.find_first_not_of(L" \t");
-            if (lpos == std::wstring::npos) continue;
-            auto rpos = line.find_last_not_of(L" \t");
-            std::wstring trimmed = line.substr(lpos, rpos - lpos + 1);
-            if (trimmed.empty()) continue;
-            if (trimmed[0] == L'#' || trimmed[0] == L';') continue;
+    // The optional columns of a mapping file (TitleMeta.h), whatever form the layer keeps its names
+    // in. Unless the caller has the bytes already, only the head of the file is read to see whether
+    // it declares columns, and the file is opened whole only when it does.
+    void LoadMeta(const std::wstring& path, TitleLayer* layer, const FileBytes* bytes = nullptr) {
+        if (bytes) {
+            layer->meta.LoadUtf8(bytes->Data(), bytes->Size());
+        } else {
+            layer->meta.LoadFile([&](char* buf, size_t cap) { return ReadFileHead(path, buf, cap); },
+                                 [&](auto&& load) {
+                                     FileBytes own;
+                                     if (!own.Open(path, nullptr)) return false;
+                                     load(own.Data(), own.Size());
+                                     return true;
+                                 });
+        }
+        if (layer->meta.Size()) {
+            LOG_INFO(L"[Meta] %u titles with details, %u publishers in %s", (unsigned)layer->meta.Size(),
+                     (unsigned)layer->meta.PublisherCount(), path.c_str());
+        }
+    }
 
-            size_t eq = trimmed.find(L'=');
-            if (eq == std::wstring::npos) continue;
-            std::wstring id = trimmed.substr(0, eq);
-            std::wstring name = trimmed.substr(eq + 1);
+    // Read one mapping file into a layer, recording the stamp of the text it reflects. For the
+    // system layer a fresh compiled index is mapped instead of parsing, or in SharedTable mode the
+    // table compiled once for every process (see AttachShared). A text layer is built by bringing
+    // a copy of `previous` up to date, so an edit or an append only parses the blocks of the file
+    // that changed, for its names and for its columns. With compact, the parsed names are then
+    // moved into a PublisherTable (about a third of the memory, names rebuilt on lookup); such a
+    // layer cannot be merged and is reloaded in full. nullptr if unreadable.
+    std::shared_ptr<const TitleLayer> LoadLayer(const std::wstring& path, bool allowIndex,
+                                                const TitleLayer* previous = nullptr, LayerDelta* delta = nullptr,
+                                                bool compact = false) {
+        auto layer = std::make_shared<TitleLayer>();
+        bool haveText = StatFile(path, &layer->stamp);
+        if (allowIndex && haveText && IsEmbeddedSource(path, layer->stamp)) {
+            // The built-in list already answers for this file; the empty layer records its stamp.
+            g_metrics.Add(Metric::EmbeddedMatches);
+            LOG_INFO(L"[Embedded] %s is the built-in list (%u mappings), not parsed", path.c_str(),
+                     (unsigned)titledb::kEmbeddedTitles.Size());
+            LoadMeta(path, layer.get());
+            return layer;
+        }
+        if (allowIndex && MapIndex(GetIndexPath(), haveText ? &layer->stamp : nullptr, &layer->index)) {
+            if (!haveText) layer->stamp = FileStamp();
+            else LoadMeta(path, layer.get());
+            g_metrics.Add(Metric::IndexMaps);
+            LOG_INFO(L"[Index] Mapped %u mappings", (unsigned)layer->Size());
+            return layer;
+        }
+        if (allowIndex && haveText && g_shared.IsOpen() && AttachShared(path, layer.get())) {
+            LoadMeta(path, layer.get());
+            return layer;
+        }
+        if (!haveText) return nullptr;
+        FileBytes bytes;
+        if (!bytes.Open(path, &layer->stamp)) return nullptr;
+        bool incremental = previous && !previous->index.index.IsOpen() && !previous->compact;
+        if (incremental) layer->table = previous->table;
+        titledb::ReloadStats st;
+        std::vector<titledb::ReloadRecord> records; // what the reload re-read, for the columns
+        {
+            MetricTimer t(g_metrics, Metric::Parse);
+            layer->table.Load(bytes.Data(), bytes.Size(), &st, delta ? &delta->keys : nullptr, incremental ? &records : nullptr);
+        }
+        g_metrics.Add(st.kind == titledb::ReloadStats::Full ? Metric::Parses : Metric::IncrementalReloads);
+        if (delta) delta->patched = incremental && st.kind != titledb::ReloadStats::Full && layer->table.OffsetsStable();
+        if (st.kind == titledb::ReloadStats::Full) {
+            LOG_INFO(L"[Parse] Loaded %u mappings from %s", (unsigned)layer->table.Size(), path.c_str());
+        } else {
+            LOG_INFO(L"[Reload] %s: %hs, %u inserted, %u updated, %u deleted (%u of %u blocks parsed)", path.c_str(),
+                     st.KindName(), (unsigned)st.inserted, (unsigned)st.updated, (unsigned)st.deleted,
+                     (unsigned)st.blocksParsed, (unsigned)st.blocks);
+        }
+        if (incremental && st.kind != titledb::ReloadStats::Full) {
+            // Only the lines the reload re-read can have new columns.
+            layer->meta = previous->meta;
+            layer->meta.Patch(std::move(records));
+        } else {
+            LoadMeta(path, layer.get(), &bytes);
+        }
+        if (compact) {
+            size_t before = layer->table.MemoryBytes();
+            auto names = std::make_unique<titledb::PublisherTable>();
+            names->Build(layer->table);
+            layer->table = titledb::IncrementalTable();
+            LOG_INFO(L"[Compact] %s: %u mappings in %u KB instead of %u KB", path.c_str(), (unsigned)names->Size(),
+                     (unsigned)(names->MemoryBytes() / 1024), (unsigned)(before / 1024));
+            layer->compact = std::move(names);
+        }
+        return layer;
+    }
 
-            auto idl = id.find_first_not_of(L" \t");
-            auto idr = id.find_last_not_of(L" \t");
-            if (idl == std::wstring::npos) continue;
-            id = id.substr(idl, idr - idl + 1);
+    // Copy of the current generation to modify and publish. Caller holds g_loadMutex, so the
+    // current generation cannot be retired while it is being copied.
+    std::unique_ptr<TitleSnapshot> CopyCurrent() {
+        auto snap = g_snapshot.Read();
+        return snap ? std::make_unique<TitleSnapshot>(*snap.get()) : std::make_unique<TitleSnapshot>();
+    }
 
-            for (auto& ch : id) if (ch >= L'a' && ch <= L'z') ch = (wchar_t)(ch - L'a' + L'A');
+    // Reload the base layers whose bit is set in `changed` and publish a generation that
+    // reuses the others. The merged table is copied and only the reloaded layers are re-merged,
+    // so a change to the per-user list never re-parses the system list. A system list that
+    // cannot be read keeps its previous contents; a missing per-user list is dropped. A
+    // cancelled warm-up stops between layers and publishes nothing.
+    // Returns whether a system list is loaded.
+    bool LoadBaseLayers(unsigned changed) {
+        std::lock_guard<std::mutex> lk(g_loadMutex);
+        auto next = CopyCurrent();
+        auto merged = next->merged ? std::make_shared<MergedTitles>(*next->merged) : std::make_shared<MergedTitles>();
+        bool any = false;
+        for (size_t i = 0; i < kBaseLayers; ++i) {
+            if (g_warmup.Cancelled()) return false;
+            if (!(changed & (1u << i))) continue;
+            std::wstring path = GetLayerPath(i);
+            const TitleLayer* previous = i < merged->table.LayerCount() ? merged->table.GetLayer(i).get() : nullptr;
+            LayerDelta delta;
+            auto layer = path.empty() ? nullptr : LoadLayer(path, i == kSystemLayer, previous, &delta);
+            if (!layer && i == kSystemLayer) continue;
+            size_t touched = layer && delta.patched ? merged->table.UpdateLayer(i, std::move(layer), delta.keys)
+                                                    : merged->table.SetLayer(i, std::move(layer));
+            LOG_INFO(L"[Merge] Layer %u: %u entries changed, %u total", (unsigned)i, (unsigned)touched,
+                     (unsigned)merged->table.Size());
+            g_metrics.Add(Metric::LayerReloads);
+            any = true;
+        }
+        bool haveSystem = merged->table.LayerCount() > kSystemLayer && merged->table.GetLayer(kSystemLayer);
+        if (!any || g_warmup.Cancelled()) return haveSystem;
+        merged->BuildFilter();
+        g_metrics.Set(Metric::Mappings, merged->table.Size());
+        next->merged = std::move(merged);
+        g_snapshot.Publish(std::move(next));
+        return haveSystem;
+    }
 
-            if (!Is8UpperAlnum(id)) continue;
-            g_cache[id] = name;
+    // Load (or reload) the overlay for one share and publish it. The least recently added
+    // share is forgotten past kMaxShares.
+    void LoadShare(const std::wstring& root) {
+        std::lock_guard<std::mutex> lk(g_loadMutex);
+        auto next = CopyCurrent();
+        auto it = std::find_if(next->shares.begin(), next->shares.end(), [&](const ShareOverlay& s) { return s.Is(root); });
+        auto layer = LoadLayer(GetShareMappingPath(root), false, it != next->shares.end() ? it->layer.get() : nullptr,
+                               nullptr, g_config.compactShares);
+        if (it != next->shares.end()) {
+            it->layer = std::move(layer);
+        } else {
+            if (next->shares.size() >= kMaxShares) next->shares.erase(next->shares.begin());
+            next->shares.push_back({ root, std::move(layer) });
         }
-        LogLine(L"[Parse] Loaded %u mappings", (unsigned)g_cache.size());
+        g_metrics.Add(Metric::LayerReloads);
+        g_metrics.Set(Metric::Shares, next->shares.size());
+        g_snapshot.Publish(std::move(next));
     }
 
-    // Ensure the cache is loaded, and reload if the file has been modified.
-    void EnsureCacheLoaded() {
+    // What a generation holds for one file, copied out so files can be checked outside a read section.
+    using LoadedFile = titledb::LoadedStamp<FileStamp>;
+
+    LoadedFile Loaded(const TitleLayer* layer) {
+        LoadedFile f;
+        if (layer) { f.present = true; f.stamp = layer->stamp; }
+        return f;
+    }
+
+    // Whether a layer no longer matches its file; exists/now describe the file as it is.
+    bool LayerStale(const LoadedFile& loaded, bool exists, const FileStamp& now) {
+        return titledb::IsStale(loaded, exists, now, SameStamp);
+    }
+
+    // The first load of the system and per-user lists. Until it finishes, lookups are answered
+    // from the built-in list alone.
+    void RunInitialLoad() {
+        MetricTimer timer(g_metrics, Metric::Warmup);
+        g_revalidate.Restart(GetTickCount64());
+        bool haveSystem = LoadBaseLayers((1u << kBaseLayers) - 1);
+        if (g_warmup.Cancelled()) {
+            g_metrics.Add(Metric::WarmupCancels);
+            LOG_INFO(L"[Warmup] Load cancelled, the handler may be unloading");
+            g_warmup.Finish(false);
+            return;
+        }
+        if (!haveSystem) {
+            LOG_WARN(L"[Init] Mapping file not found: %s; using the built-in list (%u mappings)", GetMappingPath().c_str(),
+                     (unsigned)titledb::kEmbeddedTitles.Size());
+        }
+        g_warmup.Finish(true);
+    }
+
+    // Warm-up worker: runs the first load off the caller's thread. It holds a reference on this
+    // DLL so the module cannot be unloaded under it, and drops it on exit.
+    DWORD WINAPI WarmupThread(LPVOID) {
+        RunInitialLoad();
+        FreeLibraryAndExitThread(g_hInstance, 0);
+    }
+
+    // Read the settings and start the first load unless it is running or done: on a worker
+    // thread, or on this one if LoadAsync is 0 or the thread cannot be created (unless !mayBlock,
+    // when the load is left to the first lookup). Called when the module is first used and by
+    // every lookup until the load has finished, so a load cancelled by DllCanUnloadNow starts
+    // again if the handler is used after all.
+    void WarmupEnsureStarted(bool mayBlock) {
         std::call_once(g_once, [] {
-            FILETIME wt{}; auto bytes = ReadAllBytes(GetMappingPath(), &wt);
-            if (!bytes.empty()) {
-                std::wstring wide = Utf8ToWide(bytes);
-                std::lock_guard<std::mutex> lk(g_mutex);
-                g_lastWrite = wt;
-                ParseMappingLocked(wide);
-            } else {
-                LogLine(L"[Init] Mapping file not found: %s", GetMappingPath().c_str());
+            g_config = ReadRevalidateConfig();
+            g_revalidate.SetInterval(g_config.ttlMs);
+            if (g_config.watch) {
+                HANDLE watch = FindFirstChangeNotificationW(GetSystem32Path().c_str(), FALSE,
+                    FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+                if (watch != INVALID_HANDLE_VALUE) g_watch = watch;
+            }
+            if (g_config.shared && !g_shared.Open()) {
+                g_metrics.Add(Metric::SharedFallbacks);
+                LOG_WARN(L"[Shared] Cannot open the shared table section (error %lu); loading privately", GetLastError());
             }
         });
-        FILETIME wt{}; auto bytes = ReadAllBytes(GetMappingPath(), &wt);
-        if (!bytes.empty()) {
-            bool changed = CompareFileTime(&wt, &g_lastWrite) > 0;
-            if (changed) {
-                std::wstring wide = Utf8ToWide(bytes);
-                std::lock_guard<std::mutex> lk(g_mutex);
-                g_lastWrite = wt;
-                ParseMappingLocked(wide);
-                LogLine(L"[Reload] Mapping file reloaded");
+        if ((!g_config.async && !mayBlock) || !g_warmup.Start()) return;
+        if (g_config.async) {
+            HMODULE self = nullptr;
+            if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS, (LPCWSTR)&WarmupThread, &self)) {
+                HANDLE t = CreateThread(nullptr, 0, WarmupThread, nullptr, 0, nullptr);
+                if (t) { CloseHandle(t); return; }
+                FreeLibrary(self);
             }
+            LOG_WARN(L"[Warmup] Cannot start the loader thread (error %lu); loading on this thread", GetLastError());
         }
+        RunInitialLoad();
     }
 
-    // Lookup a name for a given ID.
-    std::wstring LookupName(std::wstring id) {
-        for (auto& ch : id) if (ch >= L'a' && ch <= L'z') ch = (wchar_t)(ch - L'a' + L'A');
-        EnsureCacheLoaded();
-        std::lock_guard<std::mutex> lk(g_mutex);
-        auto it = g_cache.find(id);
-        if (it == g_cache.end()) return L"";
-        return it->second;
+    // Ensure the cache is loaded, and reload any layer whose file has been modified.
+    // Between loads only each file's metadata (size, write time, file ID) is checked,
+    // and no more often than RevalidateMs. Returns false while the first load is still
+    // running after waiting up to LoadWaitMs for it (with LoadAsync 0, for as long as it takes).
+    bool EnsureCacheLoaded() {
+        if (!g_warmup.IsReady()) {
+            WarmupEnsureStarted(true);
+            if (!g_warmup.Wait(g_config.async ? g_config.waitMs : titledb::Warmup::kForever)) return false;
+        }
+        if (!ShouldRevalidate()) return true;
+        MetricTimer timer(g_metrics, Metric::Freshness);
+        g_metrics.Add(Metric::FreshnessChecks);
+
+        // Each layer is tracked on its own: only the files whose metadata changed are reloaded.
+        LoadedFile base[kBaseLayers];
+        std::vector<std::pair<std::wstring, LoadedFile>> shares;
+        uint64_t sharedGeneration = 0; // of the system layer, when it is the shared table
+        {
+            auto snap = g_snapshot.Read();
+            if (snap) {
+                for (size_t i = 0; i < kBaseLayers; ++i) base[i] = Loaded(snap->BaseLayer(i));
+                const TitleLayer* system = snap->BaseLayer(kSystemLayer);
+                if (system && system->shared) sharedGeneration = system->shared->Generation();
+                for (const ShareOverlay& s : snap->shares) shares.emplace_back(s.root, Loaded(s.layer.get()));
+            }
+        }
+
+        // Another process published a newer shared table: switch to it (or, if it was built from a
+        // different file than this process sees, build one that matches).
+        unsigned changed = sharedGeneration && g_shared.Generation() != sharedGeneration ? 1u << kSystemLayer : 0;
+        for (size_t i = 0; i < kBaseLayers; ++i) {
+            if (i == kSystemLayer && !SystemFolderChanged()) continue;
+            std::wstring path = GetLayerPath(i);
+            FileStamp st;
+            bool exists = !path.empty() && StatFile(path, &st);
+            if (i == kSystemLayer && !exists) continue; // keep the last good system list
+            if (LayerStale(base[i], exists, st)) changed |= 1u << i;
+        }
+        if (changed) {
+            LoadBaseLayers(changed);
+            LOG_INFO(L"[Reload] Mapping layers reloaded (mask %u)", changed);
+        }
+
+        for (auto& share : shares) {
+            FileStamp st;
+            bool exists = StatFile(GetShareMappingPath(share.first), &st);
+            if (LayerStale(share.second, exists, st)) {
+                LoadShare(share.first);
+                LOG_INFO(L"[Reload] Share mapping reloaded: %s", share.first.c_str());
+            }
+        }
+        return true;
     }
 
-    // Get default Windows tooltip for a file/folder
-    std::wstring GetDefaultTooltip(const std::wstring& path) {
+    // The lists of one generation a lookup for an item under root asks (TitleLookup.h): the share
+    // overlay for root, the merged system and per-user lists, then the list compiled into the
+    // handler, which stands in for the system list.
+    titledb::TitleSources<TitleLayer> SourcesOf(const TitleSnapshot* snap, std::wstring_view root) {
+        titledb::TitleSources<TitleLayer> src;
+        src.builtIn = &titledb::kEmbeddedTitles;
+        src.builtInLayer = kSystemLayer;
+        if (!snap) return src;
+        const ShareOverlay* share = root.empty() ? nullptr : snap->FindShare(root);
+        src.share = share ? share->layer.get() : nullptr;
+        if (snap->merged) {
+            src.merged = &snap->merged->table;
+            src.filter = &snap->merged->filter;
+        }
+        return src;
+    }
+
+    // The share overlay for root, loading it on first use.
+    void EnsureShareLoaded(std::wstring_view root) {
+        {
+            auto snap = g_snapshot.Read();
+            if (snap && snap->FindShare(root)) return;
+        }
+        LoadShare(std::wstring(root));
+    }
+
+    // Lookup a name for a packed title ID (see titledb::PackTitleId) for the item of share.
+    // A mapping file at the root of the item's network share overrides the merged system and
+    // per-user lists, and the list compiled into the handler answers for IDs none of the files
+    // has (titledb::LookupTitle). While the files are still loading, *pending is set and only the
+    // built-in list is asked: the answer may change once the files are in (an override, or an ID
+    // only they have).
+    // If found, calls fn(const char16_t* name, size_t len, const titledb::TitleMeta& meta) with the
+    // name where the table holds it and the title's details, valid only during the call (the
+    // generation cannot be retired under it), and returns true. Nothing is copied, formatted or
+    // allocated on the way, and the details are only looked up with TipDetails set.
+    template <class Fn>
+    bool LookupName(uint64_t key, ItemShare* share, bool* pending, Fn&& fn) {
+        MetricTimer timer(g_metrics, Metric::Lookup);
+        *pending = !EnsureCacheLoaded();
+        if (*pending) g_metrics.Add(Metric::PendingLookups);
+        std::wstring_view root = g_config.shares && !*pending ? share->Root() : std::wstring_view();
+        if (!root.empty()) EnsureShareLoaded(root);
+        auto snap = g_snapshot.Read();
+        bool embedded;
+        bool found = titledb::LookupTitle(SourcesOf(snap.get(), root), key, g_config.details, &embedded, fn);
+        if (embedded) g_metrics.Add(Metric::EmbeddedHits);
+        g_metrics.Add(found ? Metric::LookupHits : Metric::LookupMisses);
+        return found;
+    }
+
+    // The title ID an item's path stands for (titledb::TitleIdOfPath): its name when that is an ID
+    // by itself, or with MatchInName an ID inside the name or the path, the one MatchPolicy picks
+    // among those the current generation knows. The item's share is only asked for its root once
+    // there is such an ID to check, and overlays not loaded yet are not asked; LookupName loads
+    // them for the ID picked.
+    bool TitleIdOfItem(std::wstring_view path, ItemShare* share, uint64_t* key) {
+        WarmupEnsureStarted(false); // reads the settings
+        auto snap = g_snapshot.Read();
+        titledb::TitleSources<TitleLayer> src;
+        bool sourced = false;
+        auto known = [&](uint64_t k) {
+            if (!sourced) {
+                src = SourcesOf(snap.get(), g_config.shares && g_warmup.IsReady() ? share->Root() : std::wstring_view());
+                sourced = true;
+            }
+            const char16_t* name; size_t len;
+            bool embedded;
+            return titledb::FindTitle(src, k, &name, &len, &embedded);
+        };
+        titledb::PathMatch how;
+        bool found = titledb::TitleIdOfPath(path, g_config.matchScope, g_config.scanner, known, key, &how);
+        if (how.scanned) g_metrics.Add(Metric::NameScans);
+        if (how.inName) g_metrics.Add(Metric::NameScanHits);
+        return found;
+    }
+
+    // Default tooltips already built, by path. An entry is used only while the item keeps the
+    // write time and size it was built for (a date format change shows once the item changes).
+    titledb::TooltipCache<wchar_t> g_tooltipCache;
+
+    // Default Windows-style tooltip text for a file/folder with these attributes
+    std::wstring FormatDefaultTooltip(const std::wstring& path, const WIN32_FILE_ATTRIBUTE_DATA& fad) {
         std::wstring result;
-        
-        // Simple fallback using Win32 API only
-        WIN32_FILE_ATTRIBUTE_DATA fad;
-        if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &fad)) {
-            if (fad.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
-                result = L"File folder";
+        if (fad.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            result = L"File folder";
+        } else {
+            LARGE_INTEGER size;
+            size.LowPart = fad.nFileSizeLow;
+            size.HighPart = fad.nFileSizeHigh;
+            
+            wchar_t sizeStr[64];
+            if (size.QuadPart == 0) {
+                StringCchCopyW(sizeStr, 64, L"0 bytes");
+            } else if (size.QuadPart < 1024) {
+                StringCchPrintfW(sizeStr, 64, L"%lld bytes", size.QuadPart);
+            } else if (size.QuadPart < 1024 * 1024) {
+                StringCchPrintfW(sizeStr, 64, L"%.1f KB", size.QuadPart / 1024.0);
+            } else if (size.QuadPart < 1024LL * 1024 * 1024) {
+                StringCchPrintfW(sizeStr, 64, L"%.1f MB", size.QuadPart / (1024.0 * 1024.0));
             } else {
-                LARGE_INTEGER size;
-                size.LowPart = fad.nFileSizeLow;
-                size.HighPart = fad.nFileSizeHigh;
-                
-                wchar_t sizeStr[64];
-                if (size.QuadPart == 0) {
-                    StringCchCopyW(sizeStr, 64, L"0 bytes");
-                } else if (size.QuadPart < 1024) {
-                    StringCchPrintfW(sizeStr, 64, L"%lld bytes", size.QuadPart);
-                } else if (size.QuadPart < 1024 * 1024) {
-                    StringCchPrintfW(sizeStr, 64, L"%.1f KB", size.QuadPart / 1024.0);
-                } else if (size.QuadPart < 1024LL * 1024 * 1024) {
-                    StringCchPrintfW(sizeStr, 64, L"%.1f MB", size.QuadPart / (1024.0 * 1024.0));
-                } else {
-                    StringCchPrintfW(sizeStr, 64, L"%.1f GB", size.QuadPart / (1024.0 * 1024.0 * 1024.0));
-                }
-                result = sizeStr;
-                
-                // Get file extension and add it to tooltip
-                size_t dotPos = path.find_last_of(L'.');
-                if (dotPos != std::wstring::npos && dotPos > path.find_last_of(L"\\/")) {
-                    std::wstring ext = path.substr(dotPos + 1);
-                    if (!ext.empty()) {
-                        // Convert to uppercase
-                        for (auto& ch : ext) {
-                            if (ch >= L'a' && ch <= L'z') ch = (wchar_t)(ch - L'a' + L'A');
-                        }
-                        result = ext + L" file\r\n" + result;
-                    }
-                }
+                StringCchPrintfW(sizeStr, 64, L"%.1f GB", size.QuadPart / (1024.0 * 1024.0 * 1024.0));
             }
+            result = sizeStr;
             
-            // Add modified date
-            SYSTEMTIME st;
-            if (FileTimeToSystemTime(&fad.ftLastWriteTime, &st)) {
-                wchar_t dateStr[128];
-                if (GetDateFormatW(LOCALE_USER_DEFAULT, DATE_SHORTDATE, &st, nullptr, dateStr, 128) > 0) {
-                    wchar_t timeStr[64];
-                    if (GetTimeFormatW(LOCALE_USER_DEFAULT, TIME_NOSECONDS, &st, nullptr, timeStr, 64) > 0) {
-                        result += L"\r\nDate modified: ";
-                        result += dateStr;
-                        result += L" ";
-                        result += timeStr;
+            // Get file extension and add it to tooltip
+            size_t dotPos = path.find_last_of(L'.');
+            if (dotPos != std::wstring::npos && dotPos > path.find_last_of(L"\\/")) {
+                std::wstring ext = path.substr(dotPos + 1);
+                if (!ext.empty()) {
+                    // Convert to uppercase
+                    for (auto& ch : ext) {
+                        if (ch >= L'a' && ch <= L'z') ch = (wchar_t)(ch - L'a' + L'A');
                     }
+                    result = ext + L" file\r\n" + result;
+                }
+            }
+        }
+        
+        // Add modified date
+        SYSTEMTIME st;
+        if (FileTimeToSystemTime(&fad.ftLastWriteTime, &st)) {
+            wchar_t dateStr[128];
+            if (GetDateFormatW(LOCALE_USER_DEFAULT, DATE_SHORTDATE, &st, nullptr, dateStr, 128) > 0) {
+                wchar_t timeStr[64];
+                if (GetTimeFormatW(LOCALE_USER_DEFAULT, TIME_NOSECONDS, &st, nullptr, timeStr, 64) > 0) {
+                    result += L"\r\nDate modified: ";
+                    result += dateStr;
+                    result += L" ";
+                    result += timeStr;
                 }
             }
         }
         
         return result;
     }
+
+    // Get default Windows tooltip for a file/folder as a CoTaskMemAlloc'd string for GetInfoTip,
+    // or nullptr. Hovering an unchanged item again copies it out of g_tooltipCache.
+    LPWSTR GetDefaultTooltip(const std::wstring& path) {
+        MetricTimer timer(g_metrics, Metric::DefaultTooltip);
+        WIN32_FILE_ATTRIBUTE_DATA fad;
+        if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &fad)) return nullptr;
+        uint64_t writeTime = ((uint64_t)fad.ftLastWriteTime.dwHighDateTime << 32) | fad.ftLastWriteTime.dwLowDateTime;
+        uint64_t size = ((uint64_t)fad.nFileSizeHigh << 32) | fad.nFileSizeLow;
+        if (fad.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) size |= 1ULL << 63; // a folder never matches a file
+
+        LPWSTR tip = nullptr;
+        auto copy = [&](const wchar_t* text, size_t len) {
+            tip = (LPWSTR)CoTaskMemAlloc((len + 1) * sizeof(wchar_t));
+            if (!tip) return;
+            memcpy(tip, text, len * sizeof(wchar_t));
+            tip[len] = L'\0';
+        };
+        if (g_tooltipCache.Find(path.data(), path.size(), writeTime, size, copy)) {
+            g_metrics.Add(Metric::TooltipCacheHits);
+            return tip;
+        }
+        g_metrics.Add(Metric::TooltipCacheMisses);
+        std::wstring text = FormatDefaultTooltip(path, fad);
+        if (text.empty()) return nullptr;
+        g_tooltipCache.Insert(path.data(), path.size(), writeTime, size, text.data(), text.size());
+        copy(text.data(), text.size());
+        return tip;
+    }
 }
 
 // -------------- COM: IQueryInfo + IPersistFile + IShellExtInit --------------
@@ -335,7 +1311,7 @@ public:
     IFACEMETHODIMP IsDirty() override { return S_FALSE; }
     IFACEMETHODIMP Load(LPCOLESTR pszFileName, DWORD) override {
         m_path = pszFileName;
-        LogLine(L"[Init] (IPersistFile) Path = %s", m_path.c_str());
+        LOG_DEBUG(L"[Init] (IPersistFile) Path = %s", m_path.c_str());
         return S_OK;
     }
     IFACEMETHODIMP Save(LPCOLESTR, BOOL) override { return E_NOTIMPL; }
@@ -353,7 +1329,7 @@ public:
                 wchar_t szPath[MAX_PATH];
                 if (DragQueryFileW(hDrop, 0, szPath, MAX_PATH)) {
                     m_path = szPath;
-                    LogLine(L"[Init] (IShellExtInit) Path = %s", m_path.c_str());
+                    LOG_DEBUG(L"[Init] (IShellExtInit) Path = %s", m_path.c_str());
                 }
                 ReleaseStgMedium(&stg);
             }
@@ -370,72 +1346,65 @@ public:
     }
 
     IFACEMETHODIMP GetInfoTip(DWORD, LPWSTR* ppszTip) override {
-        LogLine(L"[Query] GetInfoTip called.");
+        LOG_DEBUG(L"[Query] GetInfoTip called.");
+        LogEnsureStarted(); // the flusher also writes the stats file
+        MetricTimer timer(g_metrics, Metric::InfoTip);
+        g_metrics.Add(Metric::InfoTipCalls);
         
         *ppszTip = nullptr;
         
         if (m_path.empty()) {
-            LogLine(L"[Query] Path is empty, returning E_FAIL.");
+            LOG_DEBUG(L"[Query] Path is empty, returning E_FAIL.");
             return E_FAIL;
         }
         
-        // Check if this is a directory first
-        DWORD attrs = GetFileAttributesW(m_path.c_str());
-        bool isDirectory = (attrs != INVALID_FILE_ATTRIBUTES) && (attrs & FILE_ATTRIBUTE_DIRECTORY);
-        
-        if (isDirectory) {
-            // Find the folder name
-            size_t pos = m_path.find_last_of(L"\\/");
-            std::wstring name;
-            if (pos != std::wstring::npos) {
-                name = m_path.substr(pos + 1);
-            } else {
-                name = m_path;
-            }
+        // Most items hovered are not title folders, so reject on the name alone before any
+        // filesystem work: length and character class (PackTitleId), or a known ID inside a
+        // longer name (TitleIdOfItem), then the snapshot's key filter and tables (LookupName).
+        // Only a known title pays for the directory check.
+        // The tooltip is formatted once, from the table and the title's details straight into the
+        // buffer returned to the shell; the directory check comes after the lookup has released the
+        // generation, and the rare file named like a known title frees the buffer again.
+        uint64_t key;
+        ItemShare share(m_path);
+        if (TitleIdOfItem(m_path, &share, &key)) {
+            LOG_DEBUG(L"[Query] Candidate Name: %s", titledb::LeafName<wchar_t>(m_path).data()); // the name ends the path
 
-            LogLine(L"[Query] Directory Name: %s", name.c_str());
-
-            // Check if it's a valid Xbox title ID
-            if (name.size() == 8) {
-                bool is_id = true;
-                for (wchar_t ch : name) {
-                    if (!((ch >= L'0' && ch <= L'9') || (ch >= L'A' && ch <= L'Z') || (ch >= L'a' && ch <= L'z'))) {
-                        is_id = false;
-                        break;
-                    }
-                }
-
-                if (is_id) {
-                    std::wstring lookupName = LookupName(name);
-                    if (!lookupName.empty()) {
-                        LogLine(L"[Query] Found Xbox title lookup: %s", lookupName.c_str());
-                        *ppszTip = (LPWSTR)CoTaskMemAlloc((lookupName.size() + 1) * sizeof(wchar_t));
-                        if (*ppszTip) {
-                            StringCchCopyW(*ppszTip, lookupName.size() + 1, lookupName.c_str());
-                            LogLine(L"[Query] Returning S_OK with Xbox title tooltip.");
-                            return S_OK;
-                        }
-                    }
+            bool pending = false;
+            LPWSTR tip = nullptr;
+            LookupName(key, &share, &pending, [&](const char16_t* title, size_t len, const titledb::TitleMeta& meta) {
+                tip = titledb::AllocTitleTip<wchar_t>(title, len, meta, [](size_t bytes) { return CoTaskMemAlloc(bytes); });
+            });
+            if (pending) LOG_DEBUG(L"[Query] Mapping files still loading; answered from the built-in list.");
+            if (tip) {
+                DWORD attrs = GetFileAttributesW(m_path.c_str());
+                bool isDirectory = (attrs != INVALID_FILE_ATTRIBUTES) && (attrs & FILE_ATTRIBUTE_DIRECTORY);
+                if (isDirectory) {
+                    LOG_DEBUG(L"[Query] Found Xbox title lookup: %s", tip);
+                    *ppszTip = tip;
+                    g_metrics.Add(Metric::TitleTips);
+                    LOG_DEBUG(L"[Query] Returning S_OK with Xbox title tooltip.");
+                    return S_OK;
                 }
+                CoTaskMemFree(tip);
             }
+        } else {
+            g_metrics.Add(Metric::NotTitleNames);
         }
         
         // If we get here, it's either not a directory, not an Xbox title ID, or no mapping found
         // Try to get the default Windows tooltip
-        LogLine(L"[Query] Not an Xbox title, trying to get default tooltip.");
-        std::wstring defaultTip = GetDefaultTooltip(m_path);
-        
-        if (!defaultTip.empty()) {
-            LogLine(L"[Query] Found default tooltip: %s", defaultTip.c_str());
-            *ppszTip = (LPWSTR)CoTaskMemAlloc((defaultTip.size() + 1) * sizeof(wchar_t));
-            if (*ppszTip) {
-                StringCchCopyW(*ppszTip, defaultTip.size() + 1, defaultTip.c_str());
-                LogLine(L"[Query] Returning S_OK with default tooltip.");
-                return S_OK;
-            }
+        LOG_DEBUG(L"[Query] Not an Xbox title, trying to get default tooltip.");
+        *ppszTip = GetDefaultTooltip(m_path);
+        if (*ppszTip) {
+            LOG_DEBUG(L"[Query] Found default tooltip: %s", *ppszTip);
+            g_metrics.Add(Metric::DefaultTips);
+            LOG_DEBUG(L"[Query] Returning S_OK with default tooltip.");
+            return S_OK;
         }
         
-        LogLine(L"[Query] No tooltip available, returning S_FALSE.");
+        g_metrics.Add(Metric::NoTips);
+        LOG_DEBUG(L"[Query] No tooltip available, returning S_FALSE.");
         return S_FALSE;
     }
 };
@@ -471,17 +1440,24 @@ public:
 // COM exports
 STDAPI DllGetClassObject(REFCLSID rclsid, REFIID riid, LPVOID* ppv) {
     if (rclsid != CLSID_XboxTitleIdInfoTip) return CLASS_E_CLASSNOTAVAILABLE;
+    WarmupEnsureStarted(false); // the mapping files load while the shell sets up the handler
     auto fact = new (std::nothrow) XboxTitleIdInfoTipFactory();
     if (!fact) return E_OUTOFMEMORY;
     HRESULT hr = fact->QueryInterface(riid, ppv);
     fact->Release();
     return hr;
 }
-STDAPI DllCanUnloadNow() { return (g_dllRefCount > 0) ? S_FALSE : S_OK; }
+STDAPI DllCanUnloadNow() {
+    if (g_dllRefCount > 0) return S_FALSE;
+    if (g_warmup.Cancel()) return S_FALSE; // the loader stops at its next layer; COM asks again later
+    WatchStop();
+    LogStop();
+    return S_OK;
+}
 
 // DllRegisterServer - The registration logic.
 STDAPI DllRegisterServer() {
-    LogLine(L"[Register] DllRegisterServer called.");
+    LOG_INFO(L"[Register] DllRegisterServer called.");
     
     // Register the CLSID for the shell extension
     HKEY hCLSID;
@@ -496,7 +1472,7 @@ STDAPI DllRegisterServer() {
         RegSetValueExW(hInProc, nullptr, 0, REG_SZ, (const BYTE*)modulePath, (lstrlenW(modulePath) + 1) * sizeof(wchar_t));
         RegSetValueExW(hInProc, L"ThreadingModel", 0, REG_SZ, (const BYTE*)L"Apartment", 20);
         RegCloseKey(hInProc);
-        LogLine(L"[Register] InProcServer32 path set to: %s", modulePath);
+        LOG_INFO(L"[Register] InProcServer32 path set to: %s", modulePath);
     }
     RegCloseKey(hCLSID);
     
@@ -516,7 +1492,7 @@ STDAPI DllRegisterServer() {
     if (RegCreateKeyExW(HKEY_CLASSES_ROOT, keyPath, 0, nullptr, 0, KEY_SET_VALUE, nullptr, &hExt, nullptr) == ERROR_SUCCESS) {
         RegSetValueExW(hExt, nullptr, 0, REG_SZ, (const BYTE*)CLSID_STR, (lstrlenW(CLSID_STR) + 1) * sizeof(wchar_t));
         RegCloseKey(hExt);
-        LogLine(L"[Register] Registered for all files");
+        LOG_INFO(L"[Register] Registered for all files");
     }
     
     // Register for directories
@@ -524,16 +1500,17 @@ STDAPI DllRegisterServer() {
     if (RegCreateKeyExW(HKEY_CLASSES_ROOT, keyPath, 0, nullptr, 0, KEY_SET_VALUE, nullptr, &hExt, nullptr) == ERROR_SUCCESS) {
         RegSetValueExW(hExt, nullptr, 0, REG_SZ, (const BYTE*)CLSID_STR, (lstrlenW(CLSID_STR) + 1) * sizeof(wchar_t));
         RegCloseKey(hExt);
-        LogLine(L"[Register] Registered for directories");
+        LOG_INFO(L"[Register] Registered for directories");
     }
     
     SHChangeNotify(SHCNE_ASSOCCHANGED, SHCNF_IDLIST, nullptr, nullptr);
+    LogFlushNow(); // regsvr32 exits right after this
     return S_OK;
 }
 
 // DllUnregisterServer - The unregistration logic.
 STDAPI DllUnregisterServer() {
-    LogLine(L"[Register] DllUnregisterServer called.");
+    LOG_INFO(L"[Register] DllUnregisterServer called.");
     
     // Unregister the CLSID
     RegDeleteTreeW(HKEY_CLASSES_ROOT, L"CLSID\\{A7C2C6B9-1B52-4E1E-9D56-2D2A9AB7D0C4}");
@@ -554,5 +1531,6 @@ STDAPI DllUnregisterServer() {
     RegDeleteTreeW(HKEY_CLASSES_ROOT, keyPath);
 
     SHChangeNotify(SHCNE_ASSOCCHANGED, SHCNF_IDLIST, nullptr, nullptr);
+    LogFlushNow(); // regsvr32 exits right after this
     return S_OK;
 }
\ No newline at end of file
@@ -0,0 +1,367 @@
+// XboxTitleTool.cpp – command-line companion to the InfoTip handler.
+//   XboxTitleTool compile <XboxTitleIDs.txt> [XboxTitleIDs.bin]
+//       Compile the text mapping into the binary index the handler maps at startup.
+//   XboxTitleTool embed <XboxTitleIDs.txt> <XboxTitleIDsEmbedded.h>
+//       Generate the header that compiles the list into the handler (see TitleEmbedded.h).
+//   XboxTitleTool resolve <dir> [--db file]... [--threads N] [--format csv|json]
+//       Find every title-ID folder under <dir> and print path, ID and name (CSV, or one JSON
+//       object per line), followed by a summary of unknown IDs on stderr. Repeating --db layers
+//       the files: a later file's names override an earlier one's.
+//   XboxTitleTool search <text> [--db file]... [--limit N] [--format csv|json]
+//       List the titles whose name contains <text> (ignoring case) with their IDs: exact names
+//       first, then names starting with <text>, then the rest.
+//   XboxTitleTool stats
+//       Ask every process running the handler to write its stats file now, then print the
+//       %TEMP%\XboxTip.stats.<pid>.json files (one JSON document per process).
+// Build (x64 Dev Prompt):
+//   cl /EHsc /permissive- /std:c++17 /O2 XboxTitleTool.cpp
+// Build (Linux):
+//   g++ -std=c++17 -O2 -pthread XboxTitleTool.cpp -o XboxTitleTool
+
+#include "TitleIndex.h"
+#include "TitleEmbedded.h"
+#include "TitleLayers.h"
+#include "BatchResolve.h"
+#include "TitleSearch.h"
+#include "PortableFile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    int Usage() {
+        std::fprintf(stderr,
+            "usage:\n"
+            "  XboxTitleTool compile <XboxTitleIDs.txt> [XboxTitleIDs.bin]\n"
+            "  XboxTitleTool embed <XboxTitleIDs.txt> <XboxTitleIDsEmbedded.h>\n"
+            "  XboxTitleTool resolve <dir> [--db file]... [--threads N] [--format csv|json]\n"
+            "  XboxTitleTool search <text> [--db file]... [--limit N] [--format csv|json]\n"
+            "  XboxTitleTool stats\n");
+        return 2;
+    }
+
+    int Embed(int argc, char** argv) {
+        if (argc != 4) return Usage();
+        std::string in = argv[2], out = argv[3];
+        std::string text, header;
+        if (!titledb::ReadFileBytes(in, text)) {
+            std::fprintf(stderr, "error: cannot read %s\n", in.c_str());
+            return 1;
+        }
+        size_t slash = in.find_last_of("\\/");
+        if (!titledb::WriteEmbeddedHeader(text.data(), text.size(), slash == std::string::npos ? in : in.substr(slash + 1), header)) {
+            std::fprintf(stderr, "error: %s is not valid UTF-8\n", in.c_str());
+            return 1;
+        }
+        // Leave an unchanged header alone so it does not trigger a rebuild.
+        std::string old;
+        if (titledb::ReadFileBytes(out, old) && old == header) return 0;
+        if (!titledb::WriteFileBytes(out, header.data(), header.size())) {
+            std::fprintf(stderr, "error: cannot write %s\n", out.c_str());
+            return 1;
+        }
+        std::printf("%s: %u bytes\n", out.c_str(), (unsigned)header.size());
+        return 0;
+    }
+
+    // Default output: the input path with its extension replaced by .bin
+    std::string DefaultIndexPath(const std::string& txt) {
+        size_t slash = txt.find_last_of("\\/");
+        size_t dot = txt.find_last_of('.');
+        if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return txt + ".bin";
+        return txt.substr(0, dot) + ".bin";
+    }
+
+    int Compile(int argc, char** argv) {
+        if (argc < 3 || argc > 4) return Usage();
+        std::string in = argv[2];
+        std::string out = argc == 4 ? argv[3] : DefaultIndexPath(in);
+
+        titledb::FileInfo info;
+        std::string text;
+        if (!titledb::StatPath(in, &info) || !titledb::ReadFileBytes(in, text)) {
+            std::fprintf(stderr, "error: cannot read %s\n", in.c_str());
+            return 1;
+        }
+        std::vector<unsigned char> image;
+        if (!titledb::CompileIndex(text.data(), text.size(), info.size, info.writeTime, image)) {
+            std::fprintf(stderr, "error: %s is not valid UTF-8\n", in.c_str());
+            return 1;
+        }
+        if (!titledb::WriteFileBytes(out, image.data(), image.size())) {
+            std::fprintf(stderr, "error: cannot write %s\n", out.c_str());
+            return 1;
+        }
+        titledb::IndexView view;
+        view.Open(image.data(), image.size());
+        std::printf("%s: %u titles, %u bytes\n", out.c_str(), (unsigned)view.Size(), (unsigned)image.size());
+        return 0;
+    }
+
+    // The title database a command works on: a compiled index (.bin) or a text mapping.
+    struct Database {
+        std::string image;
+        titledb::IndexView index;
+        titledb::TitleTable table;
+
+        bool Find(uint64_t key, const char16_t** name, size_t* len) const {
+            return index.IsOpen() ? index.Find(key, name, len) : table.Find(key, name, len);
+        }
+        size_t Size() const { return index.IsOpen() ? index.Size() : table.Size(); }
+
+        template <class Fn>
+        void ForEach(Fn&& fn) const {
+            if (index.IsOpen()) index.ForEach(fn);
+            else table.ForEach(fn);
+        }
+        const char16_t* NameData() const { return index.IsOpen() ? index.NameData() : table.NameData(); }
+    };
+
+    // The handler's own files when they exist, else XboxTitleIDs.txt in the current directory.
+    std::string DefaultDatabasePath() {
+#ifdef _WIN32
+        if (const char* root = std::getenv("SystemRoot")) {
+            titledb::FileInfo info;
+            std::string base = std::string(root) + "\\System32\\XboxTitleIDs";
+            if (titledb::StatPath(base + ".bin", &info)) return base + ".bin";
+            if (titledb::StatPath(base + ".txt", &info)) return base + ".txt";
+        }
+#endif
+        return "XboxTitleIDs.txt";
+    }
+
+    // A compiled index is read whole; a text file is parsed as it is read, so a large one
+    // never has to fit in memory besides its table.
+    bool LoadDatabase(const std::string& path, Database& db) {
+        titledb::FileReader reader(path);
+        char magic[4];
+        size_t got = 0;
+        if (!reader.IsOpen() || !reader(magic, sizeof(magic), &got)) {
+            std::fprintf(stderr, "error: cannot read %s\n", path.c_str());
+            return false;
+        }
+        if (got == sizeof(magic) && std::memcmp(magic, titledb::kIndexMagic, 4) == 0) {
+            if (!titledb::ReadFileBytes(path, db.image)) {
+                std::fprintf(stderr, "error: cannot read %s\n", path.c_str());
+                return false;
+            }
+            if (db.index.Open(db.image.data(), db.image.size())) return true;
+            std::fprintf(stderr, "error: %s is not a valid index\n", path.c_str());
+            return false;
+        }
+        if (!reader.Rewind()) {
+            std::fprintf(stderr, "error: cannot read %s\n", path.c_str());
+            return false;
+        }
+        if (db.table.LoadStream(reader)) return true;
+        std::fprintf(stderr, "error: %s could not be read or is not valid UTF-8\n", path.c_str());
+        return false;
+    }
+
+    // The --db files layered in order (the default database when there are none).
+    bool LoadLayers(std::vector<std::string> paths, titledb::LayeredTable<Database>& db) {
+        if (paths.empty()) paths.push_back(DefaultDatabasePath());
+        for (const std::string& path : paths) {
+            auto layer = std::make_shared<Database>();
+            if (!LoadDatabase(path, *layer)) return false;
+            db.SetLayer(db.LayerCount(), std::move(layer));
+        }
+        return true;
+    }
+
+    void AppendCsvField(std::string& out, const std::string& field) {
+        if (field.find_first_of(",\"\r\n") == std::string::npos) { out += field; return; }
+        out += '"';
+        for (char c : field) { if (c == '"') out += '"'; out += c; }
+        out += '"';
+    }
+
+    void AppendJsonString(std::string& out, const std::string& s) {
+        out += '"';
+        for (unsigned char c : s) {
+            if (c == '"' || c == '\\') { out += '\\'; out += char(c); }
+            else if (c < 0x20) { char buf[8]; std::snprintf(buf, sizeof(buf), "\\u%04x", c); out += buf; }
+            else out += char(c);
+        }
+        out += '"';
+    }
+
+    int Resolve(int argc, char** argv) {
+        if (argc < 3) return Usage();
+        std::string root = argv[2];
+        std::vector<std::string> dbPaths;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        bool json = false;
+        for (int i = 3; i < argc; ++i) {
+            if (!std::strcmp(argv[i], "--db") && i + 1 < argc) dbPaths.push_back(argv[++i]);
+            else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) threads = (unsigned)std::atoi(argv[++i]);
+            else if (!std::strcmp(argv[i], "--format") && i + 1 < argc) json = !std::strcmp(argv[++i], "json");
+            else return Usage();
+        }
+
+        titledb::LayeredTable<Database> db;
+        if (!LoadLayers(dbPaths, db)) return 1;
+
+        // Unknown IDs are counted for the summary; past kMaxUnknown distinct IDs only the total grows.
+        const size_t kMaxUnknown = 100000;
+        std::unordered_map<uint64_t, uint64_t> unknown;
+        uint64_t unknownTotal = 0;
+        std::string out;
+        if (!json) out = "path,id,name\n";
+
+        auto stats = titledb::ResolveTree(titledb::Utf8Path(root), threads,
+            [&](uint64_t key, const char16_t** name, size_t* len) { return db.Find(key, name, len); },
+            [&](const std::vector<titledb::ResolveHit>& batch) {
+                for (const auto& hit : batch) {
+                    char id[9] = {};
+                    titledb::UnpackTitleId(hit.key, id);
+                    std::string path = titledb::PathToUtf8(hit.path), name;
+                    if (hit.name) titledb::AppendUtf8(hit.name, hit.nameLen, name);
+                    else {
+                        ++unknownTotal;
+                        auto it = unknown.find(hit.key);
+                        if (it != unknown.end()) ++it->second;
+                        else if (unknown.size() < kMaxUnknown) unknown.emplace(hit.key, 1);
+                    }
+                    if (json) {
+                        out += "{\"path\": ";
+                        AppendJsonString(out, path);
+                        out += ", \"id\": \"";
+                        out += id;
+                        out += "\", \"name\": ";
+                        if (hit.name) AppendJsonString(out, name); else out += "null";
+                        out += "}\n";
+                    } else {
+                        AppendCsvField(out, path);
+                        out += ',';
+                        out += id;
+                        out += ',';
+                        AppendCsvField(out, name);
+                        out += '\n';
+                    }
+                }
+                std::fwrite(out.data(), 1, out.size(), stdout);
+                out.clear();
+            });
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        std::fflush(stdout);
+
+        std::fprintf(stderr, "%llu directories, %llu entries, %llu title folders, %llu known, %llu unknown, %llu errors\n",
+                     (unsigned long long)stats.directories, (unsigned long long)stats.entries,
+                     (unsigned long long)stats.matches, (unsigned long long)stats.known,
+                     (unsigned long long)unknownTotal, (unsigned long long)stats.errors);
+        std::vector<std::pair<uint64_t, uint64_t>> top(unknown.begin(), unknown.end());
+        std::sort(top.begin(), top.end(), [](const auto& a, const auto& b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        if (!top.empty()) std::fprintf(stderr, "unknown IDs (%zu distinct):\n", unknown.size());
+        for (size_t i = 0; i < top.size() && i < 50; ++i) {
+            char id[9] = {};
+            titledb::UnpackTitleId(top[i].first, id);
+            std::fprintf(stderr, "  %s  %llu\n", id, (unsigned long long)top[i].second);
+        }
+        return stats.errors ? 3 : 0;
+    }
+
+    int Search(int argc, char** argv) {
+        if (argc < 3) return Usage();
+        std::string text = argv[2];
+        std::vector<std::string> dbPaths;
+        size_t limit = 20;
+        bool json = false;
+        for (int i = 3; i < argc; ++i) {
+            if (!std::strcmp(argv[i], "--db") && i + 1 < argc) dbPaths.push_back(argv[++i]);
+            else if (!std::strcmp(argv[i], "--limit") && i + 1 < argc) limit = (size_t)std::strtoul(argv[++i], nullptr, 10);
+            else if (!std::strcmp(argv[i], "--format") && i + 1 < argc) json = !std::strcmp(argv[++i], "json");
+            else return Usage();
+        }
+        if (!titledb::IsValidUtf8(text.data(), text.size())) {
+            std::fprintf(stderr, "error: search text is not valid UTF-8\n");
+            return 2;
+        }
+        std::u16string query(text.size(), u'\0');
+        query.resize(titledb::ConvertUtf8(text.data(), text.size(), &query[0]));
+
+        titledb::LayeredTable<Database> db;
+        if (!LoadLayers(dbPaths, db)) return 1;
+        titledb::NameSearch<titledb::LayeredTable<Database>> search(db);
+        static const char* const kMatch[] = { "exact", "prefix", "substring" };
+        std::string out;
+        if (!json) out = "id,name,match\n";
+        for (const titledb::SearchHit& hit : search.Search(query.data(), query.size(), limit)) {
+            char id[9] = {};
+            titledb::UnpackTitleId(hit.key, id);
+            std::string name;
+            titledb::AppendUtf8(hit.name, hit.nameLen, name);
+            if (json) {
+                out += "{\"id\": \"";
+                out += id;
+                out += "\", \"name\": ";
+                AppendJsonString(out, name);
+                out += ", \"match\": \"";
+                out += kMatch[hit.match];
+                out += "\"}\n";
+            } else {
+                out += id;
+                out += ',';
+                AppendCsvField(out, name);
+                out += ',';
+                out += kMatch[hit.match];
+                out += '\n';
+            }
+        }
+        std::fwrite(out.data(), 1, out.size(), stdout);
+        return 0;
+    }
+
+    int Stats(int argc, char**) {
+        if (argc != 2) return Usage();
+#ifdef _WIN32
+        // The handler's flusher polls this event every 500 ms and writes once per set.
+        HANDLE dump = CreateEventW(nullptr, TRUE, FALSE, L"Local\\XboxTitleIdInfoTip.DumpStats");
+        if (dump) {
+            SetEvent(dump);
+            Sleep(1500);
+            ResetEvent(dump);
+            CloseHandle(dump);
+        }
+#endif
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        fs::path dir = fs::temp_directory_path(ec);
+        size_t found = 0;
+        for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            std::string name = it->path().filename().string();
+            if (name.compare(0, 14, "XboxTip.stats.") != 0 || name.size() < 19 || name.compare(name.size() - 5, 5, ".json") != 0) continue;
+            std::string text;
+            if (!titledb::ReadFileBytes(it->path().string(), text)) continue;
+            std::fwrite(text.data(), 1, text.size(), stdout);
+            ++found;
+        }
+        if (!found) {
+            std::fprintf(stderr, "no stats files in %s\n", dir.string().c_str());
+            return 1;
+        }
+        return 0;
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) return Usage();
+    if (std::strcmp(argv[1], "compile") == 0) return Compile(argc, argv);
+    if (std::strcmp(argv[1], "embed") == 0) return Embed(argc, argv);
+    if (std::strcmp(argv[1], "resolve") == 0) return Resolve(argc, argv);
+    if (std::strcmp(argv[1], "search") == 0) return Search(argc, argv);
+    if (std::strcmp(argv[1], "stats") == 0) return Stats(argc, argv);
+    return Usage();
+}
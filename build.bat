@@ -6,6 +6,8 @@ set "OUTDIR=%SCRIPT_DIR%build"
 set "OBJDIR=%OUTDIR%\obj"
 set "OBJ=%OBJDIR%\XboxTitleIdInfoTip.obj"
 set "DLL=%OUTDIR%\XboxTitleIdInfoTip.dll"
+set "TOOL_SRC=%SCRIPT_DIR%XboxTitleTool.cpp"
+set "TOOL=%OUTDIR%\XboxTitleTool.exe"
 
 rem --- Create build directories ---
 if not exist "%OUTDIR%" mkdir "%OUTDIR%"
@@ -26,6 +28,22 @@ if defined VSROOT (
   )
 )
 
+echo.
+echo [BUILD] Building XboxTitleTool.exe...
+cl /nologo /EHsc /permissive- /std:c++17 /O2 "%TOOL_SRC%" /Fo"%OBJDIR%\\" /Fe"%TOOL%"
+if errorlevel 1 (
+  echo [ERROR] Tool build failed.
+  exit /b 1
+)
+
+echo.
+echo [BUILD] Generating the built-in title list from XboxTitleIDs.txt...
+"%TOOL%" embed "%SCRIPT_DIR%XboxTitleIDs.txt" "%SCRIPT_DIR%XboxTitleIDsEmbedded.h"
+if errorlevel 1 (
+  echo [ERROR] Generating XboxTitleIDsEmbedded.h failed.
+  exit /b 1
+)
+
 echo.
 echo [BUILD] Compiling to OBJ...
 rem We are now compiling for a DLL with the /LD flag.
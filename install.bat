@@ -5,6 +5,8 @@ set "OUTDIR=%SCRIPT_DIR%build"
 set "DLL_SRC=%OUTDIR%\XboxTitleIdInfoTip.dll"
 set "DLL_DST=%SystemRoot%\System32\XboxTitleIdInfoTip.dll"
 set "MAP_DST=%SystemRoot%\System32\XboxTitleIDs.txt"
+set "IDX_DST=%SystemRoot%\System32\XboxTitleIDs.bin"
+set "TOOL=%OUTDIR%\XboxTitleTool.exe"
 set "MAP_SRC=%~1"
 
 rem --- Elevation check ---
@@ -59,6 +61,14 @@ if not exist "%MAP_DST%" (
 )
 
 :register
+rem --- Compiled index (optional; the DLL falls back to the text file) ---
+if exist "%TOOL%" if exist "%MAP_DST%" (
+  echo(
+  echo [INSTALL] Compiling mapping index...
+  "%TOOL%" compile "%MAP_DST%" "%IDX_DST%"
+  if errorlevel 1 echo [WARN] Index compile failed. The text mapping will be used.
+)
+
 echo(
 echo [REGISTER] Unregistering (refresh)...
 "%SystemRoot%\System32\regsvr32.exe" /u /s "%DLL_DST%" >nul
@@ -2,6 +2,7 @@
 setlocal enableextensions
 set "DLL_DST=%SystemRoot%\System32\XboxTitleIdInfoTip.dll"
 set "MAP_DST=%SystemRoot%\System32\XboxTitleIDs.txt"
+set "IDX_DST=%SystemRoot%\System32\XboxTitleIDs.bin"
 
 rem --- Elevation check ---
 net session >nul 2>&1
@@ -49,6 +50,7 @@ if errorlevel 2 (
   echo [INFO] Keeping mapping file.
 ) else (
   if exist "%MAP_DST%" del /F /Q "%MAP_DST%"
+  if exist "%IDX_DST%" del /F /Q "%IDX_DST%"
 )
 
 echo.